@@ -6,6 +6,7 @@ QML_FILES = \
 HEADERS += \
     $$PWD/qquickcalendar_p.h \
     $$PWD/qquickcalendarmodel_p.h \
+    $$PWD/qquickdateattributes_p.h \
     $$PWD/qquickdayofweekmodel_p.h \
     $$PWD/qquickdayofweekrow_p.h \
     $$PWD/qquickmonthgrid_p.h \
@@ -16,6 +17,7 @@ HEADERS += \
 SOURCES += \
     $$PWD/qquickcalendar.cpp \
     $$PWD/qquickcalendarmodel.cpp \
+    $$PWD/qquickdateattributes.cpp \
     $$PWD/qquickdayofweekmodel.cpp \
     $$PWD/qquickdayofweekrow.cpp \
     $$PWD/qquickmonthgrid.cpp \
@@ -38,6 +38,8 @@
 
 #include <QtCore/private/qabstractitemmodel_p.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -79,6 +81,22 @@ QT_BEGIN_NAMESPACE
     \value Calendar.November November (10)
     \value Calendar.December December (11)
 
+    \section2 Day Mode
+
+    When \l mode is set to \c CalendarModel.Days, the model provides one row
+    per day from \l from to \l to instead of one row per month. This allows a
+    single view to present a long range of days without creating a MonthGrid,
+    and its month model, for every month. The following model data roles are
+    available in the context of each delegate in this mode:
+    \table
+        \row \li \b model.date : date \li The date of the day
+        \row \li \b model.day : int \li The number of the day
+        \row \li \b model.today : bool \li Whether the delegate represents today
+        \row \li \b model.weekNumber : int \li The week number of the day
+        \row \li \b model.month : int \li The number of the month of the day
+        \row \li \b model.year : int \li The number of the year of the day
+    \endtable
+
     \labs
 
     \sa MonthGrid, Calendar
@@ -90,18 +108,21 @@ class QQuickCalendarModelPrivate : public QAbstractItemModelPrivate
 
 public:
     QQuickCalendarModelPrivate() : complete(false),
-        from(1,1,1), to(275759, 9, 25), count(0)
+        from(1,1,1), to(275759, 9, 25), count(0), mode(QQuickCalendarModel::Months)
     {
     }
 
     static int getCount(const QDate& from, const QDate &to);
+    static int getDayCount(const QDate &from, const QDate &to);
 
-    void populate(const QDate &from, const QDate &to, bool force = false);
+    void populate(const QDate &from, const QDate &to, QQuickCalendarModel::Mode mode, bool force = false);
 
     bool complete;
     QDate from;
     QDate to;
     int count;
+    QQuickCalendarModel::Mode mode;
+    QDate today;
 };
 
 int QQuickCalendarModelPrivate::getCount(const QDate& from, const QDate &to)
@@ -121,19 +142,39 @@ int QQuickCalendarModelPrivate::getCount(const QDate& from, const QDate &to)
     return 12 * years + months + (r.day() / t.day());
 }
 
-void QQuickCalendarModelPrivate::populate(const QDate &f, const QDate &t, bool force)
+int QQuickCalendarModelPrivate::getDayCount(const QDate &from, const QDate &to)
+{
+    if (!from.isValid() || !to.isValid())
+        return 0;
+
+    const qint64 days = from.daysTo(to) + 1;
+    return days > 0 ? int(qMin<qint64>(days, std::numeric_limits<int>::max())) : 0;
+}
+
+void QQuickCalendarModelPrivate::populate(const QDate &f, const QDate &t, QQuickCalendarModel::Mode m, bool force)
 {
     Q_Q(QQuickCalendarModel);
-    if (!force && f == from && t == to)
+    if (!force && f == from && t == to && m == mode)
         return;
 
-    int c = getCount(from, to);
-    if (c != count) {
+    // the rows must be read from the new range once the views are notified,
+    // and a different mode changes what the rows represent, even if the
+    // count stays the same
+    const bool reset = m != mode;
+    from = f;
+    to = t;
+    mode = m;
+    today = QDate::currentDate();
+
+    int c = m == QQuickCalendarModel::Days ? getDayCount(f, t) : getCount(f, t);
+    if (c != count || reset) {
         q->beginResetModel();
+        const bool countChange = c != count;
         count = c;
         q->endResetModel();
-        emit q->countChanged();
-    } else {
+        if (countChange)
+            emit q->countChanged();
+    } else if (c > 0) {
         emit q->dataChanged(q->index(0, 0), q->index(c - 1, 0));
     }
 }
@@ -159,7 +200,7 @@ void QQuickCalendarModel::setFrom(const QDate &from)
     Q_D(QQuickCalendarModel);
     if (d->from != from) {
         if (d->complete)
-            d->populate(from, d->to);
+            d->populate(from, d->to, d->mode);
         d->from = from;
         emit fromChanged();
     }
@@ -181,12 +222,55 @@ void QQuickCalendarModel::setTo(const QDate &to)
     Q_D(QQuickCalendarModel);
     if (d->to != to) {
         if (d->complete)
-            d->populate(d->from, to);
+            d->populate(d->from, to, d->mode);
         d->to = to;
         emit toChanged();
     }
 }
 
+/*!
+    \qmlproperty enumeration Qt.labs.calendar::CalendarModel::mode
+
+    This property holds what each row of the model represents.
+
+    Possible values:
+    \value CalendarModel.Months Each row represents a month (default).
+    \value CalendarModel.Days Each row represents a day.
+
+    \sa {Day Mode}
+*/
+QQuickCalendarModel::Mode QQuickCalendarModel::mode() const
+{
+    Q_D(const QQuickCalendarModel);
+    return d->mode;
+}
+
+void QQuickCalendarModel::setMode(Mode mode)
+{
+    Q_D(QQuickCalendarModel);
+    if (d->mode != mode) {
+        if (d->complete)
+            d->populate(d->from, d->to, mode);
+        d->mode = mode;
+        emit modeChanged();
+    }
+}
+
+/*!
+    \qmlmethod date Qt.labs.calendar::CalendarModel::dateAt(int index)
+
+    Returns the date at the specified model \a index. In the \c Months
+    \l mode, this is the first day of the month.
+*/
+QDate QQuickCalendarModel::dateAt(int index) const
+{
+    Q_D(const QQuickCalendarModel);
+    if (d->mode == Days)
+        return d->from.addDays(index);
+    const QDate month = d->from.addMonths(index);
+    return QDate(month.year(), month.month(), 1);
+}
+
 /*!
     \qmlmethod int Qt.labs.calendar::CalendarModel::monthAt(int index)
 
@@ -195,6 +279,8 @@ void QQuickCalendarModel::setTo(const QDate &to)
 int QQuickCalendarModel::monthAt(int index) const
 {
     Q_D(const QQuickCalendarModel);
+    if (d->mode == Days)
+        return d->from.addDays(index).month() - 1;
     return d->from.addMonths(index).month() - 1;
 }
 
@@ -206,6 +292,8 @@ int QQuickCalendarModel::monthAt(int index) const
 int QQuickCalendarModel::yearAt(int index) const
 {
     Q_D(const QQuickCalendarModel);
+    if (d->mode == Days)
+        return d->from.addDays(index).year();
     return d->from.addMonths(index).year();
 }
 
@@ -217,6 +305,12 @@ int QQuickCalendarModel::yearAt(int index) const
 int QQuickCalendarModel::indexOf(const QDate &date) const
 {
     Q_D(const QQuickCalendarModel);
+    if (d->mode == Days) {
+        if (!date.isValid() || !d->from.isValid())
+            return -1;
+        const qint64 index = d->from.daysTo(date);
+        return index >= 0 && index < d->count ? int(index) : -1;
+    }
     return d->getCount(d->from, date) - 1;
 }
 
@@ -234,6 +328,27 @@ QVariant QQuickCalendarModel::data(const QModelIndex &index, int role) const
 {
     Q_D(const QQuickCalendarModel);
     if (index.isValid() && index.row() < d->count) {
+        if (d->mode == Days) {
+            const QDate date = d->from.addDays(index.row());
+            switch (role) {
+            case DateRole:
+                return date;
+            case DayRole:
+                return date.day();
+            case TodayRole:
+                return date == d->today;
+            case WeekNumberRole:
+                return date.weekNumber();
+            case MonthRole:
+                return date.month() - 1;
+            case YearRole:
+                return date.year();
+            default:
+                break;
+            }
+            return QVariant();
+        }
+
         switch (role) {
         case MonthRole:
             return monthAt(index.row());
@@ -259,6 +374,10 @@ QHash<int, QByteArray> QQuickCalendarModel::roleNames() const
     QHash<int, QByteArray> roles;
     roles[MonthRole] = QByteArrayLiteral("month");
     roles[YearRole] = QByteArrayLiteral("year");
+    roles[DateRole] = QByteArrayLiteral("date");
+    roles[DayRole] = QByteArrayLiteral("day");
+    roles[TodayRole] = QByteArrayLiteral("today");
+    roles[WeekNumberRole] = QByteArrayLiteral("weekNumber");
     return roles;
 }
 
@@ -270,7 +389,7 @@ void QQuickCalendarModel::componentComplete()
 {
     Q_D(QQuickCalendarModel);
     d->complete = true;
-    d->populate(d->from, d->to, true);
+    d->populate(d->from, d->to, d->mode, true);
 }
 
 QT_END_NAMESPACE
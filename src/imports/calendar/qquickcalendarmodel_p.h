@@ -64,6 +64,7 @@ class QQuickCalendarModel : public QAbstractListModel, public QQmlParserStatus
     Q_PROPERTY(QDate from READ from WRITE setFrom NOTIFY fromChanged FINAL)
     Q_PROPERTY(QDate to READ to WRITE setTo NOTIFY toChanged FINAL)
     Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+    Q_PROPERTY(Mode mode READ mode WRITE setMode NOTIFY modeChanged FINAL)
 
 public:
     explicit QQuickCalendarModel(QObject *parent = nullptr);
@@ -74,6 +75,16 @@ public:
     QDate to() const;
     void setTo(const QDate &to);
 
+    enum Mode {
+        Months,
+        Days
+    };
+    Q_ENUM(Mode)
+
+    Mode mode() const;
+    void setMode(Mode mode);
+
+    Q_INVOKABLE QDate dateAt(int index) const;
     Q_INVOKABLE int monthAt(int index) const;
     Q_INVOKABLE int yearAt(int index) const;
     Q_INVOKABLE int indexOf(const QDate &date) const;
@@ -81,7 +92,11 @@ public:
 
     enum {
         MonthRole,
-        YearRole
+        YearRole,
+        DateRole,
+        DayRole,
+        TodayRole,
+        WeekNumberRole
     };
 
     QHash<int, QByteArray> roleNames() const override;
@@ -92,6 +107,7 @@ Q_SIGNALS:
     void fromChanged();
     void toChanged();
     void countChanged();
+    void modeChanged();
 
 protected:
     void classBegin() override;
@@ -0,0 +1,178 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Calendar module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickdateattributes_p.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \qmltype DateAttributes
+    \inherits QtObject
+    \instantiates QQuickDateAttributes
+    \inqmlmodule Qt.labs.calendar
+    \brief A set of attributes assigned to date ranges.
+
+    DateAttributes assigns application-defined attribute flags, such as
+    holidays or days with events, to ranges of dates. When assigned to
+    \l {MonthGrid::dateAttributes}{MonthGrid.dateAttributes}, the flags
+    of all visible dates are resolved at once whenever the displayed month
+    changes, and exposed to the delegate as \c model.attributes.
+
+    \code
+    MonthGrid {
+        dateAttributes: DateAttributes {
+            id: attributes
+            Component.onCompleted: attributes.mark(new Date(2018, 11, 24), new Date(2018, 11, 26), 1)
+        }
+        delegate: Text {
+            text: model.day
+            font.bold: model.attributes & 1
+        }
+    }
+    \endcode
+
+    \sa MonthGrid
+*/
+
+QQuickDateAttributes::QQuickDateAttributes(QObject *parent)
+    : QObject(parent)
+{
+}
+
+/*!
+    \qmlmethod void Qt.labs.calendar::DateAttributes::mark(date from, date to, int attributes)
+
+    Adds \a attributes to all dates between \a from and \a to, inclusive.
+    The attributes are combined with those of any previously marked
+    ranges that overlap.
+*/
+void QQuickDateAttributes::mark(const QDate &from, const QDate &to, int attributes)
+{
+    if (!from.isValid() || !to.isValid() || !attributes)
+        return;
+
+    const qint64 first = qMin(from.toJulianDay(), to.toJulianDay());
+    const qint64 last = qMax(from.toJulianDay(), to.toJulianDay());
+
+    QVector<Range> result;
+    result.reserve(ranges.count() + 3);
+
+    // The part of the new range that has not been merged yet starts at pos.
+    qint64 pos = first;
+    for (const Range &range : qAsConst(ranges)) {
+        if (range.last < first || range.first > last) {
+            if (range.first > last && pos <= last) {
+                result.append(Range{pos, last, attributes});
+                pos = last + 1;
+            }
+            result.append(range);
+            continue;
+        }
+
+        if (range.first < first)
+            result.append(Range{range.first, first - 1, range.attributes});
+        if (pos < range.first)
+            result.append(Range{pos, range.first - 1, attributes});
+
+        const qint64 overlapLast = qMin(range.last, last);
+        result.append(Range{qMax(range.first, first), overlapLast, range.attributes | attributes});
+        pos = overlapLast + 1;
+
+        if (range.last > last)
+            result.append(Range{last + 1, range.last, range.attributes});
+    }
+    if (pos <= last)
+        result.append(Range{pos, last, attributes});
+
+    ranges = result;
+    emit changed();
+}
+
+/*!
+    \qmlmethod void Qt.labs.calendar::DateAttributes::clear()
+
+    Removes all marked ranges.
+*/
+void QQuickDateAttributes::clear()
+{
+    if (ranges.isEmpty())
+        return;
+
+    ranges.clear();
+    emit changed();
+}
+
+/*!
+    \qmlmethod int Qt.labs.calendar::DateAttributes::attributesAt(date date)
+
+    Returns the attributes of \a date, or \c 0 if it has not been marked.
+*/
+int QQuickDateAttributes::attributesAt(const QDate &date) const
+{
+    int attributes = 0;
+    attributesAt(date, 1, &attributes);
+    return attributes;
+}
+
+/*!
+    \internal
+
+    Resolves the attributes of \a count consecutive dates starting from
+    \a first into \a attributes.
+*/
+void QQuickDateAttributes::attributesAt(const QDate &first, int count, int *attributes) const
+{
+    if (count <= 0)
+        return;
+
+    std::fill(attributes, attributes + count, 0);
+    if (!first.isValid())
+        return;
+
+    const qint64 start = first.toJulianDay();
+    const qint64 end = start + count - 1;
+    auto it = std::lower_bound(ranges.cbegin(), ranges.cend(), start,
+                               [](const Range &range, qint64 day) { return range.last < day; });
+    for (; it != ranges.cend() && it->first <= end; ++it) {
+        const qint64 from = qMax(it->first, start);
+        const qint64 to = qMin(it->last, end);
+        std::fill(attributes + (from - start), attributes + (to - start) + 1, it->attributes);
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Calendar module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKDATEATTRIBUTES_P_H
+#define QQUICKDATEATTRIBUTES_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qobject.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qvector.h>
+#include <QtQml/qqml.h>
+
+QT_BEGIN_NAMESPACE
+
+class QQuickDateAttributes : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit QQuickDateAttributes(QObject *parent = nullptr);
+
+    Q_INVOKABLE void mark(const QDate &from, const QDate &to, int attributes);
+    Q_INVOKABLE void clear();
+
+    Q_INVOKABLE int attributesAt(const QDate &date) const;
+    void attributesAt(const QDate &first, int count, int *attributes) const;
+
+Q_SIGNALS:
+    void changed();
+
+private:
+    // The marked ranges are kept sorted and disjoint, with the
+    // attributes of overlapping marks combined, so that a run of
+    // consecutive dates can be resolved with a single lookup.
+    struct Range
+    {
+        qint64 first;
+        qint64 last;
+        int attributes;
+    };
+    QVector<Range> ranges;
+};
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQuickDateAttributes)
+
+#endif // QQUICKDATEATTRIBUTES_P_H
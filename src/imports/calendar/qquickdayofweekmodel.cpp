@@ -36,6 +36,7 @@
 
 #include "qquickdayofweekmodel_p.h"
 
+#include <QtCore/qhash.h>
 #include <QtCore/private/qabstractitemmodel_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -45,12 +46,59 @@ class QQuickDayOfWeekModelPrivate : public QAbstractItemModelPrivate
     Q_DECLARE_PUBLIC(QQuickDayOfWeekModel)
 
 public:
+    void updateNames();
+
+    int refCount = 0;
     QLocale locale;
+    QLocale sharedLocale; // the key in sharedModels(), even if the locale changes later
+    QString names[3][7];
 };
 
+// Day of week rows with the same locale share one model and one set of
+// localized names, so a year view does not create 12 identical models.
+typedef QHash<QLocale, QQuickDayOfWeekModel *> QQuickDayOfWeekModelHash;
+Q_GLOBAL_STATIC(QQuickDayOfWeekModelHash, sharedModels)
+
+void QQuickDayOfWeekModelPrivate::updateNames()
+{
+    static const QLocale::FormatType formats[] = { QLocale::LongFormat, QLocale::ShortFormat, QLocale::NarrowFormat };
+    for (int f = 0; f < 3; ++f) {
+        for (int d = 0; d < 7; ++d)
+            names[f][d] = locale.standaloneDayName(d + 1, formats[f]);
+    }
+}
+
 QQuickDayOfWeekModel::QQuickDayOfWeekModel(QObject *parent) :
     QAbstractListModel(*(new QQuickDayOfWeekModelPrivate), parent)
 {
+    Q_D(QQuickDayOfWeekModel);
+    d->updateNames();
+}
+
+QQuickDayOfWeekModel *QQuickDayOfWeekModel::acquire(const QLocale &locale)
+{
+    QQuickDayOfWeekModel *&model = (*sharedModels())[locale];
+    if (!model) {
+        model = new QQuickDayOfWeekModel;
+        model->setLocale(locale);
+        model->d_func()->sharedLocale = locale;
+    }
+    ++model->d_func()->refCount;
+    return model;
+}
+
+void QQuickDayOfWeekModel::release(QQuickDayOfWeekModel *model)
+{
+    if (!model || --model->d_func()->refCount > 0)
+        return;
+
+    if (sharedModels.exists()) {
+        const QLocale &key = model->d_func()->sharedLocale;
+        if (sharedModels()->value(key) == model)
+            sharedModels()->remove(key);
+    }
+    // views may still be disconnecting from the model
+    model->deleteLater();
 }
 
 QLocale QQuickDayOfWeekModel::locale() const
@@ -64,6 +112,7 @@ void QQuickDayOfWeekModel::setLocale(const QLocale &locale)
     Q_D(QQuickDayOfWeekModel);
     if (d->locale != locale) {
         d->locale = locale;
+        d->updateNames();
         emit localeChanged();
         emit dataChanged(index(0, 0), index(6, 0));
     }
@@ -85,15 +134,16 @@ QVariant QQuickDayOfWeekModel::data(const QModelIndex &index, int role) const
     Q_D(const QQuickDayOfWeekModel);
     if (index.isValid() && index.row() < 7) {
         int day = dayAt(index.row());
+        int name = (day == 0 ? Qt::Sunday : day) - 1;
         switch (role) {
         case DayRole:
             return day;
         case LongNameRole:
-            return d->locale.standaloneDayName(day == 0 ? Qt::Sunday : day, QLocale::LongFormat);
+            return d->names[0][name];
         case ShortNameRole:
-            return d->locale.standaloneDayName(day == 0 ? Qt::Sunday : day, QLocale::ShortFormat);
+            return d->names[1][name];
         case NarrowNameRole:
-            return d->locale.standaloneDayName(day == 0 ? Qt::Sunday : day, QLocale::NarrowFormat);
+            return d->names[2][name];
         default:
             break;
         }
@@ -65,6 +65,9 @@ class QQuickDayOfWeekModel : public QAbstractListModel
 public:
     explicit QQuickDayOfWeekModel(QObject *parent = nullptr);
 
+    static QQuickDayOfWeekModel *acquire(const QLocale &locale);
+    static void release(QQuickDayOfWeekModel *model);
+
     QLocale locale() const;
     void setLocale(const QLocale &locale);
 
@@ -99,10 +99,16 @@ QQuickDayOfWeekRow::QQuickDayOfWeekRow(QQuickItem *parent) :
     QQuickControl(*(new QQuickDayOfWeekRowPrivate), parent)
 {
     Q_D(QQuickDayOfWeekRow);
-    d->model = new QQuickDayOfWeekModel(this);
+    d->model = QQuickDayOfWeekModel::acquire(d->locale);
     d->source = QVariant::fromValue(d->model);
 }
 
+QQuickDayOfWeekRow::~QQuickDayOfWeekRow()
+{
+    Q_D(QQuickDayOfWeekRow);
+    QQuickDayOfWeekModel::release(d->model);
+}
+
 /*!
     \internal
     \qmlproperty model Qt.labs.calendar::DayOfWeekRow::source
@@ -179,7 +185,11 @@ void QQuickDayOfWeekRow::localeChange(const QLocale &newLocale, const QLocale &o
 {
     Q_D(QQuickDayOfWeekRow);
     QQuickControl::localeChange(newLocale, oldLocale);
-    d->model->setLocale(newLocale);
+    QQuickDayOfWeekModel *oldModel = d->model;
+    d->model = QQuickDayOfWeekModel::acquire(newLocale);
+    if (d->source == QVariant::fromValue(oldModel))
+        setSource(QVariant::fromValue(d->model));
+    QQuickDayOfWeekModel::release(oldModel);
 }
 
 void QQuickDayOfWeekRow::paddingChange(const QMarginsF &newPadding, const QMarginsF &oldPadding)
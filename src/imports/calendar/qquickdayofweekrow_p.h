@@ -63,6 +63,7 @@ class QQuickDayOfWeekRow : public QQuickControl
 
 public:
     explicit QQuickDayOfWeekRow(QQuickItem *parent = nullptr);
+    ~QQuickDayOfWeekRow();
 
     QVariant source() const;
     void setSource(const QVariant &source);
@@ -37,6 +37,7 @@
 #include "qquickmonthgrid_p.h"
 #include "qquickmonthmodel_p.h"
 
+#include <QtCore/qmath.h>
 #include <QtGui/qstylehints.h>
 #include <QtGui/qguiapplication.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
@@ -147,11 +148,36 @@ void QQuickMonthGridPrivate::resizeItems()
 QQuickItem *QQuickMonthGridPrivate::cellAt(const QPointF &pos) const
 {
     Q_Q(const QQuickMonthGrid);
-    if (contentItem) {
-        QPointF mapped = q->mapToItem(contentItem, pos);
-        return contentItem->childAt(mapped.x(), mapped.y());
+    if (!contentItem)
+        return nullptr;
+
+    const QPointF mapped = q->mapToItem(contentItem, pos);
+
+    // The cells are laid out in a uniform 7x6 grid by resizeItems(), so the
+    // cell under the point can be calculated instead of hit-testing every
+    // child. The calculated cell is verified, and the children are hit-tested
+    // instead between the cells, or if a custom content item lays them out
+    // differently.
+    const qreal cellWidth = (contentItem->width() - 6 * spacing) / 7;
+    const qreal cellHeight = (contentItem->height() - 5 * spacing) / 6;
+    if (cellWidth > 0 && cellHeight > 0 && mapped.x() >= 0 && mapped.y() >= 0) {
+        const int column = qFloor(mapped.x() / (cellWidth + spacing));
+        const int row = qFloor(mapped.y() / (cellHeight + spacing));
+        if (column < 7 && row < 6) {
+            int index = row * 7 + column;
+            const auto childItems = contentItem->childItems();
+            for (QQuickItem *item : childItems) {
+                if (QQuickItemPrivate::get(item)->isTransparentForPositioner())
+                    continue;
+                if (index-- > 0)
+                    continue;
+                if (item->isVisible() && item->contains(item->mapFromItem(contentItem, mapped)))
+                    return item;
+                break;
+            }
+        }
     }
-    return nullptr;
+    return contentItem->childAt(mapped.x(), mapped.y());
 }
 
 QDate QQuickMonthGridPrivate::dateOf(QQuickItem *cell) const
@@ -238,6 +264,7 @@ QQuickMonthGrid::QQuickMonthGrid(QQuickItem *parent) :
     connect(d->model, &QQuickMonthModel::monthChanged, this, &QQuickMonthGrid::monthChanged);
     connect(d->model, &QQuickMonthModel::yearChanged, this, &QQuickMonthGrid::yearChanged);
     connect(d->model, &QQuickMonthModel::titleChanged, this, &QQuickMonthGrid::titleChanged);
+    connect(d->model, &QQuickMonthModel::dateAttributesChanged, this, &QQuickMonthGrid::dateAttributesChanged);
 }
 
 /*!
@@ -365,10 +392,12 @@ void QQuickMonthGrid::setTitle(const QString &title)
     \table
         \row \li \b model.date : date \li The date of the cell
         \row \li \b model.day : int \li The number of the day
+        \row \li \b model.dayText : string \li The number of the day, formatted for the \l {Control::locale}{locale}
         \row \li \b model.today : bool \li Whether the delegate represents today
         \row \li \b model.weekNumber : int \li The week number
         \row \li \b model.month : int \li The number of the month
         \row \li \b model.year : int \li The number of the year
+        \row \li \b model.attributes : int \li The attributes of the date, see \l dateAttributes
     \endtable
 
     The following snippet presents the default implementation of the item
@@ -392,6 +421,31 @@ void QQuickMonthGrid::setDelegate(QQmlComponent *delegate)
     }
 }
 
+/*!
+    \qmlproperty DateAttributes Qt.labs.calendar::MonthGrid::dateAttributes
+
+    This property holds the attributes that are assigned to dates, such as
+    holidays or days with events. The attributes of all dates on display are
+    resolved in one go when the month changes, and are available to the
+    \l delegate as \c model.attributes, without having to call a JavaScript
+    function for each cell.
+
+    The default value is \c null.
+
+    \sa DateAttributes
+*/
+QQuickDateAttributes *QQuickMonthGrid::dateAttributes() const
+{
+    Q_D(const QQuickMonthGrid);
+    return d->model->dateAttributes();
+}
+
+void QQuickMonthGrid::setDateAttributes(QQuickDateAttributes *attributes)
+{
+    Q_D(QQuickMonthGrid);
+    d->model->setDateAttributes(attributes);
+}
+
 void QQuickMonthGrid::componentComplete()
 {
     Q_D(QQuickMonthGrid);
@@ -53,6 +53,7 @@
 QT_BEGIN_NAMESPACE
 
 class QQmlComponent;
+class QQuickDateAttributes;
 class QQuickMonthGridPrivate;
 
 class QQuickMonthGrid : public QQuickControl
@@ -63,6 +64,7 @@ class QQuickMonthGrid : public QQuickControl
     Q_PROPERTY(QVariant source READ source WRITE setSource NOTIFY sourceChanged FINAL)
     Q_PROPERTY(QString title READ title WRITE setTitle NOTIFY titleChanged FINAL)
     Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged FINAL)
+    Q_PROPERTY(QQuickDateAttributes *dateAttributes READ dateAttributes WRITE setDateAttributes NOTIFY dateAttributesChanged FINAL)
 
 public:
     explicit QQuickMonthGrid(QQuickItem *parent = nullptr);
@@ -82,12 +84,16 @@ public:
     QQmlComponent *delegate() const;
     void setDelegate(QQmlComponent *delegate);
 
+    QQuickDateAttributes *dateAttributes() const;
+    void setDateAttributes(QQuickDateAttributes *attributes);
+
 Q_SIGNALS:
     void monthChanged();
     void yearChanged();
     void sourceChanged();
     void titleChanged();
     void delegateChanged();
+    void dateAttributesChanged();
 
     void pressed(const QDate &date);
     void released(const QDate &date);
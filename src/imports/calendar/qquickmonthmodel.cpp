@@ -35,9 +35,13 @@
 ****************************************************************************/
 
 #include "qquickmonthmodel_p.h"
+#include "qquickdateattributes_p.h"
 
+#include <QtCore/qpointer.h>
 #include <QtCore/private/qabstractitemmodel_p.h>
 
+#include <algorithm>
+
 namespace {
     static const int daysInAWeek = 7;
     static const int weeksOnACalendarMonth = 6;
@@ -51,7 +55,7 @@ class QQuickMonthModelPrivate : public QAbstractItemModelPrivate
     Q_DECLARE_PUBLIC(QQuickMonthModel)
 
 public:
-    QQuickMonthModelPrivate() : dates(daysOnACalendarMonth)
+    QQuickMonthModelPrivate()
     {
         today = QDate::currentDate();
         month = today.month();
@@ -59,19 +63,38 @@ public:
     }
 
     bool populate(int month, int year, const QLocale &locale, bool force = false);
+    void resolveAttributes();
+    void updateAttributes();
 
     int month;
     int year;
     QString title;
     QLocale locale;
-    QVector<QDate> dates;
+    // The dates on display are consecutive, so only the first one is stored.
+    QDate firstDate;
     QDate today;
+    // The role values of the dates on display, computed by populate()
+    // so that data() does not have to do date arithmetic on each access.
+    struct Cell
+    {
+        QDate date;
+        QString dayText;
+        int day = 0;
+        int weekNumber = 0;
+        int month = 0;
+        int year = 0;
+        bool today = false;
+    };
+    Cell cells[daysOnACalendarMonth];
+    QPointer<QQuickDateAttributes> dateAttributes;
+    // The attributes of the dates on display, resolved in bulk by populate().
+    int attributes[daysOnACalendarMonth] = {};
 };
 
 bool QQuickMonthModelPrivate::populate(int m, int y, const QLocale &l, bool force)
 {
     Q_Q(QQuickMonthModel);
-    if (!force && m == month && y == year && l.firstDayOfWeek() == locale.firstDayOfWeek())
+    if (!force && m == month && y == year && l == locale)
         return false;
 
     // The actual first (1st) day of the month.
@@ -81,17 +104,42 @@ bool QQuickMonthModelPrivate::populate(int m, int y, const QLocale &l, bool forc
     // the previous month to be visible.
     if (difference == 0)
         difference += 7;
-    QDate firstDateToDisplay = firstDayOfMonthDate.addDays(-difference);
-
+    firstDate = firstDayOfMonthDate.addDays(-difference);
     today = QDate::currentDate();
-    for (int i = 0; i < daysOnACalendarMonth; ++i)
-        dates[i] = firstDateToDisplay.addDays(i);
+
+    QDate date = firstDate;
+    for (Cell &cell : cells) {
+        cell.date = date;
+        cell.day = date.day();
+        cell.dayText = l.toString(cell.day);
+        cell.weekNumber = date.weekNumber();
+        cell.month = date.month() - 1;
+        cell.year = date.year();
+        cell.today = date == today;
+        date = date.addDays(1);
+    }
+    resolveAttributes();
 
     q->setTitle(l.standaloneMonthName(m) + QStringLiteral(" ") + QString::number(y));
 
     return true;
 }
 
+void QQuickMonthModelPrivate::resolveAttributes()
+{
+    if (dateAttributes)
+        dateAttributes->attributesAt(firstDate, daysOnACalendarMonth, attributes);
+    else
+        std::fill(attributes, attributes + daysOnACalendarMonth, 0);
+}
+
+void QQuickMonthModelPrivate::updateAttributes()
+{
+    Q_Q(QQuickMonthModel);
+    resolveAttributes();
+    emit q->dataChanged(q->index(0, 0), q->index(daysOnACalendarMonth - 1, 0), QVector<int>() << QQuickMonthModel::AttributesRole);
+}
+
 QQuickMonthModel::QQuickMonthModel(QObject *parent) :
     QAbstractListModel(*(new QQuickMonthModelPrivate), parent)
 {
@@ -165,38 +213,69 @@ void QQuickMonthModel::setTitle(const QString &title)
     }
 }
 
+QQuickDateAttributes *QQuickMonthModel::dateAttributes() const
+{
+    Q_D(const QQuickMonthModel);
+    return d->dateAttributes;
+}
+
+void QQuickMonthModel::setDateAttributes(QQuickDateAttributes *attributes)
+{
+    Q_D(QQuickMonthModel);
+    if (d->dateAttributes == attributes)
+        return;
+
+    if (d->dateAttributes)
+        QObjectPrivate::disconnect(d->dateAttributes.data(), &QQuickDateAttributes::changed, d, &QQuickMonthModelPrivate::updateAttributes);
+    d->dateAttributes = attributes;
+    if (attributes)
+        QObjectPrivate::connect(attributes, &QQuickDateAttributes::changed, d, &QQuickMonthModelPrivate::updateAttributes);
+
+    d->updateAttributes();
+    emit dateAttributesChanged();
+}
+
 QDate QQuickMonthModel::dateAt(int index) const
 {
     Q_D(const QQuickMonthModel);
-    return d->dates.value(index);
+    if (index < 0 || index >= daysOnACalendarMonth)
+        return QDate();
+    return d->firstDate.addDays(index);
 }
 
 int QQuickMonthModel::indexOf(const QDate &date) const
 {
     Q_D(const QQuickMonthModel);
-    if (date < d->dates.first() || date > d->dates.last())
+    if (!date.isValid())
+        return -1;
+    const qint64 index = d->firstDate.daysTo(date);
+    if (index < 0 || index >= daysOnACalendarMonth)
         return -1;
-    return qMax(qint64(0), d->dates.first().daysTo(date));
+    return index;
 }
 
 QVariant QQuickMonthModel::data(const QModelIndex &index, int role) const
 {
     Q_D(const QQuickMonthModel);
     if (index.isValid() && index.row() < daysOnACalendarMonth) {
-        const QDate date = d->dates.at(index.row());
+        const QQuickMonthModelPrivate::Cell &cell = d->cells[index.row()];
         switch (role) {
         case DateRole:
-            return date;
+            return cell.date;
         case DayRole:
-            return date.day();
+            return cell.day;
+        case DayTextRole:
+            return cell.dayText;
         case TodayRole:
-            return date == d->today;
+            return cell.today;
         case WeekNumberRole:
-            return date.weekNumber();
+            return cell.weekNumber;
         case MonthRole:
-            return date.month() - 1;
+            return cell.month;
         case YearRole:
-            return date.year();
+            return cell.year;
+        case AttributesRole:
+            return d->attributes[index.row()];
         default:
             break;
         }
@@ -216,10 +295,12 @@ QHash<int, QByteArray> QQuickMonthModel::roleNames() const
     QHash<int, QByteArray> roles;
     roles[DateRole] = QByteArrayLiteral("date");
     roles[DayRole] = QByteArrayLiteral("day");
+    roles[DayTextRole] = QByteArrayLiteral("dayText");
     roles[TodayRole] = QByteArrayLiteral("today");
     roles[WeekNumberRole] = QByteArrayLiteral("weekNumber");
     roles[MonthRole] = QByteArrayLiteral("month");
     roles[YearRole] = QByteArrayLiteral("year");
+    roles[AttributesRole] = QByteArrayLiteral("attributes");
     return roles;
 }
 
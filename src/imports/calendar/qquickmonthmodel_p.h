@@ -55,6 +55,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickDateAttributes;
 class QQuickMonthModelPrivate;
 
 class QQuickMonthModel : public QAbstractListModel
@@ -65,6 +66,7 @@ class QQuickMonthModel : public QAbstractListModel
     Q_PROPERTY(QLocale locale READ locale WRITE setLocale NOTIFY localeChanged FINAL)
     Q_PROPERTY(QString title READ title WRITE setTitle NOTIFY titleChanged FINAL)
     Q_PROPERTY(int count READ rowCount CONSTANT FINAL)
+    Q_PROPERTY(QQuickDateAttributes *dateAttributes READ dateAttributes WRITE setDateAttributes NOTIFY dateAttributesChanged FINAL)
 
 public:
     explicit QQuickMonthModel(QObject *parent = nullptr);
@@ -81,6 +83,9 @@ public:
     QString title() const;
     void setTitle(const QString &title);
 
+    QQuickDateAttributes *dateAttributes() const;
+    void setDateAttributes(QQuickDateAttributes *attributes);
+
     Q_INVOKABLE QDate dateAt(int index) const;
     Q_INVOKABLE int indexOf(const QDate &date) const;
 
@@ -90,7 +95,9 @@ public:
         TodayRole,
         WeekNumberRole,
         MonthRole,
-        YearRole
+        YearRole,
+        AttributesRole,
+        DayTextRole
     };
 
     QHash<int, QByteArray> roleNames() const override;
@@ -102,6 +109,7 @@ Q_SIGNALS:
     void yearChanged();
     void localeChanged();
     void titleChanged();
+    void dateAttributesChanged();
 
 private:
     Q_DISABLE_COPY(QQuickMonthModel)
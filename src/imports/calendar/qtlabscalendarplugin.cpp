@@ -41,6 +41,7 @@
 #include "qquickweeknumbercolumn_p.h"
 #include "qquickcalendarmodel_p.h"
 #include "qquickcalendar_p.h"
+#include "qquickdateattributes_p.h"
 
 static inline void initResources()
 {
@@ -79,6 +80,7 @@ void QtLabsCalendarPlugin::registerTypes(const char *uri)
     qmlRegisterType<QQuickMonthGrid>(uri, 1, 0, "AbstractMonthGrid");
     qmlRegisterType<QQuickWeekNumberColumn>(uri, 1, 0, "AbstractWeekNumberColumn");
     qmlRegisterType<QQuickCalendarModel>(uri, 1, 0, "CalendarModel");
+    qmlRegisterType<QQuickDateAttributes>(uri, 1, 0, "DateAttributes");
     qmlRegisterSingletonType<QQuickCalendar>(uri, 1, 0, "Calendar", calendarSingleton);
 }
 
@@ -36,9 +36,9 @@
 
 import QtQuick 2.11
 import QtQuick.Window 2.3
-import QtQuick.Controls 2.4
+import QtQuick.Controls 2.5
 import QtQuick.Controls.impl 2.4
-import QtQuick.Templates 2.4 as T
+import QtQuick.Templates 2.5 as T
 
 T.ApplicationWindow {
     id: window
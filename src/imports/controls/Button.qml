@@ -36,16 +36,14 @@
 
 import QtQuick 2.11
 import QtQuick.Controls 2.4
-import QtQuick.Controls.impl 2.4
+import QtQuick.Controls.impl 2.5
 import QtQuick.Templates 2.4 as T
 
 T.Button {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            contentItem.implicitWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             contentItem.implicitHeight + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
+
     baselineOffset: contentItem.y + contentItem.baselineOffset
 
     padding: 6
@@ -74,9 +72,17 @@ T.Button {
         implicitWidth: 100
         implicitHeight: 40
         visible: !control.flat || control.down || control.checked || control.highlighted
-        color: Color.blend(control.checked || control.highlighted ? control.palette.dark : control.palette.button,
-                                                                    control.palette.mid, control.down ? 0.5 : 0.0)
+        color: backgroundColor.color
         border.color: control.palette.highlight
         border.width: control.visualFocus ? 2 : 0
+
+        StateColor {
+            id: backgroundColor
+            control: control
+            normal: control.palette.button
+            checked: control.palette.dark
+            down: control.palette.mid
+            downFactor: 0.5
+        }
     }
 }
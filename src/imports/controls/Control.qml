@@ -35,13 +35,11 @@
 ****************************************************************************/
 
 import QtQuick 2.11
-import QtQuick.Templates 2.4 as T
+import QtQuick.Templates 2.5 as T
+import QtQuick.Controls.impl 2.5
 
 T.Control {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            (contentItem ? contentItem.implicitWidth : 0) + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             (contentItem ? contentItem.implicitHeight : 0) + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
 }
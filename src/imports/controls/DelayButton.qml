@@ -36,16 +36,14 @@
 
 import QtQuick 2.11
 import QtQuick.Controls 2.4
-import QtQuick.Controls.impl 2.4
+import QtQuick.Controls.impl 2.5
 import QtQuick.Templates 2.4 as T
 
 T.DelayButton {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            contentItem.implicitWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             contentItem.implicitHeight + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
+
     baselineOffset: contentItem.y + contentItem.baselineOffset
 
     padding: 6
@@ -60,7 +58,6 @@ T.DelayButton {
 
     contentItem: ItemGroup {
         ClippedText {
-            clip: control.progress > 0
             clipX: -control.leftPadding + control.progress * control.width
             clipWidth: (1.0 - control.progress) * control.width
             visible: control.progress < 1
@@ -75,7 +72,6 @@ T.DelayButton {
         }
 
         ClippedText {
-            clip: control.progress > 0
             clipX: -control.leftPadding
             clipWidth: control.progress * control.width
             visible: control.progress > 0
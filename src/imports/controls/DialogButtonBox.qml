@@ -36,14 +36,12 @@
 
 import QtQuick 2.11
 import QtQuick.Templates 2.4 as T
+import QtQuick.Controls.impl 2.5
 
 T.DialogButtonBox {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            contentItem.implicitWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             contentItem.implicitHeight + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
 
     spacing: 1
     padding: 12
@@ -37,15 +37,12 @@
 import QtQuick 2.11
 import QtQuick.Templates 2.4 as T
 import QtQuick.Controls 2.4
-import QtQuick.Controls.impl 2.4
+import QtQuick.Controls.impl 2.5
 
 T.ProgressBar {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            contentItem.implicitWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             contentItem.implicitHeight + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
 
     contentItem: ProgressBarImpl {
         implicitHeight: 6
@@ -35,8 +35,8 @@
 ****************************************************************************/
 
 import QtQuick 2.11
-import QtQuick.Controls 2.4
-import QtQuick.Templates 2.4 as T
+import QtQuick.Controls 2.5
+import QtQuick.Templates 2.5 as T
 
 T.StackView {
     id: control
@@ -36,7 +36,7 @@
 
 import QtQuick 2.11
 import QtQuick.Controls 2.4
-import QtQuick.Controls.impl 2.4
+import QtQuick.Controls.impl 2.5
 import QtQuick.Templates 2.4 as T
 
 T.SwipeDelegate {
@@ -73,7 +73,15 @@ T.SwipeDelegate {
     background: Rectangle {
         implicitWidth: 100
         implicitHeight: 40
-        color: Color.blend(control.down ? control.palette.midlight : control.palette.light,
-                                          control.palette.highlight, control.visualFocus ? 0.15 : 0.0)
+        color: backgroundColor.color
+
+        StateColor {
+            id: backgroundColor
+            control: control
+            normal: control.palette.light
+            down: control.palette.midlight
+            focus: control.palette.highlight
+            focusFactor: 0.15
+        }
     }
 }
@@ -36,16 +36,14 @@
 
 import QtQuick 2.11
 import QtQuick.Controls 2.4
-import QtQuick.Controls.impl 2.4
+import QtQuick.Controls.impl 2.5
 import QtQuick.Templates 2.4 as T
 
 T.TabButton {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            contentItem.implicitWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             contentItem.implicitHeight + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
+
     baselineOffset: contentItem.y + contentItem.baselineOffset
 
     padding: 6
@@ -68,7 +66,15 @@ T.TabButton {
 
     background: Rectangle {
         implicitHeight: 40
-        color: Color.blend(control.checked ? control.palette.window : control.palette.dark,
-                                             control.palette.mid, control.down ? 0.5 : 0.0)
+        color: backgroundColor.color
+
+        StateColor {
+            id: backgroundColor
+            control: control
+            normal: control.palette.dark
+            checked: control.palette.window
+            down: control.palette.mid
+            downFactor: 0.5
+        }
     }
 }
@@ -1,6 +1,7 @@
 HEADERS += \
     $$PWD/qquickdefaultbusyindicator_p.h \
     $$PWD/qquickdefaultdial_p.h \
+    $$PWD/qquickdefaultlabel_p.h \
     $$PWD/qquickdefaultprogressbar_p.h \
     $$PWD/qquickdefaultstyle_p.h \
     $$PWD/qquickdefaulttheme_p.h
@@ -8,6 +9,7 @@ HEADERS += \
 SOURCES += \
     $$PWD/qquickdefaultbusyindicator.cpp \
     $$PWD/qquickdefaultdial.cpp \
+    $$PWD/qquickdefaultlabel.cpp \
     $$PWD/qquickdefaultprogressbar.cpp \
     $$PWD/qquickdefaultstyle.cpp \
     $$PWD/qquickdefaulttheme.cpp
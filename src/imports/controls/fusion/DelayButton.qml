@@ -60,7 +60,6 @@ T.DelayButton {
 
     contentItem: ItemGroup {
         ClippedText {
-            clip: control.progress > 0
             clipX: -control.leftPadding + (control.mirrored ? 0 : control.progress * control.width)
             clipWidth: control.width
             visible: control.mirrored ? control.progress > 0 : control.progress < 1
@@ -74,7 +73,6 @@ T.DelayButton {
         }
 
         ClippedText {
-            clip: control.progress > 0
             clipX: -control.leftPadding
             clipWidth: (control.mirrored ? 1.0 - control.progress : control.progress) * control.width
             visible: control.mirrored ? control.progress < 1 : control.progress > 0
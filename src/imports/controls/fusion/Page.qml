@@ -35,8 +35,8 @@
 ****************************************************************************/
 
 import QtQuick 2.11
-import QtQuick.Templates 2.4 as T
-import QtQuick.Controls 2.4
+import QtQuick.Templates 2.5 as T
+import QtQuick.Controls 2.5
 import QtQuick.Controls.impl 2.4
 import QtQuick.Controls.Fusion 2.4
 import QtQuick.Controls.Fusion.impl 2.4
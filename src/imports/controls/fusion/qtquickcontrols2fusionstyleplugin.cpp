@@ -34,6 +34,7 @@
 **
 ****************************************************************************/
 
+#include <QtQuickControls2/private/qquickstartuptrace_p.h>
 #include <QtQuickControls2/private/qquickstyleplugin_p.h>
 #include <QtQml/qqml.h>
 
@@ -81,6 +82,7 @@ QtQuickControls2FusionStylePlugin::QtQuickControls2FusionStylePlugin(QObject *pa
 
 void QtQuickControls2FusionStylePlugin::registerTypes(const char *uri)
 {
+    QQuickStartupTrace trace("QtQuickControls2FusionStylePlugin::registerTypes");
     qmlRegisterModule(uri, 2, 3); // Qt 5.10->2.3
     qmlRegisterModule(uri, 2, QT_VERSION_MINOR - 7); // Qt 5.11->2.4, 5.12->2.5...
 
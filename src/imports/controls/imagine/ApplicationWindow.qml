@@ -36,7 +36,7 @@
 
 import QtQuick 2.11
 import QtQuick.Window 2.2
-import QtQuick.Templates 2.4 as T
+import QtQuick.Templates 2.5 as T
 import QtQuick.Controls.Imagine 2.4
 import QtQuick.Controls.Imagine.impl 2.4
 
@@ -36,17 +36,14 @@
 
 import QtQuick 2.11
 import QtQuick.Templates 2.4 as T
+import QtQuick.Controls.impl 2.5
 import QtQuick.Controls.Imagine 2.4
 import QtQuick.Controls.Imagine.impl 2.4
 
 T.Frame {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0, contentWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0, contentHeight + topPadding + bottomPadding)
-
-    contentWidth: contentItem.implicitWidth || (contentChildren.length === 1 ? contentChildren[0].implicitWidth : 0)
-    contentHeight: contentItem.implicitHeight || (contentChildren.length === 1 ? contentChildren[0].implicitHeight : 0)
+    ImplicitSize.enabled: true
 
     topPadding: background ? background.topPadding : 0
     leftPadding: background ? background.leftPadding : 0
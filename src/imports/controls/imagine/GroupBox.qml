@@ -37,19 +37,18 @@
 import QtQuick 2.11
 import QtQuick.Templates 2.4 as T
 import QtQuick.Controls 2.4
+import QtQuick.Controls.impl 2.5
 import QtQuick.Controls.Imagine 2.4
 import QtQuick.Controls.Imagine.impl 2.4
 
 T.GroupBox {
     id: control
 
+    ImplicitSize.enabled: true
+
     implicitWidth: Math.max(background ? background.implicitWidth : 0,
                             label ? label.implicitWidth + leftPadding + rightPadding : 0,
                             contentWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0, contentHeight + topPadding + bottomPadding)
-
-    contentWidth: contentItem.implicitWidth || (contentChildren.length === 1 ? contentChildren[0].implicitWidth : 0)
-    contentHeight: contentItem.implicitHeight || (contentChildren.length === 1 ? contentChildren[0].implicitHeight : 0)
 
     topPadding: (background ? background.topPadding : 0) + (label && label.implicitWidth > 0 ? label.implicitHeight + spacing : 0)
     leftPadding: background ? background.leftPadding : 0
@@ -36,16 +36,14 @@
 
 import QtQuick 2.11
 import QtQuick.Templates 2.4 as T
+import QtQuick.Controls.impl 2.5
 import QtQuick.Controls.Imagine 2.4
 import QtQuick.Controls.Imagine.impl 2.4
 
 T.ScrollBar {
     id: control
 
-    implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            contentItem.implicitWidth + leftPadding + rightPadding)
-    implicitHeight: Math.max(background ? background.implicitHeight : 0,
-                             contentItem.implicitHeight + topPadding + bottomPadding)
+    ImplicitSize.enabled: true
 
     visible: control.policy !== T.ScrollBar.AlwaysOff
 
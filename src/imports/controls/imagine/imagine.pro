@@ -16,12 +16,23 @@ OTHER_FILES += \
 SOURCES += \
     $$PWD/qtquickcontrols2imaginestyleplugin.cpp
 
-qtquickcontrols2imaginestyle.prefix = qt-project.org/imports/QtQuick/Controls.2/Imagine
-qtquickcontrols2imaginestyle.files += \
+IMAGINE_ASSETS = \
     $$files($$PWD/images/*.png) \
     $$files($$PWD/images/*.webp)
+
+qtquickcontrols2imaginestyle.prefix = qt-project.org/imports/QtQuick/Controls.2/Imagine
+qtquickcontrols2imaginestyle.files += $$IMAGINE_ASSETS
 RESOURCES += qtquickcontrols2imaginestyle
 
+# the list of assets, so that the image selector does not have to list the directory at run time
+for(asset, IMAGINE_ASSETS): IMAGINE_MANIFEST += $$basename(asset)
+!write_file($$OUT_PWD/images/imagine.manifest, IMAGINE_MANIFEST): error("Aborting.")
+
+qtquickcontrols2imaginemanifest.prefix = qt-project.org/imports/QtQuick/Controls.2/Imagine
+qtquickcontrols2imaginemanifest.base = $$OUT_PWD
+qtquickcontrols2imaginemanifest.files += $$OUT_PWD/images/imagine.manifest
+RESOURCES += qtquickcontrols2imaginemanifest
+
 CONFIG += no_cxx_module
 load(qml_plugin)
 
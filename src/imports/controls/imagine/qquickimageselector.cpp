@@ -37,8 +37,12 @@
 #include "qquickimageselector_p.h"
 
 #include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qcache.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qfileselector.h>
 #include <QtQml/qqmlfile.h>
@@ -48,6 +52,7 @@
 QT_BEGIN_NAMESPACE
 
 static const int DEFAULT_CACHE = 500;
+static const int MAX_INDEXED_DIRS = 32;
 
 static inline int cacheSize()
 {
@@ -58,50 +63,106 @@ static inline int cacheSize()
 
 Q_DECLARE_LOGGING_CATEGORY(lcQtQuickControlsImagine)
 
-// input: [focused, pressed]
-// => [[focused, pressed], [pressed, focused], [focused], [pressed]]
-static QList<QStringList> permutations(const QStringList &input, int count = -1)
+struct QQuickImageAsset
 {
-    if (count == -1)
-        count = input.count();
+    QString baseName; // without the extension
+    QString fileName;
+};
 
-    QList<QStringList> output;
-    for (int i = 0; i < input.count(); ++i) {
-        QStringList sub = input.mid(i, count);
+typedef QVector<QQuickImageAsset> QQuickImageAssetList;
 
-        if (count > 1) {
-            if (i + count > input.count())
-                sub += input.mid(0, count - i + 1);
-
-            std::sort(sub.begin(), sub.end());
-            do {
-                if (!sub.isEmpty())
-                    output += sub;
-            } while (std::next_permutation(sub.begin(), sub.end()));
-        } else {
-            output += sub;
-        }
+// The listings of an asset directory, one per set of file extensions.
+// They are dropped when the directory is modified on disk.
+struct QQuickImageAssetDir
+{
+    QDateTime lastModified;
+    QHash<QString, QQuickImageAssetList> listings;
+};
+
+// Reads the file names from the manifest of the directory, if there is one.
+// The manifest of the built-in assets is generated at build time, and lists
+// one file name per line.
+static QStringList listFiles(const QString &path)
+{
+    const QDir dir(path);
+    QFile manifest(dir.filePath(QStringLiteral("imagine.manifest")));
+    if (!manifest.open(QIODevice::ReadOnly | QIODevice::Text))
+        return dir.entryList(QDir::Files);
+
+    QStringList fileNames;
+    while (!manifest.atEnd()) {
+        const QString fileName = QString::fromUtf8(manifest.readLine()).trimmed();
+        if (!fileName.isEmpty())
+            fileNames += fileName;
+    }
+    return fileNames;
+}
 
-        if (count == input.count())
+// Lists the files in the directory that have one of the given extensions,
+// sorted by their base names. If there are files with the same base name,
+// the one with the first extension wins.
+static QQuickImageAssetList listAssets(const QString &path, const QStringList &extensions)
+{
+    // base name -> (extension index, file name)
+    QHash<QString, QPair<int, QString> > bestFiles;
+    const QStringList fileNames = listFiles(path);
+    for (const QString &fileName : fileNames) {
+        for (int i = 0; i < extensions.count(); ++i) {
+            const QString suffix = QLatin1Char('.') + extensions.at(i);
+            if (!fileName.endsWith(suffix))
+                continue;
+
+            const QString baseName = fileName.left(fileName.length() - suffix.length());
+            auto best = bestFiles.find(baseName);
+            if (best == bestFiles.end())
+                bestFiles.insert(baseName, qMakePair(i, fileName));
+            else if (i < best.value().first)
+                best.value() = qMakePair(i, fileName);
             break;
+        }
     }
 
-    if (count > 1)
-        output += permutations(input, --count);
+    QQuickImageAssetList files;
+    files.reserve(bestFiles.count());
+    for (auto file = bestFiles.cbegin(); file != bestFiles.cend(); ++file)
+        files += QQuickImageAsset{file.key(), file.value().second};
 
-    return output;
+    std::sort(files.begin(), files.end(), [](const QQuickImageAsset &a, const QQuickImageAsset &b) {
+        return a.baseName < b.baseName;
+    });
+    return files;
 }
 
-static QString findFile(const QDir &dir, const QString &baseName, const QStringList &extensions)
+// Returns the listing of the directory, which is kept for the most recently
+// used directories until the directory is modified. Resource directories
+// have no modification time, and are listed only once.
+static QQuickImageAssetList assets(const QString &path, const QStringList &extensions, bool cache)
 {
-    for (const QString &ext : extensions) {
-        QString filePath = dir.filePath(baseName + QLatin1Char('.') + ext);
-        if (QFile::exists(filePath))
-            return QFileSelector().select(filePath);
+    if (!cache)
+        return listAssets(path, extensions);
+
+    static QCache<QString, QQuickImageAssetDir> dirs(MAX_INDEXED_DIRS);
+
+    const QDateTime lastModified = QFileInfo(path).lastModified();
+    QQuickImageAssetDir *dir = dirs.object(path);
+    if (!dir || dir->lastModified != lastModified) {
+        dir = new QQuickImageAssetDir;
+        dir->lastModified = lastModified;
+        dirs.insert(path, dir);
     }
-    // return an empty string to indicate that the lookup has been done
-    // even if no matching asset was found
-    return QLatin1String("");
+
+    const QString key = extensions.join(QLatin1Char('|'));
+    auto it = dir->listings.find(key);
+    if (it == dir->listings.end())
+        it = dir->listings.insert(key, listAssets(path, extensions));
+    return it.value();
+}
+
+static QQuickImageAssetList::const_iterator lowerBound(const QQuickImageAssetList &files, const QString &baseName)
+{
+    return std::lower_bound(files.cbegin(), files.cend(), baseName, [](const QQuickImageAsset &file, const QString &baseName) {
+        return file.baseName < baseName;
+    });
 }
 
 QQuickImageSelector::QQuickImageSelector(QObject *parent)
@@ -247,25 +308,39 @@ void QQuickImageSelector::updateSource()
 
     // note: a cached file path may be empty
     if (bestFilePath.isNull()) {
-        QDir dir(m_path);
+        const QQuickImageAssetList files = assets(m_path, fileExtensions(), m_cache);
+        const QQuickImageAsset *bestFile = nullptr;
         int bestScore = -1;
-
-        const QStringList extensions = fileExtensions();
-
-        const QList<QStringList> statePerms = permutations(m_activeStates);
-        for (const QStringList &perm : statePerms) {
-            const QString filePath = findFile(dir, m_name + m_separator + perm.join(m_separator), extensions);
-            if (!filePath.isEmpty()) {
-                int score = calculateScore(perm);
-                if (score > bestScore) {
-                    bestScore = score;
-                    bestFilePath = filePath;
-                }
+        int bestCount = -1;
+
+        // the best match of the files named <name><separator><state1><separator><state2>...
+        // whose states, in any order, are all active
+        const QString prefix = m_name + m_separator;
+        for (auto it = lowerBound(files, prefix); it != files.cend() && it->baseName.startsWith(prefix); ++it) {
+            const QStringList states = it->baseName.mid(prefix.length()).split(m_separator);
+            if (!matchesActiveStates(states))
+                continue;
+
+            const int score = calculateScore(states);
+            if (score > bestScore || (score == bestScore && states.count() > bestCount)) {
+                bestScore = score;
+                bestCount = states.count();
+                bestFile = &*it;
             }
         }
 
-        if (bestFilePath.isEmpty())
-            bestFilePath = findFile(dir, m_name, extensions);
+        if (!bestFile) {
+            auto it = lowerBound(files, m_name);
+            if (it != files.cend() && it->baseName == m_name)
+                bestFile = &*it;
+        }
+
+        // return an empty string to indicate that the lookup has been done
+        // even if no matching asset was found
+        if (bestFile)
+            bestFilePath = QFileSelector().select(QDir(m_path).filePath(bestFile->fileName));
+        else
+            bestFilePath = QLatin1String("");
 
         if (m_cache)
             cache.insert(key, new QString(bestFilePath));
@@ -305,6 +380,18 @@ bool QQuickImageSelector::updateActiveStates()
     return true;
 }
 
+bool QQuickImageSelector::matchesActiveStates(const QStringList &states) const
+{
+    if (states.count() > m_activeStates.count())
+        return false;
+
+    for (int i = 0; i < states.count(); ++i) {
+        if (!m_activeStates.contains(states.at(i)) || states.indexOf(states.at(i), i + 1) != -1)
+            return false;
+    }
+    return true;
+}
+
 int QQuickImageSelector::calculateScore(const QStringList &states) const
 {
     int score = 0;
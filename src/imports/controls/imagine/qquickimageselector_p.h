@@ -107,6 +107,7 @@ protected:
     void updateSource();
     void setUrl(const QUrl &url);
     bool updateActiveStates();
+    bool matchesActiveStates(const QStringList &states) const;
     int calculateScore(const QStringList &states) const;
 
 private:
@@ -49,9 +49,37 @@ static const QString ensureSlash(const QString &path)
     return path.endsWith(slash) ? path : path + slash;
 }
 
+static QUrl pathToUrl(const QString &path)
+{
+    // Using ApplicationWindow as an example, its NinePatchImage url
+    // was previously assigned like this:
+    //
+    // soruce: Imagine.path + "applicationwindow-background"
+    //
+    // If Imagine.path is set to ":/images" by the user, then the final URL would be:
+    //
+    // QUrl("file:///home/user/qt/qtbase/qml/QtQuick/Controls.2/Imagine/:/images/applicationwindow-background")
+    //
+    // To ensure that the correct URL is constructed, we do it ourselves here,
+    // and then the control QML files use the "url" property instead.
+    const QString slashed = ensureSlash(path);
+    if (slashed.startsWith(QLatin1String("qrc")))
+        return QUrl(slashed);
+
+    if (slashed.startsWith(QLatin1String(":/")))
+        return QUrl(QLatin1String("qrc") + slashed);
+
+    return QUrl::fromLocalFile(slashed);
+}
+
+// the URL is built only when the path changes, and shared by all attached
+// objects that inherit the same path, instead of being rebuilt on every read
+Q_GLOBAL_STATIC_WITH_ARGS(QUrl, GlobalUrl, (pathToUrl(*GlobalPath())))
+
 QQuickImagineStyle::QQuickImagineStyle(QObject *parent)
     : QQuickAttachedObject(parent),
-      m_path(*GlobalPath())
+      m_path(*GlobalPath()),
+      m_url(*GlobalUrl())
 {
     init();
 }
@@ -73,17 +101,19 @@ void QQuickImagineStyle::setPath(const QString &path)
         return;
 
     m_path = path;
+    m_url = pathToUrl(path);
     propagatePath();
 
     emit pathChanged();
 }
 
-void QQuickImagineStyle::inheritPath(const QString &path)
+void QQuickImagineStyle::inheritPath(const QString &path, const QUrl &url)
 {
     if (m_explicitPath || m_path == path)
         return;
 
     m_path = path;
+    m_url = url;
     propagatePath();
     emit pathChanged();
 }
@@ -94,7 +124,7 @@ void QQuickImagineStyle::propagatePath()
     for (QQuickAttachedObject *child : styles) {
         QQuickImagineStyle *imagine = qobject_cast<QQuickImagineStyle *>(child);
         if (imagine)
-            imagine->inheritPath(m_path);
+            imagine->inheritPath(m_path, m_url);
     }
 }
 
@@ -105,30 +135,15 @@ void QQuickImagineStyle::resetPath()
 
     m_explicitPath = false;
     QQuickImagineStyle *imagine = qobject_cast<QQuickImagineStyle *>(attachedParent());
-    inheritPath(imagine ? imagine->path() : *GlobalPath());
+    if (imagine)
+        inheritPath(imagine->path(), imagine->url());
+    else
+        inheritPath(*GlobalPath(), *GlobalUrl());
 }
 
 QUrl QQuickImagineStyle::url() const
 {
-    // Using ApplicationWindow as an example, its NinePatchImage url
-    // was previously assigned like this:
-    //
-    // soruce: Imagine.path + "applicationwindow-background"
-    //
-    // If Imagine.path is set to ":/images" by the user, then the final URL would be:
-    //
-    // QUrl("file:///home/user/qt/qtbase/qml/QtQuick/Controls.2/Imagine/:/images/applicationwindow-background")
-    //
-    // To ensure that the correct URL is constructed, we do it ourselves here,
-    // and then the control QML files use the "url" property instead.
-    const QString path = ensureSlash(m_path);
-    if (path.startsWith(QLatin1String("qrc")))
-        return QUrl(path);
-
-    if (path.startsWith(QLatin1String(":/")))
-        return QUrl(QLatin1String("qrc") + path);
-
-    return QUrl::fromLocalFile(path);
+    return m_url;
 }
 
 void QQuickImagineStyle::attachedParentChange(QQuickAttachedObject *newParent, QQuickAttachedObject *oldParent)
@@ -136,7 +151,7 @@ void QQuickImagineStyle::attachedParentChange(QQuickAttachedObject *newParent, Q
     Q_UNUSED(oldParent);
     QQuickImagineStyle *imagine = qobject_cast<QQuickImagineStyle *>(newParent);
     if (imagine)
-        inheritPath(imagine->path());
+        inheritPath(imagine->path(), imagine->url());
 }
 
 static QByteArray resolveSetting(const QByteArray &env, const QSharedPointer<QSettings> &settings, const QString &name)
@@ -156,8 +171,10 @@ void QQuickImagineStyle::init()
         QSharedPointer<QSettings> settings = QQuickStylePrivate::settings(QStringLiteral("Imagine"));
 
         QString path = QString::fromUtf8(resolveSetting("QT_QUICK_CONTROLS_IMAGINE_PATH", settings, QStringLiteral("Path")));
-        if (!path.isEmpty())
+        if (!path.isEmpty()) {
             *GlobalPath() = m_path = ensureSlash(path);
+            *GlobalUrl() = m_url = pathToUrl(m_path);
+        }
 
         globalsInitialized = true;
     }
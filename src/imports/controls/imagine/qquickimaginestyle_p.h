@@ -49,6 +49,7 @@
 //
 
 #include <QtQuickControls2/private/qquickattachedobject_p.h>
+#include <QtCore/qurl.h>
 #include <QtCore/qvariant.h>
 #include <QtQml/qqml.h>
 
@@ -67,7 +68,7 @@ public:
 
     QString path() const;
     void setPath(const QString &path);
-    void inheritPath(const QString &path);
+    void inheritPath(const QString &path, const QUrl &url);
     void propagatePath();
     void resetPath();
 
@@ -84,6 +85,7 @@ private:
 
     bool m_explicitPath = false;
     QString m_path;
+    QUrl m_url;
 };
 
 QT_END_NAMESPACE
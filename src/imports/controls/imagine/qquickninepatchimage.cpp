@@ -36,7 +36,9 @@
 
 #include "qquickninepatchimage_p.h"
 
+#include <QtCore/qcache.h>
 #include <QtCore/qfileinfo.h>
+#include <QtCore/qvarlengtharray.h>
 #include <QtQuick/qsggeometry.h>
 #include <QtQuick/qsgtexturematerial.h>
 #include <QtQuick/private/qsgnode_p.h>
@@ -46,7 +48,8 @@ QT_BEGIN_NAMESPACE
 
 struct QQuickNinePatchData
 {
-    QVector<qreal> coordsForSize(qreal count) const;
+    typedef QVarLengthArray<qreal, 16> Coords;
+    Coords coordsForSize(qreal count) const;
 
     inline bool isNull() const { return data.isEmpty(); }
     inline int count() const { return data.size(); }
@@ -61,7 +64,7 @@ private:
     QVector<qreal> data;
 };
 
-QVector<qreal> QQuickNinePatchData::coordsForSize(qreal size) const
+QQuickNinePatchData::Coords QQuickNinePatchData::coordsForSize(qreal size) const
 {
     // n = number of stretchable sections
     // We have to compensate when adding 0 and/or
@@ -70,7 +73,7 @@ QVector<qreal> QQuickNinePatchData::coordsForSize(qreal size) const
     const int n = (inverted ? l - 1 : l) / 2;
     const qreal stretch = (size - data.last()) / n;
 
-    QVector<qreal> coords;
+    Coords coords;
     coords.reserve(l);
     coords.append(0);
 
@@ -109,14 +112,27 @@ void QQuickNinePatchData::clear()
     data.clear();
 }
 
+// The coordinates parsed from the border pixels of a 9-patch image. They are
+// shared between all images that have the same source.
+struct QQuickNinePatchCoords
+{
+    QQuickNinePatchData xDivs;
+    QQuickNinePatchData yDivs;
+    QVector<qreal> hInsets;
+    QVector<qreal> vInsets;
+    QVector<qreal> hPaddings;
+    QVector<qreal> vPaddings;
+};
+
 class QQuickNinePatchNode : public QSGGeometryNode
 {
 public:
     QQuickNinePatchNode();
     ~QQuickNinePatchNode();
 
+    bool hasTexture() const;
     void initialize(QSGTexture *texture, const QSizeF &targetSize, const QSize &sourceSize,
-                    const QQuickNinePatchData &xDivs, const QQuickNinePatchData &yDivs, qreal dpr);
+                    const QQuickNinePatchData &xDivs, const QQuickNinePatchData &yDivs, qreal dpr, bool mirror);
 
 private:
     QSGGeometry m_geometry;
@@ -136,51 +152,69 @@ QQuickNinePatchNode::~QQuickNinePatchNode()
     delete m_material.texture();
 }
 
+bool QQuickNinePatchNode::hasTexture() const
+{
+    return m_material.texture();
+}
+
+// Passing a null texture keeps the current one. The geometry is only
+// reallocated when the number of patches changes. Mirroring places the
+// vertices from right to left, so that the same texture serves both
+// layout directions.
 void QQuickNinePatchNode::initialize(QSGTexture *texture, const QSizeF &targetSize, const QSize &sourceSize,
-                                     const QQuickNinePatchData &xDivs, const QQuickNinePatchData &yDivs, qreal dpr)
+                                     const QQuickNinePatchData &xDivs, const QQuickNinePatchData &yDivs, qreal dpr, bool mirror)
 {
-    delete m_material.texture();
-    m_material.setTexture(texture);
+    QSGNode::DirtyState dirty = QSGNode::DirtyGeometry;
+    if (texture) {
+        delete m_material.texture();
+        m_material.setTexture(texture);
+        dirty |= QSGNode::DirtyMaterial;
+    }
 
     const int xlen = xDivs.count();
     const int ylen = yDivs.count();
 
-    if (xlen > 0 && ylen > 0) {
+    if (xlen > 0 && ylen > 0 && m_material.texture()) {
         const int quads = (xlen - 1) * (ylen - 1);
         static const int verticesPerQuad = 6;
-        m_geometry.allocate(xlen * ylen, verticesPerQuad * quads);
+        if (m_geometry.vertexCount() != xlen * ylen || m_geometry.indexCount() != verticesPerQuad * quads) {
+            m_geometry.allocate(xlen * ylen, verticesPerQuad * quads);
+
+            quint16 *indices = m_geometry.indexDataAsUShort();
+            int n = quads;
+            for (int q = 0; n--; ++q) {
+                if ((q + 1) % xlen == 0) // next row
+                    ++q;
+                // Bottom-left half quad triangle
+                indices[0] = q;
+                indices[1] = q + xlen;
+                indices[2] = q + xlen + 1;
+
+                // Top-right half quad triangle
+                indices[3] = q;
+                indices[4] = q + xlen + 1;
+                indices[5] = q + 1;
+
+                indices += verticesPerQuad;
+            }
+        }
+
+        // the texture may be a part of an atlas
+        const QRectF subRect = m_material.texture()->normalizedTextureSubRect();
 
         QSGGeometry::TexturedPoint2D *vertices = m_geometry.vertexDataAsTexturedPoint2D();
-        QVector<qreal> xCoords = xDivs.coordsForSize(targetSize.width());
-        QVector<qreal> yCoords = yDivs.coordsForSize(targetSize.height());
+        const QQuickNinePatchData::Coords xCoords = xDivs.coordsForSize(targetSize.width());
+        const QQuickNinePatchData::Coords yCoords = yDivs.coordsForSize(targetSize.height());
 
         for (int y = 0; y < ylen; ++y) {
             for (int x = 0; x < xlen; ++x, ++vertices)
-                vertices->set(xCoords[x] / dpr, yCoords[y] / dpr,
-                              xDivs.at(x) / sourceSize.width(),
-                              yDivs.at(y) / sourceSize.height());
-        }
-
-        quint16 *indices = m_geometry.indexDataAsUShort();
-        int n = quads;
-        for (int q = 0; n--; ++q) {
-            if ((q + 1) % xlen == 0) // next row
-                ++q;
-            // Bottom-left half quad triangle
-            indices[0] = q;
-            indices[1] = q + xlen;
-            indices[2] = q + xlen + 1;
-
-            // Top-right half quad triangle
-            indices[3] = q;
-            indices[4] = q + xlen + 1;
-            indices[5] = q + 1;
-
-            indices += verticesPerQuad;
+                vertices->set((mirror ? targetSize.width() - xCoords[x] : xCoords[x]) / dpr, yCoords[y] / dpr,
+                              subRect.x() + xDivs.at(x) / sourceSize.width() * subRect.width(),
+                              subRect.y() + yDivs.at(y) / sourceSize.height() * subRect.height());
         }
     }
 
-    markDirty(QSGNode::DirtyGeometry | QSGNode::DirtyMaterial);
+    markDirty(dirty);
 }
 
 class QQuickNinePatchImagePrivate : public QQuickImagePrivate
@@ -196,6 +230,8 @@ public:
     qreal getImplicitHeight() const override;
 
     bool resetNode = false;
+    bool updateTexture = false;
+    qint64 ninePatchKey = 0;
     qreal topPadding = 0;
     qreal leftPadding = 0;
     qreal rightPadding = 0;
@@ -238,22 +274,37 @@ void QQuickNinePatchImagePrivate::updatePatches()
 
     int w = ninePatch.width();
     int h = ninePatch.height();
-    const QRgb *data = reinterpret_cast<const QRgb *>(ninePatch.constBits());
 
-    const QRgb black = qRgb(0,0,0);
-    const QRgb red = qRgb(255,0,0);
+    static QCache<qint64, QQuickNinePatchCoords> cache(100);
+
+    QQuickNinePatchCoords *coords = cache.object(ninePatchKey);
+    if (coords) {
+        updateInsets(coords->hInsets, coords->vInsets);
+    } else {
+        coords = new QQuickNinePatchCoords;
+        const QRgb *data = reinterpret_cast<const QRgb *>(ninePatch.constBits());
+
+        const QRgb black = qRgb(0,0,0);
+        const QRgb red = qRgb(255,0,0);
 
-    xDivs.fill(readCoords(data, 1, w - 1, 1, black), w - 2); // top left -> top right
-    yDivs.fill(readCoords(data, w, h - 1, w, black), h - 2); // top left -> bottom left
+        coords->xDivs.fill(readCoords(data, 1, w - 1, 1, black), w - 2); // top left -> top right
+        coords->yDivs.fill(readCoords(data, w, h - 1, w, black), h - 2); // top left -> bottom left
+
+        coords->hInsets = readCoords(data, (h - 1) * w + 1, w - 1, 1, red); // bottom left -> bottom right
+        coords->vInsets = readCoords(data, 2 * w - 1, h - 1, w, red); // top right -> bottom right
+        updateInsets(coords->hInsets, coords->vInsets);
+
+        const QSizeF sz(w - leftInset - rightInset, h - topInset - bottomInset);
+        coords->hPaddings = readCoords(data, (h - 1) * w + leftInset + 1, sz.width() - 2, 1, black); // bottom left -> bottom right
+        coords->vPaddings = readCoords(data, (2 + topInset) * w - 1, sz.height() - 2, w, black); // top right -> bottom right
+        cache.insert(ninePatchKey, coords);
+    }
 
-    QVector<qreal> hInsets = readCoords(data, (h - 1) * w + 1, w - 1, 1, red); // bottom left -> bottom right
-    QVector<qreal> vInsets = readCoords(data, 2 * w - 1, h - 1, w, red); // top right -> bottom right
-    updateInsets(hInsets, vInsets);
+    xDivs = coords->xDivs;
+    yDivs = coords->yDivs;
 
     const QSizeF sz(w - leftInset - rightInset, h - topInset - bottomInset);
-    QVector<qreal> hPaddings = readCoords(data, (h - 1) * w + leftInset + 1, sz.width() - 2, 1, black); // bottom left -> bottom right
-    QVector<qreal> vPaddings = readCoords(data, (2 + topInset) * w - 1, sz.height() - 2, w, black); // top right -> bottom right
-    updatePaddings(sz, hPaddings, vPaddings);
+    updatePaddings(sz, coords->hPaddings, coords->vPaddings);
 }
 
 void QQuickNinePatchImagePrivate::updatePaddings(const QSizeF &size, const QVector<qreal> &horizontal, const QVector<qreal> &vertical)
@@ -284,9 +335,13 @@ void QQuickNinePatchImagePrivate::updatePaddings(const QSizeF &size, const QVect
         emit q->topPaddingChanged();
     if (!qFuzzyCompare(oldBottomPadding, bottomPadding))
         emit q->bottomPaddingChanged();
-    if (!qFuzzyCompare(oldLeftPadding, leftPadding))
+    bool leftPaddingChanged = !qFuzzyCompare(oldLeftPadding, leftPadding);
+    bool rightPaddingChanged = !qFuzzyCompare(oldRightPadding, rightPadding);
+    if (mirror)
+        qSwap(leftPaddingChanged, rightPaddingChanged);
+    if (leftPaddingChanged)
         emit q->leftPaddingChanged();
-    if (!qFuzzyCompare(oldRightPadding, rightPadding))
+    if (rightPaddingChanged)
         emit q->rightPaddingChanged();
 }
 
@@ -326,9 +381,13 @@ void QQuickNinePatchImagePrivate::updateInsets(const QVector<qreal> &horizontal,
         emit q->topInsetChanged();
     if (!qFuzzyCompare(oldBottomInset, bottomInset))
         emit q->bottomInsetChanged();
-    if (!qFuzzyCompare(oldLeftInset, leftInset))
+    bool leftInsetChanged = !qFuzzyCompare(oldLeftInset, leftInset);
+    bool rightInsetChanged = !qFuzzyCompare(oldRightInset, rightInset);
+    if (mirror)
+        qSwap(leftInsetChanged, rightInsetChanged);
+    if (leftInsetChanged)
         emit q->leftInsetChanged();
-    if (!qFuzzyCompare(oldRightInset, rightInset))
+    if (rightInsetChanged)
         emit q->rightInsetChanged();
 }
 
@@ -347,6 +406,7 @@ qreal QQuickNinePatchImagePrivate::getImplicitHeight() const
 QQuickNinePatchImage::QQuickNinePatchImage(QQuickItem *parent)
     : QQuickImage(*(new QQuickNinePatchImagePrivate), parent)
 {
+    connect(this, &QQuickImageBase::mirrorChanged, this, &QQuickNinePatchImage::mirrorChange);
 }
 
 qreal QQuickNinePatchImage::topPadding() const
@@ -358,13 +418,13 @@ qreal QQuickNinePatchImage::topPadding() const
 qreal QQuickNinePatchImage::leftPadding() const
 {
     Q_D(const QQuickNinePatchImage);
-    return d->leftPadding / d->devicePixelRatio;
+    return (d->mirror ? d->rightPadding : d->leftPadding) / d->devicePixelRatio;
 }
 
 qreal QQuickNinePatchImage::rightPadding() const
 {
     Q_D(const QQuickNinePatchImage);
-    return d->rightPadding / d->devicePixelRatio;
+    return (d->mirror ? d->leftPadding : d->rightPadding) / d->devicePixelRatio;
 }
 
 qreal QQuickNinePatchImage::bottomPadding() const
@@ -382,13 +442,13 @@ qreal QQuickNinePatchImage::topInset() const
 qreal QQuickNinePatchImage::leftInset() const
 {
     Q_D(const QQuickNinePatchImage);
-    return d->leftInset / d->devicePixelRatio;
+    return (d->mirror ? d->rightInset : d->leftInset) / d->devicePixelRatio;
 }
 
 qreal QQuickNinePatchImage::rightInset() const
 {
     Q_D(const QQuickNinePatchImage);
-    return d->rightInset / d->devicePixelRatio;
+    return (d->mirror ? d->leftInset : d->rightInset) / d->devicePixelRatio;
 }
 
 qreal QQuickNinePatchImage::bottomInset() const
@@ -397,12 +457,27 @@ qreal QQuickNinePatchImage::bottomInset() const
     return d->bottomInset / d->devicePixelRatio;
 }
 
+void QQuickNinePatchImage::mirrorChange()
+{
+    Q_D(QQuickNinePatchImage);
+    if (!qFuzzyCompare(d->leftPadding, d->rightPadding)) {
+        emit leftPaddingChanged();
+        emit rightPaddingChanged();
+    }
+    if (!qFuzzyCompare(d->leftInset, d->rightInset)) {
+        emit leftInsetChanged();
+        emit rightInsetChanged();
+    }
+}
+
 void QQuickNinePatchImage::pixmapChange()
 {
     Q_D(QQuickNinePatchImage);
     if (QFileInfo(d->url.fileName()).completeSuffix().toLower() == QLatin1String("9.png")) {
         d->resetNode = d->ninePatch.isNull();
+        d->updateTexture = true;
         d->ninePatch = d->pix.image();
+        d->ninePatchKey = d->ninePatch.cacheKey();
         if (d->ninePatch.depth() != 32)
             d->ninePatch = d->ninePatch.convertToFormat(QImage::Format_ARGB32);
 
@@ -447,8 +522,13 @@ QSGNode *QQuickNinePatchImage::updatePaintNode(QSGNode *oldNode, UpdatePaintNode
     qsgnode_set_description(patchNode, QString::fromLatin1("QQuickNinePatchImage: '%1'").arg(d->url.toString()));
 #endif
 
-    QSGTexture *texture = window()->createTextureFromImage(image);
-    patchNode->initialize(texture, sz * d->devicePixelRatio, image.size(), d->xDivs, d->yDivs, d->devicePixelRatio);
+    // the texture is only re-created when the image changes, not when the item is resized
+    QSGTexture *texture = nullptr;
+    if (d->updateTexture || !patchNode->hasTexture()) {
+        texture = window()->createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas);
+        d->updateTexture = false;
+    }
+    patchNode->initialize(texture, sz * d->devicePixelRatio, image.size(), d->xDivs, d->yDivs, d->devicePixelRatio, d->mirror);
     return patchNode;
 }
 
@@ -95,6 +95,8 @@ protected:
     QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
 
 private:
+    void mirrorChange();
+
     Q_DISABLE_COPY(QQuickNinePatchImage)
     Q_DECLARE_PRIVATE(QQuickNinePatchImage)
 };
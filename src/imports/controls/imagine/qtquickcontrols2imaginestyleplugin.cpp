@@ -34,6 +34,7 @@
 **
 ****************************************************************************/
 
+#include <QtQuickControls2/private/qquickstartuptrace_p.h>
 #include <QtQuickControls2/private/qquickstyleplugin_p.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtQml/qqml.h>
@@ -76,6 +77,7 @@ QtQuickControls2ImagineStylePlugin::QtQuickControls2ImagineStylePlugin(QObject *
 
 void QtQuickControls2ImagineStylePlugin::registerTypes(const char *uri)
 {
+    QQuickStartupTrace trace("QtQuickControls2ImagineStylePlugin::registerTypes");
     qmlRegisterModule(uri, 2, QT_VERSION_MINOR - 7); // Qt 5.10 -> 2.3, 5.11 -> 2.4, ...
     qmlRegisterUncreatableType<QQuickImagineStyle>(uri, 2, 3, "Imagine", tr("Imagine is an attached property"));
 
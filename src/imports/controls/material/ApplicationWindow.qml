@@ -36,7 +36,7 @@
 
 import QtQuick 2.11
 import QtQuick.Window 2.3
-import QtQuick.Templates 2.4 as T
+import QtQuick.Templates 2.5 as T
 import QtQuick.Controls.Material 2.4
 
 T.ApplicationWindow {
@@ -39,7 +39,7 @@ import QtQuick.Templates 2.4 as T
 import QtQuick.Controls 2.4
 import QtQuick.Controls.impl 2.4
 import QtQuick.Controls.Material 2.4
-import QtQuick.Controls.Material.impl 2.4
+import QtQuick.Controls.Material.impl 2.5
 
 T.DelayButton {
     id: control
@@ -104,9 +104,13 @@ T.DelayButton {
             }
         }
 
-        layer.enabled: control.enabled && control.Material.buttonColor.a > 0
-        layer.effect: ElevationEffect {
+        ElevationShadow {
+            z: -1
+            width: parent.width
+            height: parent.height
+            radius: parent.radius
             elevation: control.Material.elevation
+            visible: control.enabled && control.Material.buttonColor.a > 0
         }
 
         Ripple {
@@ -39,7 +39,7 @@ import QtQuick.Templates 2.4 as T
 import QtQuick.Controls 2.4
 import QtQuick.Controls.impl 2.4
 import QtQuick.Controls.Material 2.4
-import QtQuick.Controls.Material.impl 2.4
+import QtQuick.Controls.Material.impl 2.5
 
 T.RoundButton {
     id: control
@@ -107,12 +107,16 @@ T.RoundButton {
             color: control.Material.rippleColor
         }
 
-        // The layer is disabled when the button color is transparent so that you can do
+        // The shadow is hidden when the button color is transparent so that you can do
         // Material.background: "transparent" and get a proper flat button without needing
         // to set Material.elevation as well
-        layer.enabled: control.enabled && control.Material.buttonColor.a > 0
-        layer.effect: ElevationEffect {
+        ElevationShadow {
+            z: -1
+            width: parent.width
+            height: parent.height
+            radius: parent.radius
             elevation: control.Material.elevation
+            visible: control.enabled && control.Material.buttonColor.a > 0
         }
     }
 }
@@ -2,6 +2,7 @@ HEADERS += \
     $$PWD/qquickmaterialbusyindicator_p.h \
     $$PWD/qquickmaterialprogressbar_p.h \
     $$PWD/qquickmaterialripple_p.h \
+    $$PWD/qquickmaterialshadow_p.h \
     $$PWD/qquickmaterialstyle_p.h \
     $$PWD/qquickmaterialtheme_p.h
 
@@ -9,6 +10,7 @@ SOURCES += \
     $$PWD/qquickmaterialbusyindicator.cpp \
     $$PWD/qquickmaterialprogressbar.cpp \
     $$PWD/qquickmaterialripple.cpp \
+    $$PWD/qquickmaterialshadow.cpp \
     $$PWD/qquickmaterialstyle.cpp \
     $$PWD/qquickmaterialtheme.cpp
 
@@ -36,15 +36,37 @@
 
 #include "qquickmaterialripple_p.h"
 
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qmath.h>
+#include <QtCore/qvector.h>
+#include <QtQuick/qsggeometry.h>
+#include <QtQuick/qsgnode.h>
+#include <QtQuick/qsgrendererinterface.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
+#include <QtQuick/qquickwindow.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qsgadaptationlayer_p.h>
 #include <QtQuickControls2/private/qquickanimatednode_p.h>
+#include <QtQuickControls2/private/qquickstyle_p.h>
 #include <QtQuickTemplates2/private/qquickabstractbutton_p.h>
 #include <QtQuickTemplates2/private/qquickabstractbutton_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
+/*
+    Each ripple is a single vertex color geometry node that contains the
+    background and all of its waves. The opacities are baked into the vertex
+    colors and the shapes are clipped to the (rounded) bounds of the ripple
+    on the CPU, so there are no opacity or clip nodes in between, and the
+    scene graph renderer can merge the ripples of a window into the same
+    batch. There is one animated node per ripple instead of one per wave.
+
+    The vertex color material is only available with OpenGL. With the other
+    graphics APIs, such as the software backend, the background and each
+    wave are rectangle nodes with an opacity node in between, and the waves
+    are clipped by the item clip node instead.
+*/
+
 namespace {
     enum WavePhase { WaveEnter, WaveExit };
 }
@@ -54,169 +76,394 @@ static const int OPACITY_ENTER_DURATION_FAST = 120;
 static const int WAVE_OPACITY_DECAY_DURATION = 333;
 static const qreal WAVE_TOUCH_DOWN_ACCELERATION = 1024.0;
 
-class QQuickMaterialRippleWaveNode : public QQuickAnimatedNode
+static const int CORNER_SEGMENTS = 8;
+static const qreal ANTIALIASING_MARGIN = 0.5;
+
+static inline qreal cross(const QPointF &a, const QPointF &b)
+{
+    return a.x() * b.y() - a.y() * b.x();
+}
+
+static inline qreal progress(const QElapsedTimer &timer, int duration)
+{
+    if (duration <= 0)
+        return 1.0;
+    return qMin<qreal>(1.0, timer.elapsed() / static_cast<qreal>(duration));
+}
+
+static bool usesVertexColors(const QQuickWindow *window)
+{
+    return window && window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL;
+}
+
+// All polygons are convex and wound in the direction of increasing angles,
+// that is, clockwise on the screen.
+static QVector<QPointF> circlePolygon(const QPointF &center, qreal radius)
+{
+    const int segments = qBound(16, qCeil(radius), 128);
+    QVector<QPointF> polygon;
+    polygon.reserve(segments);
+    for (int i = 0; i < segments; ++i) {
+        const qreal angle = 2 * M_PI * i / segments;
+        polygon += QPointF(center.x() + radius * qCos(angle), center.y() + radius * qSin(angle));
+    }
+    return polygon;
+}
+
+static QVector<QPointF> roundedRectPolygon(const QRectF &rect, qreal radius)
+{
+    const qreal r = qBound<qreal>(0, radius, qMin(rect.width(), rect.height()) / 2);
+
+    // The corners in clockwise order, starting from the top-left one.
+    const QPointF centers[4] = {
+        QPointF(rect.left() + r, rect.top() + r), QPointF(rect.right() - r, rect.top() + r),
+        QPointF(rect.right() - r, rect.bottom() - r), QPointF(rect.left() + r, rect.bottom() - r)
+    };
+
+    QVector<QPointF> polygon;
+    polygon.reserve(4 * (CORNER_SEGMENTS + 1));
+    for (int c = 0; c < 4; ++c) {
+        for (int s = 0; s <= CORNER_SEGMENTS; ++s) {
+            const qreal angle = M_PI + (c + qreal(s) / CORNER_SEGMENTS) * M_PI_2;
+            polygon += QPointF(centers[c].x() + r * qCos(angle), centers[c].y() + r * qSin(angle));
+        }
+    }
+    return polygon;
+}
+
+// Sutherland-Hodgman; both the polygon and the clip polygon must be convex.
+static QVector<QPointF> clipPolygon(const QVector<QPointF> &polygon, const QVector<QPointF> &clip)
+{
+    QVector<QPointF> result = polygon;
+    for (int i = 0; i < clip.count() && result.count() >= 3; ++i) {
+        const QPointF a = clip.at(i);
+        const QPointF edge = clip.at((i + 1) % clip.count()) - a;
+        if (qFuzzyIsNull(edge.x()) && qFuzzyIsNull(edge.y()))
+            continue;
+
+        const QVector<QPointF> input = result;
+        result.clear();
+        for (int j = 0; j < input.count(); ++j) {
+            const QPointF p = input.at(j);
+            const QPointF q = input.at((j + 1) % input.count());
+            const qreal dp = cross(edge, p - a);
+            const qreal dq = cross(edge, q - a);
+            if (dp >= 0)
+                result += p;
+            if ((dp >= 0) != (dq >= 0))
+                result += p + (q - p) * (dp / (dp - dq));
+        }
+    }
+    return result;
+}
+
+static void setVertex(QSGGeometry::ColoredPoint2D *vertex, const QPointF &point, const QColor &color, qreal opacity)
+{
+    // The vertex color material expects premultiplied colors.
+    const qreal alpha = color.alphaF() * opacity;
+    vertex->set(point.x(), point.y(), uchar(qRound(color.redF() * alpha * 255)), uchar(qRound(color.greenF() * alpha * 255)),
+                                      uchar(qRound(color.blueF() * alpha * 255)), uchar(qRound(alpha * 255)));
+}
+
+class QQuickMaterialRippleNode : public QQuickAnimatedNode
 {
 public:
-    QQuickMaterialRippleWaveNode(QQuickMaterialRipple *ripple);
+    QQuickMaterialRippleNode(QQuickMaterialRipple *ripple, bool vertexColors);
 
-    void exit();
-    void updateCurrentTime(int time) override;
     void sync(QQuickItem *item) override;
+    void updateCurrentTime(int time) override;
 
 private:
-    qreal m_from = 0;
-    qreal m_to = 0;
-    qreal m_value = 0;
-    WavePhase m_phase = WaveEnter;
-    QPointF m_anchor;
-    QRectF m_bounds;
+    struct Wave {
+        WavePhase phase;
+        int duration;
+        qreal from;
+        qreal value;
+        qreal opacity;
+        QPointF anchor;
+        QElapsedTimer timer;
+    };
+
+    // returns whether any of the animations is still running
+    bool updateWaves();
+    void updateGeometry();
+    void updateRectangleNodes();
+
+    bool m_active = false;
+    bool m_clip = false;
+    int m_backgroundDuration = 0;
+    qreal m_backgroundOpacity = 0;
+    qreal m_diameter = 0;
+    qreal m_clipRadius = 0;
+    QSizeF m_size;
+    QColor m_color;
+    QVector<Wave> m_waves;
+    QElapsedTimer m_backgroundTimer;
+    QSGGeometryNode *m_geometryNode = nullptr;
 };
 
-QQuickMaterialRippleWaveNode::QQuickMaterialRippleWaveNode(QQuickMaterialRipple *ripple)
+QQuickMaterialRippleNode::QQuickMaterialRippleNode(QQuickMaterialRipple *ripple, bool vertexColors)
     : QQuickAnimatedNode(ripple)
 {
-    start(qRound(1000.0 * qSqrt(ripple->diameter() / 2.0 / WAVE_TOUCH_DOWN_ACCELERATION)));
+    setLoopCount(Infinite);
+    if (!vertexColors)
+        return;
 
-    QSGOpacityNode *opacityNode = new QSGOpacityNode;
-    appendChildNode(opacityNode);
+    QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0, 0);
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
 
-    QQuickItemPrivate *d = QQuickItemPrivate::get(ripple);
-    QSGInternalRectangleNode *rectNode = d->sceneGraphContext()->createInternalRectangleNode();
-    rectNode->setAntialiasing(true);
-    opacityNode->appendChildNode(rectNode);
+    m_geometryNode = new QSGGeometryNode;
+    m_geometryNode->setGeometry(geometry);
+    m_geometryNode->setFlag(QSGNode::OwnsGeometry);
+    m_geometryNode->setMaterial(new QSGVertexColorMaterial);
+    m_geometryNode->setFlag(QSGNode::OwnsMaterial);
+    appendChildNode(m_geometryNode);
 }
 
-void QQuickMaterialRippleWaveNode::exit()
+void QQuickMaterialRippleNode::sync(QQuickItem *item)
 {
-    m_phase = WaveExit;
-    m_from = m_value;
-    setDuration(WAVE_OPACITY_DECAY_DURATION);
-    restart();
-    connect(this, &QQuickAnimatedNode::stopped, this, &QObject::deleteLater);
-}
+    QQuickMaterialRipple *ripple = static_cast<QQuickMaterialRipple *>(item);
+    m_diameter = ripple->diameter();
+    m_size = ripple->boundingRect().size();
+    m_color = ripple->color();
+    m_clipRadius = ripple->clipRadius();
+    m_clip = !qFuzzyIsNull(m_clipRadius);
 
-void QQuickMaterialRippleWaveNode::updateCurrentTime(int time)
-{
-    qreal p = 1.0;
-    if (duration() > 0)
-        p = time / static_cast<qreal>(duration());
+    if (m_active != ripple->isActive()) {
+        m_active = ripple->isActive();
+        m_backgroundDuration = m_active ? OPACITY_ENTER_DURATION_FAST : WAVE_OPACITY_DECAY_DURATION;
+        m_backgroundTimer.start();
+    }
 
-    m_value = m_from + (m_to - m_from) * p;
-    p = m_value / m_to;
+    // enter new waves and exit old ones, oldest first
+    const QPointF anchor = ripple->anchorPoint();
+    int entering = ripple->m_waves;
+    for (int i = m_waves.count() - 1; i >= 0; --i) {
+        Wave &wave = m_waves[i];
+        if (wave.phase != WaveEnter)
+            continue;
+
+        if (entering > 0) {
+            wave.anchor = anchor;
+            --entering;
+        } else {
+            wave.phase = WaveExit;
+            wave.from = wave.value;
+            wave.duration = WAVE_OPACITY_DECAY_DURATION;
+            wave.timer.start();
+        }
+    }
+    while (entering-- > 0) {
+        Wave wave;
+        wave.phase = WaveEnter;
+        wave.duration = qRound(1000.0 * qSqrt(m_diameter / 2.0 / WAVE_TOUCH_DOWN_ACCELERATION));
+        wave.from = 0;
+        wave.value = 0;
+        wave.opacity = 1;
+        wave.anchor = anchor;
+        wave.timer.start();
+        m_waves += wave;
+    }
 
-    const qreal dx = (1.0 - p) * (m_anchor.x() - m_bounds.width() / 2);
-    const qreal dy = (1.0 - p) * (m_anchor.y() - m_bounds.height() / 2);
+    if (!m_geometryNode) {
+        // an opacity node with a rectangle node for the background and each wave
+        QSGContext *context = QQuickItemPrivate::get(ripple)->sceneGraphContext();
+        for (int i = childCount(); i < m_waves.count() + 1; ++i) {
+            QSGOpacityNode *opacityNode = new QSGOpacityNode;
+            QSGInternalRectangleNode *rectNode = context->createInternalRectangleNode();
+            rectNode->setAntialiasing(true);
+            opacityNode->appendChildNode(rectNode);
+            appendChildNode(opacityNode);
+        }
+    }
 
-    QMatrix4x4 m;
-    m.translate(qRound((m_bounds.width() - m_value) / 2 + dx),
-                qRound((m_bounds.height() - m_value) / 2 + dy));
-    setMatrix(m);
+    if (updateWaves())
+        start();
+}
 
-    QSGOpacityNode *opacityNode = static_cast<QSGOpacityNode *>(firstChild());
-    Q_ASSERT(opacityNode->type() == QSGNode::OpacityNodeType);
-    qreal opacity = 1.0;
-    if (m_phase == WaveExit)
-        opacity -= static_cast<qreal>(time) / WAVE_OPACITY_DECAY_DURATION;
-    opacityNode->setOpacity(opacity);
+void QQuickMaterialRippleNode::updateCurrentTime(int time)
+{
+    Q_UNUSED(time);
 
-    QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(opacityNode->firstChild());
-    Q_ASSERT(rectNode->type() == QSGNode::GeometryNodeType);
-    rectNode->setRect(QRectF(0, 0, m_value, m_value));
-    rectNode->setRadius(m_value / 2);
-    rectNode->update();
+    // the waves and the background have their own timers
+    if (!updateWaves())
+        stop();
 }
 
-void QQuickMaterialRippleWaveNode::sync(QQuickItem *item)
+bool QQuickMaterialRippleNode::updateWaves()
 {
-    QQuickMaterialRipple *ripple = static_cast<QQuickMaterialRipple *>(item);
-    m_to = ripple->diameter();
-    m_anchor = ripple->anchorPoint();
-    m_bounds = ripple->boundingRect();
+    bool running = false;
 
-    QSGOpacityNode *opacityNode = static_cast<QSGOpacityNode *>(firstChild());
-    Q_ASSERT(opacityNode->type() == QSGNode::OpacityNodeType);
+    if (m_backgroundTimer.isValid()) {
+        const qreal p = progress(m_backgroundTimer, m_backgroundDuration);
+        m_backgroundOpacity = m_active ? p : 1.0 - p;
+        if (p < 1.0)
+            running = true;
+        else
+            m_backgroundTimer.invalidate();
+    }
 
-    QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(opacityNode->firstChild());
-    Q_ASSERT(rectNode->type() == QSGNode::GeometryNodeType);
-    rectNode->setColor(ripple->color());
+    for (int i = m_waves.count() - 1; i >= 0; --i) {
+        Wave &wave = m_waves[i];
+        const qreal p = progress(wave.timer, wave.duration);
+        wave.value = wave.from + (m_diameter - wave.from) * p;
+        if (wave.phase == WaveExit) {
+            if (p >= 1.0) {
+                m_waves.remove(i);
+                continue;
+            }
+            wave.opacity = 1.0 - p;
+        }
+        if (p < 1.0)
+            running = true;
+    }
+
+    updateGeometry();
+    return running;
 }
 
-class QQuickMaterialRippleBackgroundNode : public QQuickAnimatedNode
+void QQuickMaterialRippleNode::updateGeometry()
 {
-    Q_OBJECT
+    struct Shape {
+        QVector<QPointF> polygon;
+        qreal opacity;
+    };
 
-public:
-    QQuickMaterialRippleBackgroundNode(QQuickMaterialRipple *ripple);
+    if (!m_geometryNode) {
+        updateRectangleNodes();
+        return;
+    }
 
-    void updateCurrentTime(int time) override;
-    void sync(QQuickItem *item) override;
+    const QRectF bounds(QPointF(0, 0), m_size);
+    const QVector<QPointF> clip = m_clip ? roundedRectPolygon(bounds, m_clipRadius) : QVector<QPointF>();
 
-private:
-    bool m_active = false;
-};
+    QVector<Shape> shapes;
+    shapes.reserve(m_waves.count() + 1);
 
-QQuickMaterialRippleBackgroundNode::QQuickMaterialRippleBackgroundNode(QQuickMaterialRipple *ripple)
-    : QQuickAnimatedNode(ripple)
-{
-    setDuration(OPACITY_ENTER_DURATION_FAST);
+    if (m_backgroundOpacity > 0 && m_color.alpha() > 0) {
+        if (m_clip)
+            shapes += Shape { clip, m_backgroundOpacity };
+        else
+            shapes += Shape { circlePolygon(bounds.center(), m_diameter / 2), m_backgroundOpacity };
+    }
 
-    QSGOpacityNode *opacityNode = new QSGOpacityNode;
-    opacityNode->setOpacity(0.0);
-    appendChildNode(opacityNode);
+    for (const Wave &wave : qAsConst(m_waves)) {
+        if (wave.value <= 0 || wave.opacity <= 0 || m_color.alpha() == 0)
+            continue;
+
+        const qreal p = qFuzzyIsNull(m_diameter) ? 1.0 : wave.value / m_diameter;
+        const QPointF center(m_size.width() / 2 + (1.0 - p) * (wave.anchor.x() - m_size.width() / 2),
+                             m_size.height() / 2 + (1.0 - p) * (wave.anchor.y() - m_size.height() / 2));
+        QVector<QPointF> polygon = circlePolygon(center, wave.value / 2);
+        if (m_clip)
+            polygon = clipPolygon(polygon, clip);
+        if (polygon.count() >= 3)
+            shapes += Shape { polygon, wave.opacity };
+    }
 
-    QQuickItemPrivate *d = QQuickItemPrivate::get(ripple);
-    QSGInternalRectangleNode *rectNode = d->sceneGraphContext()->createInternalRectangleNode();
-    rectNode->setAntialiasing(true);
-    opacityNode->appendChildNode(rectNode);
-}
+    int vertexCount = 0;
+    int indexCount = 0;
+    for (const Shape &shape : qAsConst(shapes)) {
+        vertexCount += 2 * shape.polygon.count() + 1;
+        indexCount += 9 * shape.polygon.count();
+    }
 
-void QQuickMaterialRippleBackgroundNode::updateCurrentTime(int time)
-{
-    qreal opacity = time / static_cast<qreal>(duration());
-    if (!m_active)
-        opacity = 1.0 - opacity;
+    QSGGeometry *geometry = m_geometryNode->geometry();
+    geometry->allocate(vertexCount, indexCount);
+    QSGGeometry::ColoredPoint2D *vertex = geometry->vertexDataAsColoredPoint2D();
+    quint16 *index = geometry->indexDataAsUShort();
+
+    // Each convex shape is a fan around its centroid, surrounded by an
+    // antialiasing fringe that fades out across the edge.
+    int first = 0;
+    for (const Shape &shape : qAsConst(shapes)) {
+        const QVector<QPointF> &polygon = shape.polygon;
+        const int count = polygon.count();
+
+        QPointF centroid;
+        for (const QPointF &point : polygon)
+            centroid += point;
+        centroid /= count;
+
+        setVertex(vertex++, centroid, m_color, shape.opacity);
+        for (int i = 0; i < count; ++i) {
+            const QPointF point = polygon.at(i);
+            const QPointF prev = point - polygon.at((i + count - 1) % count);
+            const QPointF next = polygon.at((i + 1) % count) - point;
+            const qreal prevLength = qMax<qreal>(1e-6, qSqrt(prev.x() * prev.x() + prev.y() * prev.y()));
+            const qreal nextLength = qMax<qreal>(1e-6, qSqrt(next.x() * next.x() + next.y() * next.y()));
+            QPointF normal = QPointF(prev.y(), -prev.x()) / prevLength + QPointF(next.y(), -next.x()) / nextLength;
+            const qreal normalLength = qMax<qreal>(1e-6, qSqrt(normal.x() * normal.x() + normal.y() * normal.y()));
+            // the outward offset of the vertex that moves both edges by the margin
+            normal *= 2 * ANTIALIASING_MARGIN / normalLength / qMax<qreal>(0.5, normalLength);
+
+            setVertex(vertex++, point - normal, m_color, shape.opacity);
+            setVertex(vertex++, point + normal, m_color, 0);
+        }
 
-    QSGOpacityNode *opacityNode = static_cast<QSGOpacityNode *>(firstChild());
-    Q_ASSERT(opacityNode->type() == QSGNode::OpacityNodeType);
-    opacityNode->setOpacity(opacity);
+        for (int i = 0; i < count; ++i) {
+            const int inner = first + 1 + 2 * i;
+            const int outer = inner + 1;
+            const int nextInner = first + 1 + 2 * ((i + 1) % count);
+            const int nextOuter = nextInner + 1;
+            *index++ = first;
+            *index++ = inner;
+            *index++ = nextInner;
+            *index++ = inner;
+            *index++ = outer;
+            *index++ = nextOuter;
+            *index++ = inner;
+            *index++ = nextOuter;
+            *index++ = nextInner;
+        }
+        first += 2 * count + 1;
+    }
+
+    m_geometryNode->markDirty(QSGNode::DirtyGeometry);
 }
 
-void QQuickMaterialRippleBackgroundNode::sync(QQuickItem *item)
+void QQuickMaterialRippleNode::updateRectangleNodes()
 {
-    QQuickMaterialRipple *ripple = static_cast<QQuickMaterialRipple *>(item);
-    if (m_active != ripple->isActive()) {
-        m_active = ripple->isActive();
-        setDuration(m_active ? OPACITY_ENTER_DURATION_FAST : WAVE_OPACITY_DECAY_DURATION);
-        restart();
+    // the nodes of the waves that have exited
+    while (childCount() > m_waves.count() + 1) {
+        QSGNode *node = lastChild();
+        removeChildNode(node);
+        delete node;
     }
 
+    const QRectF bounds(QPointF(0, 0), m_size);
     QSGOpacityNode *opacityNode = static_cast<QSGOpacityNode *>(firstChild());
-    Q_ASSERT(opacityNode->type() == QSGNode::OpacityNodeType);
-
     QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(opacityNode->firstChild());
-    Q_ASSERT(rectNode->type() == QSGNode::GeometryNodeType);
-
-    const qreal w = ripple->width();
-    const qreal h = ripple->height();
-    const qreal sz = qSqrt(w * w + h * h);
-
-    QMatrix4x4 matrix;
-    if (qFuzzyIsNull(ripple->clipRadius())) {
-        matrix.translate(qRound((w - sz) / 2), qRound((h - sz) / 2));
-        rectNode->setRect(QRectF(0, 0, sz, sz));
-        rectNode->setRadius(sz / 2);
+    opacityNode->setOpacity(m_backgroundOpacity);
+    if (m_clip) {
+        rectNode->setRect(bounds);
+        rectNode->setRadius(m_clipRadius);
     } else {
-        rectNode->setRect(QRectF(0, 0, w, h));
-        rectNode->setRadius(ripple->clipRadius());
+        const QPointF center = bounds.center();
+        rectNode->setRect(QRectF(center.x() - m_diameter / 2, center.y() - m_diameter / 2, m_diameter, m_diameter));
+        rectNode->setRadius(m_diameter / 2);
     }
-
-    setMatrix(matrix);
-    rectNode->setColor(ripple->color());
+    rectNode->setColor(m_color);
     rectNode->update();
+
+    for (const Wave &wave : qAsConst(m_waves)) {
+        opacityNode = static_cast<QSGOpacityNode *>(opacityNode->nextSibling());
+        rectNode = static_cast<QSGInternalRectangleNode *>(opacityNode->firstChild());
+
+        const qreal p = qFuzzyIsNull(m_diameter) ? 1.0 : wave.value / m_diameter;
+        const QPointF center(m_size.width() / 2 + (1.0 - p) * (wave.anchor.x() - m_size.width() / 2),
+                             m_size.height() / 2 + (1.0 - p) * (wave.anchor.y() - m_size.height() / 2));
+        opacityNode->setOpacity(wave.opacity);
+        rectNode->setRect(QRectF(center.x() - wave.value / 2, center.y() - wave.value / 2, wave.value, wave.value));
+        rectNode->setRadius(wave.value / 2);
+        rectNode->setColor(m_color);
+        rectNode->update();
+    }
 }
 
 QQuickMaterialRipple::QQuickMaterialRipple(QQuickItem *parent)
-    : QQuickItem(parent)
+    : QQuickItem(parent),
+      m_waveEnabled(!QQuickStylePrivate::isLowEndProfile())
 {
     setFlag(ItemHasContents);
 }
@@ -260,7 +507,7 @@ void QQuickMaterialRipple::setClipRadius(qreal radius)
         return;
 
     m_clipRadius = radius;
-    setClip(!qFuzzyIsNull(radius));
+    updateClip();
     update();
 }
 
@@ -349,76 +596,56 @@ qreal QQuickMaterialRipple::diameter() const
 void QQuickMaterialRipple::itemChange(ItemChange change, const ItemChangeData &data)
 {
     QQuickItem::itemChange(change, data);
+    if (change == ItemSceneChange)
+        updateClip();
 }
 
-QSGNode *QQuickMaterialRipple::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+// The waves are clipped on the CPU when they are drawn with vertex colors,
+// and by the item otherwise. An explicit clip of the delegate is left alone.
+void QQuickMaterialRipple::updateClip()
 {
-    QQuickItemPrivate *d = QQuickItemPrivate::get(this);
-    QQuickDefaultClipNode *clipNode = d->clipNode();
-    if (clipNode) {
-        // TODO: QTBUG-51894
-        // clipNode->setRadius(m_clipRadius);
-        clipNode->setRect(boundingRect());
-        clipNode->update();
-    }
-
-    QSGNode *container = oldNode;
-    if (!container)
-        container = new QSGNode;
-
-    QQuickMaterialRippleBackgroundNode *backgroundNode = static_cast<QQuickMaterialRippleBackgroundNode *>(container->firstChild());
-    if (!backgroundNode) {
-        backgroundNode = new QQuickMaterialRippleBackgroundNode(this);
-        backgroundNode->setObjectName(objectName());
-        container->appendChildNode(backgroundNode);
-    }
-    backgroundNode->sync(this);
-
-    // enter new waves
-    int i = m_waves;
-    QQuickMaterialRippleWaveNode *enterNode = static_cast<QQuickMaterialRippleWaveNode *>(backgroundNode->nextSibling());
-    while (i-- > 0) {
-        if (!enterNode) {
-            enterNode = new QQuickMaterialRippleWaveNode(this);
-            container->appendChildNode(enterNode);
-        }
-        enterNode->sync(this);
-        enterNode = static_cast<QQuickMaterialRippleWaveNode *>(enterNode->nextSibling());
-    }
-
-    // exit old waves
-    int j = container->childCount() - 1 - m_waves;
-    while (j-- > 0) {
-        QQuickMaterialRippleWaveNode *exitNode = static_cast<QQuickMaterialRippleWaveNode *>(backgroundNode->nextSibling());
-        if (exitNode) {
-            exitNode->exit();
-            exitNode->sync(this);
-        }
+    const bool needsClip = !qFuzzyIsNull(m_clipRadius) && window() && !usesVertexColors(window());
+    if (needsClip && !clip()) {
+        setClip(true);
+        m_itemClip = true;
+    } else if (!needsClip && m_itemClip) {
+        setClip(false);
+        m_itemClip = false;
     }
+}
 
-    return container;
+QSGNode *QQuickMaterialRipple::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    QQuickMaterialRippleNode *node = static_cast<QQuickMaterialRippleNode *>(oldNode);
+    if (!node)
+        node = new QQuickMaterialRippleNode(this, usesVertexColors(window()));
+    node->sync(this);
+    return node;
 }
 
 void QQuickMaterialRipple::timerEvent(QTimerEvent *event)
 {
     QQuickItem::timerEvent(event);
 
-    if (event->timerId() == m_enterDelay)
+    if (event->timerId() == m_enterDelay.timerId())
         enterWave();
 }
 
 void QQuickMaterialRipple::prepareWave()
 {
-    if (m_enterDelay <= 0)
-        m_enterDelay = startTimer(RIPPLE_ENTER_DELAY);
+    // the low-end profile shows the pressed state without the wave
+    if (!m_waveEnabled)
+        return;
+    if (!m_enterDelay.isActive())
+        m_enterDelay.start(RIPPLE_ENTER_DELAY, this);
 }
 
 void QQuickMaterialRipple::enterWave()
 {
-    if (m_enterDelay > 0) {
-        killTimer(m_enterDelay);
-        m_enterDelay = 0;
-    }
+    m_enterDelay.stop();
+
+    if (!m_waveEnabled)
+        return;
 
     ++m_waves;
     update();
@@ -426,10 +653,7 @@ void QQuickMaterialRipple::enterWave()
 
 void QQuickMaterialRipple::exitWave()
 {
-    if (m_enterDelay > 0) {
-        killTimer(m_enterDelay);
-        m_enterDelay = 0;
-    }
+    m_enterDelay.stop();
 
     if (m_waves > 0) {
         --m_waves;
@@ -438,5 +662,3 @@ void QQuickMaterialRipple::exitWave()
 }
 
 QT_END_NAMESPACE
-
-#include "qquickmaterialripple.moc"
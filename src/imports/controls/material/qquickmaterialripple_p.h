@@ -50,6 +50,7 @@
 
 #include <QtQuick/qquickitem.h>
 #include <QtGui/qcolor.h>
+#include <QtQuickTemplates2/private/qquickpresstimer_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -101,10 +102,16 @@ protected:
     void exitWave();
 
 private:
+    void updateClip();
+
+    friend class QQuickMaterialRippleNode;
+
     bool m_active = false;
     bool m_pressed = false;
+    bool m_waveEnabled = true;
+    bool m_itemClip = false;
     int m_waves = 0;
-    int m_enterDelay = 0;
+    QQuickPressTimer m_enterDelay;
     Trigger m_trigger = Press;
     qreal m_clipRadius = 0.0;
     QColor m_color;
@@ -0,0 +1,395 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickmaterialshadow_p.h"
+
+#include <QtCore/qmath.h>
+#include <QtQuick/qsggeometry.h>
+#include <QtQuick/qsgnode.h>
+#include <QtQuick/qsgrendererinterface.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QtQuick/private/qsgadaptationlayer_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    An analytic replacement for ElevationEffect, which needs a layer and a
+    shader pass per elevated item. Each of the three box shadows that make up
+    an elevation is tessellated into rounded rectangle rings with per-vertex
+    alpha approximating the Gaussian falloff of a CSS box-shadow. All of them
+    go into a single vertex color geometry node, which the scene graph
+    renderer can batch with the shadows of other items.
+
+    The vertex color material is only available with OpenGL. With the other
+    graphics APIs, such as the software backend, each box shadow is drawn as
+    translucent rounded rectangle nodes stacked between the rings instead.
+*/
+
+namespace {
+    struct BoxShadow {
+        int offset;
+        int blur;
+        int spread;
+    };
+
+    // The same values as ElevationEffect.qml, which are taken from Angular Material
+    // (The MIT License (MIT), Copyright (c) 2014-2016 Google, Inc. http://angularjs.org)
+    static const BoxShadow shadows[][3] = {
+        { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } },
+        { { 1, 3, 0 }, { 1, 1, 0 }, { 2, 1, -1 } },
+        { { 1, 5, 0 }, { 2, 2, 0 }, { 3, 1, -2 } },
+        { { 1, 8, 0 }, { 3, 4, 0 }, { 3, 3, -2 } },
+        { { 2, 4, -1 }, { 4, 5, 0 }, { 1, 10, 0 } },
+        { { 3, 5, -1 }, { 5, 8, 0 }, { 1, 14, 0 } },
+        { { 3, 5, -1 }, { 6, 10, 0 }, { 1, 18, 0 } },
+        { { 4, 5, -2 }, { 7, 10, 1 }, { 2, 16, 1 } },
+        { { 5, 5, -3 }, { 8, 10, 1 }, { 3, 14, 2 } },
+        { { 5, 6, -3 }, { 9, 12, 1 }, { 3, 16, 2 } },
+        { { 6, 6, -3 }, { 10, 14, 1 }, { 4, 18, 3 } },
+        { { 6, 7, -4 }, { 11, 15, 1 }, { 4, 20, 3 } },
+        { { 7, 8, -4 }, { 12, 17, 2 }, { 5, 22, 4 } },
+        { { 7, 8, -4 }, { 13, 19, 2 }, { 5, 24, 4 } },
+        { { 7, 9, -4 }, { 14, 21, 2 }, { 5, 26, 4 } },
+        { { 8, 9, -5 }, { 15, 22, 2 }, { 6, 28, 5 } },
+        { { 8, 10, -5 }, { 16, 24, 2 }, { 6, 30, 5 } },
+        { { 8, 11, -5 }, { 17, 26, 2 }, { 6, 32, 5 } },
+        { { 9, 11, -5 }, { 18, 28, 2 }, { 7, 34, 6 } },
+        { { 9, 12, -6 }, { 19, 29, 2 }, { 7, 36, 6 } },
+        { { 10, 13, -6 }, { 20, 31, 3 }, { 8, 38, 7 } },
+        { { 10, 13, -6 }, { 21, 33, 3 }, { 8, 40, 7 } },
+        { { 10, 14, -6 }, { 22, 35, 3 }, { 8, 42, 7 } },
+        { { 11, 14, -7 }, { 23, 36, 3 }, { 9, 44, 8 } },
+        { { 11, 15, -7 }, { 24, 38, 3 }, { 9, 46, 8 } }
+    };
+
+    static const int maxElevation = sizeof(shadows) / sizeof(shadows[0]) - 1;
+
+    // The opacities of the three shadows, as in ElevationEffect.qml.
+    static const qreal shadowOpacities[3] = { 0.2, 0.14, 0.12 };
+
+    // The rings are placed at -blur, -blur/2, 0, blur/2 and blur from the edge,
+    // where the Gaussian with sigma = blur/2 has roughly the following coverage.
+    static const int ringCount = 5;
+    static const qreal ringOffsets[ringCount] = { -1.0, -0.5, 0.0, 0.5, 1.0 };
+    static const qreal ringCoverage[ringCount] = { 1.0, 0.84, 0.5, 0.16, 0.0 };
+
+    static const int cornerSegments = 6;
+    static const int ringVertexCount = 4 * (cornerSegments + 1);
+    static const int shadowVertexCount = ringCount * ringVertexCount + 1;
+    static const int shadowIndexCount = ringVertexCount * 3 + (ringCount - 1) * ringVertexCount * 6;
+
+    static bool usesVertexColors(const QQuickWindow *window)
+    {
+        return window && window->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL;
+    }
+
+    // The opacity of the rectangle that is grown to the given ring. Each
+    // rectangle adds the coverage that the area between the ring and the
+    // previous one has over the area outside the ring.
+    static qreal layerOpacity(int ring)
+    {
+        const qreal coverage = (ringCoverage[ring - 1] + ringCoverage[ring]) / 2;
+        if (ring + 1 == ringCount)
+            return coverage;
+        return coverage - (ringCoverage[ring] + ringCoverage[ring + 1]) / 2;
+    }
+
+    static void setVertex(QSGGeometry::ColoredPoint2D *vertex, float x, float y, const QColor &color, qreal opacity)
+    {
+        // The vertex color material expects premultiplied colors.
+        const qreal alpha = color.alphaF() * opacity;
+        vertex->set(x, y, uchar(qRound(color.redF() * alpha * 255)), uchar(qRound(color.greenF() * alpha * 255)),
+                          uchar(qRound(color.blueF() * alpha * 255)), uchar(qRound(alpha * 255)));
+    }
+
+    // Writes one rounded rectangle ring, which is the shadow rect grown by
+    // the given distance, and returns the new vertex position.
+    static QSGGeometry::ColoredPoint2D *addRing(QSGGeometry::ColoredPoint2D *vertex, const QRectF &rect, qreal radius,
+                                               qreal distance, const QColor &color, qreal opacity)
+    {
+        qreal left = rect.left() - distance;
+        qreal right = rect.right() + distance;
+        qreal top = rect.top() - distance;
+        qreal bottom = rect.bottom() + distance;
+        if (left > right)
+            left = right = rect.center().x();
+        if (top > bottom)
+            top = bottom = rect.center().y();
+
+        const qreal r = qBound<qreal>(0, radius + distance, qMin(right - left, bottom - top) / 2);
+
+        // The corners in clockwise order, starting from the top-left one.
+        const QPointF centers[4] = {
+            QPointF(left + r, top + r), QPointF(right - r, top + r),
+            QPointF(right - r, bottom - r), QPointF(left + r, bottom - r)
+        };
+        for (int c = 0; c < 4; ++c) {
+            for (int s = 0; s <= cornerSegments; ++s) {
+                const qreal angle = M_PI + (c + qreal(s) / cornerSegments) * M_PI_2;
+                setVertex(vertex++, centers[c].x() + r * qCos(angle), centers[c].y() + r * qSin(angle), color, opacity);
+            }
+        }
+        return vertex;
+    }
+
+    // Grows a rounded rectangle by the given distance like addRing().
+    static void setRect(QSGInternalRectangleNode *node, const QRectF &rect, qreal radius,
+                        qreal distance, const QColor &color, qreal opacity)
+    {
+        QRectF r = rect.adjusted(-distance, -distance, distance, distance);
+        if (r.width() < 0)
+            r.setWidth(0);
+        if (r.height() < 0)
+            r.setHeight(0);
+
+        QColor c = color;
+        c.setAlphaF(color.alphaF() * opacity);
+        node->setRect(r);
+        node->setRadius(qBound<qreal>(0, radius + distance, qMin(r.width(), r.height()) / 2));
+        node->setColor(c);
+        node->update();
+    }
+}
+
+QQuickMaterialShadow::QQuickMaterialShadow(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents);
+}
+
+int QQuickMaterialShadow::elevation() const
+{
+    return m_elevation;
+}
+
+void QQuickMaterialShadow::setElevation(int elevation)
+{
+    if (elevation == m_elevation)
+        return;
+
+    m_elevation = elevation;
+    update();
+}
+
+qreal QQuickMaterialShadow::radius() const
+{
+    return m_radius;
+}
+
+void QQuickMaterialShadow::setRadius(qreal radius)
+{
+    if (qFuzzyCompare(radius, m_radius))
+        return;
+
+    m_radius = radius;
+    update();
+}
+
+QColor QQuickMaterialShadow::color() const
+{
+    return m_color;
+}
+
+void QQuickMaterialShadow::setColor(const QColor &color)
+{
+    if (color == m_color)
+        return;
+
+    m_color = color;
+    update();
+}
+
+bool QQuickMaterialShadow::isFullWidth() const
+{
+    return m_fullWidth;
+}
+
+void QQuickMaterialShadow::setFullWidth(bool full)
+{
+    if (full == m_fullWidth)
+        return;
+
+    m_fullWidth = full;
+    update();
+}
+
+bool QQuickMaterialShadow::isFullHeight() const
+{
+    return m_fullHeight;
+}
+
+void QQuickMaterialShadow::setFullHeight(bool full)
+{
+    if (full == m_fullHeight)
+        return;
+
+    m_fullHeight = full;
+    update();
+}
+
+QRectF QQuickMaterialShadow::shadowRect(int index, qreal *radius) const
+{
+    const BoxShadow &shadow = shadows[qBound(0, m_elevation, maxElevation)][index];
+    QRectF rect = boundingRect().adjusted(-shadow.spread, -shadow.spread, shadow.spread, shadow.spread);
+    rect.translate(0, shadow.offset);
+    *radius = qMax<qreal>(0, m_radius + shadow.spread);
+    // Push the rounded ends of full width/height shadows out of sight.
+    const qreal extension = shadow.blur + *radius;
+    if (m_fullWidth)
+        rect.adjust(-extension, 0, extension, 0);
+    if (m_fullHeight)
+        rect.adjust(0, -extension, 0, extension);
+    return rect;
+}
+
+QSGNode *QQuickMaterialShadow::updateRectangleNodes(QSGNode *oldNode, int count)
+{
+    const int nodeCount = count * (ringCount - 1);
+    QSGNode *node = oldNode;
+    if (!node)
+        node = new QSGNode;
+
+    QSGContext *context = QQuickItemPrivate::get(this)->sceneGraphContext();
+    while (node->childCount() < nodeCount) {
+        QSGInternalRectangleNode *rectNode = context->createInternalRectangleNode();
+        rectNode->setAntialiasing(true);
+        node->appendChildNode(rectNode);
+    }
+    while (node->childCount() > nodeCount) {
+        QSGNode *child = node->lastChild();
+        node->removeChildNode(child);
+        delete child;
+    }
+
+    const BoxShadow *boxShadows = shadows[qBound(0, m_elevation, maxElevation)];
+    QSGNode *child = node->firstChild();
+    for (int i = 0; i < 3; ++i) {
+        const BoxShadow &shadow = boxShadows[i];
+        if (!shadow.offset && !shadow.blur && !shadow.spread)
+            continue;
+
+        qreal radius = 0;
+        const QRectF rect = shadowRect(i, &radius);
+        const qreal opacity = shadowOpacities[i];
+        for (int r = 1; r < ringCount; ++r) {
+            setRect(static_cast<QSGInternalRectangleNode *>(child), rect, radius,
+                    ringOffsets[r] * shadow.blur, m_color, opacity * layerOpacity(r));
+            child = child->nextSibling();
+        }
+    }
+    return node;
+}
+
+QSGNode *QQuickMaterialShadow::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    const BoxShadow *boxShadows = shadows[qBound(0, m_elevation, maxElevation)];
+    int count = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (boxShadows[i].offset || boxShadows[i].blur || boxShadows[i].spread)
+            ++count;
+    }
+
+    if (count == 0 || width() <= 0 || height() <= 0 || m_color.alpha() == 0) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    if (!usesVertexColors(window()))
+        return updateRectangleNodes(oldNode, count);
+
+    QSGGeometryNode *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode;
+        QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0, 0);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    geometry->allocate(count * shadowVertexCount, count * shadowIndexCount);
+    QSGGeometry::ColoredPoint2D *vertex = geometry->vertexDataAsColoredPoint2D();
+    quint16 *index = geometry->indexDataAsUShort();
+
+    int first = 0;
+    for (int i = 0; i < 3; ++i) {
+        const BoxShadow &shadow = boxShadows[i];
+        if (!shadow.offset && !shadow.blur && !shadow.spread)
+            continue;
+
+        qreal radius = 0;
+        const QRectF rect = shadowRect(i, &radius);
+
+        const qreal opacity = shadowOpacities[i];
+
+        // The center vertex fills the innermost ring.
+        setVertex(vertex++, rect.center().x(), rect.center().y(), m_color, opacity);
+        for (int r = 0; r < ringCount; ++r)
+            vertex = addRing(vertex, rect, radius, ringOffsets[r] * shadow.blur, m_color, opacity * ringCoverage[r]);
+
+        const int center = first;
+        const int ring = first + 1;
+        for (int v = 0; v < ringVertexCount; ++v) {
+            const int next = (v + 1) % ringVertexCount;
+            *index++ = center;
+            *index++ = ring + v;
+            *index++ = ring + next;
+        }
+        for (int r = 0; r < ringCount - 1; ++r) {
+            const int inner = ring + r * ringVertexCount;
+            const int outer = inner + ringVertexCount;
+            for (int v = 0; v < ringVertexCount; ++v) {
+                const int next = (v + 1) % ringVertexCount;
+                *index++ = inner + v;
+                *index++ = outer + v;
+                *index++ = outer + next;
+                *index++ = inner + v;
+                *index++ = outer + next;
+                *index++ = inner + next;
+            }
+        }
+        first += shadowVertexCount;
+    }
+
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+
+QT_END_NAMESPACE
@@ -37,6 +37,7 @@
 #include "qquickmaterialstyle_p.h"
 
 #include <QtCore/qdebug.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qsettings.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQuickControls2/private/qquickstyle_p.h>
@@ -493,11 +494,8 @@ void QQuickMaterialStyle::inheritTheme(Theme theme)
 void QQuickMaterialStyle::propagateTheme()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(child);
-        if (material)
-            material->inheritTheme(m_theme);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickMaterialStyle *>(child)->inheritTheme(m_theme);
 }
 
 void QQuickMaterialStyle::resetTheme()
@@ -548,11 +546,8 @@ void QQuickMaterialStyle::inheritPrimary(uint primary, bool custom)
 void QQuickMaterialStyle::propagatePrimary()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(child);
-        if (material)
-            material->inheritPrimary(m_primary, m_customPrimary);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickMaterialStyle *>(child)->inheritPrimary(m_primary, m_customPrimary);
 }
 
 void QQuickMaterialStyle::resetPrimary()
@@ -607,11 +602,8 @@ void QQuickMaterialStyle::inheritAccent(uint accent, bool custom)
 void QQuickMaterialStyle::propagateAccent()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(child);
-        if (material)
-            material->inheritAccent(m_accent, m_customAccent);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickMaterialStyle *>(child)->inheritAccent(m_accent, m_customAccent);
 }
 
 void QQuickMaterialStyle::resetAccent()
@@ -672,11 +664,8 @@ void QQuickMaterialStyle::inheritForeground(uint foreground, bool custom, bool h
 void QQuickMaterialStyle::propagateForeground()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(child);
-        if (material)
-            material->inheritForeground(m_foreground, m_customForeground, m_hasForeground);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickMaterialStyle *>(child)->inheritForeground(m_foreground, m_customForeground, m_hasForeground);
 }
 
 void QQuickMaterialStyle::resetForeground()
@@ -731,11 +720,8 @@ void QQuickMaterialStyle::inheritBackground(uint background, bool custom, bool h
 void QQuickMaterialStyle::propagateBackground()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(child);
-        if (material)
-            material->inheritBackground(m_background, m_customBackground, m_hasBackground);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickMaterialStyle *>(child)->inheritBackground(m_background, m_customBackground, m_hasBackground);
 }
 
 void QQuickMaterialStyle::resetBackground()
@@ -1133,13 +1119,59 @@ void QQuickMaterialStyle::attachedParentChange(QQuickAttachedObject *newParent,
 {
     Q_UNUSED(oldParent);
     QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(newParent);
-    if (material) {
-        inheritPrimary(material->m_primary, material->m_customPrimary);
-        inheritAccent(material->m_accent, material->m_customAccent);
-        inheritForeground(material->m_foreground, material->m_customForeground, material->m_hasForeground);
-        inheritBackground(material->m_background, material->m_customBackground, material->m_hasBackground);
-        inheritTheme(material->theme());
+    if (material)
+        inheritStyle(material);
+}
+
+// Inherits all values of a new attached parent at once, so that the attached
+// subtree is walked only once and each signal is emitted at most once.
+void QQuickMaterialStyle::inheritStyle(const QQuickMaterialStyle *style)
+{
+    const bool themeChange = !m_explicitTheme && m_theme != style->m_theme;
+    const bool primaryChange = !m_explicitPrimary && m_primary != style->m_primary;
+    const bool accentChange = !m_explicitAccent && m_accent != style->m_accent;
+    const bool foregroundChange = !m_explicitForeground && m_foreground != style->m_foreground;
+    const bool backgroundChange = !m_explicitBackground && m_background != style->m_background;
+    if (!themeChange && !primaryChange && !accentChange && !foregroundChange && !backgroundChange)
+        return;
+
+    if (themeChange)
+        m_theme = style->m_theme;
+    if (primaryChange) {
+        m_customPrimary = style->m_customPrimary;
+        m_primary = style->m_primary;
+    }
+    if (accentChange) {
+        m_customAccent = style->m_customAccent;
+        m_accent = style->m_accent;
     }
+    if (foregroundChange) {
+        m_hasForeground = style->m_hasForeground;
+        m_customForeground = style->m_customForeground;
+        m_foreground = style->m_foreground;
+    }
+    if (backgroundChange) {
+        m_hasBackground = style->m_hasBackground;
+        m_customBackground = style->m_customBackground;
+        m_background = style->m_background;
+    }
+
+    const auto styles = attachedChildren();
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickMaterialStyle *>(child)->inheritStyle(this);
+
+    if (themeChange)
+        emit themeChanged();
+    if (primaryChange)
+        emit primaryChanged();
+    if (accentChange || (themeChange && !m_customAccent))
+        emit accentChanged();
+    if (foregroundChange || (themeChange && !m_hasForeground))
+        emit foregroundChanged();
+    if (backgroundChange || (themeChange && !m_hasBackground))
+        emit backgroundChanged();
+    if (themeChange || primaryChange || accentChange || backgroundChange)
+        emit paletteChanged();
 }
 
 template <typename Enum>
@@ -1243,6 +1275,19 @@ void QQuickMaterialStyle::init()
     QQuickAttachedObject::init(); // TODO: lazy init?
 }
 
+struct QQuickMaterialParsedColor
+{
+    QRgb rgba;
+    bool custom;
+};
+
+// Colors are often assigned from the same few strings over and over again,
+// for example in delegates, so the result of resolving a color name or
+// parsing a color string is cached. The cache is reset once it is full.
+typedef QHash<QString, QQuickMaterialParsedColor> QQuickMaterialParsedColorCache;
+Q_GLOBAL_STATIC(QQuickMaterialParsedColorCache, parsedColors)
+static const int MaxParsedColors = 64;
+
 bool QQuickMaterialStyle::variantToRgba(const QVariant &var, const char *name, QRgb *rgba, bool *custom) const
 {
     *custom = false;
@@ -1253,19 +1298,35 @@ bool QQuickMaterialStyle::variantToRgba(const QVariant &var, const char *name, Q
             return false;
         }
         *rgba = val;
+    } else if (var.type() == QVariant::Color && var.value<QColor>().isValid()) {
+        *custom = true;
+        *rgba = var.value<QColor>().rgba();
     } else {
-        int val = QMetaEnum::fromType<Color>().keyToValue(var.toByteArray());
+        const QString str = var.toString();
+        QQuickMaterialParsedColorCache *cache = parsedColors();
+        const auto it = cache->constFind(str);
+        if (it != cache->constEnd()) {
+            *rgba = it->rgba;
+            *custom = it->custom;
+            return true;
+        }
+
+        int val = QMetaEnum::fromType<Color>().keyToValue(str.toUtf8());
         if (val != -1) {
             *rgba = val;
         } else {
-            QColor color(var.toString());
+            QColor color(str);
             if (!color.isValid()) {
-                qmlWarning(parent()) << "unknown Material." << name << " value: " << var.toString();
+                qmlWarning(parent()) << "unknown Material." << name << " value: " << str;
                 return false;
             }
             *custom = true;
             *rgba = color.rgba();
         }
+
+        if (cache->size() >= MaxParsedColors)
+            cache->clear();
+        cache->insert(str, { *rgba, *custom });
     }
     return true;
 }
@@ -240,6 +240,7 @@ protected:
 
 private:
     void init();
+    void inheritStyle(const QQuickMaterialStyle *style);
     bool variantToRgba(const QVariant &var, const char *name, QRgb *rgba, bool *custom) const;
 
     QColor backgroundColor(Shade shade) const;
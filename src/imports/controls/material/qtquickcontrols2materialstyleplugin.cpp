@@ -34,6 +34,7 @@
 **
 ****************************************************************************/
 
+#include <QtQuickControls2/private/qquickstartuptrace_p.h>
 #include <QtQuickControls2/private/qquickstyleplugin_p.h>
 
 #include "qquickmaterialstyle_p.h"
@@ -41,6 +42,7 @@
 #include "qquickmaterialbusyindicator_p.h"
 #include "qquickmaterialprogressbar_p.h"
 #include "qquickmaterialripple_p.h"
+#include "qquickmaterialshadow_p.h"
 
 #include <QtQuickControls2/private/qquickstyleselector_p.h>
 #include <QtQuickControls2/private/qquickpaddedrectangle_p.h>
@@ -76,11 +78,13 @@ QtQuickControls2MaterialStylePlugin::QtQuickControls2MaterialStylePlugin(QObject
 
 void QtQuickControls2MaterialStylePlugin::registerTypes(const char *uri)
 {
+    QQuickStartupTrace trace("QtQuickControls2MaterialStylePlugin::registerTypes");
     qmlRegisterModule(uri, 2, QT_VERSION_MINOR - 7); // Qt 5.7->2.0, 5.8->2.1, 5.9->2.2...
     qmlRegisterUncreatableType<QQuickMaterialStyle>(uri, 2, 0, "Material", tr("Material is an attached property"));
 
     QByteArray import = QByteArray(uri) + ".impl";
     qmlRegisterModule(import, 2, QT_VERSION_MINOR - 7); // Qt 5.7->2.0, 5.8->2.1, 5.9->2.2...
+    qmlRegisterModule(import, 2, 5);
 
     qmlRegisterType<QQuickMaterialBusyIndicator>(import, 2, 0, "BusyIndicatorImpl");
     qmlRegisterType<QQuickMaterialProgressBar>(import, 2, 0, "ProgressBarImpl");
@@ -93,6 +97,9 @@ void QtQuickControls2MaterialStylePlugin::registerTypes(const char *uri)
     qmlRegisterType(typeUrl(QStringLiteral("RectangularGlow.qml")), import, 2, 0, "RectangularGlow");
     qmlRegisterType(typeUrl(QStringLiteral("SliderHandle.qml")), import, 2, 0, "SliderHandle");
     qmlRegisterType(typeUrl(QStringLiteral("SwitchIndicator.qml")), import, 2, 0, "SwitchIndicator");
+
+    // QtQuick.Controls.Material.impl 2.5 (Qt 5.12)
+    qmlRegisterType<QQuickMaterialShadow>(import, 2, 5, "ElevationShadow");
 }
 
 QString QtQuickControls2MaterialStylePlugin::name() const
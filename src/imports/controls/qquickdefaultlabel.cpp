@@ -0,0 +1,75 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickdefaultlabel_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QQuickDefaultLabel::QQuickDefaultLabel(QQuickItem *parent)
+    : QQuickLabel(parent)
+{
+    connect(this, &QQuickLabel::paletteChanged, this, &QQuickDefaultLabel::updateColors);
+    connect(this, &QQuickText::colorChanged, this, &QQuickDefaultLabel::colorChange);
+    connect(this, &QQuickText::linkColorChanged, this, &QQuickDefaultLabel::linkColorChange);
+    updateColors();
+}
+
+void QQuickDefaultLabel::updateColors()
+{
+    m_updating = true;
+    const QPalette p = palette();
+    if (!m_explicitColor)
+        setColor(p.color(QPalette::WindowText));
+    if (!m_explicitLinkColor)
+        setLinkColor(p.color(QPalette::Link));
+    m_updating = false;
+}
+
+// Like with the bindings of Label.qml, a color that is assigned from
+// outside takes precedence over the palette.
+void QQuickDefaultLabel::colorChange()
+{
+    if (!m_updating)
+        m_explicitColor = true;
+}
+
+void QQuickDefaultLabel::linkColorChange()
+{
+    if (!m_updating)
+        m_explicitLinkColor = true;
+}
+
+QT_END_NAMESPACE
@@ -37,6 +37,13 @@
 #include "qquickdefaultprogressbar_p.h"
 
 #include <QtCore/qeasingcurve.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtGui/qopenglcontext.h>
+#include <QtGui/qopenglshaderprogram.h>
+#include <QtGui/qvector4d.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuick/qsgmaterial.h>
+#include <QtQuick/qsgrendererinterface.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qsgadaptationlayer_p.h>
 #include <QtQuickControls2/private/qquickanimatednode_p.h>
@@ -68,6 +75,170 @@ static inline qreal blockEndX(int blockIndex, qreal availableWidth)
     return availableWidth - blockStartX(Blocks - 1 - blockIndex) - BlockWidth;
 }
 
+static void deleteChildNodes(QSGNode *node)
+{
+    while (QSGNode *child = node->firstChild()) {
+        node->removeChildNode(child);
+        delete child;
+    }
+}
+
+/*
+    With OpenGL, the indeterminate animation is a single static quad whose
+    fragment shader evaluates the same block positions as the transform node
+    based implementation below. The shader reads the time when the material
+    state is updated for rendering, so animating does not dirty any nodes.
+*/
+
+// Shared by the compatibility and core profile shaders.
+static const char *const indeterminateVertexShader =
+        "attribute highp vec4 vertex;\n"
+        "uniform highp mat4 matrix;\n"
+        "varying highp float x;\n"
+        "void main() {\n"
+        "    x = vertex.x;\n"
+        "    gl_Position = matrix * vertex;\n"
+        "}\n";
+
+static const char *const indeterminateFragmentShader =
+        "uniform highp float time;\n"
+        "uniform highp float width;\n"
+        "uniform lowp vec4 color;\n"
+        "uniform lowp float opacity;\n"
+        "varying highp float x;\n"
+        "highp float blockX(highp float i) {\n"
+        "    highp float startX = -(i + 1.0) * 16.0 - i * 48.0;\n"
+        "    highp float restX = width / 2.0 + 38.0 - (i + 1.0) * 16.0 - i * 4.0;\n"
+        "    if (time < 1600.0) {\n"
+        "        highp float p = time / 1600.0;\n"
+        "        return min(startX + width * p * p * 1.6, restX);\n"
+        "    }\n"
+        "    if (time < 2400.0)\n"
+        "        return restX;\n"
+        "    highp float kickoff = max(1.0, floor(48.0 / width * 1000.0));\n"
+        "    if (floor((time - 2400.0) / kickoff) < i)\n"
+        "        return restX;\n"
+        "    highp float endX = width + (4.0 - i) * 16.0 + (3.0 - i) * 48.0 - 16.0;\n"
+        "    return min(restX + width * ((time - 2400.0) - kickoff * i) / 1000.0, endX);\n"
+        "}\n"
+        "void main() {\n"
+        "    lowp float coverage = 0.0;\n"
+        "    for (int i = 0; i < 4; ++i) {\n"
+        "        highp float bx = blockX(float(i));\n"
+        "        if (x >= bx && x < bx + 16.0)\n"
+        "            coverage = 1.0;\n"
+        "    }\n"
+        "    gl_FragColor = color * (opacity * coverage);\n"
+        "}\n";
+
+static bool isCoreProfile()
+{
+    QOpenGLContext *context = QOpenGLContext::currentContext();
+    return context && context->format().profile() == QSurfaceFormat::CoreProfile;
+}
+
+class QQuickDefaultProgressBarMaterial : public QSGMaterial
+{
+public:
+    QQuickDefaultProgressBarMaterial();
+
+    QSGMaterialType *type() const override;
+    QSGMaterialShader *createShader() const override;
+    int compare(const QSGMaterial *other) const override;
+
+    QColor color;
+    qreal width = 0;
+    QElapsedTimer timer;
+};
+
+class QQuickDefaultProgressBarMaterialShader : public QSGMaterialShader
+{
+public:
+    void updateState(const RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override;
+    char const *const *attributeNames() const override;
+
+protected:
+    void initialize() override;
+    const char *vertexShader() const override;
+    const char *fragmentShader() const override;
+
+private:
+    int m_matrixId = -1;
+    int m_opacityId = -1;
+    int m_colorId = -1;
+    int m_widthId = -1;
+    int m_timeId = -1;
+};
+
+QQuickDefaultProgressBarMaterial::QQuickDefaultProgressBarMaterial()
+{
+    setFlag(Blending);
+    timer.start();
+}
+
+QSGMaterialType *QQuickDefaultProgressBarMaterial::type() const
+{
+    static QSGMaterialType type;
+    return &type;
+}
+
+QSGMaterialShader *QQuickDefaultProgressBarMaterial::createShader() const
+{
+    return new QQuickDefaultProgressBarMaterialShader;
+}
+
+int QQuickDefaultProgressBarMaterial::compare(const QSGMaterial *other) const
+{
+    // Each bar runs its own timer, so materials are never equivalent.
+    if (this == other)
+        return 0;
+    return this < other ? -1 : 1;
+}
+
+void QQuickDefaultProgressBarMaterialShader::updateState(const RenderState &state, QSGMaterial *newMaterial, QSGMaterial *)
+{
+    if (state.isMatrixDirty())
+        program()->setUniformValue(m_matrixId, state.combinedMatrix());
+    if (state.isOpacityDirty())
+        program()->setUniformValue(m_opacityId, state.opacity());
+
+    QQuickDefaultProgressBarMaterial *material = static_cast<QQuickDefaultProgressBarMaterial *>(newMaterial);
+    const QColor &color = material->color;
+    program()->setUniformValue(m_colorId, QVector4D(color.redF() * color.alphaF(), color.greenF() * color.alphaF(),
+                                                    color.blueF() * color.alphaF(), color.alphaF()));
+    program()->setUniformValue(m_widthId, GLfloat(material->width));
+    program()->setUniformValue(m_timeId, GLfloat(material->timer.elapsed() % TotalDuration));
+}
+
+char const *const *QQuickDefaultProgressBarMaterialShader::attributeNames() const
+{
+    static const char *const attributes[] = { "vertex", nullptr };
+    return attributes;
+}
+
+void QQuickDefaultProgressBarMaterialShader::initialize()
+{
+    m_matrixId = program()->uniformLocation("matrix");
+    m_opacityId = program()->uniformLocation("opacity");
+    m_colorId = program()->uniformLocation("color");
+    m_widthId = program()->uniformLocation("width");
+    m_timeId = program()->uniformLocation("time");
+}
+
+const char *QQuickDefaultProgressBarMaterialShader::vertexShader() const
+{
+    static const QByteArray core = QByteArrayLiteral("#version 150 core\n#define attribute in\n#define varying out\n")
+            + indeterminateVertexShader;
+    return isCoreProfile() ? core.constData() : indeterminateVertexShader;
+}
+
+const char *QQuickDefaultProgressBarMaterialShader::fragmentShader() const
+{
+    static const QByteArray core = QByteArrayLiteral("#version 150 core\n#define varying in\n#define gl_FragColor fragColor\nout vec4 fragColor;\n")
+            + indeterminateFragmentShader;
+    return isCoreProfile() ? core.constData() : indeterminateFragmentShader;
+}
+
 class QQuickDefaultProgressBarNode : public QQuickAnimatedNode
 {
 public:
@@ -78,11 +249,14 @@ public:
 
 private:
     bool m_indeterminate = false;
+    bool m_useShader = false;
     qreal m_pixelsPerSecond = 0;
+    QSGGeometryNode *m_shaderNode = nullptr;
 };
 
 QQuickDefaultProgressBarNode::QQuickDefaultProgressBarNode(QQuickDefaultProgressBar *item)
     : QQuickAnimatedNode(item),
+      m_useShader(item->window()->rendererInterface()->graphicsApi() == QSGRendererInterface::OpenGL),
       m_pixelsPerSecond(item->width())
 {
     setLoopCount(Infinite);
@@ -91,6 +265,10 @@ QQuickDefaultProgressBarNode::QQuickDefaultProgressBarNode(QQuickDefaultProgress
 
 void QQuickDefaultProgressBarNode::updateCurrentTime(int time)
 {
+    // The shader animates on its own; the node only keeps the frames coming.
+    if (m_shaderNode)
+        return;
+
     QSGTransformNode *transformNode = static_cast<QSGTransformNode*>(firstChild());
     for (int i = 0; i < Blocks; ++i) {
         Q_ASSERT(transformNode->type() == QSGNode::TransformNodeType);
@@ -160,10 +338,31 @@ void QQuickDefaultProgressBarNode::sync(QQuickItem *item)
     m.translate(0, (item->height() - item->implicitHeight()) / 2);
     setMatrix(m);
 
-    if (m_indeterminate) {
+    if (m_indeterminate && m_useShader) {
+        if (!m_shaderNode) {
+            // This was previously a regular progress bar; remove the old nodes.
+            deleteChildNodes(this);
+
+            QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 4);
+            geometry->setDrawingMode(QSGGeometry::DrawTriangleStrip);
+
+            m_shaderNode = new QSGGeometryNode;
+            m_shaderNode->setGeometry(geometry);
+            m_shaderNode->setFlag(QSGNode::OwnsGeometry);
+            m_shaderNode->setMaterial(new QQuickDefaultProgressBarMaterial);
+            m_shaderNode->setFlag(QSGNode::OwnsMaterial);
+            appendChildNode(m_shaderNode);
+        }
+
+        QQuickDefaultProgressBarMaterial *material = static_cast<QQuickDefaultProgressBarMaterial *>(m_shaderNode->material());
+        material->color = bar->color();
+        material->width = m_pixelsPerSecond;
+        QSGGeometry::updateRectGeometry(m_shaderNode->geometry(), QRectF(0, 0, item->width(), item->implicitHeight()));
+        m_shaderNode->markDirty(QSGNode::DirtyGeometry | QSGNode::DirtyMaterial);
+    } else if (m_indeterminate) {
         if (childCount() != Blocks) {
             // This was previously a regular progress bar; remove the old nodes.
-            removeAllChildNodes();
+            deleteChildNodes(this);
         }
 
         QSGTransformNode *transformNode = static_cast<QSGTransformNode*>(firstChild());
@@ -190,9 +389,10 @@ void QQuickDefaultProgressBarNode::sync(QQuickItem *item)
             transformNode = static_cast<QSGTransformNode *>(transformNode->nextSibling());
         }
     } else {
-        if (childCount() > 1) {
+        if (childCount() > 1 || m_shaderNode) {
             // This was previously an indeterminate progress bar; remove the old nodes.
-            removeAllChildNodes();
+            deleteChildNodes(this);
+            m_shaderNode = nullptr;
         }
 
         QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(firstChild());
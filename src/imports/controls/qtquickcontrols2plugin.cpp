@@ -44,6 +44,9 @@
 #include <QtQuickControls2/private/qquickpaddedrectangle_p.h>
 #include <QtQuickControls2/private/qquickplaceholdertext_p.h>
 #include <QtQuickControls2/private/qquickiconlabel_p.h>
+#include <QtQuickControls2/private/qquickimplicitsize_p.h>
+#include <QtQuickControls2/private/qquickstartuptrace_p.h>
+#include <QtQuickControls2/private/qquickstatecolor_p.h>
 #include <QtQuickControls2/private/qquickstyle_p.h>
 #include <QtQuickControls2/private/qquickstyleplugin_p.h>
 #include <QtQuickControls2/private/qquickstyleselector_p.h>
@@ -56,6 +59,7 @@
 
 #include "qquickdefaultbusyindicator_p.h"
 #include "qquickdefaultdial_p.h"
+#include "qquickdefaultlabel_p.h"
 #include "qquickdefaultprogressbar_p.h"
 #include "qquickdefaultstyle_p.h"
 #include "qquickdefaulttheme_p.h"
@@ -70,6 +74,12 @@ static inline void initResources()
 
 QT_BEGIN_NAMESPACE
 
+static bool isNativeControlsEnabled()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_NATIVE") > 0;
+    return enabled;
+}
+
 class QtQuickControls2Plugin: public QQuickStylePlugin
 {
     Q_OBJECT
@@ -97,6 +107,7 @@ QtQuickControls2Plugin::~QtQuickControls2Plugin()
 
 void QtQuickControls2Plugin::registerTypes(const char *uri)
 {
+    QQuickStartupTrace trace("QtQuickControls2Plugin::registerTypes");
     QQuickStylePrivate::init(typeUrl());
     const QString style = QQuickStyle::name();
     if (!style.isEmpty())
@@ -106,6 +117,7 @@ void QtQuickControls2Plugin::registerTypes(const char *uri)
     selector.setBaseUrl(typeUrl());
 
     qmlRegisterModule(uri, 2, QT_VERSION_MINOR - 7); // Qt 5.7->2.0, 5.8->2.1, 5.9->2.2...
+    qmlRegisterModule(uri, 2, 5); // the revisions of QtQuick.Templates 2.5
 
     // QtQuick.Controls 2.0 (originally introduced in Qt 5.7)
     qmlRegisterType(selector.select(QStringLiteral("AbstractButton.qml")), uri, 2, 0, "AbstractButton");
@@ -123,7 +135,17 @@ void QtQuickControls2Plugin::registerTypes(const char *uri)
     qmlRegisterType(selector.select(QStringLiteral("Frame.qml")), uri, 2, 0, "Frame");
     qmlRegisterType(selector.select(QStringLiteral("GroupBox.qml")), uri, 2, 0, "GroupBox");
     qmlRegisterType(selector.select(QStringLiteral("ItemDelegate.qml")), uri, 2, 0, "ItemDelegate");
-    qmlRegisterType(selector.select(QStringLiteral("Label.qml")), uri, 2, 0, "Label");
+    const QUrl labelUrl(selector.select(QStringLiteral("Label.qml")));
+    if (isNativeControlsEnabled() && labelUrl.adjusted(QUrl::NormalizePathSegments) == typeUrl(QStringLiteral("Label.qml")).adjusted(QUrl::NormalizePathSegments)) {
+        // the same revisions as T.Label in QtQuick.Templates
+        qmlRegisterType<QQuickDefaultLabel>(uri, 2, 0, "Label");
+        qmlRegisterType<QQuickDefaultLabel, 3>(uri, 2, 3, "Label");
+        qmlRegisterRevision<QQuickText, 6>(uri, 2, 0);
+        qmlRegisterRevision<QQuickText, 9>(uri, 2, 2);
+        qmlRegisterRevision<QQuickText, 10>(uri, 2, 3);
+    } else {
+        qmlRegisterType(labelUrl, uri, 2, 0, "Label");
+    }
     qmlRegisterType(selector.select(QStringLiteral("Menu.qml")), uri, 2, 0, "Menu");
     qmlRegisterType(selector.select(QStringLiteral("MenuItem.qml")), uri, 2, 0, "MenuItem");
     qmlRegisterType(selector.select(QStringLiteral("Page.qml")), uri, 2, 0, "Page");
@@ -174,6 +196,7 @@ void QtQuickControls2Plugin::registerTypes(const char *uri)
 
     const QByteArray import = QByteArray(uri) + ".impl";
     qmlRegisterModule(import, 2, QT_VERSION_MINOR - 7); // Qt 5.7->2.0, 5.8->2.1, 5.9->2.2...
+    qmlRegisterModule(import, 2, 5);
 
     // QtQuick.Controls.impl 2.0 (Qt 5.7)
     qmlRegisterType<QQuickDefaultBusyIndicator>(import, 2, 0, "BusyIndicatorImpl");
@@ -208,6 +231,10 @@ void QtQuickControls2Plugin::registerTypes(const char *uri)
     qmlRegisterType<QQuickCheckLabel>(import, 2, 3, "CheckLabel");
     qmlRegisterType<QQuickMnemonicLabel>(import, 2, 3, "MnemonicLabel");
     qmlRegisterRevision<QQuickText, 6>(import, 2, 3);
+
+    // QtQuick.Controls.impl 2.5 (Qt 5.12)
+    qmlRegisterType<QQuickStateColor>(import, 2, 5, "StateColor");
+    qmlRegisterUncreatableType<QQuickImplicitSize>(import, 2, 5, "ImplicitSize", QStringLiteral("ImplicitSize is only available as an attached property."));
 }
 
 QString QtQuickControls2Plugin::name() const
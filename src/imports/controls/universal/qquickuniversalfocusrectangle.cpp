@@ -36,49 +36,186 @@
 
 #include "qquickuniversalfocusrectangle_p.h"
 
-#include <QtGui/qpixmap.h>
+#include <QtCore/qvector.h>
+#include <QtGui/qimage.h>
 #include <QtGui/qpainter.h>
-#include <QtGui/qpixmapcache.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuick/qsggeometry.h>
+#include <QtQuick/qsgimagenode.h>
+#include <QtQuick/qsgnode.h>
+#include <QtQuick/qsgrendererinterface.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
 #include <QtQuick/private/qquickitem_p.h>
 
 QT_BEGIN_NAMESPACE
 
+/*
+    A one pixel white frame with a black 2-on-1-off dash pattern on top,
+    built from pixel aligned quads in a single vertex color geometry node.
+    Unlike a painted item, this needs no rasterization or texture upload
+    when the focus moves to an item of a different size, and the frames of
+    different items can be batched.
+
+    The vertex color material is only available with OpenGL. With the other
+    graphics APIs, such as the software backend, the frame is painted into
+    an image instead.
+*/
+
+static const int DashLength = 2;
+static const int DashPeriod = 3;
+
+template <typename Index>
+static void addQuad(QSGGeometry::ColoredPoint2D *&vertex, Index *&index, int &first, const QRect &rect, uchar value)
+{
+    vertex[0].set(rect.left(), rect.top(), value, value, value, 255);
+    vertex[1].set(rect.right() + 1, rect.top(), value, value, value, 255);
+    vertex[2].set(rect.left(), rect.bottom() + 1, value, value, value, 255);
+    vertex[3].set(rect.right() + 1, rect.bottom() + 1, value, value, value, 255);
+    vertex += 4;
+
+    index[0] = first;
+    index[1] = first + 1;
+    index[2] = first + 2;
+    index[3] = first + 2;
+    index[4] = first + 1;
+    index[5] = first + 3;
+    index += 6;
+
+    first += 4;
+}
+
+template <typename Index>
+static void addQuads(QSGGeometry *geometry, int w, int h, const QVector<QRect> &dashes)
+{
+    QSGGeometry::ColoredPoint2D *vertex = geometry->vertexDataAsColoredPoint2D();
+    Index *index = static_cast<Index *>(geometry->indexData());
+    int first = 0;
+
+    // the white frame
+    addQuad(vertex, index, first, QRect(0, 0, w, 1), 255);
+    addQuad(vertex, index, first, QRect(0, h - 1, w, 1), 255);
+    addQuad(vertex, index, first, QRect(0, 1, 1, h - 2), 255);
+    addQuad(vertex, index, first, QRect(w - 1, 1, 1, h - 2), 255);
+
+    for (const QRect &dash : dashes)
+        addQuad(vertex, index, first, dash, 0);
+}
+
+static QImage paintFrame(int w, int h)
+{
+    QImage image(w, h, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    QPen pen;
+    pen.setWidth(1);
+    pen.setColor(Qt::white);
+    painter.setPen(pen);
+    painter.drawRect(0, 0, w - 1, h - 1);
+
+    pen.setColor(Qt::black);
+    pen.setDashPattern(QVector<qreal>() << DashLength << DashPeriod - DashLength);
+    painter.setPen(pen);
+    painter.drawRect(0, 0, w - 1, h - 1);
+    return image;
+}
+
+QSGNode *QQuickUniversalFocusRectangle::updateImageNode(QSGNode *oldNode, int w, int h)
+{
+    QSGImageNode *node = static_cast<QSGImageNode *>(oldNode);
+    if (!node)
+        node = window()->createImageNode();
+
+    node->setTexture(window()->createTextureFromImage(paintFrame(w, h)));
+    node->setOwnsTexture(true);
+    node->setRect(0, 0, w, h);
+    return node;
+}
+
 QQuickUniversalFocusRectangle::QQuickUniversalFocusRectangle(QQuickItem *parent)
-    : QQuickPaintedItem(parent)
+    : QQuickItem(parent)
 {
+    setFlag(ItemHasContents);
     QQuickItemPrivate::get(this)->setTransparentForPositioner(true);
 }
 
-void QQuickUniversalFocusRectangle::paint(QPainter *painter)
+void QQuickUniversalFocusRectangle::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
-    if (!isVisible() || width() <= 0 || height() <= 0)
-        return;
-
-    QRect bounds = boundingRect().toAlignedRect();
-    const int boundsWidth = bounds.width();
-    const int boundsHeight = bounds.width();
-    const QString key = QStringLiteral("qquickuniversalfocusrectangle_%1_%2").arg(QString::number(boundsWidth), QString::number(boundsHeight));
-
-    QPixmap pixmap(boundsWidth, boundsHeight);
-    if (!QPixmapCache::find(key, &pixmap)) {
-        bounds.adjust(0, 0, -1, -1);
-        pixmap.fill(Qt::transparent);
-        QPainter p(&pixmap);
-
-        QPen pen;
-        pen.setWidth(1);
-        pen.setColor(Qt::white);
-        p.setPen(pen);
-        p.drawRect(bounds);
-
-        pen.setColor(Qt::black);
-        pen.setDashPattern(QVector<qreal>(2, 1));
-        p.setPen(pen);
-        p.drawRect(bounds);
-
-        QPixmapCache::insert(key, pixmap);
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        update();
+}
+
+QSGNode *QQuickUniversalFocusRectangle::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    const QRect bounds = boundingRect().toAlignedRect();
+    const int w = bounds.width();
+    const int h = bounds.height();
+    if (w < 2 || h < 2) {
+        delete oldNode;
+        return nullptr;
     }
-    painter->drawPixmap(0, 0, pixmap);
+
+    if (window()->rendererInterface()->graphicsApi() != QSGRendererInterface::OpenGL)
+        return updateImageNode(oldNode, w, h);
+
+    QSGGeometryNode *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode;
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    // The sides in clockwise order, starting from the top-left corner, as
+    // QPainter walks the outline of a rectangle when dashing it.
+    struct Side {
+        QPoint start;
+        QPoint step;
+        int length;
+    };
+    const Side sides[4] = {
+        { QPoint(0, 0), QPoint(1, 0), w - 1 },
+        { QPoint(w - 1, 0), QPoint(0, 1), h - 1 },
+        { QPoint(w - 1, h - 1), QPoint(-1, 0), w - 1 },
+        { QPoint(0, h - 1), QPoint(0, -1), h - 1 }
+    };
+
+    // the black dashes, split at the corners
+    QVector<QRect> dashes;
+    int offset = 0;
+    for (const Side &side : sides) {
+        int pos = 0;
+        while (pos < side.length) {
+            const int phase = (offset + pos) % DashPeriod;
+            const int run = qMin(side.length - pos, phase < DashLength ? DashLength - phase : DashPeriod - phase);
+            if (phase < DashLength) {
+                const QPoint a = side.start + side.step * pos;
+                const QPoint b = side.start + side.step * (pos + run - 1);
+                dashes += QRect(QPoint(qMin(a.x(), b.x()), qMin(a.y(), b.y())), QPoint(qMax(a.x(), b.x()), qMax(a.y(), b.y())));
+            }
+            pos += run;
+        }
+        offset += side.length;
+    }
+
+    // very large frames need more vertices than 16-bit indices can address
+    const int quads = 4 + dashes.count();
+    const int indexType = 4 * quads > 0xffff ? QSGGeometry::UnsignedIntType : QSGGeometry::UnsignedShortType;
+    QSGGeometry *geometry = node->geometry();
+    if (!geometry || geometry->indexType() != indexType) {
+        geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0, 0, indexType);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+    }
+    geometry->allocate(4 * quads, 6 * quads);
+    if (indexType == QSGGeometry::UnsignedIntType)
+        addQuads<quint32>(geometry, w, h, dashes);
+    else
+        addQuads<quint16>(geometry, w, h, dashes);
+
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
 }
 
 QT_END_NAMESPACE
@@ -48,18 +48,23 @@
 // We mean it.
 //
 
-#include <QtQuick/qquickpainteditem.h>
+#include <QtQuick/qquickitem.h>
 
 QT_BEGIN_NAMESPACE
 
-class QQuickUniversalFocusRectangle : public QQuickPaintedItem
+class QQuickUniversalFocusRectangle : public QQuickItem
 {
     Q_OBJECT
 
 public:
     QQuickUniversalFocusRectangle(QQuickItem *parent = nullptr);
 
-    void paint(QPainter *painter) override;
+protected:
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override;
+
+private:
+    QSGNode *updateImageNode(QSGNode *oldNode, int w, int h);
 };
 
 QT_END_NAMESPACE
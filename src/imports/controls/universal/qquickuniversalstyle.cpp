@@ -37,6 +37,7 @@
 #include "qquickuniversalstyle_p.h"
 
 #include <QtCore/qdebug.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qsettings.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQuickControls2/private/qquickstyle_p.h>
@@ -199,11 +200,8 @@ void QQuickUniversalStyle::inheritTheme(Theme theme)
 void QQuickUniversalStyle::propagateTheme()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickUniversalStyle *universal = qobject_cast<QQuickUniversalStyle *>(child);
-        if (universal)
-            universal->inheritTheme(m_theme);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickUniversalStyle *>(child)->inheritTheme(m_theme);
 }
 
 void QQuickUniversalStyle::resetTheme()
@@ -249,11 +247,8 @@ void QQuickUniversalStyle::inheritAccent(QRgb accent)
 void QQuickUniversalStyle::propagateAccent()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickUniversalStyle *universal = qobject_cast<QQuickUniversalStyle *>(child);
-        if (universal)
-            universal->inheritAccent(m_accent);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickUniversalStyle *>(child)->inheritAccent(m_accent);
 }
 
 void QQuickUniversalStyle::resetAccent()
@@ -303,11 +298,8 @@ void QQuickUniversalStyle::inheritForeground(QRgb foreground, bool has)
 void QQuickUniversalStyle::propagateForeground()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickUniversalStyle *universal = qobject_cast<QQuickUniversalStyle *>(child);
-        if (universal)
-            universal->inheritForeground(m_foreground, m_hasForeground);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickUniversalStyle *>(child)->inheritForeground(m_foreground, m_hasForeground);
 }
 
 void QQuickUniversalStyle::resetForeground()
@@ -358,11 +350,8 @@ void QQuickUniversalStyle::inheritBackground(QRgb background, bool has)
 void QQuickUniversalStyle::propagateBackground()
 {
     const auto styles = attachedChildren();
-    for (QQuickAttachedObject *child : styles) {
-        QQuickUniversalStyle *universal = qobject_cast<QQuickUniversalStyle *>(child);
-        if (universal)
-            universal->inheritBackground(m_background, m_hasBackground);
-    }
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickUniversalStyle *>(child)->inheritBackground(m_background, m_hasBackground);
 }
 
 void QQuickUniversalStyle::resetBackground()
@@ -510,12 +499,48 @@ void QQuickUniversalStyle::attachedParentChange(QQuickAttachedObject *newParent,
 {
     Q_UNUSED(oldParent);
     QQuickUniversalStyle *universal = qobject_cast<QQuickUniversalStyle *>(newParent);
-    if (universal) {
-        inheritTheme(universal->theme());
-        inheritAccent(universal->m_accent);
-        inheritForeground(universal->m_foreground, universal->m_hasForeground);
-        inheritBackground(universal->m_background, universal->m_hasBackground);
+    if (universal)
+        inheritStyle(universal);
+}
+
+// Inherits all values of a new attached parent at once, so that the attached
+// subtree is walked only once and each signal is emitted at most once.
+void QQuickUniversalStyle::inheritStyle(const QQuickUniversalStyle *style)
+{
+    const bool themeChange = !m_explicitTheme && m_theme != style->m_theme;
+    const bool accentChange = !m_explicitAccent && m_accent != style->m_accent;
+    const bool foregroundChange = !m_explicitForeground && m_foreground != style->m_foreground;
+    const bool backgroundChange = !m_explicitBackground && m_background != style->m_background;
+    if (!themeChange && !accentChange && !foregroundChange && !backgroundChange)
+        return;
+
+    if (themeChange)
+        m_theme = style->m_theme;
+    if (accentChange)
+        m_accent = style->m_accent;
+    if (foregroundChange) {
+        m_hasForeground = style->m_hasForeground;
+        m_foreground = style->m_foreground;
     }
+    if (backgroundChange) {
+        m_hasBackground = style->m_hasBackground;
+        m_background = style->m_background;
+    }
+
+    const auto styles = attachedChildren();
+    for (QQuickAttachedObject *child : styles)
+        static_cast<QQuickUniversalStyle *>(child)->inheritStyle(this);
+
+    if (themeChange) {
+        emit themeChanged();
+        emit paletteChanged();
+    }
+    if (accentChange)
+        emit accentChanged();
+    if (themeChange || foregroundChange)
+        emit foregroundChanged();
+    if (themeChange || backgroundChange)
+        emit backgroundChanged();
 }
 
 template <typename Enum>
@@ -590,6 +615,13 @@ void QQuickUniversalStyle::initGlobals()
     }
 }
 
+// Colors are often assigned from the same few strings over and over again,
+// for example in delegates, so the result of resolving a color name or
+// parsing a color string is cached. The cache is reset once it is full.
+typedef QHash<QString, QRgb> QQuickUniversalParsedColorCache;
+Q_GLOBAL_STATIC(QQuickUniversalParsedColorCache, parsedColors)
+static const int MaxParsedColors = 64;
+
 bool QQuickUniversalStyle::variantToRgba(const QVariant &var, const char *name, QRgb *rgba) const
 {
     if (var.type() == QVariant::Int) {
@@ -599,18 +631,32 @@ bool QQuickUniversalStyle::variantToRgba(const QVariant &var, const char *name,
             return false;
         }
         *rgba = qquickuniversal_accent_color(static_cast<Color>(val));
+    } else if (var.type() == QVariant::Color && var.value<QColor>().isValid()) {
+        *rgba = var.value<QColor>().rgba();
     } else {
-        int val = QMetaEnum::fromType<Color>().keyToValue(var.toByteArray());
+        const QString str = var.toString();
+        QQuickUniversalParsedColorCache *cache = parsedColors();
+        const auto it = cache->constFind(str);
+        if (it != cache->constEnd()) {
+            *rgba = it.value();
+            return true;
+        }
+
+        int val = QMetaEnum::fromType<Color>().keyToValue(str.toUtf8());
         if (val != -1) {
             *rgba = qquickuniversal_accent_color(static_cast<Color>(val));
         } else {
-            QColor color(var.toString());
+            QColor color(str);
             if (!color.isValid()) {
-                qmlWarning(parent()) << "unknown Universal." << name << " value: " << var.toString();
+                qmlWarning(parent()) << "unknown Universal." << name << " value: " << str;
                 return false;
             }
             *rgba = color.rgba();
         }
+
+        if (cache->size() >= MaxParsedColors)
+            cache->clear();
+        cache->insert(str, *rgba);
     }
     return true;
 }
@@ -213,6 +213,7 @@ protected:
     void attachedParentChange(QQuickAttachedObject *newParent, QQuickAttachedObject *oldParent) override;
 
 private:
+    void inheritStyle(const QQuickUniversalStyle *style);
     bool variantToRgba(const QVariant &var, const char *name, QRgb *rgba) const;
 
     // These reflect whether a color value was explicitly set on the specific
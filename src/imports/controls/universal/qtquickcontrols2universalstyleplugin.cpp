@@ -34,6 +34,7 @@
 **
 ****************************************************************************/
 
+#include <QtQuickControls2/private/qquickstartuptrace_p.h>
 #include <QtQuickControls2/private/qquickstyleplugin_p.h>
 
 #include "qquickuniversalbusyindicator_p.h"
@@ -74,6 +75,7 @@ QtQuickControls2UniversalStylePlugin::QtQuickControls2UniversalStylePlugin(QObje
 
 void QtQuickControls2UniversalStylePlugin::registerTypes(const char *uri)
 {
+    QQuickStartupTrace trace("QtQuickControls2UniversalStylePlugin::registerTypes");
     qmlRegisterModule(uri, 2, QT_VERSION_MINOR - 7); // Qt 5.7->2.0, 5.8->2.1, 5.9->2.2...
     qmlRegisterUncreatableType<QQuickUniversalStyle>(uri, 2, 0, "Universal", tr("Universal is an attached property"));
 
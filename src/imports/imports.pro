@@ -10,3 +10,5 @@ SUBDIRS += \
     controls/imagine/imagine.pro \
     controls/material/material.pro \
     controls/universal/universal.pro
+
+qtHaveModule(widgets):!static: SUBDIRS += platform/widgets/widgets.pro
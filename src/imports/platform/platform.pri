@@ -11,7 +11,9 @@ HEADERS += \
     $$PWD/qquickplatformmenuitemgroup_p.h \
     $$PWD/qquickplatformmenuseparator_p.h \
     $$PWD/qquickplatformmessagedialog_p.h \
-    $$PWD/qquickplatformstandardpaths_p.h
+    $$PWD/qquickplatformstandardpaths_p.h \
+    $$PWD/widgets/qwidgetplatform_p.h \
+    $$PWD/widgets/qwidgetplatforminterface_p.h
 
 SOURCES += \
     $$PWD/qquickplatformcolordialog.cpp \
@@ -26,7 +28,8 @@ SOURCES += \
     $$PWD/qquickplatformmenuitemgroup.cpp \
     $$PWD/qquickplatformmenuseparator.cpp \
     $$PWD/qquickplatformmessagedialog.cpp \
-    $$PWD/qquickplatformstandardpaths.cpp
+    $$PWD/qquickplatformstandardpaths.cpp \
+    $$PWD/widgets/qwidgetplatform.cpp
 
 
 qtConfig(systemtrayicon) {
@@ -35,3 +38,12 @@ qtConfig(systemtrayicon) {
     SOURCES += \
         $$PWD/qquickplatformsystemtrayicon.cpp
 }
+
+# Static plugins are not found through the plugin directory, so static builds
+# link the Qt Widgets fallback into the QML plugin and import it from there.
+static:qtHaveModule(widgets) {
+    DEFINES += QT_LABSPLATFORM_STATIC_WIDGETS
+    SOURCES += \
+        $$PWD/widgets/qwidgetplatformplugin.cpp
+    include(widgets/widgets.pri)
+}
@@ -16,7 +16,6 @@ SOURCES += \
     $$PWD/qtlabsplatformplugin.cpp
 
 include(platform.pri)
-qtHaveModule(widgets): include(widgets/widgets.pri)
 
 CONFIG += no_cxx_module
 load(qml_plugin)
@@ -37,6 +37,7 @@
 #include "qquickplatformdialog_p.h"
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qtimer.h>
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickwindow.h>
@@ -331,6 +332,28 @@ void QQuickPlatformDialog::done(int result)
         emit rejected();
 }
 
+/*!
+    \qmlmethod void Qt.labs.platform::Dialog::preload()
+    \since Qt.labs.platform 1.0 (Qt 5.12)
+
+    Creates the native dialog ahead of time, without showing it, so that the
+    first call to \l open() does not have to wait for it. Creating a native
+    file dialog can take a noticeable amount of time on some platforms.
+
+    The dialog is created from the event loop once the pending events have
+    been processed, so calling this method from \c Component.onCompleted
+    does not delay the startup of the application.
+
+    \sa open()
+*/
+void QQuickPlatformDialog::preload()
+{
+    if (m_handle)
+        return;
+
+    QTimer::singleShot(0, this, [this]() { create(); });
+}
+
 void QQuickPlatformDialog::classBegin()
 {
 }
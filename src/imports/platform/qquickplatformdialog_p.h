@@ -108,6 +108,7 @@ public Q_SLOTS:
     virtual void accept();
     virtual void reject();
     virtual void done(int result);
+    void preload();
 
 Q_SIGNALS:
     void accepted();
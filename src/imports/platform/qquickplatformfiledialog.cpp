@@ -544,22 +544,30 @@ void QQuickPlatformFileDialog::accept()
     QQuickPlatformDialog::accept();
 }
 
-QUrl QQuickPlatformFileDialog::addDefaultSuffix(const QUrl &file) const
+static QUrl addSuffix(const QUrl &file, const QString &suffix)
 {
     QUrl url = file;
     const QString path = url.path();
-    const QString suffix = m_options->defaultSuffix();
     if (!suffix.isEmpty() && !path.endsWith(QLatin1Char('/')) && path.lastIndexOf(QLatin1Char('.')) == -1)
         url.setPath(path + QLatin1Char('.') + suffix);
     return url;
 }
 
+QUrl QQuickPlatformFileDialog::addDefaultSuffix(const QUrl &file) const
+{
+    return addSuffix(file, m_options->defaultSuffix());
+}
+
 QList<QUrl> QQuickPlatformFileDialog::addDefaultSuffixes(const QList<QUrl> &files) const
 {
+    const QString suffix = m_options->defaultSuffix();
+    if (suffix.isEmpty())
+        return files;
+
     QList<QUrl> urls;
     urls.reserve(files.size());
     for (const QUrl &file : files)
-        urls += addDefaultSuffix(file);
+        urls += addSuffix(file, suffix);
     return urls;
 }
 
@@ -636,8 +644,12 @@ void QQuickPlatformFileNameFilter::update(const QString &filter)
     const QStringList oldExtensions = m_extensions;
 
     m_index = filters.indexOf(filter);
-    m_name = extractName(filter);
-    m_extensions = extractExtensions(filter);
+    if (m_filter != filter) {
+        m_filter = filter;
+        m_name = extractName(filter);
+        m_extensions = extractExtensions(filter);
+        compile();
+    }
 
     if (oldIndex != m_index)
         emit indexChanged(m_index);
@@ -647,6 +659,57 @@ void QQuickPlatformFileNameFilter::update(const QString &filter)
         emit extensionsChanged(m_extensions);
 }
 
+/*
+    Returns whether \a fileName matches the extensions of the selected
+    filter. Plain extensions are compared without allocating.
+*/
+bool QQuickPlatformFileNameFilter::matches(const QString &fileName) const
+{
+    if (m_matchesAll)
+        return true;
+
+    for (const QString &suffix : m_suffixes) {
+        if (fileName.endsWith(suffix, Qt::CaseInsensitive))
+            return true;
+    }
+    for (const QRegExp &wildcard : m_wildcards) {
+        if (wildcard.exactMatch(fileName))
+            return true;
+    }
+    return false;
+}
+
+static bool isWildcard(const QString &pattern)
+{
+    for (const QChar &c : pattern) {
+        if (c == QLatin1Char('*') || c == QLatin1Char('?') || c == QLatin1Char('['))
+            return true;
+    }
+    return false;
+}
+
+void QQuickPlatformFileNameFilter::compile()
+{
+    m_suffixes.clear();
+    m_wildcards.clear();
+    m_matchesAll = m_extensions.isEmpty();
+
+    for (const QString &extension : qAsConst(m_extensions)) {
+        if (extension == QLatin1String("*") || extension.isEmpty()) {
+            m_matchesAll = true;
+        } else if (isWildcard(extension)) {
+            m_wildcards += QRegExp(QLatin1String("*.") + extension, Qt::CaseInsensitive, QRegExp::Wildcard);
+        } else {
+            m_suffixes += QLatin1Char('.') + extension;
+        }
+    }
+
+    if (m_matchesAll) {
+        m_suffixes.clear();
+        m_wildcards.clear();
+    }
+}
+
 QStringList QQuickPlatformFileNameFilter::nameFilters() const
 {
     return m_options ? m_options->nameFilters() : QStringList();
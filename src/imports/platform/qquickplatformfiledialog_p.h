@@ -49,7 +49,9 @@
 //
 
 #include "qquickplatformdialog_p.h"
+#include <QtCore/qregexp.h>
 #include <QtCore/qurl.h>
+#include <QtCore/qvector.h>
 #include <QtQml/qqml.h>
 
 QT_BEGIN_NAMESPACE
@@ -172,6 +174,8 @@ public:
     QSharedPointer<QFileDialogOptions> options() const;
     void setOptions(const QSharedPointer<QFileDialogOptions> &options);
 
+    bool matches(const QString &fileName) const;
+
     void update(const QString &filter);
 
 Q_SIGNALS:
@@ -183,10 +187,19 @@ private:
     QStringList nameFilters() const;
     QString nameFilter(int index) const;
 
+    void compile();
+
     int m_index;
+    QString m_filter;
     QString m_name;
     QStringList m_extensions;
     QSharedPointer<QFileDialogOptions> m_options;
+
+    // the compiled extensions: plain suffixes (".png") are compared as is,
+    // and only the other patterns fall back to wildcard matching
+    bool m_matchesAll = true;
+    QStringList m_suffixes;
+    QVector<QRegExp> m_wildcards;
 };
 
 QT_END_NAMESPACE
@@ -36,6 +36,11 @@
 
 #include "qquickplatformfontdialog_p.h"
 
+#include <QtCore/qatomic.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qthreadpool.h>
+#include <QtGui/qfontdatabase.h>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -178,6 +183,33 @@ void QQuickPlatformFontDialog::setOptions(QFontDialogOptions::FontDialogOptions
     emit optionsChanged();
 }
 
+class QQuickPlatformFontDatabaseLoader : public QRunnable
+{
+public:
+    void run() override
+    {
+        QFontDatabase().families();
+    }
+};
+
+// QFontDatabase populates itself on first use, which can take a long time
+// with thousands of installed fonts. It is thread-safe and keeps the result
+// for the whole process, so the first completed fallback font dialog starts
+// populating it in the background instead of blocking when it is opened.
+static void populateFontDatabase()
+{
+    static QBasicAtomicInt started = Q_BASIC_ATOMIC_INITIALIZER(0);
+    if (started.testAndSetRelaxed(0, 1))
+        QThreadPool::globalInstance()->start(new QQuickPlatformFontDatabaseLoader);
+}
+
+void QQuickPlatformFontDialog::componentComplete()
+{
+    QQuickPlatformDialog::componentComplete();
+    if (!useNativeDialog())
+        populateFontDatabase();
+}
+
 bool QQuickPlatformFontDialog::useNativeDialog() const
 {
     return QQuickPlatformDialog::useNativeDialog()
@@ -80,6 +80,7 @@ Q_SIGNALS:
     void optionsChanged();
 
 protected:
+    void componentComplete() override;
     bool useNativeDialog() const override;
     void onCreate(QPlatformDialogHelper *dialog) override;
     void onShow(QPlatformDialogHelper *dialog) override;
@@ -45,7 +45,8 @@ QT_BEGIN_NAMESPACE
 QQuickPlatformIconLoader::QQuickPlatformIconLoader(int slot, QObject *parent)
     : m_parent(parent),
       m_slot(slot),
-      m_enabled(false)
+      m_enabled(false),
+      m_iconDirty(true)
 {
     Q_ASSERT(slot != -1 && parent);
 }
@@ -64,8 +65,18 @@ void QQuickPlatformIconLoader::setEnabled(bool enabled)
 
 QIcon QQuickPlatformIconLoader::icon() const
 {
+    // the theme lookup and the pixmap conversion are not free, so the icon
+    // is resolved once per loaded source and name, not for every sync
+    if (!m_iconDirty)
+        return m_icon;
+
     QIcon fallback = QPixmap::fromImage(image());
-    return QIcon::fromTheme(m_iconName, fallback);
+    QIcon icon = QIcon::fromTheme(m_iconName, fallback);
+    if (!isLoading()) {
+        m_icon = icon;
+        m_iconDirty = false;
+    }
+    return icon;
 }
 
 QUrl QQuickPlatformIconLoader::iconSource() const
@@ -94,14 +105,18 @@ void QQuickPlatformIconLoader::setIconName(const QString& name)
 
 void QQuickPlatformIconLoader::loadIcon()
 {
+    m_iconDirty = true;
+    m_icon = QIcon();
+
     if (m_iconSource.isEmpty()) {
         clear(m_parent);
     } else {
-        load(qmlEngine(m_parent), m_iconSource);
-        if (m_slot != -1 && isLoading()) {
+        // decode in the pixmap reader thread, so that menus with many icons
+        // can be created right away. The decoded images are shared through
+        // the pixmap cache, and the parent is notified once they are ready.
+        load(qmlEngine(m_parent), m_iconSource, QQuickPixmap::Options(QQuickPixmap::Asynchronous | QQuickPixmap::Cache));
+        if (isLoading())
             connectFinished(m_parent, m_slot);
-            m_slot = -1;
-        }
     }
 
     if (!isLoading())
@@ -290,29 +290,90 @@ void QQuickPlatformMenu::destroy()
 
     delete m_handle;
     m_handle = nullptr;
+
+    // a new handle may be allocated at the same address, so make sure
+    // that everything is pushed to it again on the next sync
+    m_synced.handle = nullptr;
+    for (QQuickPlatformMenuItem *item : qAsConst(m_items))
+        item->m_synced.menu = nullptr;
+    if (m_menuItem)
+        m_menuItem->m_synced.subMenu = nullptr;
 }
 
 void QQuickPlatformMenu::sync()
 {
-    if (!m_complete || !create())
+    if (!syncProperties())
         return;
 
-    m_handle->setText(m_title);
-    m_handle->setEnabled(m_enabled);
-    m_handle->setVisible(m_visible);
-    m_handle->setMinimumWidth(m_minimumWidth);
-    m_handle->setMenuType(m_type);
-    m_handle->setFont(m_font);
+    for (QQuickPlatformMenuItem *item : qAsConst(m_items))
+        item->sync();
+}
 
+bool QQuickPlatformMenu::syncProperties(bool *full)
+{
+    if (!m_complete || !create())
+        return false;
+
+    // Only the properties that changed since the last sync are forwarded.
+    // Everything is pushed again when the menu gets a new platform handle
+    // or is moved to another menu bar or system tray icon.
+    QObject *container = nullptr;
     if (m_menuBar && m_menuBar->handle())
-        m_menuBar->handle()->syncMenu(m_handle);
+        container = m_menuBar->handle();
 #if QT_CONFIG(systemtrayicon)
     else if (m_systemTrayIcon && m_systemTrayIcon->handle())
-        m_systemTrayIcon->handle()->updateMenu(m_handle);
+        container = m_systemTrayIcon->handle();
 #endif
 
-    for (QQuickPlatformMenuItem *item : qAsConst(m_items))
-        item->sync();
+    const bool pushAll = m_synced.handle != m_handle || m_synced.container != container;
+    bool changed = pushAll || m_synced.iconChanged;
+    m_synced.handle = m_handle;
+    m_synced.container = container;
+    m_synced.iconChanged = false;
+
+    if (pushAll || m_synced.title != m_title) {
+        m_handle->setText(m_title);
+        m_synced.title = m_title;
+        changed = true;
+    }
+    if (pushAll || m_synced.enabled != m_enabled) {
+        m_handle->setEnabled(m_enabled);
+        m_synced.enabled = m_enabled;
+        changed = true;
+    }
+    if (pushAll || m_synced.visible != m_visible) {
+        m_handle->setVisible(m_visible);
+        m_synced.visible = m_visible;
+        changed = true;
+    }
+    if (pushAll || m_synced.minimumWidth != m_minimumWidth) {
+        m_handle->setMinimumWidth(m_minimumWidth);
+        m_synced.minimumWidth = m_minimumWidth;
+        changed = true;
+    }
+    if (pushAll || m_synced.type != m_type) {
+        m_handle->setMenuType(m_type);
+        m_synced.type = m_type;
+        changed = true;
+    }
+    if (pushAll || m_synced.font != m_font) {
+        m_handle->setFont(m_font);
+        m_synced.font = m_font;
+        changed = true;
+    }
+
+    if (changed) {
+        if (m_menuBar && m_menuBar->handle())
+            m_menuBar->handle()->syncMenu(m_handle);
+#if QT_CONFIG(systemtrayicon)
+        else if (m_systemTrayIcon && m_systemTrayIcon->handle())
+            m_systemTrayIcon->handle()->updateMenu(m_handle);
+#endif
+    }
+
+    if (full)
+        *full = pushAll;
+    return true;
 }
 
 /*!
@@ -644,7 +705,18 @@ void QQuickPlatformMenu::insertItem(int index, QQuickPlatformMenuItem *item)
         QQuickPlatformMenuItem *before = m_items.value(index + 1);
         m_handle->insertMenuItem(item->handle(), before ? before->create() : nullptr);
     }
-    sync();
+
+    // The other items are only synced if the menu got a new handle, so that
+    // populating long or dynamic menus does not re-sync every existing item.
+    bool full = false;
+    if (syncProperties(&full)) {
+        if (full) {
+            for (QQuickPlatformMenuItem *other : qAsConst(m_items))
+                other->sync();
+        } else {
+            item->sync();
+        }
+    }
     emit itemsChanged();
 }
 
@@ -662,7 +734,12 @@ void QQuickPlatformMenu::removeItem(QQuickPlatformMenuItem *item)
     if (m_handle)
         m_handle->removeMenuItem(item->handle());
     item->setMenu(nullptr);
-    sync();
+
+    bool full = false;
+    if (syncProperties(&full) && full) {
+        for (QQuickPlatformMenuItem *other : qAsConst(m_items))
+            other->sync();
+    }
     emit itemsChanged();
 }
 
@@ -723,7 +800,7 @@ void QQuickPlatformMenu::clear()
     }
 
     m_items.clear();
-    sync();
+    syncProperties();
     emit itemsChanged();
 }
 
@@ -914,6 +991,7 @@ void QQuickPlatformMenu::updateIcon()
         return;
 
     m_handle->setIcon(m_iconLoader->icon());
+    m_synced.iconChanged = true;
     sync();
 }
 
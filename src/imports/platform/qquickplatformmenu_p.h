@@ -190,6 +190,7 @@ private Q_SLOTS:
 
 private:
     void unparentSubmenus();
+    bool syncProperties(bool *full = nullptr);
 
     bool m_complete;
     bool m_enabled;
@@ -206,6 +207,20 @@ private:
     mutable QQuickPlatformMenuItem *m_menuItem;
     mutable QQuickPlatformIconLoader *m_iconLoader;
     QPlatformMenu *m_handle;
+
+    // the state that was last pushed to the platform menu, used
+    // to forward only the changed properties in sync()
+    struct SyncState {
+        QPlatformMenu *handle = nullptr;
+        QObject *container = nullptr;
+        bool enabled = false;
+        bool visible = false;
+        bool iconChanged = false;
+        int minimumWidth = -1;
+        QPlatformMenu::MenuType type = QPlatformMenu::DefaultMenu;
+        QString title;
+        QFont font;
+    } m_synced;
 };
 
 QT_END_NAMESPACE
@@ -156,17 +156,70 @@ void QQuickPlatformMenuItem::sync()
     if (!m_complete || !create())
         return;
 
-    m_handle->setEnabled(isEnabled());
-    m_handle->setVisible(isVisible());
-    m_handle->setIsSeparator(m_separator);
-    m_handle->setCheckable(m_checkable);
-    m_handle->setChecked(m_checked);
-    m_handle->setRole(m_role);
-    m_handle->setText(m_text);
-    m_handle->setFont(m_font);
-    m_handle->setHasExclusiveGroup(m_group && m_group->isExclusive());
-    if (m_subMenu && m_subMenu->handle())
-        m_handle->setMenu(m_subMenu->handle());
+    // Native calls are expensive on some platforms, so only the properties
+    // that changed since the last sync are forwarded. Everything is pushed
+    // again when the item or its menu gets a new platform handle.
+    QPlatformMenu *menuHandle = m_menu ? m_menu->handle() : nullptr;
+    const bool full = m_synced.handle != m_handle || m_synced.menu != menuHandle;
+    bool changed = full || m_synced.iconChanged;
+    m_synced.handle = m_handle;
+    m_synced.menu = menuHandle;
+    m_synced.iconChanged = false;
+
+    const bool enabled = isEnabled();
+    if (full || m_synced.enabled != enabled) {
+        m_handle->setEnabled(enabled);
+        m_synced.enabled = enabled;
+        changed = true;
+    }
+    const bool visible = isVisible();
+    if (full || m_synced.visible != visible) {
+        m_handle->setVisible(visible);
+        m_synced.visible = visible;
+        changed = true;
+    }
+    if (full || m_synced.separator != m_separator) {
+        m_handle->setIsSeparator(m_separator);
+        m_synced.separator = m_separator;
+        changed = true;
+    }
+    if (full || m_synced.checkable != m_checkable) {
+        m_handle->setCheckable(m_checkable);
+        m_synced.checkable = m_checkable;
+        changed = true;
+    }
+    if (full || m_synced.checked != m_checked) {
+        m_handle->setChecked(m_checked);
+        m_synced.checked = m_checked;
+        changed = true;
+    }
+    if (full || m_synced.role != m_role) {
+        m_handle->setRole(m_role);
+        m_synced.role = m_role;
+        changed = true;
+    }
+    if (full || m_synced.text != m_text) {
+        m_handle->setText(m_text);
+        m_synced.text = m_text;
+        changed = true;
+    }
+    if (full || m_synced.font != m_font) {
+        m_handle->setFont(m_font);
+        m_synced.font = m_font;
+        changed = true;
+    }
+    const bool exclusive = m_group && m_group->isExclusive();
+    if (full || m_synced.exclusive != exclusive) {
+        m_handle->setHasExclusiveGroup(exclusive);
+        m_synced.exclusive = exclusive;
+        changed = true;
+    }
+    QPlatformMenu *subMenuHandle = m_subMenu ? m_subMenu->handle() : nullptr;
+    if (subMenuHandle && (full || m_synced.subMenu != subMenuHandle)) {
+        m_handle->setMenu(subMenuHandle);
+        changed = true;
+    }
+    m_synced.subMenu = subMenuHandle;
 
 #if QT_CONFIG(shortcut)
     QKeySequence sequence;
@@ -174,11 +227,16 @@ void QQuickPlatformMenuItem::sync()
         sequence = QKeySequence(static_cast<QKeySequence::StandardKey>(m_shortcut.toInt()));
     else
         sequence = QKeySequence::fromString(m_shortcut.toString());
-    m_handle->setShortcut(sequence.toString());
+    const QString shortcut = sequence.toString();
+    if (full || m_synced.shortcut != shortcut) {
+        m_handle->setShortcut(shortcut);
+        m_synced.shortcut = shortcut;
+        changed = true;
+    }
 #endif
 
-    if (m_menu && m_menu->handle())
-        m_menu->handle()->syncMenuItem(m_handle);
+    if (changed && menuHandle)
+        menuHandle->syncMenuItem(m_handle);
 }
 
 /*!
@@ -605,6 +663,7 @@ void QQuickPlatformMenuItem::updateIcon()
         return;
 
     m_handle->setIcon(m_iconLoader->icon());
+    m_synced.iconChanged = true;
     sync();
 }
 
@@ -181,6 +181,25 @@ private:
     mutable QQuickPlatformIconLoader *m_iconLoader;
     QPlatformMenuItem *m_handle;
 
+    // the state that was last pushed to the platform menu item, used
+    // to forward only the changed properties in sync()
+    struct SyncState {
+        QPlatformMenuItem *handle = nullptr;
+        QPlatformMenu *menu = nullptr;
+        QPlatformMenu *subMenu = nullptr;
+        bool enabled = false;
+        bool visible = false;
+        bool separator = false;
+        bool checkable = false;
+        bool checked = false;
+        bool exclusive = false;
+        bool iconChanged = false;
+        QPlatformMenuItem::MenuRole role = QPlatformMenuItem::TextHeuristicRole;
+        QString text;
+        QString shortcut;
+        QFont font;
+    } m_synced;
+
     friend class QQuickPlatformMenu;
     friend class QQuickPlatformMenuItemGroup;
 };
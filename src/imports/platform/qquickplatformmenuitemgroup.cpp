@@ -241,10 +241,14 @@ void QQuickPlatformMenuItemGroup::setCheckedItem(QQuickPlatformMenuItem *item)
     if (m_checkedItem == item)
         return;
 
-    if (m_checkedItem)
-        m_checkedItem->setChecked(false);
-
+    // only the previously and the newly checked item change state, so only
+    // those two are synced to the platform. The new item is assigned first so
+    // that unchecking the previous one is not taken for a user unchecking it.
+    QQuickPlatformMenuItem *previous = m_checkedItem;
     m_checkedItem = item;
+    if (previous)
+        previous->setChecked(false);
+
     emit checkedItemChanged();
 
     if (item)
@@ -345,8 +349,15 @@ void QQuickPlatformMenuItemGroup::updateCurrent()
         return;
 
     QQuickPlatformMenuItem *item = qobject_cast<QQuickPlatformMenuItem*>(sender());
-    if (item && item->isChecked())
+    if (!item)
+        return;
+
+    if (item->isChecked()) {
         setCheckedItem(item);
+    } else if (item == m_checkedItem) {
+        m_checkedItem = nullptr;
+        emit checkedItemChanged();
+    }
 }
 
 void QQuickPlatformMenuItemGroup::activateItem()
@@ -75,6 +75,22 @@ static QList<QUrl> toUrlList(const QStringList &paths)
     return urls;
 }
 
+// Bindings that call StandardPaths re-evaluate often, and locating files
+// hits the file system every time. The results are cached per engine, and
+// the ones that depend on the contents of the file system are re-evaluated
+// after a short while so that new and removed files are picked up.
+static const int LookupTimeout = 2000; // ms
+static const int MaxLookups = 64;
+
+static QString lookupKey(char kind, int type, int options, const QString &name, const QStringList &paths = QStringList())
+{
+    QString key(QLatin1Char(kind));
+    key += QString::number(type) + QLatin1Char(':') + QString::number(options) + QLatin1Char(':') + name;
+    for (const QString &path : paths)
+        key += QLatin1Char('\n') + path;
+    return key;
+}
+
 QQuickPlatformStandardPaths::QQuickPlatformStandardPaths(QObject *parent)
     : QObject(parent)
 {
@@ -103,17 +119,33 @@ QString QQuickPlatformStandardPaths::displayName(QStandardPaths::StandardLocatio
 */
 QUrl QQuickPlatformStandardPaths::findExecutable(const QString &executableName, const QStringList &paths)
 {
-    return QUrl::fromLocalFile(QStandardPaths::findExecutable(executableName, paths));
+    const QString key = lookupKey('x', 0, 0, executableName, paths);
+    if (const Lookup *lookup = cachedLookup(key))
+        return lookup->urls.value(0);
+
+    const QUrl url = QUrl::fromLocalFile(QStandardPaths::findExecutable(executableName, paths));
+    storeLookup(key, QList<QUrl>() << url);
+    return url;
 }
 
 /*!
     \qmlmethod url Qt.labs.platform::StandardPaths::locate(StandardLocation type, string fileName, LocateOptions options = LocateFile)
 
+    \note The results of locate(), locateAll() and findExecutable() are cached
+    for a couple of seconds, so a file that was just created or removed may not
+    be reflected right away.
+
     \sa QStandardPaths::locate()
 */
 QUrl QQuickPlatformStandardPaths::locate(QStandardPaths::StandardLocation type, const QString &fileName, QStandardPaths::LocateOptions options)
 {
-    return QUrl::fromLocalFile(QStandardPaths::locate(type, fileName, options));
+    const QString key = lookupKey('l', type, options, fileName);
+    if (const Lookup *lookup = cachedLookup(key))
+        return lookup->urls.value(0);
+
+    const QUrl url = QUrl::fromLocalFile(QStandardPaths::locate(type, fileName, options));
+    storeLookup(key, QList<QUrl>() << url);
+    return url;
 }
 
 /*!
@@ -123,7 +155,13 @@ QUrl QQuickPlatformStandardPaths::locate(QStandardPaths::StandardLocation type,
 */
 QList<QUrl> QQuickPlatformStandardPaths::locateAll(QStandardPaths::StandardLocation type, const QString &fileName, QStandardPaths::LocateOptions options)
 {
-    return toUrlList(QStandardPaths::locateAll(type, fileName, options));
+    const QString key = lookupKey('a', type, options, fileName);
+    if (const Lookup *lookup = cachedLookup(key))
+        return lookup->urls;
+
+    const QList<QUrl> urls = toUrlList(QStandardPaths::locateAll(type, fileName, options));
+    storeLookup(key, urls);
+    return urls;
 }
 
 /*!
@@ -134,6 +172,7 @@ QList<QUrl> QQuickPlatformStandardPaths::locateAll(QStandardPaths::StandardLocat
 void QQuickPlatformStandardPaths::setTestModeEnabled(bool testMode)
 {
     QStandardPaths::setTestModeEnabled(testMode);
+    clearCache();
 }
 
 /*!
@@ -143,7 +182,10 @@ void QQuickPlatformStandardPaths::setTestModeEnabled(bool testMode)
 */
 QList<QUrl> QQuickPlatformStandardPaths::standardLocations(QStandardPaths::StandardLocation type)
 {
-    return toUrlList(QStandardPaths::standardLocations(type));
+    auto it = m_standardLocations.find(type);
+    if (it == m_standardLocations.end())
+        it = m_standardLocations.insert(type, toUrlList(QStandardPaths::standardLocations(type)));
+    return it.value();
 }
 
 /*!
@@ -153,7 +195,45 @@ QList<QUrl> QQuickPlatformStandardPaths::standardLocations(QStandardPaths::Stand
 */
 QUrl QQuickPlatformStandardPaths::writableLocation(QStandardPaths::StandardLocation type)
 {
-    return QUrl::fromLocalFile(QStandardPaths::writableLocation(type));
+    auto it = m_writableLocations.find(type);
+    if (it == m_writableLocations.end())
+        it = m_writableLocations.insert(type, QUrl::fromLocalFile(QStandardPaths::writableLocation(type)));
+    return it.value();
+}
+
+const QQuickPlatformStandardPaths::Lookup *QQuickPlatformStandardPaths::cachedLookup(const QString &key) const
+{
+    auto it = m_lookups.constFind(key);
+    if (it == m_lookups.constEnd() || it->timestamp.hasExpired(LookupTimeout))
+        return nullptr;
+    return &it.value();
+}
+
+void QQuickPlatformStandardPaths::storeLookup(const QString &key, const QList<QUrl> &urls)
+{
+    // every distinct file name gets a key of its own, so drop the expired
+    // results before the cache grows past a handful of entries
+    if (m_lookups.size() >= MaxLookups && !m_lookups.contains(key)) {
+        for (auto it = m_lookups.begin(); it != m_lookups.end(); ) {
+            if (it->timestamp.hasExpired(LookupTimeout))
+                it = m_lookups.erase(it);
+            else
+                ++it;
+        }
+        if (m_lookups.size() >= MaxLookups)
+            m_lookups.clear();
+    }
+
+    Lookup &lookup = m_lookups[key];
+    lookup.urls = urls;
+    lookup.timestamp.start();
+}
+
+void QQuickPlatformStandardPaths::clearCache()
+{
+    m_standardLocations.clear();
+    m_writableLocations.clear();
+    m_lookups.clear();
 }
 
 QT_END_NAMESPACE
@@ -52,6 +52,8 @@
 //
 
 #include <QtCore/qobject.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qstandardpaths.h>
 #include <QtCore/qurl.h>
 #include <QtQml/qqml.h>
@@ -72,15 +74,30 @@ public:
     static QObject *create(QQmlEngine *engine, QJSEngine *scriptEngine);
 
     Q_INVOKABLE static QString displayName(QStandardPaths::StandardLocation type);
-    Q_INVOKABLE static QUrl findExecutable(const QString &executableName, const QStringList &paths = QStringList());
-    Q_INVOKABLE static QUrl locate(QStandardPaths::StandardLocation type, const QString &fileName, QStandardPaths::LocateOptions options = QStandardPaths::LocateFile);
-    Q_INVOKABLE static QList<QUrl> locateAll(QStandardPaths::StandardLocation type, const QString &fileName, QStandardPaths::LocateOptions options = QStandardPaths::LocateFile);
-    Q_INVOKABLE static void setTestModeEnabled(bool testMode);
-    Q_INVOKABLE static QList<QUrl> standardLocations(QStandardPaths::StandardLocation type);
-    Q_INVOKABLE static QUrl writableLocation(QStandardPaths::StandardLocation type);
+    Q_INVOKABLE QUrl findExecutable(const QString &executableName, const QStringList &paths = QStringList());
+    Q_INVOKABLE QUrl locate(QStandardPaths::StandardLocation type, const QString &fileName, QStandardPaths::LocateOptions options = QStandardPaths::LocateFile);
+    Q_INVOKABLE QList<QUrl> locateAll(QStandardPaths::StandardLocation type, const QString &fileName, QStandardPaths::LocateOptions options = QStandardPaths::LocateFile);
+    Q_INVOKABLE void setTestModeEnabled(bool testMode);
+    Q_INVOKABLE QList<QUrl> standardLocations(QStandardPaths::StandardLocation type);
+    Q_INVOKABLE QUrl writableLocation(QStandardPaths::StandardLocation type);
 
 private:
     Q_DISABLE_COPY(QQuickPlatformStandardPaths)
+
+    struct Lookup {
+        QList<QUrl> urls;
+        QElapsedTimer timestamp;
+    };
+
+    const Lookup *cachedLookup(const QString &key) const;
+    void storeLookup(const QString &key, const QList<QUrl> &urls);
+    void clearCache();
+
+    // the locations only change with the test mode, whereas the results of
+    // locate() and findExecutable() depend on the file system and expire
+    QHash<int, QList<QUrl>> m_standardLocations;
+    QHash<int, QUrl> m_writableLocations;
+    QHash<QString, Lookup> m_lookups;
 };
 
 QT_END_NAMESPACE
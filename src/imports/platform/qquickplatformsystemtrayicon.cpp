@@ -39,6 +39,7 @@
 #include "qquickplatformiconloader_p.h"
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qcoreevent.h>
 #include <QtGui/qpa/qplatformtheme.h>
 #include <QtGui/private/qguiapplication_p.h>
 
@@ -304,6 +305,10 @@ void QQuickPlatformSystemTrayIcon::setIconName(const QString& name)
     \qmlproperty string Qt.labs.platform::SystemTrayIcon::tooltip
 
     This property holds the tooltip of the system tray icon.
+
+    \note Changes to the icon and the tooltip are sent to the system tray at most
+    ten times per second. Intermediate values that are replaced within that
+    interval are not shown.
 */
 QString QQuickPlatformSystemTrayIcon::tooltip() const
 {
@@ -315,10 +320,9 @@ void QQuickPlatformSystemTrayIcon::setTooltip(const QString &tooltip)
     if (m_tooltip == tooltip)
         return;
 
-    if (m_handle && m_complete)
-        m_handle->updateToolTip(tooltip);
-
     m_tooltip = tooltip;
+    m_tooltipPending = true;
+    scheduleUpdate();
     emit tooltipChanged();
 }
 
@@ -396,6 +400,9 @@ void QQuickPlatformSystemTrayIcon::init()
     if (m_menu && m_menu->create())
         m_handle->updateMenu(m_menu->handle());
     m_handle->updateToolTip(m_tooltip);
+    m_pushedTooltip = m_tooltip;
+    m_tooltipPending = false;
+    m_iconPushed = false;
     if (m_iconLoader)
         m_iconLoader->setEnabled(true);
 }
@@ -406,6 +413,9 @@ void QQuickPlatformSystemTrayIcon::cleanup()
         m_handle->cleanup();
     if (m_iconLoader)
         m_iconLoader->setEnabled(false);
+    m_updateTimer.stop();
+    m_iconPending = false;
+    m_tooltipPending = false;
 }
 
 void QQuickPlatformSystemTrayIcon::classBegin()
@@ -430,12 +440,73 @@ QQuickPlatformIconLoader *QQuickPlatformSystemTrayIcon::iconLoader() const
     return m_iconLoader;
 }
 
+void QQuickPlatformSystemTrayIcon::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_updateTimer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    m_updateTimer.stop();
+    flushUpdates();
+}
+
 void QQuickPlatformSystemTrayIcon::updateIcon()
 {
     if (!m_handle || !m_iconLoader)
         return;
 
-    m_handle->updateIcon(m_iconLoader->icon());
+    m_iconPending = true;
+    scheduleUpdate();
+}
+
+// The platform tray may have to send each update to another process, for
+// example over D-Bus, so applications that animate the icon or the tooltip
+// are limited to a number of updates per second. The first change is pushed
+// right away, and the changes that follow within the interval are coalesced.
+static const int UpdateInterval = 100; // ms
+
+void QQuickPlatformSystemTrayIcon::scheduleUpdate()
+{
+    if (!m_handle || !m_complete || m_updateTimer.isActive())
+        return;
+
+    const qint64 elapsed = m_lastUpdate.isValid() ? m_lastUpdate.elapsed() : UpdateInterval;
+    if (elapsed >= UpdateInterval)
+        flushUpdates();
+    else
+        m_updateTimer.start(UpdateInterval - elapsed, this);
+}
+
+void QQuickPlatformSystemTrayIcon::flushUpdates()
+{
+    bool pushed = false;
+
+    if (m_iconPending && m_iconLoader) {
+        m_iconPending = false;
+        const QUrl source = m_iconLoader->iconSource();
+        const QString name = m_iconLoader->iconName();
+        if (!m_iconPushed || source != m_pushedIconSource || name != m_pushedIconName) {
+            m_handle->updateIcon(m_iconLoader->icon());
+            pushed = true;
+            // an icon that is still loading is pushed again once it is ready
+            m_iconPushed = !m_iconLoader->isLoading();
+            m_pushedIconSource = source;
+            m_pushedIconName = name;
+        }
+    }
+
+    if (m_tooltipPending) {
+        m_tooltipPending = false;
+        if (m_tooltip != m_pushedTooltip) {
+            m_handle->updateToolTip(m_tooltip);
+            m_pushedTooltip = m_tooltip;
+            pushed = true;
+        }
+    }
+
+    if (pushed)
+        m_lastUpdate.start();
 }
 
 QT_END_NAMESPACE
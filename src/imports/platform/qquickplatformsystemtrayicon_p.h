@@ -48,6 +48,8 @@
 // We mean it.
 //
 
+#include <QtCore/qbasictimer.h>
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/qurl.h>
 #include <QtGui/qpa/qplatformsystemtrayicon.h>
 #include <QtQml/qqmlparserstatus.h>
@@ -120,8 +122,13 @@ protected:
     void classBegin() override;
     void componentComplete() override;
 
+    void timerEvent(QTimerEvent *event) override;
+
     QQuickPlatformIconLoader *iconLoader() const;
 
+    void scheduleUpdate();
+    void flushUpdates();
+
 private Q_SLOTS:
     void updateIcon();
 
@@ -132,6 +139,16 @@ private:
     QQuickPlatformMenu *m_menu;
     mutable QQuickPlatformIconLoader *m_iconLoader;
     QPlatformSystemTrayIcon *m_handle;
+
+    // the icon and tooltip updates that have not been pushed to the handle
+    bool m_iconPending = false;
+    bool m_tooltipPending = false;
+    bool m_iconPushed = false;
+    QUrl m_pushedIconSource;
+    QString m_pushedIconName;
+    QString m_pushedTooltip;
+    QBasicTimer m_updateTimer;
+    QElapsedTimer m_lastUpdate;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwidgetplatform_p.h"
+#include "qwidgetplatforminterface_p.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/private/qfactoryloader_p.h>
+
+#ifdef QT_LABSPLATFORM_STATIC_WIDGETS
+#include <QtCore/qplugin.h>
+
+Q_IMPORT_PLUGIN(QWidgetPlatformPlugin)
+#endif
+
+QT_BEGIN_NAMESPACE
+
+Q_GLOBAL_STATIC_WITH_ARGS(QFactoryLoader, widgetPlatformLoader,
+    (QWidgetPlatformInterface_iid, QLatin1String("/qtlabsplatform")))
+
+static bool isAvailable(const char *type)
+{
+    if (!qApp->inherits("QApplication")) {
+        qCritical("\nERROR: No native %s implementation available."
+                  "\nQt Labs Platform requires Qt Widgets on this setup."
+                  "\nAdd 'QT += widgets' to .pro and create QApplication in main().\n", type);
+        return false;
+    }
+    return true;
+}
+
+static QWidgetPlatformInterface *widgetPlatform()
+{
+    static QWidgetPlatformInterface *platform = []() -> QWidgetPlatformInterface * {
+        QFactoryLoader *loader = widgetPlatformLoader();
+        const int index = loader->indexOf(QStringLiteral("widgets"));
+        QWidgetPlatformInterface *interface = index != -1 ? qobject_cast<QWidgetPlatformInterface *>(loader->instance(index)) : nullptr;
+        if (!interface)
+            qCritical("\nERROR: The Qt Widgets fallback plugin of Qt Labs Platform could not be loaded.\n");
+        return interface;
+    }();
+    return platform;
+}
+
+QPlatformMenu *QWidgetPlatform::createMenu(QObject *parent)
+{
+    static const bool available = isAvailable("Menu");
+    QWidgetPlatformInterface *platform = available ? widgetPlatform() : nullptr;
+    return platform ? platform->createMenu(parent) : nullptr;
+}
+
+QPlatformMenuItem *QWidgetPlatform::createMenuItem(QObject *parent)
+{
+    static const bool available = isAvailable("MenuItem");
+    QWidgetPlatformInterface *platform = available ? widgetPlatform() : nullptr;
+    return platform ? platform->createMenuItem(parent) : nullptr;
+}
+
+QPlatformSystemTrayIcon *QWidgetPlatform::createSystemTrayIcon(QObject *parent)
+{
+    static const bool available = isAvailable("SystemTrayIcon");
+    QWidgetPlatformInterface *platform = available ? widgetPlatform() : nullptr;
+    return platform ? platform->createSystemTrayIcon(parent) : nullptr;
+}
+
+QPlatformDialogHelper *QWidgetPlatform::createDialog(QPlatformTheme::DialogType type, QObject *parent)
+{
+    bool available = false;
+    switch (type) {
+    case QPlatformTheme::ColorDialog: {
+        static const bool colorDialog = isAvailable("ColorDialog");
+        available = colorDialog;
+        break;
+    }
+    case QPlatformTheme::FileDialog: {
+        static const bool fileDialog = isAvailable("FileDialog");
+        available = fileDialog;
+        break;
+    }
+    case QPlatformTheme::FontDialog: {
+        static const bool fontDialog = isAvailable("FontDialog");
+        available = fontDialog;
+        break;
+    }
+    case QPlatformTheme::MessageDialog: {
+        static const bool messageDialog = isAvailable("MessageDialog");
+        available = messageDialog;
+        break;
+    }
+    default:
+        break;
+    }
+
+    QWidgetPlatformInterface *platform = available ? widgetPlatform() : nullptr;
+    return platform ? platform->createDialog(type, parent) : nullptr;
+}
+
+QT_END_NAMESPACE
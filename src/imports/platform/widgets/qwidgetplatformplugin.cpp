@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwidgetplatforminterface_p.h"
+
+#include <QtWidgets/qtwidgetsglobal.h>
+#if QT_CONFIG(colordialog)
+#include "qwidgetplatformcolordialog_p.h"
+#endif
+#if QT_CONFIG(filedialog)
+#include "qwidgetplatformfiledialog_p.h"
+#endif
+#if QT_CONFIG(fontdialog)
+#include "qwidgetplatformfontdialog_p.h"
+#endif
+#if QT_CONFIG(messagebox)
+#include "qwidgetplatformmessagedialog_p.h"
+#endif
+#if QT_CONFIG(menu)
+#include "qwidgetplatformmenu_p.h"
+#include "qwidgetplatformmenuitem_p.h"
+#endif
+#ifndef QT_NO_SYSTEMTRAYICON
+#include "qwidgetplatformsystemtrayicon_p.h"
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QWidgetPlatformPlugin : public QObject, public QWidgetPlatformInterface
+{
+    Q_OBJECT
+    Q_PLUGIN_METADATA(IID QWidgetPlatformInterface_iid FILE "qwidgetplatformplugin.json")
+    Q_INTERFACES(QWidgetPlatformInterface)
+
+public:
+    QPlatformMenu *createMenu(QObject *parent) override;
+    QPlatformMenuItem *createMenuItem(QObject *parent) override;
+    QPlatformSystemTrayIcon *createSystemTrayIcon(QObject *parent) override;
+    QPlatformDialogHelper *createDialog(QPlatformTheme::DialogType type, QObject *parent) override;
+};
+
+QPlatformMenu *QWidgetPlatformPlugin::createMenu(QObject *parent)
+{
+#if QT_CONFIG(menu)
+    return new QWidgetPlatformMenu(parent);
+#else
+    Q_UNUSED(parent);
+    return nullptr;
+#endif
+}
+
+QPlatformMenuItem *QWidgetPlatformPlugin::createMenuItem(QObject *parent)
+{
+#if QT_CONFIG(menu)
+    return new QWidgetPlatformMenuItem(parent);
+#else
+    Q_UNUSED(parent);
+    return nullptr;
+#endif
+}
+
+QPlatformSystemTrayIcon *QWidgetPlatformPlugin::createSystemTrayIcon(QObject *parent)
+{
+#ifndef QT_NO_SYSTEMTRAYICON
+    return new QWidgetPlatformSystemTrayIcon(parent);
+#else
+    Q_UNUSED(parent);
+    return nullptr;
+#endif
+}
+
+QPlatformDialogHelper *QWidgetPlatformPlugin::createDialog(QPlatformTheme::DialogType type, QObject *parent)
+{
+#if !(QT_CONFIG(colordialog) || QT_CONFIG(filedialog) || QT_CONFIG(fontdialog) || QT_CONFIG(messagebox))
+    Q_UNUSED(parent);
+#endif
+    switch (type) {
+#if QT_CONFIG(colordialog)
+    case QPlatformTheme::ColorDialog: return new QWidgetPlatformColorDialog(parent);
+#endif
+#if QT_CONFIG(filedialog)
+    case QPlatformTheme::FileDialog: return new QWidgetPlatformFileDialog(parent);
+#endif
+#if QT_CONFIG(fontdialog)
+    case QPlatformTheme::FontDialog: return new QWidgetPlatformFontDialog(parent);
+#endif
+#if QT_CONFIG(messagebox)
+    case QPlatformTheme::MessageDialog: return new QWidgetPlatformMessageDialog(parent);
+#endif
+    default: break;
+    }
+    return nullptr;
+}
+
+QT_END_NAMESPACE
+
+#include "qwidgetplatformplugin.moc"
@@ -1,9 +1,6 @@
 QT += widgets
 DEPENDPATH += $$PWD
 
-HEADERS += \
-    $$PWD/qwidgetplatform_p.h
-
 qtConfig(systemtrayicon) {
     HEADERS += \
         $$PWD/qwidgetplatformsystemtrayicon_p.h
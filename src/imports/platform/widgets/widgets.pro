@@ -0,0 +1,24 @@
+TARGET = qwidgetplatformplugin
+
+QT += widgets
+QT_PRIVATE += core-private gui-private
+
+DEFINES += QT_NO_CAST_TO_ASCII QT_NO_CAST_FROM_ASCII
+
+OTHER_FILES += \
+    qwidgetplatformplugin.json
+
+HEADERS += \
+    $$PWD/qwidgetplatforminterface_p.h
+
+SOURCES += \
+    $$PWD/qwidgetplatformplugin.cpp
+
+include(widgets.pri)
+
+PLUGIN_TYPE = qtlabsplatform
+# Loaded on demand by the QML plugin, see QWidgetPlatform. Static builds link
+# the sources into the QML plugin instead, see platform.pri.
+PLUGIN_EXTENDS = -
+PLUGIN_CLASS_NAME = QWidgetPlatformPlugin
+load(qt_plugin)
@@ -329,6 +329,14 @@ void QtQuickTemplates2Plugin::registerTypes(const char *uri)
     qmlRegisterType<QQuickScrollBar, 4>(uri, 2, 4, "ScrollBar");
     qmlRegisterType<QQuickScrollIndicator, 4>(uri, 2, 4, "ScrollIndicator");
     qmlRegisterType<QQuickSpinBox, 4>(uri, 2, 4, "SpinBox");
+
+    // QtQuick.Templates 2.5 (new types and revisions in Qt 5.12)
+    qmlRegisterType<QQuickApplicationWindow, 5>(uri, 2, 5, "ApplicationWindow");
+    qmlRegisterType<QQuickContainer, 5>(uri, 2, 5, "Container");
+    qmlRegisterType<QQuickControl, 5>(uri, 2, 5, "Control");
+    qmlRegisterType<QQuickPane, 5>(uri, 2, 5, "Pane");
+    qmlRegisterType<QQuickStackView, 5>(uri, 2, 5, "StackView");
+    qmlRegisterType<QQuickSwipeView, 5>(uri, 2, 5, "SwipeView");
 }
 
 QT_END_NAMESPACE
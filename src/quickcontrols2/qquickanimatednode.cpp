@@ -36,6 +36,9 @@
 
 #include "qquickanimatednode_p.h"
 
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickwindow.h>
 
@@ -43,11 +46,142 @@
 
 QT_BEGIN_NAMESPACE
 
+/*
+    All running animated nodes of a window are advanced by a single driver,
+    which connects to the window only while there is something to animate.
+    Nodes that are not part of the rendered scene (invisible items) or whose
+    subtree is blocked (fully transparent items) are skipped, and the driver
+    stops scheduling frames when none of its nodes was advanced. The render
+    loop does not render obscured windows, which pauses the driver entirely
+    until the window is exposed again.
+
+    The driver runs on the render thread and requests the next frame from
+    there. With the threaded render loop, such a request is a repaint that
+    does not synchronize with the GUI thread, so the animations keep running
+    while the GUI thread is blocked, until the next sync.
+*/
+class QQuickAnimatedNodeDriver : public QObject
+{
+public:
+    static QQuickAnimatedNodeDriver *acquire(QQuickWindow *window);
+    void release();
+
+    void start(QQuickAnimatedNode *node);
+    void stop(QQuickAnimatedNode *node);
+
+private:
+    explicit QQuickAnimatedNodeDriver(QQuickWindow *window);
+
+    void advance();
+    void update();
+
+    bool m_advanced = false;
+    int m_refCount = 0;
+    QQuickWindow *m_window = nullptr;
+    QVector<QQuickAnimatedNode *> m_nodes;
+};
+
+typedef QHash<QQuickWindow *, QQuickAnimatedNodeDriver *> QQuickAnimatedNodeDriverHash;
+Q_GLOBAL_STATIC(QQuickAnimatedNodeDriverHash, animatedNodeDrivers)
+Q_GLOBAL_STATIC(QMutex, animatedNodeDriverMutex)
+
+static bool isRendered(const QSGNode *node)
+{
+    for (; node; node = node->parent()) {
+        if (node->isSubtreeBlocked())
+            return false;
+        if (node->type() == QSGNode::RootNodeType)
+            return true;
+    }
+    return false;
+}
+
+QQuickAnimatedNodeDriver::QQuickAnimatedNodeDriver(QQuickWindow *window)
+    : m_window(window)
+{
+}
+
+QQuickAnimatedNodeDriver *QQuickAnimatedNodeDriver::acquire(QQuickWindow *window)
+{
+    QMutexLocker locker(animatedNodeDriverMutex());
+    QQuickAnimatedNodeDriver *driver = animatedNodeDrivers()->value(window);
+    if (!driver) {
+        driver = new QQuickAnimatedNodeDriver(window);
+        animatedNodeDrivers()->insert(window, driver);
+    }
+    ++driver->m_refCount;
+    return driver;
+}
+
+void QQuickAnimatedNodeDriver::release()
+{
+    QMutexLocker locker(animatedNodeDriverMutex());
+    if (--m_refCount > 0)
+        return;
+
+    animatedNodeDrivers()->remove(m_window);
+    delete this;
+}
+
+void QQuickAnimatedNodeDriver::start(QQuickAnimatedNode *node)
+{
+    if (m_nodes.contains(node))
+        return;
+
+    if (m_nodes.isEmpty()) {
+        connect(m_window, &QQuickWindow::beforeRendering, this, &QQuickAnimatedNodeDriver::advance, Qt::DirectConnection);
+        connect(m_window, &QQuickWindow::frameSwapped, this, &QQuickAnimatedNodeDriver::update, Qt::DirectConnection);
+    }
+    m_nodes += node;
+}
+
+void QQuickAnimatedNodeDriver::stop(QQuickAnimatedNode *node)
+{
+    if (!m_nodes.removeOne(node) || !m_nodes.isEmpty())
+        return;
+
+    m_advanced = false;
+    disconnect(m_window, &QQuickWindow::beforeRendering, this, &QQuickAnimatedNodeDriver::advance);
+    disconnect(m_window, &QQuickWindow::frameSwapped, this, &QQuickAnimatedNodeDriver::update);
+}
+
+void QQuickAnimatedNodeDriver::advance()
+{
+    m_advanced = false;
+
+    const QVector<QQuickAnimatedNode *> nodes = m_nodes;
+    for (QQuickAnimatedNode *node : nodes) {
+        // a node may have been stopped by one that was advanced before it
+        if (!m_nodes.contains(node) || !isRendered(node))
+            continue;
+
+        node->advance();
+        m_advanced = true;
+    }
+
+    // If we're inside a QQuickWidget, this call is necessary to ensure the widget gets updated.
+    if (m_advanced)
+        m_window->update();
+}
+
+void QQuickAnimatedNodeDriver::update()
+{
+    if (m_advanced)
+        m_window->update();
+}
+
 QQuickAnimatedNode::QQuickAnimatedNode(QQuickItem *target)
-    : m_window(target->window())
+    : m_window(target->window()),
+      m_driver(QQuickAnimatedNodeDriver::acquire(m_window))
 {
 }
 
+QQuickAnimatedNode::~QQuickAnimatedNode()
+{
+    m_driver->stop(this);
+    m_driver->release();
+}
+
 bool QQuickAnimatedNode::isRunning() const
 {
     return m_running;
@@ -108,8 +242,7 @@ void QQuickAnimatedNode::start(int duration)
     if (duration > 0)
         m_duration = duration;
 
-    connect(m_window, &QQuickWindow::beforeRendering, this, &QQuickAnimatedNode::advance, Qt::DirectConnection);
-    connect(m_window, &QQuickWindow::frameSwapped, this, &QQuickAnimatedNode::update, Qt::DirectConnection);
+    m_driver->start(this);
 
     // If we're inside a QQuickWidget, this call is necessary to ensure the widget
     // gets updated for the first time.
@@ -130,8 +263,7 @@ void QQuickAnimatedNode::stop()
         return;
 
     m_running = false;
-    disconnect(m_window, &QQuickWindow::beforeRendering, this, &QQuickAnimatedNode::advance);
-    disconnect(m_window, &QQuickWindow::frameSwapped, this, &QQuickAnimatedNode::update);
+    m_driver->stop(this);
     emit stopped();
 }
 
@@ -153,15 +285,6 @@ void QQuickAnimatedNode::advance()
         }
     }
     updateCurrentTime(time);
-
-    // If we're inside a QQuickWidget, this call is necessary to ensure the widget gets updated.
-    m_window->update();
-}
-
-void QQuickAnimatedNode::update()
-{
-    if (m_running)
-        m_window->update();
 }
 
 QT_END_NAMESPACE
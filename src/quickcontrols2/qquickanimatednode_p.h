@@ -56,6 +56,7 @@ QT_BEGIN_NAMESPACE
 
 class QQuickItem;
 class QQuickWindow;
+class QQuickAnimatedNodeDriver;
 
 class Q_QUICKCONTROLS2_PRIVATE_EXPORT QQuickAnimatedNode : public QObject, public QSGTransformNode
 {
@@ -63,6 +64,7 @@ class Q_QUICKCONTROLS2_PRIVATE_EXPORT QQuickAnimatedNode : public QObject, publi
 
 public:
     explicit QQuickAnimatedNode(QQuickItem *target);
+    ~QQuickAnimatedNode();
 
     bool isRunning() const;
 
@@ -93,11 +95,11 @@ Q_SIGNALS:
 protected:
     virtual void updateCurrentTime(int time);
 
-private Q_SLOTS:
+private:
+    friend class QQuickAnimatedNodeDriver;
+
     void advance();
-    void update();
 
-private:
     bool m_running = false;
     int m_duration = 0;
     int m_loopCount = 1;
@@ -105,6 +107,7 @@ private:
     int m_currentLoop = 0;
     QElapsedTimer m_timer;
     QQuickWindow *m_window = nullptr;
+    QQuickAnimatedNodeDriver *m_driver = nullptr;
 };
 
 QT_END_NAMESPACE
@@ -39,44 +39,54 @@
 #include <QtQuick/qquickwindow.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuickTemplates2/private/qquickpopup_p.h>
+#include <QtQuickTemplates2/private/qquicktimingspan_p_p.h>
+#include <QtCore/qscopedvaluerollback.h>
 
 QT_BEGIN_NAMESPACE
 
-static QQuickAttachedObject *attachedObject(const QMetaObject *type, QObject *object, bool create = false)
+Q_LOGGING_CATEGORY(lcAttached, "qt.quick.controls.attached")
+
+// the span of the outermost attached parent change in progress, which counts
+// the attached objects that are reached while the change propagates
+static QQuickTimingSpan *attachedParentSpan = nullptr;
+
+// Resolving the attached properties function of a type is a locked lookup in
+// the QML type registry, so the resolved id is cached by the attached object.
+// Looking up an attached object by id is a plain lookup in the object's data.
+static QQuickAttachedObject *attachedObject(const QMetaObject *type, int *idCache, QObject *object, bool create = false)
 {
     if (!object)
         return nullptr;
-    int idx = -1;
-    return qobject_cast<QQuickAttachedObject *>(qmlAttachedPropertiesObject(&idx, object, type, create));
+    return qobject_cast<QQuickAttachedObject *>(qmlAttachedPropertiesObject(idCache, object, type, create));
 }
 
-static QQuickAttachedObject *findAttachedParent(const QMetaObject *type, QObject *object)
+static QQuickAttachedObject *findAttachedParent(const QMetaObject *type, int *idCache, QObject *object)
 {
     QQuickItem *item = qobject_cast<QQuickItem *>(object);
     if (item) {
         // lookup parent items and popups
         QQuickItem *parent = item->parentItem();
         while (parent) {
-            QQuickAttachedObject *attached = attachedObject(type, parent);
+            QQuickAttachedObject *attached = attachedObject(type, idCache, parent);
             if (attached)
                 return attached;
 
             QQuickPopup *popup = qobject_cast<QQuickPopup *>(parent->parent());
             if (popup)
-                return attachedObject(type, popup);
+                return attachedObject(type, idCache, popup);
 
             parent = parent->parentItem();
         }
 
         // fallback to item's window
-        QQuickAttachedObject *attached = attachedObject(type, item->window());
+        QQuickAttachedObject *attached = attachedObject(type, idCache, item->window());
         if (attached)
             return attached;
     } else {
         // lookup popup's window
         QQuickPopup *popup = qobject_cast<QQuickPopup *>(object);
         if (popup)
-            return attachedObject(type, popup->popupItem()->window());
+            return attachedObject(type, idCache, popup->popupItem()->window());
     }
 
     // lookup parent window
@@ -84,7 +94,7 @@ static QQuickAttachedObject *findAttachedParent(const QMetaObject *type, QObject
     if (window) {
         QQuickWindow *parentWindow = qobject_cast<QQuickWindow *>(window->parent());
         if (parentWindow) {
-            QQuickAttachedObject *attached = attachedObject(type, window);
+            QQuickAttachedObject *attached = attachedObject(type, idCache, window);
             if (attached)
                 return attached;
         }
@@ -92,22 +102,17 @@ static QQuickAttachedObject *findAttachedParent(const QMetaObject *type, QObject
 
     // fallback to engine (global)
     if (object) {
+        // the engine keeps its attached objects like any other object, so
+        // there is no need for a separate registry of the global styles
         QQmlEngine *engine = qmlEngine(object);
-        if (engine) {
-            QByteArray name = QByteArray("_q_") + type->className();
-            QQuickAttachedObject *attached = engine->property(name).value<QQuickAttachedObject *>();
-            if (!attached) {
-                attached = attachedObject(type, engine, true);
-                engine->setProperty(name, QVariant::fromValue(attached));
-            }
-            return attached;
-        }
+        if (engine)
+            return attachedObject(type, idCache, engine, true);
     }
 
     return nullptr;
 }
 
-static QList<QQuickAttachedObject *> findAttachedChildren(const QMetaObject *type, QObject *object)
+static QList<QQuickAttachedObject *> findAttachedChildren(const QMetaObject *type, int *idCache, QObject *object)
 {
     QList<QQuickAttachedObject *> children;
 
@@ -121,7 +126,7 @@ static QList<QQuickAttachedObject *> findAttachedChildren(const QMetaObject *typ
             for (QObject *child : windowChildren) {
                 QQuickWindow *childWindow = qobject_cast<QQuickWindow *>(child);
                 if (childWindow) {
-                    QQuickAttachedObject *attached = attachedObject(type, childWindow);
+                    QQuickAttachedObject *attached = attachedObject(type, idCache, childWindow);
                     if (attached)
                         children += attached;
                 }
@@ -132,11 +137,11 @@ static QList<QQuickAttachedObject *> findAttachedChildren(const QMetaObject *typ
     if (item) {
         const auto childItems = item->childItems();
         for (QQuickItem *child : childItems) {
-            QQuickAttachedObject *attached = attachedObject(type, child);
+            QQuickAttachedObject *attached = attachedObject(type, idCache, child);
             if (attached)
                 children += attached;
             else
-                children += findAttachedChildren(type, child);
+                children += findAttachedChildren(type, idCache, child);
         }
     }
 
@@ -184,6 +189,10 @@ QQuickAttachedObject *QQuickAttachedObject::attachedParent() const
 void QQuickAttachedObject::setAttachedParent(QQuickAttachedObject *parent)
 {
     if (m_attachedParent != parent) {
+        QQuickTimingSpan span(lcAttached, "setAttachedParent", this, !attachedParentSpan);
+        QScopedValueRollback<QQuickTimingSpan *> rollback(attachedParentSpan, attachedParentSpan ? attachedParentSpan : &span);
+        attachedParentSpan->addItems();
+
         QQuickAttachedObject *oldParent = m_attachedParent;
         if (m_attachedParent)
             m_attachedParent->m_attachedChildren.removeOne(this);
@@ -196,11 +205,11 @@ void QQuickAttachedObject::setAttachedParent(QQuickAttachedObject *parent)
 
 void QQuickAttachedObject::init()
 {
-    QQuickAttachedObject *attachedParent = findAttachedParent(metaObject(), parent());
+    QQuickAttachedObject *attachedParent = findAttachedParent(metaObject(), &m_attachedId, parent());
     if (attachedParent)
         setAttachedParent(attachedParent);
 
-    const QList<QQuickAttachedObject *> attachedChildren = findAttachedChildren(metaObject(), parent());
+    const QList<QQuickAttachedObject *> attachedChildren = findAttachedChildren(metaObject(), &m_attachedId, parent());
     for (QQuickAttachedObject *child : attachedChildren)
         child->setAttachedParent(this);
 }
@@ -216,16 +225,16 @@ void QQuickAttachedObject::itemWindowChanged(QQuickWindow *window)
     QQuickAttachedObject *attachedParent = nullptr;
     QQuickItem *item = qobject_cast<QQuickItem *>(sender());
     if (item)
-        attachedParent = findAttachedParent(metaObject(), item);
+        attachedParent = findAttachedParent(metaObject(), &m_attachedId, item);
     if (!attachedParent)
-        attachedParent = attachedObject(metaObject(), window);
+        attachedParent = attachedObject(metaObject(), &m_attachedId, window);
     setAttachedParent(attachedParent);
 }
 
 void QQuickAttachedObject::itemParentChanged(QQuickItem *item, QQuickItem *parent)
 {
     Q_UNUSED(parent);
-    setAttachedParent(findAttachedParent(metaObject(), item));
+    setAttachedParent(findAttachedParent(metaObject(), &m_attachedId, item));
 }
 
 void QQuickAttachedObject::attachTo(QObject *object)
@@ -86,6 +86,7 @@ private:
     void attachTo(QObject *object);
     void detachFrom(QObject *object);
 
+    int m_attachedId = -1;
     QList<QQuickAttachedObject *> m_attachedChildren;
     QPointer<QQuickAttachedObject> m_attachedParent;
 };
@@ -43,6 +43,9 @@ QT_BEGIN_NAMESPACE
 QQuickClippedText::QQuickClippedText(QQuickItem *parent)
     : QQuickText(parent)
 {
+    connect(this, &QQuickText::contentSizeChanged, this, &QQuickClippedText::updateClip);
+    connect(this, &QQuickText::effectiveHorizontalAlignmentChanged, this, &QQuickClippedText::updateClip);
+    connect(this, &QQuickText::verticalAlignmentChanged, this, &QQuickClippedText::updateClip);
 }
 
 qreal QQuickClippedText::clipX() const
@@ -108,9 +111,24 @@ QRectF QQuickClippedText::clipRect() const
     return QRectF(clipX(), clipY(), clipWidth(), clipHeight());
 }
 
+void QQuickClippedText::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickText::geometryChanged(newGeometry, oldGeometry);
+    updateClip();
+}
+
 void QQuickClippedText::markClipDirty()
 {
     QQuickItemPrivate::get(this)->dirty(QQuickItemPrivate::Size);
+    updateClip();
+}
+
+// Only clip when the clip rect actually cuts through the text. A clip
+// node breaks batching, so text that lies entirely within the clip rect
+// is rendered without one.
+void QQuickClippedText::updateClip()
+{
+    setClip(!clipRect().contains(boundingRect()));
 }
 
 QT_END_NAMESPACE
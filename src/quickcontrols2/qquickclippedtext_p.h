@@ -78,8 +78,12 @@ public:
 
     QRectF clipRect() const override;
 
+protected:
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
 private:
     void markClipDirty();
+    void updateClip();
 
     bool m_hasClipWidth = false;
     bool m_hasClipHeight = false;
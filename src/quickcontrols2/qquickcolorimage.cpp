@@ -36,6 +36,9 @@
 
 #include "qquickcolorimage_p.h"
 
+#include <QtCore/qcache.h>
+#include <QtCore/qpair.h>
+#include <QtGui/qpainter.h>
 #include <QtQuick/private/qquickimagebase_p_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -85,18 +88,37 @@ void QQuickColorImage::resetDefaultColor()
     setDefaultColor(Qt::transparent);
 }
 
+// Many items typically tint the same icon, which the pixmap cache loads only
+// once, with the same color. The tinted copies are shared process-wide by the
+// cache key of the untinted image and the color, so that an icon is tinted
+// once and all the items share the same image data.
+QImage QQuickColorImage::tinted(const QImage &image, const QColor &color)
+{
+    typedef QPair<qint64, QRgb> Key;
+    static QCache<Key, QImage> cache(4 * 1024); // in kilobytes
+
+    const Key key(image.cacheKey(), color.rgba());
+    if (const QImage *cached = cache.object(key))
+        return *cached;
+
+    QImage result = image;
+    QPainter painter(&result);
+    painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+    painter.fillRect(result.rect(), color);
+    painter.end();
+
+    cache.insert(key, new QImage(result), qMax(1, int(result.sizeInBytes() / 1024)));
+    return result;
+}
+
 void QQuickColorImage::pixmapChange()
 {
     QQuickImage::pixmapChange();
     if (m_color.alpha() > 0 && m_color != m_defaultColor) {
         QQuickImageBasePrivate *d = static_cast<QQuickImageBasePrivate *>(QQuickItemPrivate::get(this));
-        QImage image = d->pix.image();
-        if (!image.isNull()) {
-            QPainter painter(&image);
-            painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-            painter.fillRect(image.rect(), m_color);
-            d->pix.setImage(image);
-        }
+        const QImage image = d->pix.image();
+        if (!image.isNull())
+            d->pix.setImage(tinted(image, m_color));
     }
 }
 
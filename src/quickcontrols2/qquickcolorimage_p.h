@@ -49,6 +49,7 @@
 //
 
 #include <QtGui/qcolor.h>
+#include <QtGui/qimage.h>
 #include <QtQuick/private/qquickimage_p.h>
 #include <QtQuickControls2/private/qtquickcontrols2global_p.h>
 
@@ -71,6 +72,8 @@ public:
     void setDefaultColor(const QColor &color);
     void resetDefaultColor();
 
+    static QImage tinted(const QImage &image, const QColor &color);
+
 Q_SIGNALS:
     void colorChanged();
     void defaultColorChanged();
@@ -36,12 +36,54 @@
 
 #include "qquickiconimage_p.h"
 #include "qquickiconimage_p_p.h"
+#include "qquickcolorimage_p.h"
 
+#include <QtCore/qhash.h>
 #include <QtCore/qmath.h>
 #include <QtQuick/private/qquickimagebase_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
+static bool isAsyncIconsEnabled()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_ASYNC_ICONS") > 0;
+    return enabled;
+}
+
+// A window that is dragged across screens can report several device pixel
+// ratio changes in a row, so the icon is reloaded once the ratio has settled.
+static const int DevicePixelRatioDelay = 50;
+
+// Looking up a theme icon stats every directory of the theme and its
+// parents, so that the entries are kept for the lifetime of the process and
+// shared between all icon images. The index is dropped when the theme changes.
+struct QQuickIconThemeIndex
+{
+    QString themeName;
+    QHash<QString, QThemeIconInfo> icons;
+};
+
+Q_GLOBAL_STATIC(QQuickIconThemeIndex, iconThemeIndex)
+
+static QThemeIconInfo lookupThemeIcon(const QString &name)
+{
+    QIconLoader *loader = QIconLoader::instance();
+    QQuickIconThemeIndex *index = iconThemeIndex();
+    if (!index)
+        return loader->loadIcon(name);
+
+    const QString themeName = loader->themeName();
+    if (index->themeName != themeName) {
+        index->themeName = themeName;
+        index->icons.clear();
+    }
+
+    auto it = index->icons.find(name);
+    if (it == index->icons.end())
+        it = index->icons.insert(name, loader->loadIcon(name));
+    return it.value();
+}
+
 bool QQuickIconImagePrivate::updateDevicePixelRatio(qreal targetDevicePixelRatio)
 {
     if (isThemeIcon) {
@@ -71,6 +113,8 @@ void QQuickIconImagePrivate::updateIcon()
         size.setHeight(q->height());
 
     const qreal dpr = calculateDevicePixelRatio();
+    loadedDevicePixelRatio = dpr;
+    devicePixelRatioTimer.stop();
     const QIconLoaderEngineEntry *entry = QIconLoaderEngine::entryForSize(icon, size * dpr, qCeil(dpr));
 
     if (entry) {
@@ -118,6 +162,11 @@ QQuickIconImage::QQuickIconImage(QQuickItem *parent)
     : QQuickImage(*(new QQuickIconImagePrivate), parent)
 {
     setFillMode(Pad);
+    // Theme icons resolve to image files, so an asynchronous load decodes and
+    // rasterizes them on the pixmap reader thread, through the shared pixmap
+    // cache that is keyed by the file and the requested size.
+    if (isAsyncIconsEnabled())
+        setAsynchronous(true);
 }
 
 QString QQuickIconImage::name() const
@@ -132,7 +181,7 @@ void QQuickIconImage::setName(const QString &name)
     if (d->icon.iconName == name)
         return;
 
-    d->icon = QIconLoader::instance()->loadIcon(name);
+    d->icon = lookupThemeIcon(name);
     if (isComponentComplete())
         d->updateIcon();
     emit nameChanged();
@@ -187,8 +236,15 @@ void QQuickIconImage::geometryChanged(const QRectF &newGeometry, const QRectF &o
 void QQuickIconImage::itemChange(ItemChange change, const ItemChangeData &value)
 {
     Q_D(QQuickIconImage);
-    if (change == ItemDevicePixelRatioHasChanged)
-        d->updateIcon();
+    if (change == ItemDevicePixelRatioHasChanged) {
+        // Skip the immediate reload of QQuickImageBase; the previously loaded
+        // variants stay in the shared pixmap cache, so returning to a screen
+        // with a known ratio is served from there.
+        if (isComponentComplete())
+            d->devicePixelRatioTimer.start(DevicePixelRatioDelay, this);
+        QQuickItem::itemChange(change, value);
+        return;
+    }
     QQuickImage::itemChange(change, value);
 }
 
@@ -200,14 +256,23 @@ void QQuickIconImage::pixmapChange()
 
     // Don't apply the color if we're recursing (updateFillMode() can cause us to recurse).
     if (!d->updatingFillMode && d->color.alpha() > 0) {
-        QImage image = d->pix.image();
-        if (!image.isNull()) {
-            QPainter painter(&image);
-            painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-            painter.fillRect(image.rect(), d->color);
-            d->pix.setImage(image);
-        }
+        const QImage image = d->pix.image();
+        if (!image.isNull())
+            d->pix.setImage(QQuickColorImage::tinted(image, d->color));
+    }
+}
+
+void QQuickIconImage::timerEvent(QTimerEvent *event)
+{
+    Q_D(QQuickIconImage);
+    if (event->timerId() != d->devicePixelRatioTimer.timerId()) {
+        QQuickImage::timerEvent(event);
+        return;
     }
+
+    d->devicePixelRatioTimer.stop();
+    if (!qFuzzyCompare(d->calculateDevicePixelRatio(), d->loadedDevicePixelRatio))
+        d->updateIcon();
 }
 
 QT_END_NAMESPACE
@@ -81,6 +81,7 @@ protected:
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
     void itemChange(ItemChange change, const ItemChangeData &value) override;
     void pixmapChange() override;
+    void timerEvent(QTimerEvent *event) override;
 
 private:
     Q_DISABLE_COPY(QQuickIconImage)
@@ -51,6 +51,7 @@
 #include <QtQuick/private/qquickimage_p_p.h>
 #include <QtQuickControls2/private/qtquickcontrols2global_p.h>
 #include <QtGui/private/qiconloader_p.h>
+#include <QtCore/qbasictimer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -70,6 +71,8 @@ public:
     bool updatingIcon = false;
     bool isThemeIcon = false;
     bool updatingFillMode = false;
+    qreal loadedDevicePixelRatio = 0;
+    QBasicTimer devicePixelRatioTimer;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickimplicitsize_p.h"
+
+#include <QtQml/qqmlinfo.h>
+#include <QtQuickTemplates2/private/qquickcontrol_p.h>
+#include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// ImplicitSize.enabled lets a style type turn on the native calculation of
+// the default implicit size of a control, instead of binding implicitWidth
+// and implicitHeight to the same Math.max() expressions. Controls that are
+// based directly on the templates keep an implicit size of 0.
+
+QQuickImplicitSize::QQuickImplicitSize(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QQuickImplicitSize *QQuickImplicitSize::qmlAttachedProperties(QObject *object)
+{
+    return new QQuickImplicitSize(object);
+}
+
+bool QQuickImplicitSize::isEnabled() const
+{
+    return m_enabled;
+}
+
+void QQuickImplicitSize::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled)
+        return;
+
+    QQuickControl *control = qobject_cast<QQuickControl *>(parent());
+    if (!control) {
+        qmlWarning(parent()) << "ImplicitSize must be attached to a Control";
+        return;
+    }
+
+    m_enabled = enabled;
+    QQuickControlPrivate::get(control)->setImplicitSizePolicy(enabled);
+}
+
+QT_END_NAMESPACE
@@ -40,8 +40,39 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickItemGroupPrivate : public QQuickImplicitSizeItemPrivate
+{
+    Q_DECLARE_PUBLIC(QQuickItemGroup)
+
+public:
+    qreal getImplicitWidth() const override;
+    qreal getImplicitHeight() const override;
+
+    void ensureImplicitSize() const;
+};
+
+// a pending shrink is carried out when the size is asked for before the polish
+void QQuickItemGroupPrivate::ensureImplicitSize() const
+{
+    Q_Q(const QQuickItemGroup);
+    if (q->m_implicitSizeDirty)
+        const_cast<QQuickItemGroup *>(q)->updateImplicitSize();
+}
+
+qreal QQuickItemGroupPrivate::getImplicitWidth() const
+{
+    ensureImplicitSize();
+    return QQuickImplicitSizeItemPrivate::getImplicitWidth();
+}
+
+qreal QQuickItemGroupPrivate::getImplicitHeight() const
+{
+    ensureImplicitSize();
+    return QQuickImplicitSizeItemPrivate::getImplicitHeight();
+}
+
 QQuickItemGroup::QQuickItemGroup(QQuickItem *parent)
-    : QQuickImplicitSizeItem(*(new QQuickImplicitSizeItemPrivate), parent)
+    : QQuickImplicitSizeItem(*(new QQuickItemGroupPrivate), parent)
 {
 }
 
@@ -62,22 +93,47 @@ void QQuickItemGroup::unwatch(QQuickItem *item)
     QQuickItemPrivate::get(item)->removeItemChangeListener(this, QQuickItemPrivate::ImplicitWidth | QQuickItemPrivate::ImplicitHeight);
 }
 
-QSizeF QQuickItemGroup::calculateImplicitSize() const
+void QQuickItemGroup::updateImplicitSize()
 {
     qreal width = 0;
     qreal height = 0;
+    m_widestChild = nullptr;
+    m_tallestChild = nullptr;
     const auto children = childItems();
     for (QQuickItem *child : children) {
-        width = qMax(width, child->implicitWidth());
-        height = qMax(height, child->implicitHeight());
+        if (!m_widestChild || child->implicitWidth() > width) {
+            width = child->implicitWidth();
+            m_widestChild = child;
+        }
+        if (!m_tallestChild || child->implicitHeight() > height) {
+            height = child->implicitHeight();
+            m_tallestChild = child;
+        }
     }
-    return QSizeF(width, height);
+    m_implicitSizeDirty = false;
+    setImplicitSize(width, height);
 }
 
-void QQuickItemGroup::updateImplicitSize()
+void QQuickItemGroup::scheduleImplicitSize()
+{
+    // several children may shrink at once (a font change, for example),
+    // so the full scan is done only once, when the group is polished. There
+    // is no polish without a window, so the scan is done right away instead.
+    if (m_implicitSizeDirty)
+        return;
+    if (!window()) {
+        updateImplicitSize();
+        return;
+    }
+    m_implicitSizeDirty = true;
+    polish();
+}
+
+void QQuickItemGroup::updatePolish()
 {
-    QSizeF size = calculateImplicitSize();
-    setImplicitSize(size.width(), size.height());
+    QQuickImplicitSizeItem::updatePolish();
+    if (m_implicitSizeDirty)
+        updateImplicitSize();
 }
 
 void QQuickItemGroup::itemChange(ItemChange change, const ItemChangeData &data)
@@ -87,11 +143,18 @@ void QQuickItemGroup::itemChange(ItemChange change, const ItemChangeData &data)
     case ItemChildAddedChange:
         watch(data.item);
         data.item->setSize(QSizeF(width(), height()));
-        updateImplicitSize();
+        itemImplicitWidthChanged(data.item);
+        itemImplicitHeightChanged(data.item);
         break;
     case ItemChildRemovedChange:
         unwatch(data.item);
-        updateImplicitSize();
+        if (data.item == m_widestChild || data.item == m_tallestChild) {
+            if (data.item == m_widestChild)
+                m_widestChild = nullptr;
+            if (data.item == m_tallestChild)
+                m_tallestChild = nullptr;
+            scheduleImplicitSize();
+        }
         break;
     default:
         break;
@@ -109,14 +172,32 @@ void QQuickItemGroup::geometryChanged(const QRectF &newGeometry, const QRectF &o
     }
 }
 
-void QQuickItemGroup::itemImplicitWidthChanged(QQuickItem *)
+void QQuickItemGroup::itemImplicitWidthChanged(QQuickItem *item)
 {
-    setImplicitWidth(calculateImplicitSize().width());
+    // a child that grows to the widest can be taken as is,
+    // only the widest child shrinking requires a full scan
+    if (m_implicitSizeDirty)
+        return;
+    const qreal width = item->implicitWidth();
+    if (!m_widestChild || width >= implicitWidth()) {
+        m_widestChild = item;
+        setImplicitWidth(width);
+    } else if (item == m_widestChild) {
+        scheduleImplicitSize();
+    }
 }
 
-void QQuickItemGroup::itemImplicitHeightChanged(QQuickItem *)
+void QQuickItemGroup::itemImplicitHeightChanged(QQuickItem *item)
 {
-    setImplicitHeight(calculateImplicitSize().height());
+    if (m_implicitSizeDirty)
+        return;
+    const qreal height = item->implicitHeight();
+    if (!m_tallestChild || height >= implicitHeight()) {
+        m_tallestChild = item;
+        setImplicitHeight(height);
+    } else if (item == m_tallestChild) {
+        scheduleImplicitSize();
+    }
 }
 
 QT_END_NAMESPACE
@@ -54,6 +54,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickItemGroupPrivate;
+
 class Q_QUICKCONTROLS2_PRIVATE_EXPORT QQuickItemGroup : public QQuickImplicitSizeItem, protected QQuickItemChangeListener
 {
     Q_OBJECT
@@ -66,14 +68,22 @@ protected:
     void watch(QQuickItem *item);
     void unwatch(QQuickItem *item);
 
-    QSizeF calculateImplicitSize() const;
     void updateImplicitSize();
+    void scheduleImplicitSize();
 
+    void updatePolish() override;
     void itemChange(ItemChange change, const ItemChangeData &data) override;
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
 
     void itemImplicitWidthChanged(QQuickItem *item) override;
     void itemImplicitHeightChanged(QQuickItem *item) override;
+
+private:
+    Q_DECLARE_PRIVATE(QQuickItemGroup)
+
+    bool m_implicitSizeDirty = false;
+    QQuickItem *m_widestChild = nullptr;
+    QQuickItem *m_tallestChild = nullptr;
 };
 
 QT_END_NAMESPACE
@@ -70,9 +70,10 @@ void QQuickMnemonicLabel::setMnemonicVisible(bool visible)
         return;
 
     m_mnemonicVisible = visible;
-    updateMnemonic();
 
-    if (isComponentComplete())
+    // Most labels have no mnemonic at all, in which case neither the text nor
+    // the formats change and there is no need to lay out the text again.
+    if (updateMnemonic() && isComponentComplete())
         forceLayout();
 }
 
@@ -86,7 +87,7 @@ static QTextLayout::FormatRange underlineRange(int start, int length = 1)
 }
 
 // based on QPlatformTheme::removeMnemonics()
-void QQuickMnemonicLabel::updateMnemonic()
+bool QQuickMnemonicLabel::updateMnemonic()
 {
     QString text(m_fullText.size(), 0);
     int idx = 0;
@@ -125,8 +126,13 @@ void QQuickMnemonicLabel::updateMnemonic()
     }
     text.truncate(idx);
 
-    QQuickTextPrivate::get(this)->layout.setFormats(formats);
+    QTextLayout &layout = QQuickTextPrivate::get(this)->layout;
+    if (text == QQuickText::text() && formats == layout.formats())
+        return false;
+
+    layout.setFormats(formats);
     QQuickText::setText(text);
+    return true;
 }
 
 QT_END_NAMESPACE
@@ -69,7 +69,7 @@ public:
     void setMnemonicVisible(bool visible);
 
 private:
-    void updateMnemonic();
+    bool updateMnemonic();
 
     bool m_mnemonicVisible = true;
     QString m_fullText;
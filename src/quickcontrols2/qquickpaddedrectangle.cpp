@@ -178,34 +178,25 @@ void QQuickPaddedRectangle::setBottomPadding(qreal padding, bool has)
 
 QSGNode *QQuickPaddedRectangle::updatePaintNode(QSGNode *node, UpdatePaintNodeData *data)
 {
-    QSGTransformNode *transformNode = static_cast<QSGTransformNode *>(node);
-    if (!transformNode)
-        transformNode = new QSGTransformNode;
-
-    QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(QQuickRectangle::updatePaintNode(transformNode->firstChild(), data));
+    // The padding is applied to the rectangle node itself, rather than through
+    // a parent transform node, to keep it a single node that can be batched.
+    QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(QQuickRectangle::updatePaintNode(node, data));
 
     if (rectNode) {
-        if (!transformNode->firstChild())
-            transformNode->appendChildNode(rectNode);
-
         qreal top = topPadding();
         qreal left = leftPadding();
         qreal right = rightPadding();
         qreal bottom = bottomPadding();
 
         if (!qFuzzyIsNull(top) || !qFuzzyIsNull(left) || !qFuzzyIsNull(right) || !qFuzzyIsNull(bottom)) {
-            QMatrix4x4 m;
-            m.translate(left, top);
-            transformNode->setMatrix(m);
-
             qreal w = qMax<qreal>(0.0, width() -left-right);
             qreal h = qMax<qreal>(0.0, height() -top-bottom);
 
-            rectNode->setRect(QRectF(0, 0, w, h));
+            rectNode->setRect(QRectF(left, top, w, h));
             rectNode->update();
         }
     }
-    return transformNode;
+    return rectNode;
 }
 
 QT_END_NAMESPACE
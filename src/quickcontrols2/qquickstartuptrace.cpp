@@ -0,0 +1,159 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickstartuptrace_p.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qvector.h>
+#include <QtQuick/qquickwindow.h>
+
+#include <stdio.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Records the time spent in the steps of the style and plugin
+    initialization, and the number of file system operations made by each
+    step, from the first step until the first frame has been swapped. The
+    trace is printed once the first frame has been swapped.
+*/
+
+struct QQuickStartupStep
+{
+    const char *name;
+    int depth;
+    qint64 start;
+    qint64 duration;
+    int fileSystemOperations;
+};
+
+class QQuickStartupTraceData : public QObject
+{
+public:
+    QQuickStartupTraceData()
+    {
+        timer.start();
+    }
+
+    void watchWindows()
+    {
+        if (watching || finished || !QCoreApplication::instance())
+            return;
+        QCoreApplication::instance()->installEventFilter(this);
+        watching = true;
+    }
+
+    void print()
+    {
+        if (finished)
+            return;
+        finished = true;
+
+        fprintf(stderr, "Qt Quick Controls startup trace:\n");
+        for (const QQuickStartupStep &step : qAsConst(steps)) {
+            fprintf(stderr, "%*s%s: started at %.3f ms, took %.3f ms, %d file system operations\n",
+                    2 + step.depth * 2, "", step.name, step.start / 1e6, step.duration / 1e6, step.fileSystemOperations);
+        }
+        fprintf(stderr, "  first frame: %.3f ms, %d file system operations\n",
+                timer.nsecsElapsed() / 1e6, fileSystemOperations);
+    }
+
+    QElapsedTimer timer;
+    QVector<QQuickStartupStep> steps;
+    int depth = 0;
+    int fileSystemOperations = 0;
+    bool watching = false;
+    bool finished = false;
+
+protected:
+    bool eventFilter(QObject *object, QEvent *event) override
+    {
+        if (event->type() == QEvent::Expose) {
+            if (QQuickWindow *window = qobject_cast<QQuickWindow *>(object)) {
+                QCoreApplication::instance()->removeEventFilter(this);
+                // frameSwapped() is emitted on the render thread
+                connect(window, &QQuickWindow::frameSwapped, this, &QQuickStartupTraceData::print, Qt::QueuedConnection);
+            }
+        }
+        return false;
+    }
+};
+
+Q_GLOBAL_STATIC(QQuickStartupTraceData, startupTrace)
+
+QQuickStartupTrace::QQuickStartupTrace(const char *step)
+    : m_step(step),
+      m_index(-1)
+{
+    if (!isEnabled())
+        return;
+
+    QQuickStartupTraceData *trace = startupTrace();
+    if (trace->finished)
+        return;
+
+    trace->watchWindows();
+    m_index = trace->steps.count();
+    // the operations made so far are subtracted again when the step ends
+    trace->steps.append(QQuickStartupStep{step, trace->depth++, trace->timer.nsecsElapsed(), 0, trace->fileSystemOperations});
+}
+
+QQuickStartupTrace::~QQuickStartupTrace()
+{
+    if (m_index == -1)
+        return;
+
+    QQuickStartupTraceData *trace = startupTrace();
+    QQuickStartupStep &step = trace->steps[m_index];
+    step.duration = trace->timer.nsecsElapsed() - step.start;
+    step.fileSystemOperations = trace->fileSystemOperations - step.fileSystemOperations;
+    --trace->depth;
+}
+
+bool QQuickStartupTrace::isEnabled()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_TRACE_STARTUP") > 0;
+    return enabled;
+}
+
+void QQuickStartupTrace::addFileSystemOperations(int count)
+{
+    if (isEnabled())
+        startupTrace()->fileSystemOperations += count;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,270 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickstatecolor_p.h"
+
+#include <QtCore/qmetaobject.h>
+#include <QtQuickTemplates2/private/qquickcontrol_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// StateColor resolves the background color of a control for its current
+// state, without re-evaluating a JavaScript binding on every state change.
+// The checked color replaces the normal color while the control is checked
+// or highlighted. The down and focus colors are blended on top of that by
+// their factors while the control is down or has visual focus. Unset colors
+// are ignored.
+
+static const char *const CheckedProperties[] = { "checked", "highlighted" };
+
+static QColor blend(const QColor &a, const QColor &b, qreal factor)
+{
+    if (!b.isValid() || factor <= 0.0)
+        return a;
+    if (factor >= 1.0)
+        return b;
+
+    QColor color;
+    color.setRedF(a.redF() * (1.0 - factor) + b.redF() * factor);
+    color.setGreenF(a.greenF() * (1.0 - factor) + b.greenF() * factor);
+    color.setBlueF(a.blueF() * (1.0 - factor) + b.blueF() * factor);
+    return color;
+}
+
+QQuickStateColor::QQuickStateColor(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QQuickControl *QQuickStateColor::control() const
+{
+    return m_control;
+}
+
+void QQuickStateColor::setControl(QQuickControl *control)
+{
+    if (m_control == control)
+        return;
+
+    if (m_control) {
+        for (const char *name : CheckedProperties)
+            connectState(name, false);
+        connectState("down", false);
+        connectState("visualFocus", false);
+    }
+    m_control = control;
+    if (control) {
+        for (const char *name : CheckedProperties)
+            connectState(name, true);
+        connectState("down", true);
+        connectState("visualFocus", true);
+    }
+    update();
+    emit controlChanged();
+}
+
+QColor QQuickStateColor::normal() const
+{
+    return m_normal;
+}
+
+void QQuickStateColor::setNormal(const QColor &color)
+{
+    if (m_normal == color)
+        return;
+
+    m_normal = color;
+    updateColors();
+    emit normalChanged();
+}
+
+QColor QQuickStateColor::checked() const
+{
+    return m_checked;
+}
+
+void QQuickStateColor::setChecked(const QColor &color)
+{
+    if (m_checked == color)
+        return;
+
+    m_checked = color;
+    updateColors();
+    emit checkedChanged();
+}
+
+QColor QQuickStateColor::down() const
+{
+    return m_down;
+}
+
+void QQuickStateColor::setDown(const QColor &color)
+{
+    if (m_down == color)
+        return;
+
+    m_down = color;
+    updateColors();
+    emit downChanged();
+}
+
+qreal QQuickStateColor::downFactor() const
+{
+    return m_downFactor;
+}
+
+void QQuickStateColor::setDownFactor(qreal factor)
+{
+    if (qFuzzyCompare(m_downFactor, factor))
+        return;
+
+    m_downFactor = factor;
+    updateColors();
+    emit downFactorChanged();
+}
+
+QColor QQuickStateColor::focus() const
+{
+    return m_focus;
+}
+
+void QQuickStateColor::setFocus(const QColor &color)
+{
+    if (m_focus == color)
+        return;
+
+    m_focus = color;
+    updateColors();
+    emit focusChanged();
+}
+
+qreal QQuickStateColor::focusFactor() const
+{
+    return m_focusFactor;
+}
+
+void QQuickStateColor::setFocusFactor(qreal factor)
+{
+    if (qFuzzyCompare(m_focusFactor, factor))
+        return;
+
+    m_focusFactor = factor;
+    updateColors();
+    emit focusFactorChanged();
+}
+
+QColor QQuickStateColor::color() const
+{
+    return m_color;
+}
+
+void QQuickStateColor::classBegin()
+{
+    m_complete = false;
+}
+
+void QQuickStateColor::componentComplete()
+{
+    m_complete = true;
+    updateColors();
+}
+
+void QQuickStateColor::update()
+{
+    if (!m_complete)
+        return;
+
+    int state = 0;
+    if (m_control) {
+        for (const char *name : CheckedProperties) {
+            if (readState(name))
+                state |= Checked;
+        }
+        if (readState("down"))
+            state |= Down;
+        if (m_control->hasVisualFocus())
+            state |= Focused;
+    }
+
+    const QColor color = m_colors[state];
+    if (m_color == color)
+        return;
+
+    m_color = color;
+    emit colorChanged();
+}
+
+void QQuickStateColor::connectState(const char *name, bool connect)
+{
+    const QMetaObject *mo = m_control->metaObject();
+    const int index = mo->indexOfProperty(name);
+    if (index == -1)
+        return;
+
+    const QMetaProperty property = mo->property(index);
+    if (!property.hasNotifySignal())
+        return;
+
+    static const int updateIndex = staticMetaObject.indexOfSlot("update()");
+    if (connect)
+        QMetaObject::connect(m_control, property.notifySignalIndex(), this, updateIndex);
+    else
+        QMetaObject::disconnect(m_control, property.notifySignalIndex(), this, updateIndex);
+}
+
+bool QQuickStateColor::readState(const char *name) const
+{
+    const QVariant value = m_control->property(name);
+    return value.isValid() && value.toBool();
+}
+
+void QQuickStateColor::updateColors()
+{
+    if (!m_complete)
+        return;
+
+    for (int state = 0; state < StateCount; ++state) {
+        QColor color = (state & Checked) && m_checked.isValid() ? m_checked : m_normal;
+        if (state & Down)
+            color = blend(color, m_down, m_downFactor);
+        if (state & Focused)
+            color = blend(color, m_focus, m_focusFactor);
+        m_colors[state] = color;
+    }
+    update();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,143 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKSTATECOLOR_P_H
+#define QQUICKSTATECOLOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qobject.h>
+#include <QtCore/qpointer.h>
+#include <QtGui/qcolor.h>
+#include <QtQml/qqml.h>
+#include <QtQml/qqmlparserstatus.h>
+#include <QtQuickControls2/private/qtquickcontrols2global_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QQuickControl;
+
+class Q_QUICKCONTROLS2_PRIVATE_EXPORT QQuickStateColor : public QObject, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+    Q_PROPERTY(QQuickControl *control READ control WRITE setControl NOTIFY controlChanged FINAL)
+    Q_PROPERTY(QColor normal READ normal WRITE setNormal NOTIFY normalChanged FINAL)
+    Q_PROPERTY(QColor checked READ checked WRITE setChecked NOTIFY checkedChanged FINAL)
+    Q_PROPERTY(QColor down READ down WRITE setDown NOTIFY downChanged FINAL)
+    Q_PROPERTY(qreal downFactor READ downFactor WRITE setDownFactor NOTIFY downFactorChanged FINAL)
+    Q_PROPERTY(QColor focus READ focus WRITE setFocus NOTIFY focusChanged FINAL)
+    Q_PROPERTY(qreal focusFactor READ focusFactor WRITE setFocusFactor NOTIFY focusFactorChanged FINAL)
+    Q_PROPERTY(QColor color READ color NOTIFY colorChanged FINAL)
+
+public:
+    explicit QQuickStateColor(QObject *parent = nullptr);
+
+    QQuickControl *control() const;
+    void setControl(QQuickControl *control);
+
+    QColor normal() const;
+    void setNormal(const QColor &color);
+
+    QColor checked() const;
+    void setChecked(const QColor &color);
+
+    QColor down() const;
+    void setDown(const QColor &color);
+
+    qreal downFactor() const;
+    void setDownFactor(qreal factor);
+
+    QColor focus() const;
+    void setFocus(const QColor &color);
+
+    qreal focusFactor() const;
+    void setFocusFactor(qreal factor);
+
+    QColor color() const;
+
+Q_SIGNALS:
+    void controlChanged();
+    void normalChanged();
+    void checkedChanged();
+    void downChanged();
+    void downFactorChanged();
+    void focusChanged();
+    void focusFactorChanged();
+    void colorChanged();
+
+protected:
+    void classBegin() override;
+    void componentComplete() override;
+
+private Q_SLOTS:
+    void update();
+
+private:
+    void connectState(const char *name, bool connect);
+    bool readState(const char *name) const;
+    void updateColors();
+
+    bool m_complete = true;
+    QPointer<QQuickControl> m_control;
+    QColor m_normal;
+    QColor m_checked;
+    QColor m_down;
+    qreal m_downFactor = 1.0;
+    QColor m_focus;
+    qreal m_focusFactor = 1.0;
+    QColor m_color;
+
+    // the blended colors only depend on the input colors, not on the state,
+    // so they are calculated up front for each combination of the states
+    enum State { Checked = 0x1, Down = 0x2, Focused = 0x4, StateCount = 0x8 };
+    QColor m_colors[StateCount];
+};
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQuickStateColor)
+
+#endif // QQUICKSTATECOLOR_P_H
@@ -36,9 +36,11 @@
 
 #include "qquickstyle.h"
 #include "qquickstyle_p.h"
+#include "qquickstartuptrace_p.h"
 
 #include <QtCore/qdir.h>
 #include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qdebug.h>
 #include <QtCore/qsettings.h>
 #include <QtCore/qfileselector.h>
@@ -50,9 +52,12 @@
 #include <QtQml/private/qqmlmetatype_p.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlfile.h>
+#include <QtQuickTemplates2/private/qquicktimingspan_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcStyle, "qt.quick.controls.style")
+
 /*!
     \class QQuickStyle
     \brief The QQuickStyle class allows configuring the application style.
@@ -155,12 +160,14 @@ struct QQuickStyleSpec
     static QString findStyle(const QString &path, const QString &name)
     {
         QDir dir(path);
+        QQuickStartupTrace::addFileSystemOperations();
         if (!dir.exists())
             return QString();
 
         if (name.isEmpty())
             return dir.absolutePath() + QLatin1Char('/');
 
+        QQuickStartupTrace::addFileSystemOperations();
         const QStringList entries = dir.entryList(QStringList(), QDir::Dirs | QDir::NoDotAndDotDot);
         for (const QString &entry : entries) {
             if (entry.compare(name, Qt::CaseInsensitive) == 0)
@@ -234,12 +241,15 @@ struct QQuickStyleSpec
         fallbackStyle.clear();
         fallbackMethod.clear();
         configFilePath.clear();
+        settings.clear();
     }
 
     QString resolveConfigFilePath()
     {
         if (configFilePath.isEmpty()) {
             configFilePath = QFile::decodeName(qgetenv("QT_QUICK_CONTROLS_CONF"));
+            if (!configFilePath.isEmpty())
+                QQuickStartupTrace::addFileSystemOperations();
             if (configFilePath.isEmpty() || !QFile::exists(configFilePath)) {
                 if (!configFilePath.isEmpty())
                     qWarning("QT_QUICK_CONTROLS_CONF=%s: No such file", qPrintable(configFilePath));
@@ -256,6 +266,10 @@ struct QQuickStyleSpec
     QString fallbackStyle;
     QByteArray fallbackMethod;
     QString configFilePath;
+#ifndef QT_NO_SETTINGS
+    // the parsed configuration file, per settings group
+    QHash<QString, QSharedPointer<QSettings>> settings;
+#endif
 };
 
 Q_GLOBAL_STATIC(QQuickStyleSpec, styleSpec)
@@ -351,6 +365,8 @@ bool QQuickStylePrivate::isCustomStyle()
 
 void QQuickStylePrivate::init(const QUrl &baseUrl)
 {
+    QQuickTimingSpan span(lcStyle, "init");
+    QQuickStartupTrace trace("QQuickStylePrivate::init");
     QQuickStyleSpec *spec = styleSpec();
     spec->resolve(baseUrl);
 
@@ -380,16 +396,35 @@ QString QQuickStylePrivate::configFilePath()
 QSharedPointer<QSettings> QQuickStylePrivate::settings(const QString &group)
 {
 #ifndef QT_NO_SETTINGS
+    // The configuration file is looked up and parsed once per group until the
+    // style is reset. The callers must leave the settings in the group they
+    // got them in.
+    QQuickStyleSpec *spec = styleSpec();
+    if (spec) {
+        auto it = spec->settings.constFind(group);
+        if (it != spec->settings.constEnd())
+            return it.value();
+    }
+
+    QQuickStartupTrace trace("QQuickStylePrivate::settings");
+    QSharedPointer<QSettings> settings;
     const QString filePath = QQuickStylePrivate::configFilePath();
+    QQuickStartupTrace::addFileSystemOperations();
     if (QFile::exists(filePath)) {
+        // selecting the file and reading the settings
+        QQuickStartupTrace::addFileSystemOperations(2);
         QFileSelector selector;
-        QSettings *settings = new QSettings(selector.select(filePath), QSettings::IniFormat);
+        settings.reset(new QSettings(selector.select(filePath), QSettings::IniFormat));
         if (!group.isEmpty())
             settings->beginGroup(group);
-        return QSharedPointer<QSettings>(settings);
     }
-#endif // QT_NO_SETTINGS
+    if (spec)
+        spec->settings.insert(group, settings);
+    return settings;
+#else
+    Q_UNUSED(group);
     return QSharedPointer<QSettings>();
+#endif // QT_NO_SETTINGS
 }
 
 static bool qt_is_dark_system_theme()
@@ -409,6 +444,25 @@ bool QQuickStylePrivate::isDarkSystemTheme()
     return dark;
 }
 
+/*
+    Returns whether the styles should leave out their purely decorative
+    effects, such as ripples, because the hardware cannot afford them. The
+    profile is read from the QT_QUICK_CONTROLS_RENDERING_PROFILE environment
+    variable, or the RenderingProfile key of the configuration file.
+*/
+bool QQuickStylePrivate::isLowEndProfile()
+{
+    QByteArray profile = qgetenv("QT_QUICK_CONTROLS_RENDERING_PROFILE");
+#if QT_CONFIG(settings)
+    if (profile.isEmpty()) {
+        QSharedPointer<QSettings> settings = QQuickStylePrivate::settings(QStringLiteral("Controls"));
+        if (settings)
+            profile = settings->value(QStringLiteral("RenderingProfile")).toByteArray();
+    }
+#endif
+    return profile.compare("low", Qt::CaseInsensitive) == 0;
+}
+
 /*!
     Returns the name of the application style.
 
@@ -67,6 +67,7 @@ public:
     static QString configFilePath();
     static QSharedPointer<QSettings> settings(const QString &group = QString());
     static bool isDarkSystemTheme();
+    static bool isLowEndProfile();
 };
 
 QT_END_NAMESPACE
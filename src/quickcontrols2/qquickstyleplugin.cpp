@@ -37,6 +37,7 @@
 #include "qquickstyleplugin_p.h"
 #include "qquickproxytheme_p.h"
 #include "qquickstyle.h"
+#include "qquickstartuptrace_p.h"
 
 #include <QtGui/private/qguiapplication_p.h>
 
@@ -65,7 +66,9 @@ void QQuickStylePlugin::initializeEngine(QQmlEngine *engine, const char *uri)
     if (!m_theme.isNull())
         return;
 
+    QQuickStartupTrace trace("QQuickStylePlugin::initializeEngine");
     if (isCurrent()) {
+        QQuickStartupTrace themeTrace("QQuickStylePlugin::createTheme");
         m_theme.reset(createTheme());
         if (m_theme)
             QGuiApplicationPrivate::platform_theme = m_theme.data();
@@ -42,12 +42,15 @@
 #include "qquickstyleselector_p_p.h"
 #include "qquickstyle.h"
 #include "qquickstyle_p.h"
+#include "qquickstartuptrace_p.h"
 
 #include <QtCore/qdir.h>
 #include <QtCore/qfile.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qsysinfo.h>
 #include <QtCore/qlocale.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qset.h>
 #include <QtQml/qqmlfile.h>
 
 #include <QtCore/private/qfileselector_p.h>
@@ -71,6 +74,44 @@ static QString ensureSlash(const QString &path)
     return path + QLatin1Char('/');
 }
 
+typedef QHash<QString, QSet<QString> > QQuickStyleDirectoryHash;
+Q_GLOBAL_STATIC(QQuickStyleDirectoryHash, styleDirectories)
+Q_GLOBAL_STATIC(QMutex, styleDirectoriesMutex)
+
+// Style directories are listed once and cached for the lifetime of the
+// process, so that resolving a control does not stat every candidate file
+// and selector directory separately.
+static QSet<QString> directoryEntries(const QString &path)
+{
+    QMutexLocker locker(styleDirectoriesMutex());
+    QQuickStyleDirectoryHash::const_iterator it = styleDirectories()->constFind(path);
+    if (it != styleDirectories()->constEnd())
+        return it.value();
+
+    QQuickStartupTrace::addFileSystemOperations();
+    QSet<QString> entries;
+    const QStringList names = QDir(path).entryList(QDir::AllEntries | QDir::NoDotAndDotDot);
+    for (const QString &name : names)
+        entries.insert(name);
+    styleDirectories()->insert(path, entries);
+    return entries;
+}
+
+static bool fileExists(const QFileInfo &fi)
+{
+    return directoryEntries(fi.path()).contains(fi.fileName());
+}
+
+static bool hasSelectorDirectories(const QString &path, const QStringList &selectors)
+{
+    const QSet<QString> entries = directoryEntries(path);
+    for (const QString &selector : selectors) {
+        if (entries.contains(selector))
+            return true;
+    }
+    return false;
+}
+
 static QStringList prefixedPlatformSelectors(const QChar &prefix)
 {
     QStringList selectors = QFileSelectorPrivate::platformSelectors();
@@ -95,12 +136,16 @@ QString QQuickStyleSelectorPrivate::select(const QString &filePath) const
 {
     QFileInfo fi(filePath);
     // If file doesn't exist, don't select
-    if (!fi.exists())
+    if (!fileExists(fi))
         return filePath;
 
     const QString path = fi.path();
+    const QStringList selectors = allSelectors(styleName);
+    if (!hasSelectorDirectories(path, selectors))
+        return filePath;
+
     const QString ret = QFileSelectorPrivate::selectionHelper(path.isEmpty() ? QString() : path + QLatin1Char('/'),
-                                                              fi.fileName(), allSelectors(styleName), QChar());
+                                                              fi.fileName(), selectors, QChar());
 
     if (!ret.isEmpty())
         return ret;
@@ -110,14 +155,17 @@ QString QQuickStyleSelectorPrivate::select(const QString &filePath) const
 QString QQuickStyleSelectorPrivate::trySelect(const QString &filePath, const QString &fallback) const
 {
     QFileInfo fi(filePath);
-    if (!fi.exists())
+    if (!fileExists(fi))
         return fallback;
 
     // the path contains the name of the custom/fallback style, so exclude it from
     // the selectors. the rest of the selectors (os, locale) are still valid, though.
     const QString path = fi.path();
-    const QString selectedPath = QFileSelectorPrivate::selectionHelper(path.isEmpty() ? QString() : path + QLatin1Char('/'),
-                                                                       fi.fileName(), allSelectors(), QChar());
+    const QStringList selectors = allSelectors();
+    const QString selectedPath = hasSelectorDirectories(path, selectors)
+            ? QFileSelectorPrivate::selectionHelper(path.isEmpty() ? QString() : path + QLatin1Char('/'),
+                                                    fi.fileName(), selectors, QChar())
+            : filePath;
     if (selectedPath.startsWith(QLatin1Char(':')))
         return QLatin1String("qrc") + selectedPath;
     return QUrl::fromLocalFile(QFileInfo(selectedPath).absoluteFilePath()).toString();
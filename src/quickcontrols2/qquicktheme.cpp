@@ -115,6 +115,7 @@ static QPalette *readPalette(const QSharedPointer<QSettings> &settings)
     settings->beginGroup(QStringLiteral("Disabled"));
     readColorGroup(settings, QPalette::Disabled, &p);
     settings->endGroup();
+    settings->endGroup();
     return new QPalette(p);
 }
 
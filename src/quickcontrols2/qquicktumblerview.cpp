@@ -109,6 +109,10 @@ void QQuickTumblerView::setPath(QQuickPath *path)
         return;
 
     m_path = path;
+
+    if (m_pathView)
+        m_pathView->setPath(m_path);
+
     emit pathChanged();
 }
 
@@ -116,6 +120,13 @@ void QQuickTumblerView::createView()
 {
     Q_ASSERT(m_tumbler);
 
+    // The wrap of the Tumbler, and thereby the type of the view, can change
+    // several times while the Tumbler is being created (explicitly and based
+    // on the count), so the view is created once, after the Tumbler has been
+    // completed. QQuickTumbler::componentComplete() emits wrapChanged() then.
+    if (!m_tumbler->isComponentComplete())
+        return;
+
     // We create a view regardless of whether or not we know
     // the count yet, because we rely on the view to tell us the count.
     if (m_tumbler->wrap()) {
@@ -284,6 +295,10 @@ void QQuickTumblerView::itemChange(QQuickItem::ItemChange change, const QQuickIt
             // We assume that the parentChanged() signal of the tumbler will be emitted before its wrap property is set...
             connect(m_tumbler, &QQuickTumbler::wrapChanged, this, &QQuickTumblerView::createView);
             connect(m_tumbler, &QQuickTumbler::visibleItemCountChanged, this, &QQuickTumblerView::updateView);
+
+            // A TumblerView that is assigned to a completed Tumbler gets no wrapChanged().
+            if (m_tumbler->isComponentComplete())
+                createView();
         }
     }
 }
@@ -9,11 +9,14 @@ HEADERS += \
     $$PWD/qquickiconimage_p_p.h \
     $$PWD/qquickiconlabel_p.h \
     $$PWD/qquickiconlabel_p_p.h \
+    $$PWD/qquickimplicitsize_p.h \
     $$PWD/qquickitemgroup_p.h \
     $$PWD/qquickmnemoniclabel_p.h \
     $$PWD/qquickpaddedrectangle_p.h \
     $$PWD/qquickplaceholdertext_p.h \
     $$PWD/qquickproxytheme_p.h \
+    $$PWD/qquickstartuptrace_p.h \
+    $$PWD/qquickstatecolor_p.h \
     $$PWD/qquickstyle.h \
     $$PWD/qquickstyle_p.h \
     $$PWD/qquickstyleplugin_p.h \
@@ -30,11 +33,14 @@ SOURCES += \
     $$PWD/qquickcolorimage.cpp \
     $$PWD/qquickiconimage.cpp \
     $$PWD/qquickiconlabel.cpp \
+    $$PWD/qquickimplicitsize.cpp \
     $$PWD/qquickitemgroup.cpp \
     $$PWD/qquickmnemoniclabel.cpp \
     $$PWD/qquickpaddedrectangle.cpp \
     $$PWD/qquickplaceholdertext.cpp \
     $$PWD/qquickproxytheme.cpp \
+    $$PWD/qquickstartuptrace.cpp \
+    $$PWD/qquickstatecolor.cpp \
     $$PWD/qquickstyle.cpp \
     $$PWD/qquickstyleplugin.cpp \
     $$PWD/qquickstyleselector.cpp \
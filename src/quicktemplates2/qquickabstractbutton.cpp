@@ -157,7 +157,7 @@ void QQuickAbstractButtonPrivate::handleMove(const QPointF &point)
 
     if (!pressed && autoRepeat)
         stopPressRepeat();
-    else if (holdTimer > 0 && (!pressed || QLineF(pressPoint, point).length() > QGuiApplication::styleHints()->startDragDistance()))
+    else if (holdTimer.isActive() && (!pressed || QLineF(pressPoint, point).length() > QGuiApplication::styleHints()->startDragDistance()))
         stopPressAndHold();
 }
 
@@ -213,43 +213,32 @@ void QQuickAbstractButtonPrivate::startPressAndHold()
     wasHeld = false;
     stopPressAndHold();
     if (isPressAndHoldConnected())
-        holdTimer = q->startTimer(QGuiApplication::styleHints()->mousePressAndHoldInterval());
+        holdTimer.start(QGuiApplication::styleHints()->mousePressAndHoldInterval(), q);
 }
 
 void QQuickAbstractButtonPrivate::stopPressAndHold()
 {
-    Q_Q(QQuickAbstractButton);
-    if (holdTimer > 0) {
-        q->killTimer(holdTimer);
-        holdTimer = 0;
-    }
+    holdTimer.stop();
 }
 
 void QQuickAbstractButtonPrivate::startRepeatDelay()
 {
     Q_Q(QQuickAbstractButton);
     stopPressRepeat();
-    delayTimer = q->startTimer(repeatDelay);
+    delayTimer.start(repeatDelay, q);
 }
 
 void QQuickAbstractButtonPrivate::startPressRepeat()
 {
     Q_Q(QQuickAbstractButton);
     stopPressRepeat();
-    repeatTimer = q->startTimer(repeatInterval);
+    repeatTimer.start(repeatInterval, q);
 }
 
 void QQuickAbstractButtonPrivate::stopPressRepeat()
 {
-    Q_Q(QQuickAbstractButton);
-    if (delayTimer > 0) {
-        q->killTimer(delayTimer);
-        delayTimer = 0;
-    }
-    if (repeatTimer > 0) {
-        q->killTimer(repeatTimer);
-        repeatTimer = 0;
-    }
+    delayTimer.stop();
+    repeatTimer.stop();
 }
 
 #if QT_CONFIG(shortcut)
@@ -354,7 +343,7 @@ void QQuickAbstractButtonPrivate::executeIndicator(bool complete)
     if (!indicator || complete)
         quickBeginDeferred(q, indicatorName(), indicator);
     if (complete)
-        quickCompleteDeferred(q, indicatorName(), indicator);
+        quickCompleteDeferred(q, indicator);
 }
 
 QQuickAbstractButton *QQuickAbstractButtonPrivate::findCheckedButton() const
@@ -363,43 +352,25 @@ QQuickAbstractButton *QQuickAbstractButtonPrivate::findCheckedButton() const
     if (group)
         return qobject_cast<QQuickAbstractButton *>(group->checkedButton());
 
-    const QList<QQuickAbstractButton *> buttons = findExclusiveButtons();
     // TODO: A singular QRadioButton can be unchecked, which seems logical,
     // because there's nothing to be exclusive with. However, a RadioButton
     // from QtQuick.Controls 1.x can never be unchecked, which is the behavior
-    // that QQuickRadioButton adopted. Uncommenting the following count check
-    // gives the QRadioButton behavior. Notice that tst_radiobutton.qml needs
-    // to be updated.
-    if (!autoExclusive /*|| buttons.count() == 1*/)
+    // that QQuickRadioButton adopted. Counting the exclusive siblings and
+    // returning nullptr for a lonely button gives the QRadioButton behavior.
+    // Notice that tst_radiobutton.qml needs to be updated.
+    if (!autoExclusive)
         return nullptr;
 
-    for (QQuickAbstractButton *button : buttons) {
-        if (button->isChecked() && button != q)
-            return button;
-    }
-    return checked ? const_cast<QQuickAbstractButton *>(q) : nullptr;
-}
-
-QList<QQuickAbstractButton *> QQuickAbstractButtonPrivate::findExclusiveButtons() const
-{
-    QList<QQuickAbstractButton *> buttons;
-    if (group) {
-        QQmlListProperty<QQuickAbstractButton> groupButtons = group->buttons();
-        int count = groupButtons.count(&groupButtons);
-        for (int i = 0; i < count; ++i) {
-            QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton *>(groupButtons.at(&groupButtons, i));
-            if (button)
-                buttons += button;
-        }
-    } else if (parentItem) {
+    // scan the siblings in place, without collecting them into a list first
+    if (parentItem) {
         const auto childItems = parentItem->childItems();
         for (QQuickItem *child : childItems) {
             QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton *>(child);
-            if (button && button->autoExclusive() && !QQuickAbstractButtonPrivate::get(button)->group)
-                buttons += button;
+            if (button && button != q && button->isChecked() && button->autoExclusive() && !QQuickAbstractButtonPrivate::get(button)->group)
+                return button;
         }
     }
-    return buttons;
+    return checked ? const_cast<QQuickAbstractButton *>(q) : nullptr;
 }
 
 QQuickAbstractButton::QQuickAbstractButton(QQuickItem *parent)
@@ -1000,13 +971,13 @@ void QQuickAbstractButton::timerEvent(QTimerEvent *event)
 {
     Q_D(QQuickAbstractButton);
     QQuickControl::timerEvent(event);
-    if (event->timerId() == d->holdTimer) {
+    if (event->timerId() == d->holdTimer.timerId()) {
         d->stopPressAndHold();
         d->wasHeld = true;
         emit pressAndHold();
-    } else if (event->timerId() == d->delayTimer) {
+    } else if (event->timerId() == d->delayTimer.timerId()) {
         d->startPressRepeat();
-    } else if (event->timerId() == d->repeatTimer) {
+    } else if (event->timerId() == d->repeatTimer.timerId()) {
         emit released();
         d->trigger();
         emit pressed();
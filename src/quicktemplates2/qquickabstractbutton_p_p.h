@@ -50,6 +50,7 @@
 
 #include <QtQuickTemplates2/private/qquickabstractbutton_p.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
+#include <QtQuickTemplates2/private/qquickpresstimer_p_p.h>
 #include <QtGui/qkeysequence.h>
 
 QT_BEGIN_NAMESPACE
@@ -89,7 +90,6 @@ public:
 #endif
 
     QQuickAbstractButton *findCheckedButton() const;
-    QList<QQuickAbstractButton *> findExclusiveButtons() const;
 
     void actionTextChange();
     void setText(const QString &text, bool isExplicit);
@@ -117,9 +117,9 @@ public:
     bool autoExclusive = false;
     bool autoRepeat = false;
     bool wasHeld = false;
-    int holdTimer = 0;
-    int delayTimer = 0;
-    int repeatTimer = 0;
+    QQuickPressTimer holdTimer;
+    QQuickPressTimer delayTimer;
+    QQuickPressTimer repeatTimer;
     int repeatDelay = AUTO_REPEAT_DELAY;
     int repeatInterval = AUTO_REPEAT_INTERVAL;
 #if QT_CONFIG(shortcut)
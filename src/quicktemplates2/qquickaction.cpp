@@ -187,9 +187,11 @@ void QQuickActionPrivate::setShortcut(const QVariant &var)
     vshortcut = var.toString();
     keySequence = variantToKeySequence(var);
 
-    defaultShortcutEntry->grab(keySequence, enabled);
-    for (QQuickActionPrivate::ShortcutEntry *entry : qAsConst(shortcutEntries))
-        entry->grab(keySequence, enabled);
+    for (QQuickActionPrivate::ShortcutEntry *entry : qAsConst(shortcutEntries)) {
+        if (static_cast<QQuickItem *>(entry->target())->isVisible())
+            entry->grab(keySequence, enabled);
+    }
+    updateDefaultShortcutEntry();
 
     emit q->shortcutChanged(keySequence);
 }
@@ -38,15 +38,16 @@
 #include "qquickoverlay_p.h"
 #include "qquickpopup_p_p.h"
 #include "qquickcontrol_p_p.h"
-#include "qquicktextarea_p.h"
-#include "qquicktextfield_p.h"
 #include "qquicktoolbar_p.h"
 #include "qquicktabbar_p.h"
 #include "qquickdialogbuttonbox_p.h"
 #include "qquickdeferredexecute_p_p.h"
 #include "qquickdeferredpointer_p_p.h"
 
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
 #include <QtCore/private/qobject_p.h>
+#include <QtQml/qqmlinfo.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 
@@ -129,6 +130,7 @@ public:
     }
 
     void relayout();
+    void scheduleRelayout();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemVisibilityChanged(QQuickItem *item) override;
@@ -151,6 +153,8 @@ public:
     }
     void resolvePalette();
 
+    void notify(QQuickInheritanceNode::Attributes attributes);
+
     void _q_updateActiveFocus();
     void setActiveFocusControl(QQuickItem *item);
 
@@ -170,9 +174,36 @@ public:
     QLocale locale;
     QPalette palette;
     QQuickItem *activeFocusControl = nullptr;
+    QQuickInheritanceNode inheritanceNode;
+    int updateDepth = 0;
+    QQuickInheritanceNode::Attributes heldNotifications;
+    QScopedPointer<QQuickInheritanceBatch> inheritanceBatch;
     QQuickApplicationWindow *q_ptr = nullptr;
 };
 
+// Implicit size changes of the header, footer and menu bar are laid out in
+// the polish pass of the content item, so that any number of them during a
+// frame result in a single relayout. Resizes of the window and geometry or
+// visibility changes of the bars are still laid out right away.
+class QQuickApplicationWindowContentItem : public QQuickItem
+{
+public:
+    QQuickApplicationWindowContentItem(QQuickApplicationWindowPrivate *window, QQuickItem *parent)
+        : QQuickItem(parent), window(window)
+    {
+    }
+
+protected:
+    void updatePolish() override
+    {
+        QQuickItem::updatePolish();
+        window->relayout();
+    }
+
+private:
+    QQuickApplicationWindowPrivate *window;
+};
+
 static void layoutItem(QQuickItem *item, qreal y, qreal width)
 {
     if (!item)
@@ -218,6 +249,13 @@ void QQuickApplicationWindowPrivate::relayout()
     }
 }
 
+void QQuickApplicationWindowPrivate::scheduleRelayout()
+{
+    Q_Q(QQuickApplicationWindow);
+    if (complete)
+        q->contentItem()->polish();
+}
+
 void QQuickApplicationWindowPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff)
 {
     Q_UNUSED(item)
@@ -235,29 +273,30 @@ void QQuickApplicationWindowPrivate::itemVisibilityChanged(QQuickItem *item)
 void QQuickApplicationWindowPrivate::itemImplicitWidthChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemImplicitHeightChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::updateFont(const QFont &f)
 {
     Q_Q(QQuickApplicationWindow);
     const bool changed = font != f;
+    const uint changes = QQuickInheritanceNode::fontChanges(font, f);
     font = f;
 
-    QQuickControlPrivate::updateFontRecur(q->QQuickWindow::contentItem(), f);
+    inheritanceNode.propagateFont(f, changes);
 
     const QList<QQuickPopup *> popups = q->findChildren<QQuickPopup *>();
     for (QQuickPopup *popup : popups)
         QQuickControlPrivate::get(static_cast<QQuickControl *>(popup->popupItem()))->inheritFont(f);
 
     if (changed)
-        emit q->fontChanged();
+        notify(QQuickInheritanceNode::FontAttribute);
 }
 
 void QQuickApplicationWindowPrivate::resolveFont()
@@ -270,16 +309,17 @@ void QQuickApplicationWindowPrivate::updatePalette(const QPalette &p)
 {
     Q_Q(QQuickApplicationWindow);
     const bool changed = palette != p;
+    const uint changes = QQuickInheritanceNode::paletteChanges(palette, p);
     palette = p;
 
-    QQuickControlPrivate::updatePaletteRecur(q->QQuickWindow::contentItem(), p);
+    inheritanceNode.propagatePalette(p, changes);
 
     const QList<QQuickPopup *> popups = q->findChildren<QQuickPopup *>();
     for (QQuickPopup *popup : popups)
         QQuickControlPrivate::get(static_cast<QQuickControl *>(popup->popupItem()))->inheritPalette(p);
 
     if (changed)
-        emit q->paletteChanged();
+        notify(QQuickInheritanceNode::PaletteAttribute);
 }
 
 void QQuickApplicationWindowPrivate::resolvePalette()
@@ -288,12 +328,41 @@ void QQuickApplicationWindowPrivate::resolvePalette()
     setPalette_helper(resolvedPalette);
 }
 
+// Like the controls, the window holds back its change signals until the
+// outermost batch of updates ends.
+void QQuickApplicationWindowPrivate::notify(QQuickInheritanceNode::Attributes attributes)
+{
+    Q_Q(QQuickApplicationWindow);
+    if (updateDepth > 0) {
+        heldNotifications |= attributes;
+        return;
+    }
+
+    if (attributes & QQuickInheritanceNode::FontAttribute)
+        emit q->fontChanged();
+    if (attributes & QQuickInheritanceNode::PaletteAttribute)
+        emit q->paletteChanged();
+    if (attributes & QQuickInheritanceNode::LocaleAttribute)
+        emit q->localeChanged();
+}
+
 static QQuickItem *findActiveFocusControl(QQuickWindow *window)
 {
+    // Controls, TextFields and TextAreas are tagged with an inheritance node,
+    // which avoids three qobject_casts per ancestor.
     QQuickItem *item = window->activeFocusItem();
     while (item) {
-        if (qobject_cast<QQuickControl *>(item) || qobject_cast<QQuickTextField *>(item) || qobject_cast<QQuickTextArea *>(item))
-            return item;
+        if (const QQuickInheritanceNode *node = QQuickInheritanceNode::get(item)) {
+            switch (node->type()) {
+            case QQuickInheritanceNode::ControlType:
+            case QQuickInheritanceNode::PopupItemType:
+            case QQuickInheritanceNode::TextFieldType:
+            case QQuickInheritanceNode::TextAreaType:
+                return item;
+            default:
+                break;
+            }
+        }
         item = item->parentItem();
     }
     return item;
@@ -340,13 +409,14 @@ void QQuickApplicationWindowPrivate::executeBackground(bool complete)
     if (!background || complete)
         quickBeginDeferred(q, backgroundName(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickApplicationWindow::QQuickApplicationWindow(QWindow *parent)
     : QQuickWindowQmlImpl(parent), d_ptr(new QQuickApplicationWindowPrivate)
 {
     d_ptr->q_ptr = this;
+    d_ptr->inheritanceNode.init(QQuickWindow::contentItem(), QQuickInheritanceNode::ItemType);
     connect(this, SIGNAL(activeFocusItemChanged()), this, SLOT(_q_updateActiveFocus()));
 }
 
@@ -361,6 +431,8 @@ QQuickApplicationWindow::~QQuickApplicationWindow()
         QQuickItemPrivate::get(d->header)->removeItemChangeListener(d, ItemChanges);
     if (d->footer)
         QQuickItemPrivate::get(d->footer)->removeItemChangeListener(d, ItemChanges);
+    if (d->inheritanceBatch)
+        d->inheritanceBatch->discard();
     d_ptr.reset(); // QTBUG-52731
 }
 
@@ -572,7 +644,7 @@ QQuickItem *QQuickApplicationWindow::contentItem() const
 {
     QQuickApplicationWindowPrivate *d = const_cast<QQuickApplicationWindowPrivate *>(d_func());
     if (!d->contentItem) {
-        d->contentItem = new QQuickItem(QQuickWindow::contentItem());
+        d->contentItem = new QQuickApplicationWindowContentItem(d, QQuickWindow::contentItem());
         d->contentItem->setFlag(QQuickItem::ItemIsFocusScope);
         d->contentItem->setFocus(true);
         d->relayout();
@@ -715,14 +787,14 @@ void QQuickApplicationWindow::setLocale(const QLocale &locale)
         return;
 
     d->locale = locale;
-    QQuickControlPrivate::updateLocaleRecur(QQuickWindow::contentItem(), locale);
+    d->inheritanceNode.propagateLocale(locale);
 
     // TODO: internal QQuickPopupManager that provides reliable access to all QQuickPopup instances
     const QList<QQuickPopup *> popups = QQuickWindow::contentItem()->findChildren<QQuickPopup *>();
     for (QQuickPopup *popup : popups)
         QQuickControlPrivate::get(static_cast<QQuickControl *>(popup->popupItem()))->updateLocale(locale, false); // explicit=false
 
-    emit localeChanged();
+    d->notify(QQuickInheritanceNode::LocaleAttribute);
 }
 
 void QQuickApplicationWindow::resetLocale()
@@ -767,6 +839,67 @@ void QQuickApplicationWindow::resetPalette()
     setPalette(QPalette());
 }
 
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlmethod void QtQuick.Controls::ApplicationWindow::beginUpdate()
+
+    Starts a batch of font, palette and locale changes. Until the matching
+    call to endUpdate(), changes to these properties of the window and its
+    controls take effect on the controls themselves, but are not yet
+    propagated to their children, and their change signals are not yet
+    emitted. Calls can be nested. Other windows are not
+    affected by the batch, and the recorded changes are dropped if the window
+    is destroyed before the batch ends.
+
+    \code
+    ApplicationWindow {
+        function applyTheme(theme) {
+            beginUpdate()
+            font = theme.font
+            palette = theme.palette
+            locale = theme.locale
+            endUpdate()
+        }
+    }
+    \endcode
+
+    \sa endUpdate()
+*/
+void QQuickApplicationWindow::beginUpdate()
+{
+    Q_D(QQuickApplicationWindow);
+    if (d->updateDepth++ == 0)
+        d->inheritanceBatch.reset(new QQuickInheritanceBatch(this));
+}
+
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlmethod void QtQuick.Controls::ApplicationWindow::endUpdate()
+
+    Ends a batch of changes started with beginUpdate(). When the outermost
+    batch ends, the changes are propagated to the children in a single pass,
+    so that each control is updated once for all the changed properties.
+    Then the window and each affected control emit the change signal of
+    each of the changed properties once.
+
+    \sa beginUpdate()
+*/
+void QQuickApplicationWindow::endUpdate()
+{
+    Q_D(QQuickApplicationWindow);
+    if (d->updateDepth == 0) {
+        qmlWarning(this) << "endUpdate() called without a matching beginUpdate()";
+        return;
+    }
+    if (--d->updateDepth == 0) {
+        d->inheritanceBatch.reset(); // propagates the recorded changes
+
+        const QQuickInheritanceNode::Attributes attributes = d->heldNotifications;
+        d->heldNotifications = QQuickInheritanceNode::Attributes();
+        d->notify(attributes);
+    }
+}
+
 /*!
     \since QtQuick.Controls 2.3 (Qt 5.10)
     \qmlproperty Item QtQuick.Controls::ApplicationWindow::menuBar
@@ -845,18 +978,114 @@ void QQuickApplicationWindow::resizeEvent(QResizeEvent *event)
     d->relayout();
 }
 
+class QQuickApplicationWindowAttachedPrivate;
+
+// Finds the active focus control of a plain window once per focus change,
+// and hands it to the attached objects that follow it. An ApplicationWindow
+// tracks its active focus control itself.
+class QQuickWindowFocusTracker : public QObject
+{
+public:
+    static QQuickWindowFocusTracker *get(QQuickWindow *window, bool create);
+    ~QQuickWindowFocusTracker();
+
+    QQuickItem *activeFocusControl() const { return control; }
+
+    void addListener(QQuickApplicationWindowAttachedPrivate *listener);
+    void removeListener(QQuickApplicationWindowAttachedPrivate *listener);
+
+private:
+    explicit QQuickWindowFocusTracker(QQuickWindow *window);
+
+    void update();
+
+    QQuickWindow *window = nullptr;
+    QQuickItem *control = nullptr;
+    QVector<QQuickApplicationWindowAttachedPrivate *> listeners;
+};
+
+typedef QHash<QQuickWindow *, QQuickWindowFocusTracker *> QQuickWindowFocusTrackers;
+Q_GLOBAL_STATIC(QQuickWindowFocusTrackers, windowFocusTrackers)
+
 class QQuickApplicationWindowAttachedPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QQuickApplicationWindowAttached)
 
 public:
+    ~QQuickApplicationWindowAttachedPrivate();
+
     void windowChange(QQuickWindow *wnd);
+    void trackActiveFocus(QQuickWindow *wnd, bool track);
     void activeFocusChange();
+    QQuickItem *currentActiveFocusControl() const;
 
+    bool tracksActiveFocus = false;
     QQuickWindow *window = nullptr;
     QQuickItem *activeFocusControl = nullptr;
 };
 
+QQuickWindowFocusTracker::QQuickWindowFocusTracker(QQuickWindow *window)
+    : QObject(window),
+      window(window),
+      control(findActiveFocusControl(window))
+{
+    connect(window, &QQuickWindow::activeFocusItemChanged, this, &QQuickWindowFocusTracker::update);
+}
+
+QQuickWindowFocusTracker::~QQuickWindowFocusTracker()
+{
+    if (QQuickWindowFocusTrackers *trackers = windowFocusTrackers())
+        trackers->remove(window);
+}
+
+QQuickWindowFocusTracker *QQuickWindowFocusTracker::get(QQuickWindow *window, bool create)
+{
+    QQuickWindowFocusTrackers *trackers = windowFocusTrackers();
+    if (!window || !trackers)
+        return nullptr;
+
+    QQuickWindowFocusTracker *tracker = trackers->value(window);
+    if (!tracker && create) {
+        tracker = new QQuickWindowFocusTracker(window);
+        trackers->insert(window, tracker);
+    }
+    return tracker;
+}
+
+void QQuickWindowFocusTracker::addListener(QQuickApplicationWindowAttachedPrivate *listener)
+{
+    listeners.append(listener);
+}
+
+void QQuickWindowFocusTracker::removeListener(QQuickApplicationWindowAttachedPrivate *listener)
+{
+    listeners.removeOne(listener);
+}
+
+void QQuickWindowFocusTracker::update()
+{
+    QQuickItem *newControl = findActiveFocusControl(window);
+    if (control == newControl)
+        return;
+
+    control = newControl;
+    // a listener may stop following the focus as a result of the notification
+    const QVector<QQuickApplicationWindowAttachedPrivate *> currentListeners = listeners;
+    for (QQuickApplicationWindowAttachedPrivate *listener : currentListeners) {
+        if (listeners.contains(listener))
+            listener->activeFocusChange();
+    }
+}
+
+QQuickApplicationWindowAttachedPrivate::~QQuickApplicationWindowAttachedPrivate()
+{
+    // an attached object may outlive its window, so the window is not touched
+    if (!tracksActiveFocus)
+        return;
+    if (QQuickWindowFocusTracker *tracker = QQuickWindowFocusTracker::get(window, false))
+        tracker->removeListener(this);
+}
+
 void QQuickApplicationWindowAttachedPrivate::windowChange(QQuickWindow *wnd)
 {
     Q_Q(QQuickApplicationWindowAttached);
@@ -868,40 +1097,39 @@ void QQuickApplicationWindowAttachedPrivate::windowChange(QQuickWindow *wnd)
         oldWindow = nullptr; // being deleted (QTBUG-52731)
 
     if (oldWindow) {
-        disconnect(oldWindow, &QQuickApplicationWindow::activeFocusControlChanged,
-                   this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
         QObject::disconnect(oldWindow, &QQuickApplicationWindow::menuBarChanged,
                             q, &QQuickApplicationWindowAttached::menuBarChanged);
         QObject::disconnect(oldWindow, &QQuickApplicationWindow::headerChanged,
                             q, &QQuickApplicationWindowAttached::headerChanged);
         QObject::disconnect(oldWindow, &QQuickApplicationWindow::footerChanged,
                             q, &QQuickApplicationWindowAttached::footerChanged);
-    } else if (window) {
-        disconnect(window, &QQuickWindow::activeFocusItemChanged,
-                   this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
+    }
+    if (tracksActiveFocus) {
+        if (oldWindow)
+            trackActiveFocus(oldWindow, false);
+        else if (QQuickWindowFocusTracker *tracker = QQuickWindowFocusTracker::get(window, false))
+            tracker->removeListener(this);
     }
 
     QQuickApplicationWindow *newWindow = qobject_cast<QQuickApplicationWindow *>(wnd);
     if (newWindow) {
-        connect(newWindow, &QQuickApplicationWindow::activeFocusControlChanged,
-                this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
         QObject::connect(newWindow, &QQuickApplicationWindow::menuBarChanged,
                          q, &QQuickApplicationWindowAttached::menuBarChanged);
         QObject::connect(newWindow, &QQuickApplicationWindow::headerChanged,
                          q, &QQuickApplicationWindowAttached::headerChanged);
         QObject::connect(newWindow, &QQuickApplicationWindow::footerChanged,
                          q, &QQuickApplicationWindowAttached::footerChanged);
-    } else if (wnd) {
-        connect(wnd, &QQuickWindow::activeFocusItemChanged,
-                this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
     }
+    if (tracksActiveFocus)
+        trackActiveFocus(wnd, true);
 
     window = wnd;
     emit q->windowChanged();
     emit q->contentItemChanged();
     emit q->overlayChanged();
 
-    activeFocusChange();
+    if (tracksActiveFocus)
+        activeFocusChange();
     if ((oldWindow && oldWindow->menuBar()) || (newWindow && newWindow->menuBar()))
         emit q->menuBarChanged();
     if ((oldWindow && oldWindow->header()) || (newWindow && newWindow->header()))
@@ -910,14 +1138,44 @@ void QQuickApplicationWindowAttachedPrivate::windowChange(QQuickWindow *wnd)
         emit q->footerChanged();
 }
 
+/*
+    The active focus control is only followed once something connects to
+    activeFocusControlChanged(), such as a binding. Until then, the getter
+    looks it up on demand, so that attached objects that are only used for
+    the other properties do not react to focus changes at all.
+*/
+void QQuickApplicationWindowAttachedPrivate::trackActiveFocus(QQuickWindow *wnd, bool track)
+{
+    if (QQuickApplicationWindow *appWindow = qobject_cast<QQuickApplicationWindow *>(wnd)) {
+        if (track)
+            connect(appWindow, &QQuickApplicationWindow::activeFocusControlChanged,
+                    this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
+        else
+            disconnect(appWindow, &QQuickApplicationWindow::activeFocusControlChanged,
+                       this, &QQuickApplicationWindowAttachedPrivate::activeFocusChange);
+    } else if (QQuickWindowFocusTracker *tracker = QQuickWindowFocusTracker::get(wnd, track)) {
+        if (track)
+            tracker->addListener(this);
+        else
+            tracker->removeListener(this);
+    }
+}
+
+QQuickItem *QQuickApplicationWindowAttachedPrivate::currentActiveFocusControl() const
+{
+    if (QQuickApplicationWindow *appWindow = qobject_cast<QQuickApplicationWindow *>(window))
+        return appWindow->activeFocusControl();
+    if (QQuickWindowFocusTracker *tracker = QQuickWindowFocusTracker::get(window, false))
+        return tracker->activeFocusControl();
+    if (window)
+        return findActiveFocusControl(window);
+    return nullptr;
+}
+
 void QQuickApplicationWindowAttachedPrivate::activeFocusChange()
 {
     Q_Q(QQuickApplicationWindowAttached);
-    QQuickItem *control = nullptr;
-    if (QQuickApplicationWindow *appWindow = qobject_cast<QQuickApplicationWindow *>(window))
-        control = appWindow->activeFocusControl();
-    else if (window)
-        control = findActiveFocusControl(window);
+    QQuickItem *control = currentActiveFocusControl();
     if (activeFocusControl == control)
         return;
 
@@ -993,6 +1251,8 @@ QQuickItem *QQuickApplicationWindowAttached::contentItem() const
 QQuickItem *QQuickApplicationWindowAttached::activeFocusControl() const
 {
     Q_D(const QQuickApplicationWindowAttached);
+    if (!d->tracksActiveFocus)
+        return d->currentActiveFocusControl();
     return d->activeFocusControl;
 }
 
@@ -1069,6 +1329,20 @@ QQuickItem *QQuickApplicationWindowAttached::menuBar() const
     return nullptr;
 }
 
+void QQuickApplicationWindowAttached::connectNotify(const QMetaMethod &signal)
+{
+    Q_D(QQuickApplicationWindowAttached);
+    QObject::connectNotify(signal);
+
+    static const QMetaMethod activeFocusControlSignal = QMetaMethod::fromSignal(&QQuickApplicationWindowAttached::activeFocusControlChanged);
+    if (d->tracksActiveFocus || signal != activeFocusControlSignal)
+        return;
+
+    d->tracksActiveFocus = true;
+    d->activeFocusControl = d->currentActiveFocusControl();
+    d->trackActiveFocus(d->window, true);
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qquickapplicationwindow_p.cpp"
@@ -117,6 +117,10 @@ public:
     QQuickItem *menuBar() const;
     void setMenuBar(QQuickItem *menuBar);
 
+    // 2.5 (Qt 5.12)
+    Q_REVISION(5) Q_INVOKABLE void beginUpdate();
+    Q_REVISION(5) Q_INVOKABLE void endUpdate();
+
 Q_SIGNALS:
     void backgroundChanged();
     void activeFocusControlChanged();
@@ -172,6 +176,9 @@ Q_SIGNALS:
     // 2.3 (Qt 5.10)
     /*Q_REVISION(3)*/ void menuBarChanged();
 
+protected:
+    void connectNotify(const QMetaMethod &signal) override;
+
 private:
     Q_DISABLE_COPY(QQuickApplicationWindowAttached)
     Q_DECLARE_PRIVATE(QQuickApplicationWindowAttached)
@@ -38,6 +38,7 @@
 
 #include <QtCore/private/qobject_p.h>
 #include <QtCore/qmetaobject.h>
+#include <QtCore/qset.h>
 #include <QtCore/qvariant.h>
 #include <QtQml/qqmlinfo.h>
 
@@ -171,6 +172,7 @@ public:
     Qt::CheckState checkState = Qt::Unchecked;
     QPointer<QQuickAbstractButton> checkedButton;
     QVector<QQuickAbstractButton*> buttons;
+    QSet<QQuickAbstractButton*> checkedButtons;
 };
 
 void QQuickButtonGroupPrivate::clear()
@@ -181,6 +183,7 @@ void QQuickButtonGroupPrivate::clear()
         QObjectPrivate::disconnect(button, &QQuickAbstractButton::checkedChanged, this, &QQuickButtonGroupPrivate::_q_updateCurrent);
     }
     buttons.clear();
+    checkedButtons.clear();
 }
 
 void QQuickButtonGroupPrivate::buttonClicked()
@@ -194,8 +197,14 @@ void QQuickButtonGroupPrivate::buttonClicked()
 void QQuickButtonGroupPrivate::_q_updateCurrent()
 {
     Q_Q(QQuickButtonGroup);
+    QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton*>(q->sender());
+    if (button) {
+        if (button->isChecked())
+            checkedButtons.insert(button);
+        else
+            checkedButtons.remove(button);
+    }
     if (exclusive) {
-        QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton*>(q->sender());
         if (button && button->isChecked())
             q->setCheckedButton(button);
         else if (!buttons.contains(checkedButton))
@@ -209,13 +218,10 @@ void QQuickButtonGroupPrivate::updateCheckState()
     if (!complete || settingCheckState)
         return;
 
-    bool anyChecked = false;
-    bool allChecked = !buttons.isEmpty();
-    for (QQuickAbstractButton *button : qAsConst(buttons)) {
-        const bool isChecked = button->isChecked();
-        anyChecked |= isChecked;
-        allChecked &= isChecked;
-    }
+    // checkedButtons is kept up to date as the buttons are toggled, added and
+    // removed, so the aggregate state does not require scanning all buttons
+    const bool anyChecked = !checkedButtons.isEmpty();
+    const bool allChecked = !buttons.isEmpty() && checkedButtons.count() == buttons.count();
     setCheckState(Qt::CheckState(anyChecked + allChecked));
 }
 
@@ -442,6 +448,8 @@ void QQuickButtonGroup::addButton(QQuickAbstractButton *button)
         setCheckedButton(button);
 
     d->buttons.append(button);
+    if (button->isChecked())
+        d->checkedButtons.insert(button);
     d->updateCheckState();
     emit buttonsChanged();
 }
@@ -471,6 +479,7 @@ void QQuickButtonGroup::removeButton(QQuickAbstractButton *button)
         setCheckedButton(nullptr);
 
     d->buttons.removeOne(button);
+    d->checkedButtons.remove(button);
     d->updateCheckState();
     emit buttonsChanged();
 }
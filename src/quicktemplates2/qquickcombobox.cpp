@@ -43,17 +43,21 @@
 
 #include <QtCore/qregexp.h>
 #include <QtCore/qabstractitemmodel.h>
+#include <QtCore/qpointer.h>
 #include <QtGui/qinputmethod.h>
 #include <QtGui/qguiapplication.h>
 #include <QtGui/qpa/qplatformtheme.h>
 #include <QtQml/qjsvalue.h>
 #include <QtQml/qqmlcontext.h>
 #include <QtQml/private/qlazilyallocated_p.h>
+#include <QtQml/private/qqmlchangeset_p.h>
 #include <QtQml/private/qqmldelegatemodel_p.h>
 #include <QtQuick/private/qquickevents_p_p.h>
 #include <QtQuick/private/qquicktextinput_p.h>
 #include <QtQuick/private/qquickitemview_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -187,20 +191,61 @@ public:
     QString stringValue(int index, const QString &role) override;
 
 private:
+    // The combo box creates a new delegate model whenever its model changes,
+    // so the kind of the model can be resolved once, at construction.
+    enum ModelType {
+        OtherModel,
+        VariantListModel,
+        StringListModel,
+        ItemModel
+    };
+
+    int itemModelRole(const QString &role);
+
     QQuickComboBox *combo = nullptr;
+    ModelType modelType = OtherModel;
+    QVariantList variantList;
+    QStringList stringList;
+    QPointer<QAbstractItemModel> itemModel;
+    QString resolvedRole;
+    int resolvedRoleIndex = -1;
 };
 
 QQuickComboBoxDelegateModel::QQuickComboBoxDelegateModel(QQuickComboBox *combo)
     : QQmlDelegateModel(qmlContext(combo), combo),
       combo(combo)
 {
+    const QVariant model = combo->model();
+    if (model.userType() == QMetaType::QVariantList) {
+        modelType = VariantListModel;
+        variantList = model.toList();
+    } else if (model.userType() == QMetaType::QStringList) {
+        modelType = StringListModel;
+        stringList = model.toStringList();
+    } else if (QAbstractItemModel *aim = qvariant_cast<QAbstractItemModel *>(model)) {
+        modelType = ItemModel;
+        itemModel = aim;
+        // role names may change when the model is reset
+        QObject::connect(aim, &QAbstractItemModel::modelReset, this, [this]() { resolvedRole.clear(); });
+    }
+}
+
+int QQuickComboBoxDelegateModel::itemModelRole(const QString &role)
+{
+    if (resolvedRole.isNull() || resolvedRole != role) {
+        resolvedRole = role;
+        resolvedRoleIndex = itemModel->roleNames().key(role.toUtf8(), -1);
+    }
+    return resolvedRoleIndex;
 }
 
 QString QQuickComboBoxDelegateModel::stringValue(int index, const QString &role)
 {
-    QVariant model = combo->model();
-    if (model.userType() == QMetaType::QVariantList) {
-        QVariant object = model.toList().value(index);
+    switch (modelType) {
+    case VariantListModel: {
+        if (index < 0 || index >= variantList.count())
+            break;
+        const QVariant &object = variantList.at(index);
         if (object.userType() == QMetaType::QVariantMap) {
             const QVariantMap data = object.toMap();
             if (data.count() == 1 && role == QLatin1String("modelData"))
@@ -211,6 +256,23 @@ QString QQuickComboBoxDelegateModel::stringValue(int index, const QString &role)
             if (data && role != QLatin1String("modelData"))
                 return data->property(role.toUtf8()).toString();
         }
+        break;
+    }
+    case StringListModel:
+        if (role == QLatin1String("modelData"))
+            return stringList.value(index);
+        break;
+    case ItemModel:
+        if (itemModel) {
+            const int roleIndex = itemModelRole(role);
+            if (roleIndex != -1) {
+                const QModelIndex parent = qvariant_cast<QModelIndex>(rootIndex());
+                return itemModel->data(itemModel->index(index, 0, parent), roleIndex).toString();
+            }
+        }
+        break;
+    default:
+        break;
     }
     return QQmlDelegateModel::stringValue(index, role);
 }
@@ -230,7 +292,9 @@ public:
     void itemHovered();
 
     void createdItem(int index, QObject *object);
-    void modelUpdated();
+    void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
+    void itemModelDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+    bool affectsCurrentIndex(const QQmlChangeSet &changeSet) const;
     void countChanged();
 
     void updateEditText();
@@ -248,6 +312,16 @@ public:
     void keySearch(const QString &text);
     int match(int start, const QString &text, Qt::MatchFlags flags) const;
 
+    struct IndexedText {
+        QString foldedText;
+        int index;
+    };
+    typedef QVector<IndexedText>::const_iterator IndexedTextIterator;
+
+    void invalidateTexts();
+    const QStringList &texts() const;
+    QPair<IndexedTextIterator, IndexedTextIterator> textsWithPrefix(const QString &prefix) const;
+
     void createDelegateModel();
 
     void handlePress(const QPointF &point) override;
@@ -259,7 +333,7 @@ public:
     void executeIndicator(bool complete = false);
 
     void cancelPopup();
-    void executePopup(bool complete = false);
+    void executePopup(bool complete = false) override;
 
     bool flat = false;
     bool down = false;
@@ -290,6 +364,11 @@ public:
         QValidator *validator = nullptr;
     };
     QLazilyAllocated<ExtraData> extra;
+
+    // the texts of the model rows, built on demand for searching
+    mutable QStringList textCache;
+    mutable QVector<IndexedText> textIndex; // sorted by case folded text
+    mutable bool textCacheValid = false;
 };
 
 bool QQuickComboBoxPrivate::isPopupVisible() const
@@ -398,15 +477,47 @@ void QQuickComboBoxPrivate::createdItem(int index, QObject *object)
         updateCurrentText();
 }
 
-void QQuickComboBoxPrivate::modelUpdated()
+void QQuickComboBoxPrivate::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
 {
+    invalidateTexts();
+    if (!reset && !affectsCurrentIndex(changeSet))
+        return;
     if (!extra.isAllocated() || !extra->accepting)
         updateCurrentText();
 }
 
+void QQuickComboBoxPrivate::itemModelDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    if (currentIndex >= topLeft.row() && currentIndex <= bottomRight.row())
+        updateCurrentText();
+}
+
+bool QQuickComboBoxPrivate::affectsCurrentIndex(const QQmlChangeSet &changeSet) const
+{
+    if (currentIndex == -1)
+        return !changeSet.inserts().isEmpty();
+
+    // the current index is not adjusted for inserted or removed rows,
+    // so any insertion or removal at or before it changes its text
+    for (const QQmlChangeSet::Change &remove : changeSet.removes()) {
+        if (remove.index <= currentIndex)
+            return true;
+    }
+    for (const QQmlChangeSet::Change &insert : changeSet.inserts()) {
+        if (insert.index <= currentIndex)
+            return true;
+    }
+    for (const QQmlChangeSet::Change &change : changeSet.changes()) {
+        if (currentIndex >= change.start() && currentIndex < change.end())
+            return true;
+    }
+    return false;
+}
+
 void QQuickComboBoxPrivate::countChanged()
 {
     Q_Q(QQuickComboBox);
+    invalidateTexts();
     if (q->count() == 0)
         q->setCurrentIndex(-1);
     emit q->countChanged();
@@ -467,24 +578,23 @@ void QQuickComboBoxPrivate::acceptInput()
 
 QString QQuickComboBoxPrivate::tryComplete(const QString &input)
 {
-    Q_Q(QQuickComboBox);
-    QString match;
-
-    const int itemCount = q->count();
-    for (int idx = 0; idx < itemCount; ++idx) {
-        const QString text = q->textAt(idx);
-        if (!text.startsWith(input, Qt::CaseInsensitive))
-            continue;
+    const QStringList &allTexts = texts();
+    int match = -1;
 
+    const auto range = textsWithPrefix(input);
+    for (auto it = range.first; it != range.second; ++it) {
         // either the first or the shortest match
-        if (match.isEmpty() || text.length() < match.length())
-            match = text;
+        const int length = allTexts.at(it->index).length();
+        if (match == -1 || length < allTexts.at(match).length()
+                || (length == allTexts.at(match).length() && it->index < match)) {
+            match = it->index;
+        }
     }
 
-    if (match.isEmpty())
+    if (match == -1)
         return input;
 
-    return input + match.mid(input.length());
+    return input + allTexts.at(match).mid(input.length());
 }
 
 void QQuickComboBoxPrivate::setCurrentIndex(int index, Activation activate)
@@ -566,32 +676,51 @@ void QQuickComboBoxPrivate::keySearch(const QString &text)
 
 int QQuickComboBoxPrivate::match(int start, const QString &text, Qt::MatchFlags flags) const
 {
-    Q_Q(const QQuickComboBox);
+    const QStringList &allTexts = texts();
     uint matchType = flags & 0x0F;
     bool wrap = flags & Qt::MatchWrap;
     Qt::CaseSensitivity cs = flags & Qt::MatchCaseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
     int from = start;
-    int to = q->count();
+    int to = allTexts.count();
+
+    if (matchType == Qt::MatchStartsWith) {
+        // the first match at or after start, or before start if wrapping
+        int result = -1;
+        int wrappedResult = -1;
+        const auto range = textsWithPrefix(text);
+        for (auto it = range.first; it != range.second; ++it) {
+            const int idx = it->index;
+            if (cs == Qt::CaseSensitive && !allTexts.at(idx).startsWith(text))
+                continue;
+            if (idx >= from) {
+                if (result == -1 || idx < result)
+                    result = idx;
+            } else if (wrap) {
+                if (wrappedResult == -1 || idx < wrappedResult)
+                    wrappedResult = idx;
+            }
+        }
+        return result != -1 ? result : wrappedResult;
+    }
+
+    QRegExp regExp;
+    if (matchType == Qt::MatchRegExp)
+        regExp = QRegExp(text, cs);
+    else if (matchType == Qt::MatchWildcard)
+        regExp = QRegExp(text, cs, QRegExp::Wildcard);
 
     // iterates twice if wrapping
     for (int i = 0; (wrap && i < 2) || (!wrap && i < 1); ++i) {
         for (int idx = from; idx < to; ++idx) {
-            QString t = q->textAt(idx);
+            const QString &t = allTexts.at(idx);
             switch (matchType) {
             case Qt::MatchExactly:
                 if (t == text)
                     return idx;
                 break;
             case Qt::MatchRegExp:
-                if (QRegExp(text, cs).exactMatch(t))
-                    return idx;
-                break;
             case Qt::MatchWildcard:
-                if (QRegExp(text, cs, QRegExp::Wildcard).exactMatch(t))
-                    return idx;
-                break;
-            case Qt::MatchStartsWith:
-                if (t.startsWith(text, cs))
+                if (regExp.exactMatch(t))
                     return idx;
                 break;
             case Qt::MatchEndsWith:
@@ -616,6 +745,53 @@ int QQuickComboBoxPrivate::match(int start, const QString &text, Qt::MatchFlags
     return -1;
 }
 
+void QQuickComboBoxPrivate::invalidateTexts()
+{
+    textCache.clear();
+    textIndex.clear();
+    textCacheValid = false;
+}
+
+const QStringList &QQuickComboBoxPrivate::texts() const
+{
+    Q_Q(const QQuickComboBox);
+    if (!textCacheValid) {
+        const int count = q->count();
+        textCache.reserve(count);
+        for (int idx = 0; idx < count; ++idx)
+            textCache += q->textAt(idx);
+        textCacheValid = true;
+    }
+    return textCache;
+}
+
+/*
+    Returns the range of the text index that starts with \a prefix, compared
+    case insensitively. The index is built on first use, and invalidated
+    together with the texts when the model changes.
+*/
+QPair<QQuickComboBoxPrivate::IndexedTextIterator, QQuickComboBoxPrivate::IndexedTextIterator> QQuickComboBoxPrivate::textsWithPrefix(const QString &prefix) const
+{
+    const QStringList &allTexts = texts();
+    if (textIndex.isEmpty() && !allTexts.isEmpty()) {
+        textIndex.reserve(allTexts.count());
+        for (int idx = 0; idx < allTexts.count(); ++idx)
+            textIndex += IndexedText{allTexts.at(idx).toCaseFolded(), idx};
+        std::stable_sort(textIndex.begin(), textIndex.end(), [](const IndexedText &a, const IndexedText &b) {
+            return a.foldedText < b.foldedText;
+        });
+    }
+
+    const QString foldedPrefix = prefix.toCaseFolded();
+    const auto first = std::lower_bound(textIndex.cbegin(), textIndex.cend(), foldedPrefix, [](const IndexedText &item, const QString &prefix) {
+        return item.foldedText < prefix;
+    });
+    const auto last = std::upper_bound(first, textIndex.cend(), foldedPrefix, [](const QString &prefix, const IndexedText &item) {
+        return !item.foldedText.startsWith(prefix) && prefix < item.foldedText;
+    });
+    return qMakePair(first, last);
+}
+
 void QQuickComboBoxPrivate::createDelegateModel()
 {
     Q_Q(QQuickComboBox);
@@ -627,6 +803,7 @@ void QQuickComboBoxPrivate::createDelegateModel()
         disconnect(delegateModel, &QQmlInstanceModel::createdItem, this, &QQuickComboBoxPrivate::createdItem);
     }
 
+    invalidateTexts();
     ownModel = false;
     delegateModel = model.value<QQmlInstanceModel *>();
 
@@ -701,7 +878,7 @@ void QQuickComboBoxPrivate::executeIndicator(bool complete)
     if (!indicator || complete)
         quickBeginDeferred(q, indicatorName(), indicator);
     if (complete)
-        quickCompleteDeferred(q, indicatorName(), indicator);
+        quickCompleteDeferred(q, indicator);
 }
 
 static inline QString popupName() { return QStringLiteral("popup"); }
@@ -721,7 +898,7 @@ void QQuickComboBoxPrivate::executePopup(bool complete)
     if (!popup || complete)
         quickBeginDeferred(q, popupName(), popup);
     if (complete)
-        quickCompleteDeferred(q, popupName(), popup);
+        quickCompleteDeferred(q, popup);
 }
 
 QQuickComboBox::QQuickComboBox(QQuickItem *parent)
@@ -795,9 +972,9 @@ void QQuickComboBox::setModel(const QVariant& m)
         return;
 
     if (QAbstractItemModel* aim = qvariant_cast<QAbstractItemModel *>(d->model))
-        QObjectPrivate::disconnect(aim, &QAbstractItemModel::dataChanged, d, &QQuickComboBoxPrivate::updateCurrentText);
+        QObjectPrivate::disconnect(aim, &QAbstractItemModel::dataChanged, d, &QQuickComboBoxPrivate::itemModelDataChanged);
     if (QAbstractItemModel* aim = qvariant_cast<QAbstractItemModel *>(model))
-        QObjectPrivate::connect(aim, &QAbstractItemModel::dataChanged, d, &QQuickComboBoxPrivate::updateCurrentText);
+        QObjectPrivate::connect(aim, &QAbstractItemModel::dataChanged, d, &QQuickComboBoxPrivate::itemModelDataChanged);
 
     d->model = model;
     d->createDelegateModel();
@@ -975,6 +1152,7 @@ void QQuickComboBox::setTextRole(const QString &role)
         return;
 
     d->textRole = role;
+    d->invalidateTexts();
     if (isComponentComplete())
         d->updateCurrentText();
     emit textRoleChanged();
@@ -1377,13 +1555,8 @@ QString QQuickComboBox::textAt(int index) const
     if (!d->delegateModel || index < 0 || index >= d->delegateModel->count())
         return QString();
 
-    QString text;
-    QObject *object = d->delegateModel->object(index);
-    if (object) {
-        text = d->delegateModel->stringValue(index, d->textRole.isEmpty() ? QStringLiteral("modelData") : d->textRole);
-        d->delegateModel->release(object);
-    }
-    return text;
+    // the text is read from the model, without instantiating the delegate
+    return d->delegateModel->stringValue(index, d->textRole.isEmpty() ? QStringLiteral("modelData") : d->textRole);
 }
 
 /*!
@@ -1631,9 +1804,12 @@ void QQuickComboBox::componentComplete()
     QQuickControl::componentComplete();
     if (d->popup)
         d->executePopup(true);
+    else
+        d->incubatePopup();
 
     if (d->delegateModel && d->ownModel)
         static_cast<QQmlDelegateModel *>(d->delegateModel)->componentComplete();
+    d->invalidateTexts();
 
     if (count() > 0) {
         if (!d->hasCurrentIndex && d->currentIndex == -1)
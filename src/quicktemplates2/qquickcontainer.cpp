@@ -196,8 +196,8 @@ void QQuickContainerPrivate::init()
 {
     Q_Q(QQuickContainer);
     contentModel = new QQmlObjectModel(q);
-    QObject::connect(contentModel, &QQmlObjectModel::countChanged, q, &QQuickContainer::countChanged);
-    QObject::connect(contentModel, &QQmlObjectModel::childrenChanged, q, &QQuickContainer::contentChildrenChanged);
+    QObjectPrivate::connect(contentModel, &QQmlObjectModel::countChanged, this, &QQuickContainerPrivate::contentModelCountChanged);
+    QObjectPrivate::connect(contentModel, &QQmlObjectModel::childrenChanged, this, &QQuickContainerPrivate::contentModelChildrenChanged);
 }
 
 void QQuickContainerPrivate::cleanup()
@@ -220,8 +220,8 @@ void QQuickContainerPrivate::cleanup()
         delete contentItem;
     }
 
-    QObject::disconnect(contentModel, &QQmlObjectModel::countChanged, q, &QQuickContainer::countChanged);
-    QObject::disconnect(contentModel, &QQmlObjectModel::childrenChanged, q, &QQuickContainer::contentChildrenChanged);
+    QObjectPrivate::disconnect(contentModel, &QQmlObjectModel::countChanged, this, &QQuickContainerPrivate::contentModelCountChanged);
+    QObjectPrivate::disconnect(contentModel, &QQmlObjectModel::childrenChanged, this, &QQuickContainerPrivate::contentModelChildrenChanged);
     delete contentModel;
 }
 
@@ -230,6 +230,24 @@ QQuickItem *QQuickContainerPrivate::itemAt(int index) const
     return qobject_cast<QQuickItem *>(contentModel->get(index));
 }
 
+/*
+    QQmlObjectModel::indexOf() is a linear search, which made populating
+    and re-synchronizing large containers quadratic. The indexes are cached
+    and the cache is rebuilt lazily after anything but an append.
+*/
+int QQuickContainerPrivate::indexOf(QQuickItem *item) const
+{
+    if (indexCacheDirty) {
+        const int count = contentModel->count();
+        indexCache.clear();
+        indexCache.reserve(count);
+        for (int i = 0; i < count; ++i)
+            indexCache.insert(contentModel->get(i), i);
+        indexCacheDirty = false;
+    }
+    return indexCache.value(item, -1);
+}
+
 void QQuickContainerPrivate::insertItem(int index, QQuickItem *item)
 {
     Q_Q(QQuickContainer);
@@ -241,7 +259,13 @@ void QQuickContainerPrivate::insertItem(int index, QQuickItem *item)
 
     item->setParentItem(effectiveContentItem(contentItem));
     QQuickItemPrivate::get(item)->addItemChangeListener(this, changeTypes);
+
+    const bool append = !indexCacheDirty && index == contentModel->count();
     contentModel->insert(index, item);
+    if (append) {
+        indexCache.insert(item, index);
+        indexCacheDirty = false;
+    }
 
     q->itemAdded(index, item);
 
@@ -255,6 +279,48 @@ void QQuickContainerPrivate::insertItem(int index, QQuickItem *item)
     updatingCurrent = false;
 }
 
+void QQuickContainerPrivate::insertItems(int index, const QList<QQuickItem *> &items)
+{
+    Q_Q(QQuickContainer);
+    const int oldCount = contentModel->count();
+
+    insertingItems = true;
+    updatingCurrent = true;
+
+    int to = index;
+    for (QQuickItem *item : items) {
+        if (!q->isContent(item))
+            continue;
+        contentData.append(item);
+        item->setParentItem(effectiveContentItem(contentItem));
+        QQuickItemPrivate::get(item)->addItemChangeListener(this, changeTypes);
+
+        const bool append = !indexCacheDirty && to == contentModel->count();
+        contentModel->insert(to, item);
+        if (append) {
+            indexCache.insert(item, to);
+            indexCacheDirty = false;
+        }
+
+        q->itemAdded(to++, item);
+    }
+
+    const int count = contentModel->count();
+    for (int i = to; i < count; ++i)
+        q->itemMoved(i, itemAt(i));
+
+    if (oldCount == 0 && count > 0 && currentIndex == -1)
+        q->setCurrentIndex(index);
+
+    updatingCurrent = false;
+    insertingItems = false;
+
+    if (count != oldCount) {
+        emit q->countChanged();
+        emit q->contentChildrenChanged();
+    }
+}
+
 void QQuickContainerPrivate::moveItem(int from, int to, QQuickItem *item)
 {
     Q_Q(QQuickContainer);
@@ -329,7 +395,7 @@ void QQuickContainerPrivate::reorderItems()
         QQuickItem* sibling = siblings.at(i);
         if (QQuickItemPrivate::get(sibling)->isTransparentForPositioner())
             continue;
-        int index = contentModel->indexOf(sibling, nullptr);
+        int index = indexOf(sibling);
         q->moveItem(index, to++);
     }
 }
@@ -342,7 +408,7 @@ void QQuickContainerPrivate::addObject(QObject *obj)
     if (item) {
         if (QQuickItemPrivate::get(item)->isTransparentForPositioner())
             item->setParentItem(effectiveContentItem(contentItem));
-        else if (contentModel->indexOf(item, nullptr) == -1)
+        else if (indexOf(item) == -1)
             q->addItem(item);
     } else {
         contentData.append(obj);
@@ -356,10 +422,29 @@ void QQuickContainerPrivate::_q_currentIndexChanged()
         q->setCurrentIndex(contentItem ? contentItem->property("currentIndex").toInt() : -1);
 }
 
+void QQuickContainerPrivate::contentModelCountChanged()
+{
+    Q_Q(QQuickContainer);
+    if (!insertingItems)
+        emit q->countChanged();
+}
+
+void QQuickContainerPrivate::contentModelChildrenChanged()
+{
+    Q_Q(QQuickContainer);
+    indexCacheDirty = true;
+    if (!insertingItems)
+        emit q->contentChildrenChanged();
+}
+
 void QQuickContainerPrivate::itemChildAdded(QQuickItem *, QQuickItem *child)
 {
-    // add dynamically reparented items (eg. by a Repeater)
-    if (!QQuickItemPrivate::get(child)->isTransparentForPositioner() && !contentData.contains(child))
+    // add dynamically reparented items (eg. by a Repeater). An item that is
+    // being inserted has already been appended to contentData, but is not
+    // yet in the content model.
+    if (QQuickItemPrivate::get(child)->isTransparentForPositioner())
+        return;
+    if ((contentData.isEmpty() || contentData.last() != child) && indexOf(child) == -1)
         insertItem(contentModel->count(), child);
 }
 
@@ -367,7 +452,7 @@ void QQuickContainerPrivate::itemParentChanged(QQuickItem *item, QQuickItem *par
 {
     // remove dynamically unparented items (eg. by a Repeater)
     if (!parent)
-        removeItem(contentModel->indexOf(item, nullptr), item);
+        removeItem(indexOf(item), item);
 }
 
 void QQuickContainerPrivate::itemSiblingOrderChanged(QQuickItem *)
@@ -381,7 +466,7 @@ void QQuickContainerPrivate::itemSiblingOrderChanged(QQuickItem *)
 
 void QQuickContainerPrivate::itemDestroyed(QQuickItem *item)
 {
-    int index = contentModel->indexOf(item, nullptr);
+    int index = indexOf(item);
     if (index != -1)
         removeItem(index, item);
 }
@@ -503,7 +588,7 @@ void QQuickContainer::insertItem(int index, QQuickItem *item)
     if (index < 0 || index > count)
         index = count;
 
-    int oldIndex = d->contentModel->indexOf(item, nullptr);
+    int oldIndex = d->indexOf(item);
     if (oldIndex != -1) {
         if (oldIndex < index)
             --index;
@@ -514,6 +599,41 @@ void QQuickContainer::insertItem(int index, QQuickItem *item)
     }
 }
 
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlmethod void QtQuick.Controls::Container::insertItems(int index, list<Item> items)
+
+    Inserts a list of \a items at \a index.
+
+    This is faster than inserting the items one by one, especially when
+    populating a container with a large amount of items. The \l count and
+    \l contentChildren properties change only once. Items that are \c null
+    or already in the container are ignored.
+
+    \sa insertItem()
+*/
+void QQuickContainer::insertItems(int index, const QVariantList &items)
+{
+    Q_D(QQuickContainer);
+    const int count = d->contentModel->count();
+    if (index < 0 || index > count)
+        index = count;
+
+    QList<QQuickItem *> newItems;
+    newItems.reserve(items.count());
+    QSet<QQuickItem *> seen;
+    for (const QVariant &var : items) {
+        QQuickItem *item = var.value<QQuickItem *>();
+        if (!item || d->indexOf(item) != -1 || seen.contains(item))
+            continue;
+        seen.insert(item);
+        newItems += item;
+    }
+
+    if (!newItems.isEmpty())
+        d->insertItems(index, newItems);
+}
+
 /*!
     \qmlmethod void QtQuick.Controls::Container::moveItem(int from, int to)
 
@@ -561,7 +681,7 @@ void QQuickContainer::removeItem(QQuickItem *item)
     if (!item)
         return;
 
-    const int index = d->contentModel->indexOf(item, nullptr);
+    const int index = d->indexOf(item);
     if (index == -1)
         return;
 
@@ -762,7 +882,7 @@ void QQuickContainer::itemChange(ItemChange change, const ItemChangeData &data)
     Q_D(QQuickContainer);
     QQuickControl::itemChange(change, data);
     if (change == QQuickItem::ItemChildAddedChange && isComponentComplete() && data.item != d->background && data.item != d->contentItem) {
-        if (!QQuickItemPrivate::get(data.item)->isTransparentForPositioner() && d->contentModel->indexOf(data.item, nullptr) == -1)
+        if (!QQuickItemPrivate::get(data.item)->isTransparentForPositioner() && d->indexOf(data.item) == -1)
             addItem(data.item);
     }
 }
@@ -79,6 +79,8 @@ public:
     void removeItem(QQuickItem *item); // ### Qt 6: Q_INVOKABLE
     // 2.3 (Qt 5.10)
     Q_REVISION(3) Q_INVOKABLE QQuickItem *takeItem(int index);
+    // 2.5 (Qt 5.12)
+    Q_REVISION(5) Q_INVOKABLE void insertItems(int index, const QVariantList &items);
 
     QVariant contentModel() const;
     QQmlListProperty<QObject> contentData();
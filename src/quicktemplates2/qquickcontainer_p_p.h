@@ -69,7 +69,9 @@ public:
     void cleanup();
 
     QQuickItem *itemAt(int index) const;
+    int indexOf(QQuickItem *item) const;
     void insertItem(int index, QQuickItem *item);
+    void insertItems(int index, const QList<QQuickItem *> &items);
     void moveItem(int from, int to, QQuickItem *item);
     void removeItem(int index, QQuickItem *item);
     void reorderItems();
@@ -77,6 +79,8 @@ public:
     void addObject(QObject *obj);
 
     void _q_currentIndexChanged();
+    void contentModelCountChanged();
+    void contentModelChildrenChanged();
 
     void itemChildAdded(QQuickItem *item, QQuickItem *child) override;
     void itemSiblingOrderChanged(QQuickItem *item) override;
@@ -97,6 +101,9 @@ public:
     QQmlObjectModel *contentModel = nullptr;
     int currentIndex = -1;
     bool updatingCurrent = false;
+    bool insertingItems = false;
+    mutable bool indexCacheDirty = false;
+    mutable QHash<QObject *, int> indexCache;
     QQuickItemPrivate::ChangeTypes changeTypes = Destroyed | Parent | SiblingOrder;
 };
 
@@ -39,21 +39,18 @@
 
 #include <QtGui/qstylehints.h>
 #include <QtGui/qguiapplication.h>
-#include "qquicklabel_p.h"
-#include "qquicklabel_p_p.h"
 #include "qquicktextarea_p.h"
-#include "qquicktextarea_p_p.h"
 #include "qquicktextfield_p.h"
-#include "qquicktextfield_p_p.h"
 #include "qquickpopup_p.h"
-#include "qquickpopupitem_p_p.h"
 #include "qquickapplicationwindow_p.h"
 #include "qquickdeferredexecute_p_p.h"
+#include "qquickimplicitsizer_p_p.h"
 
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformtheme.h>
 
 #if QT_CONFIG(accessibility)
+#include <QtCore/qset.h>
 #include <QtQuick/private/qquickaccessibleattached_p.h>
 #endif
 
@@ -81,7 +78,15 @@ QT_BEGIN_NAMESPACE
     are typically based on the implicit sizes of the background and the content
     item plus any \l {Control::}{padding}. These properties determine how large
     the control will be when no explicit \l {Item::}{width} or
-    \l {Item::}{height} is specified.
+    \l {Item::}{height} is specified. Some controls of the built-in styles
+    calculate the implicit width and height natively, as the larger of the
+    implicit size of the background, and the implicit size of the content
+    item plus the padding. The calculation is turned off for a dimension that
+    the user binds or assigns.
+
+    \note A custom control that is based directly on a
+    \l {Qt Quick Templates 2}{template} does not get this calculation. Its
+    implicit width and height are \c 0 unless they are bound or assigned.
 
     The \l {Control::}{background} item fills the entire width and height of the
     control, unless an explicit size has been given for it.
@@ -106,19 +111,111 @@ static bool isKeyFocusReason(Qt::FocusReason reason)
 }
 
 QQuickControlPrivate::QQuickControlPrivate()
+    : hasTopPadding(false),
+      hasLeftPadding(false),
+      hasRightPadding(false),
+      hasBottomPadding(false),
+      hasLocale(false),
+      wheelEnabled(false),
+      hasImplicitSizePolicy(false),
+      explicitImplicitWidth(false),
+      explicitImplicitHeight(false),
+      delegatesDeferred(false),
+      popupIncubation(true),
+      suspended(false)
 {
+#if QT_CONFIG(quicktemplates2_hover)
+    hovered = false;
+    hoverEnabledValue = false;
+    explicitHoverEnabled = false;
+    handlesHover = false;
+#endif
 #if QT_CONFIG(accessibility)
-    QAccessible::installActivationObserver(this);
+    addAccessibilityObserver(this);
 #endif
 }
 
 QQuickControlPrivate::~QQuickControlPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::removeActivationObserver(this);
+    removeAccessibilityObserver(this);
 #endif
 }
 
+void QQuickControlPrivate::implicitWidthChanged()
+{
+    QQuickItemPrivate::implicitWidthChanged();
+    // someone else than the sizer assigned the implicit width
+    if (implicitSizer && !implicitSizer->isUpdating())
+        implicitSizer->release(Qt::Horizontal);
+}
+
+void QQuickControlPrivate::implicitHeightChanged()
+{
+    QQuickItemPrivate::implicitHeightChanged();
+    if (implicitSizer && !implicitSizer->isUpdating())
+        implicitSizer->release(Qt::Vertical);
+}
+
+/*!
+    \internal
+
+    Sets up the default implicit size policy for the dimensions that are
+    neither bound nor assigned when the control is completed: the larger of
+    the implicit size of the background, and the implicit size of the content
+    item plus the padding.
+*/
+void QQuickControlPrivate::initImplicitSize()
+{
+    Q_Q(QQuickControl);
+    if (!hasImplicitSizePolicy || implicitSizer)
+        return;
+
+    const bool width = !explicitImplicitWidth;
+    const bool height = !explicitImplicitHeight;
+    if (!width && !height)
+        return;
+
+    implicitSizer.reset(new QQuickImplicitSizer(q, width, height));
+    implicitSizer->setBackground(background);
+    implicitSizer->setContentItem(contentItem);
+    implicitSizer->update();
+}
+
+/*!
+    \internal
+
+    Turns the default implicit size policy on or off. It is off by default,
+    and turned on by the style types that do not bind the implicit size.
+*/
+void QQuickControlPrivate::setImplicitSizePolicy(bool enabled)
+{
+    if (hasImplicitSizePolicy == enabled)
+        return;
+
+    hasImplicitSizePolicy = enabled;
+    if (!enabled)
+        implicitSizer.reset();
+    else if (componentComplete)
+        initImplicitSize();
+}
+
+void QQuickControlPrivate::updateImplicitSize()
+{
+    if (implicitSizer)
+        implicitSizer->update();
+}
+
+qreal QQuickControlPrivate::getContentWidth() const
+{
+    return contentItem ? contentItem->implicitWidth() : 0;
+}
+
+qreal QQuickControlPrivate::getContentHeight() const
+{
+    return contentItem ? contentItem->implicitHeight() : 0;
+}
+
 #if QT_CONFIG(quicktemplates2_multitouch)
 bool QQuickControlPrivate::acceptTouch(const QTouchEvent::TouchPoint &point)
 {
@@ -190,6 +287,7 @@ void QQuickControlPrivate::setTopPadding(qreal value, bool reset)
         emit q->availableHeightChanged();
         q->paddingChange(QMarginsF(leftPadding, topPadding, rightPadding, bottomPadding),
                          QMarginsF(leftPadding, oldPadding, rightPadding, bottomPadding));
+        updateImplicitSize();
     }
 }
 
@@ -204,6 +302,7 @@ void QQuickControlPrivate::setLeftPadding(qreal value, bool reset)
         emit q->availableWidthChanged();
         q->paddingChange(QMarginsF(leftPadding, topPadding, rightPadding, bottomPadding),
                          QMarginsF(oldPadding, topPadding, rightPadding, bottomPadding));
+        updateImplicitSize();
     }
 }
 
@@ -218,6 +317,7 @@ void QQuickControlPrivate::setRightPadding(qreal value, bool reset)
         emit q->availableWidthChanged();
         q->paddingChange(QMarginsF(leftPadding, topPadding, rightPadding, bottomPadding),
                          QMarginsF(leftPadding, topPadding, oldPadding, bottomPadding));
+        updateImplicitSize();
     }
 }
 
@@ -232,6 +332,7 @@ void QQuickControlPrivate::setBottomPadding(qreal value, bool reset)
         emit q->availableHeightChanged();
         q->paddingChange(QMarginsF(leftPadding, topPadding, rightPadding, bottomPadding),
                          QMarginsF(leftPadding, topPadding, rightPadding, oldPadding));
+        updateImplicitSize();
     }
 }
 
@@ -262,8 +363,12 @@ void QQuickControlPrivate::resizeContent()
 
 QQuickItem *QQuickControlPrivate::getContentItem()
 {
-    if (!contentItem)
-        executeContentItem();
+    if (!contentItem) {
+        if (delegatesDeferred)
+            executeDeferredDelegates();
+        else
+            executeContentItem();
+    }
     return contentItem;
 }
 
@@ -279,6 +384,10 @@ void QQuickControlPrivate::setContentItem_helper(QQuickItem *item, bool notify)
     q->contentItemChange(item, contentItem);
     delete contentItem;
     contentItem = item;
+    if (implicitSizer) {
+        implicitSizer->setContentItem(item);
+        implicitSizer->update();
+    }
 
     if (item) {
         if (!item->parentItem())
@@ -295,6 +404,9 @@ void QQuickControlPrivate::setContentItem_helper(QQuickItem *item, bool notify)
 void QQuickControlPrivate::accessibilityActiveChanged(bool active)
 {
     Q_Q(QQuickControl);
+    // incomplete controls are set up in componentComplete()
+    if (!componentComplete)
+        return;
     return q->accessibilityActiveChanged(active);
 }
 
@@ -310,6 +422,42 @@ QQuickAccessibleAttached *QQuickControlPrivate::accessibleAttached(const QObject
         return nullptr;
     return QQuickAccessibleAttached::attachedProperties(object);
 }
+
+// QAccessible keeps its activation observers in a list, which makes creating
+// and destroying thousands of controls quadratic. Instead, a single observer
+// is installed that notifies the controls, which are kept in a set.
+class QQuickAccessibilityObservers : public QAccessible::ActivationObserver
+{
+public:
+    QQuickAccessibilityObservers() { QAccessible::installActivationObserver(this); }
+    ~QQuickAccessibilityObservers() { QAccessible::removeActivationObserver(this); }
+
+    void accessibilityActiveChanged(bool active) override
+    {
+        // the observers may create or destroy other observers
+        const QSet<QAccessible::ActivationObserver *> current = observers;
+        for (QAccessible::ActivationObserver *observer : current) {
+            if (observers.contains(observer))
+                observer->accessibilityActiveChanged(active);
+        }
+    }
+
+    QSet<QAccessible::ActivationObserver *> observers;
+};
+
+Q_GLOBAL_STATIC(QQuickAccessibilityObservers, accessibilityObservers)
+
+void QQuickControlPrivate::addAccessibilityObserver(QAccessible::ActivationObserver *observer)
+{
+    if (QQuickAccessibilityObservers *instance = accessibilityObservers())
+        instance->observers.insert(observer);
+}
+
+void QQuickControlPrivate::removeAccessibilityObserver(QAccessible::ActivationObserver *observer)
+{
+    if (QQuickAccessibilityObservers *instance = accessibilityObservers())
+        instance->observers.remove(observer);
+}
 #endif
 
 /*!
@@ -322,14 +470,8 @@ QFont QQuickControlPrivate::parentFont(const QQuickItem *item)
 {
     QQuickItem *p = item->parentItem();
     while (p) {
-        if (QQuickControl *control = qobject_cast<QQuickControl *>(p))
-            return control->font();
-        else if (QQuickLabel *label = qobject_cast<QQuickLabel *>(p))
-            return label->font();
-        else if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(p))
-            return textField->font();
-        else if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(p))
-            return textArea->font();
+        if (QQuickInheritanceNode *node = QQuickInheritanceNode::get(p))
+            return node->font();
 
         p = p->parentItem();
     }
@@ -375,7 +517,7 @@ void QQuickControlPrivate::inheritFont(const QFont &font)
     parentFont.resolve(extra.isAllocated() ? extra->requestedFont.resolve() | font.resolve() : font.resolve());
 
     const QFont defaultFont = q->defaultFont();
-    const QFont resolvedFont = parentFont.resolve(defaultFont);
+    const QFont resolvedFont = QQuickControlPrivate::shareInherited(parentFont.resolve(defaultFont), font);
 
     setFont_helper(resolvedFont);
 }
@@ -394,27 +536,10 @@ void QQuickControlPrivate::updateFont(const QFont &font)
     if (oldFont != font)
         q->fontChange(font, oldFont);
 
-    QQuickControlPrivate::updateFontRecur(q, font);
+    inheritanceNode.propagateFont(font, QQuickInheritanceNode::fontChanges(oldFont, font));
 
     if (oldFont != font)
-        emit q->fontChanged();
-}
-
-void QQuickControlPrivate::updateFontRecur(QQuickItem *item, const QFont &font)
-{
-    const auto childItems = item->childItems();
-    for (QQuickItem *child : childItems) {
-        if (QQuickControl *control = qobject_cast<QQuickControl *>(child))
-            QQuickControlPrivate::get(control)->inheritFont(font);
-        else if (QQuickLabel *label = qobject_cast<QQuickLabel *>(child))
-            QQuickLabelPrivate::get(label)->inheritFont(font);
-        else if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(child))
-            QQuickTextAreaPrivate::get(textArea)->inheritFont(font);
-        else if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(child))
-            QQuickTextFieldPrivate::get(textField)->inheritFont(font);
-        else
-            QQuickControlPrivate::updateFontRecur(child, font);
-    }
+        inheritanceNode.notify(QQuickInheritanceNode::FontAttribute);
 }
 
 /*!
@@ -427,14 +552,8 @@ QPalette QQuickControlPrivate::parentPalette(const QQuickItem *item)
 {
     QQuickItem *p = item->parentItem();
     while (p) {
-        if (QQuickControl *control = qobject_cast<QQuickControl *>(p))
-            return control->palette();
-        else if (QQuickLabel *label = qobject_cast<QQuickLabel *>(p))
-            return label->palette();
-        else if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(p))
-            return textField->palette();
-        else if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(p))
-            return textArea->palette();
+        if (QQuickInheritanceNode *node = QQuickInheritanceNode::get(p))
+            return node->palette();
 
         p = p->parentItem();
     }
@@ -480,7 +599,7 @@ void QQuickControlPrivate::inheritPalette(const QPalette &palette)
     parentPalette.resolve(extra.isAllocated() ? extra->requestedPalette.resolve() | palette.resolve() : palette.resolve());
 
     const QPalette defaultPalette = q->defaultPalette();
-    const QPalette resolvedPalette = parentPalette.resolve(defaultPalette);
+    const QPalette resolvedPalette = QQuickControlPrivate::shareInherited(parentPalette.resolve(defaultPalette), palette);
 
     setPalette_helper(resolvedPalette);
 }
@@ -499,39 +618,24 @@ void QQuickControlPrivate::updatePalette(const QPalette &palette)
     if (oldPalette != palette)
         q->paletteChange(palette, oldPalette);
 
-    QQuickControlPrivate::updatePaletteRecur(q, palette);
+    inheritanceNode.propagatePalette(palette, QQuickInheritanceNode::paletteChanges(oldPalette, palette));
 
     if (oldPalette != palette)
-        emit q->paletteChanged();
-}
-
-void QQuickControlPrivate::updatePaletteRecur(QQuickItem *item, const QPalette &palette)
-{
-    const auto childItems = item->childItems();
-    for (QQuickItem *child : childItems) {
-        if (QQuickControl *control = qobject_cast<QQuickControl *>(child))
-            QQuickControlPrivate::get(control)->inheritPalette(palette);
-        else if (QQuickLabel *label = qobject_cast<QQuickLabel *>(child))
-            QQuickLabelPrivate::get(label)->inheritPalette(palette);
-        else if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(child))
-            QQuickTextAreaPrivate::get(textArea)->inheritPalette(palette);
-        else if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(child))
-            QQuickTextFieldPrivate::get(textField)->inheritPalette(palette);
-        else
-            QQuickControlPrivate::updatePaletteRecur(child, palette);
-    }
+        inheritanceNode.notify(QQuickInheritanceNode::PaletteAttribute);
 }
 
 QLocale QQuickControlPrivate::calcLocale(const QQuickItem *item)
 {
     const QQuickItem *p = item;
     while (p) {
-        if (const QQuickControl *control = qobject_cast<const QQuickControl *>(p))
-            return control->locale();
-
-        QVariant v = p->property("locale");
-        if (v.isValid() && v.userType() == QMetaType::QLocale)
-            return v.toLocale();
+        if (const QQuickInheritanceNode *node = QQuickInheritanceNode::get(p)) {
+            if (node->type() == QQuickInheritanceNode::ControlType || node->type() == QQuickInheritanceNode::PopupItemType)
+                return static_cast<const QQuickControl *>(p)->locale();
+        } else {
+            QVariant v = p->property("locale");
+            if (v.isValid() && v.userType() == QMetaType::QLocale)
+                return v.toLocale();
+        }
 
         p = p->parentItem();
     }
@@ -556,24 +660,13 @@ void QQuickControlPrivate::updateLocale(const QLocale &l, bool e)
         bool wasMirrored = q->isMirrored();
         locale = l;
         q->localeChange(l, old);
-        QQuickControlPrivate::updateLocaleRecur(q, l);
-        emit q->localeChanged();
+        inheritanceNode.propagateLocale(l);
+        inheritanceNode.notify(QQuickInheritanceNode::LocaleAttribute);
         if (wasMirrored != q->isMirrored())
             q->mirrorChange();
     }
 }
 
-void QQuickControlPrivate::updateLocaleRecur(QQuickItem *item, const QLocale &l)
-{
-    const auto childItems = item->childItems();
-    for (QQuickItem *child : childItems) {
-        if (QQuickControl *control = qobject_cast<QQuickControl *>(child))
-            QQuickControlPrivate::get(control)->updateLocale(l, false);
-        else
-            updateLocaleRecur(child, l);
-    }
-}
-
 #if QT_CONFIG(quicktemplates2_hover)
 void QQuickControlPrivate::updateHoverEnabled(bool enabled, bool xplicit)
 {
@@ -583,40 +676,58 @@ void QQuickControlPrivate::updateHoverEnabled(bool enabled, bool xplicit)
 
     bool wasEnabled = q->isHoverEnabled();
     explicitHoverEnabled = xplicit;
+    hoverEnabledValue = enabled;
+    updateAcceptHoverEvents();
     if (wasEnabled != enabled) {
-        q->setAcceptHoverEvents(enabled);
-        QQuickControlPrivate::updateHoverEnabledRecur(q, enabled);
+        inheritanceNode.propagateHoverEnabled(enabled);
         emit q->hoverEnabledChanged();
     }
 }
 
-void QQuickControlPrivate::updateHoverEnabledRecur(QQuickItem *item, bool enabled)
+static bool isLazyHoverEnabled()
 {
-    const auto childItems = item->childItems();
-    for (QQuickItem *child : childItems) {
-        if (QQuickControl *control = qobject_cast<QQuickControl *>(child))
-            QQuickControlPrivate::get(control)->updateHoverEnabled(enabled, false);
-        else
-            updateHoverEnabledRecur(child, enabled);
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_LAZY_HOVER") > 0;
+    return enabled;
+}
+
+// By default, a control accepts hover events whenever hoverEnabled is true.
+// With QT_QUICK_CONTROLS_LAZY_HOVER, hover events are only accepted by the
+// controls that use them: the ones that set hoverEnabled explicitly, that
+// handle hover internally, or that someone is bound or connected to the
+// hovered property of. The other controls inherit hoverEnabled as usual,
+// but they are left out of the hover event delivery.
+void QQuickControlPrivate::updateAcceptHoverEvents()
+{
+    Q_Q(QQuickControl);
+    bool accept = hoverEnabledValue;
+    if (accept && isLazyHoverEnabled() && !explicitHoverEnabled && !handlesHover) {
+        static const QMetaMethod hoveredSignal = QMetaMethod::fromSignal(&QQuickControl::hoveredChanged);
+        accept = q->isSignalConnected(hoveredSignal);
     }
+    q->setAcceptHoverEvents(accept);
 }
 
 bool QQuickControlPrivate::calcHoverEnabled(const QQuickItem *item)
 {
     const QQuickItem *p = item;
     while (p) {
-        // QQuickPopupItem accepts hover events to avoid leaking them through.
-        // Don't inherit that to the children of the popup, but fallback to the
-        // environment variable or style hint.
-        if (qobject_cast<const QQuickPopupItem *>(p))
-            break;
-
-        if (const QQuickControl *control = qobject_cast<const QQuickControl *>(p))
-            return control->isHoverEnabled();
-
-        QVariant v = p->property("hoverEnabled");
-        if (v.isValid() && v.userType() == QMetaType::Bool)
-            return v.toBool();
+        if (const QQuickInheritanceNode *node = QQuickInheritanceNode::get(p)) {
+            // QQuickPopupItem accepts hover events to avoid leaking them through.
+            // Don't inherit that to the children of the popup, but fallback to the
+            // environment variable or style hint.
+            if (node->type() == QQuickInheritanceNode::PopupItemType)
+                break;
+            if (node->type() == QQuickInheritanceNode::ControlType)
+                return static_cast<const QQuickControl *>(p)->isHoverEnabled();
+            if (node->type() == QQuickInheritanceNode::TextAreaType)
+                return static_cast<const QQuickTextArea *>(p)->isHoverEnabled();
+            if (node->type() == QQuickInheritanceNode::TextFieldType)
+                return static_cast<const QQuickTextField *>(p)->isHoverEnabled();
+        } else {
+            QVariant v = p->property("hoverEnabled");
+            if (v.isValid() && v.userType() == QMetaType::Bool)
+                return v.toBool();
+        }
 
         p = p->parentItem();
     }
@@ -649,7 +760,7 @@ void QQuickControlPrivate::executeContentItem(bool complete)
     if (!contentItem || complete)
         quickBeginDeferred(q, contentItemName(), contentItem);
     if (complete)
-        quickCompleteDeferred(q, contentItemName(), contentItem);
+        quickCompleteDeferred(q, contentItem);
 }
 
 static inline QString backgroundName() { return QStringLiteral("background"); }
@@ -669,17 +780,99 @@ void QQuickControlPrivate::executeBackground(bool complete)
     if (!background || complete)
         quickBeginDeferred(q, backgroundName(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
+}
+
+/*
+    Controls that are not visible until their state changes, such as scroll
+    bars of content that fits the view, may return \c true to skip executing
+    the background and content item in componentComplete(). The delegates are
+    then executed by executeDeferredDelegates() once they are needed.
+*/
+bool QQuickControlPrivate::canDeferDelegates() const
+{
+    return false;
+}
+
+void QQuickControlPrivate::executeDeferredDelegates()
+{
+    Q_Q(QQuickControl);
+    if (!delegatesDeferred)
+        return;
+
+    delegatesDeferred = false;
+    QQuickItem *oldBackground = background;
+    QQuickItem *oldContentItem = contentItem;
+    executeBackground(true);
+    executeContentItem(true);
+    if (background != oldBackground)
+        emit q->backgroundChanged();
+    if (contentItem != oldContentItem)
+        emit q->contentItemChanged();
+}
+
+/*
+    Popup-owning controls, such as ComboBox, execute their deferred popup here.
+*/
+void QQuickControlPrivate::executePopup(bool complete)
+{
+    Q_UNUSED(complete);
+}
+
+/*
+    Popup-owning controls call this in componentComplete() when their deferred
+    popup was not needed during creation. If the incubation of delegates is
+    enabled (QT_QUICK_CONTROLS_INCUBATE_DELEGATES), the popup is then executed
+    from the event loop, so that it is ready by the time it is opened. A control
+    whose popup must not be created before it is requested opts out by clearing
+    popupIncubation.
+*/
+void QQuickControlPrivate::incubatePopup()
+{
+    Q_Q(QQuickControl);
+    if (!popupIncubation || !quickIncubationEnabled())
+        return;
+
+    quickIncubateDeferred(q, [](QObject *object) {
+        QQuickControlPrivate::get(static_cast<QQuickControl *>(object))->executePopup(true);
+    });
+}
+
+/*
+    Re-resolves the inherited attributes that changed while the control was
+    suspended from its ancestors, and propagates them into the subtree in
+    one combined pass.
+*/
+void QQuickControlPrivate::resumeInheritance()
+{
+    const QQuickInheritanceNode::Attributes attributes = suspendedAttributes;
+    suspendedAttributes = QQuickInheritanceNode::Attributes();
+
+    QQuickInheritanceBatch batch;
+    if (attributes & QQuickInheritanceNode::FontAttribute)
+        resolveFont();
+    if (attributes & QQuickInheritanceNode::PaletteAttribute)
+        resolvePalette();
+    if (attributes & QQuickInheritanceNode::LocaleAttribute)
+        updateLocale(calcLocale(parentItem), false); // explicit=false
+#if QT_CONFIG(quicktemplates2_hover)
+    if (attributes & QQuickInheritanceNode::HoverEnabledAttribute)
+        updateHoverEnabled(calcHoverEnabled(parentItem), false); // explicit=false
+#endif
 }
 
 QQuickControl::QQuickControl(QQuickItem *parent)
     : QQuickItem(*(new QQuickControlPrivate), parent)
 {
+    Q_D(QQuickControl);
+    d->inheritanceNode.init(this, QQuickInheritanceNode::ControlType);
 }
 
 QQuickControl::QQuickControl(QQuickControlPrivate &dd, QQuickItem *parent)
     : QQuickItem(dd, parent)
 {
+    Q_D(QQuickControl);
+    d->inheritanceNode.init(this, QQuickInheritanceNode::ControlType);
 }
 
 void QQuickControl::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &value)
@@ -718,6 +911,17 @@ void QQuickControl::itemChange(QQuickItem::ItemChange change, const QQuickItem::
     }
 }
 
+void QQuickControl::connectNotify(const QMetaMethod &signal)
+{
+    QQuickItem::connectNotify(signal);
+#if QT_CONFIG(quicktemplates2_hover)
+    Q_D(QQuickControl);
+    static const QMetaMethod hoveredSignal = QMetaMethod::fromSignal(&QQuickControl::hoveredChanged);
+    if (signal == hoveredSignal && isComponentComplete() && !acceptHoverEvents())
+        d->updateAcceptHoverEvents();
+#endif
+}
+
 /*!
     \qmlproperty font QtQuick.Controls::Control::font
 
@@ -878,6 +1082,7 @@ void QQuickControl::setPadding(qreal padding)
     if (!qFuzzyCompare(newPadding.left(), oldPadding.left()) || !qFuzzyCompare(newPadding.right(), oldPadding.right()))
         emit availableWidthChanged();
     paddingChange(newPadding, oldPadding);
+    d->updateImplicitSize();
 }
 
 void QQuickControl::resetPadding()
@@ -1216,7 +1421,7 @@ bool QQuickControl::isHoverEnabled() const
 {
 #if QT_CONFIG(quicktemplates2_hover)
     Q_D(const QQuickControl);
-    return d->hoverEnabled;
+    return d->hoverEnabledValue;
 #else
     return false;
 #endif
@@ -1226,7 +1431,7 @@ void QQuickControl::setHoverEnabled(bool enabled)
 {
 #if QT_CONFIG(quicktemplates2_hover)
     Q_D(QQuickControl);
-    if (d->explicitHoverEnabled && enabled == d->hoverEnabled)
+    if (d->explicitHoverEnabled && enabled == d->hoverEnabledValue)
         return;
 
     d->updateHoverEnabled(enabled, true); // explicit=true
@@ -1297,8 +1502,12 @@ void QQuickControl::setWheelEnabled(bool enabled)
 QQuickItem *QQuickControl::background() const
 {
     QQuickControlPrivate *d = const_cast<QQuickControlPrivate *>(d_func());
-    if (!d->background)
-        d->executeBackground();
+    if (!d->background) {
+        if (d->delegatesDeferred)
+            d->executeDeferredDelegates();
+        else
+            d->executeBackground();
+    }
     return d->background;
 }
 
@@ -1313,6 +1522,10 @@ void QQuickControl::setBackground(QQuickItem *background)
 
     delete d->background;
     d->background = background;
+    if (d->implicitSizer) {
+        d->implicitSizer->setBackground(background);
+        d->implicitSizer->update();
+    }
     if (background) {
         background->setParentItem(this);
         if (qFuzzyIsNull(background->z()))
@@ -1435,6 +1648,72 @@ void QQuickControl::resetPalette()
     setPalette(QPalette());
 }
 
+/*
+    Assignments and bindings to the implicit size from QML and C++ go through
+    these, so that an explicit value is kept even if it equals the default.
+    The implicit size sizer sets the value through QQuickItem directly.
+*/
+void QQuickControl::setImplicitWidth(qreal width)
+{
+    Q_D(QQuickControl);
+    d->explicitImplicitWidth = true;
+    if (d->implicitSizer)
+        d->implicitSizer->release(Qt::Horizontal);
+    QQuickItem::setImplicitWidth(width);
+}
+
+void QQuickControl::setImplicitHeight(qreal height)
+{
+    Q_D(QQuickControl);
+    d->explicitImplicitHeight = true;
+    if (d->implicitSizer)
+        d->implicitSizer->release(Qt::Vertical);
+    QQuickItem::setImplicitHeight(height);
+}
+
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlproperty bool QtQuick.Controls::Control::suspended
+
+    This property holds whether the control is suspended from inheriting
+    attributes from its ancestors. The default value is \c false.
+
+    While suspended, changes to the \l font, \l palette, \l locale and
+    \l hoverEnabled of the ancestors are not passed on to the control and
+    its children, which keep their current values. Instead, the control
+    remembers which attributes changed, and resolves them once for the
+    whole subtree when it is no longer suspended. This avoids updating
+    the content of hidden pages, for example:
+
+    \code
+    SwipeView {
+        Page {
+            suspended: !SwipeView.isCurrentItem
+        }
+    }
+    \endcode
+
+    \note Attributes that are assigned to the control itself, or to its
+    children, are applied as usual.
+*/
+bool QQuickControl::isSuspended() const
+{
+    Q_D(const QQuickControl);
+    return d->suspended;
+}
+
+void QQuickControl::setSuspended(bool suspended)
+{
+    Q_D(QQuickControl);
+    if (d->suspended == suspended)
+        return;
+
+    d->suspended = suspended;
+    if (!suspended && d->suspendedAttributes)
+        d->resumeInheritance();
+    emit suspendedChanged();
+}
+
 void QQuickControl::classBegin()
 {
     Q_D(QQuickControl);
@@ -1446,16 +1725,25 @@ void QQuickControl::classBegin()
 void QQuickControl::componentComplete()
 {
     Q_D(QQuickControl);
-    d->executeBackground(true);
-    d->executeContentItem(true);
+    // delegates that were accessed during creation have already begun,
+    // and must be completed; only the ones never started can be held back
+    const bool canDefer = d->canDeferDelegates();
+    if (!canDefer || d->background || d->background.state())
+        d->executeBackground(true);
+    if (!canDefer || d->contentItem || d->contentItem.state())
+        d->executeContentItem(true);
+    d->delegatesDeferred = canDefer && (!d->background.wasExecuted() || !d->contentItem.wasExecuted());
     QQuickItem::componentComplete();
     d->resizeBackground();
     d->resizeContent();
+    d->initImplicitSize();
     if (!d->hasLocale)
         d->locale = QQuickControlPrivate::calcLocale(d->parentItem);
 #if QT_CONFIG(quicktemplates2_hover)
     if (!d->explicitHoverEnabled)
-        setAcceptHoverEvents(QQuickControlPrivate::calcHoverEnabled(d->parentItem));
+        d->hoverEnabledValue = QQuickControlPrivate::calcHoverEnabled(d->parentItem);
+    // the style has bound to hovered by now, if at all
+    d->updateAcceptHoverEvents();
 #endif
 #if QT_CONFIG(accessibility)
     if (QAccessible::isActive())
@@ -1595,8 +1883,12 @@ void QQuickControl::geometryChanged(const QRectF &newGeometry, const QRectF &old
 {
     Q_D(QQuickControl);
     QQuickItem::geometryChanged(newGeometry, oldGeometry);
-    d->resizeBackground();
-    d->resizeContent();
+    // the background and content are resized once in componentComplete(),
+    // no matter how many times the size and padding change during creation
+    if (isComponentComplete()) {
+        d->resizeBackground();
+        d->resizeContent();
+    }
     if (!qFuzzyCompare(newGeometry.width(), oldGeometry.width()))
         emit availableWidthChanged();
     if (!qFuzzyCompare(newGeometry.height(), oldGeometry.height()))
@@ -1631,7 +1923,8 @@ void QQuickControl::paddingChange(const QMarginsF &newPadding, const QMarginsF &
     Q_D(QQuickControl);
     Q_UNUSED(newPadding);
     Q_UNUSED(oldPadding);
-    d->resizeContent();
+    if (isComponentComplete())
+        d->resizeContent();
 }
 
 void QQuickControl::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
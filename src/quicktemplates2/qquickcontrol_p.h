@@ -79,8 +79,12 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickControl : public QQuickItem
     Q_PROPERTY(bool wheelEnabled READ isWheelEnabled WRITE setWheelEnabled NOTIFY wheelEnabledChanged FINAL)
     Q_PROPERTY(QQuickItem *background READ background WRITE setBackground NOTIFY backgroundChanged FINAL)
     Q_PROPERTY(QQuickItem *contentItem READ contentItem WRITE setContentItem NOTIFY contentItemChanged FINAL)
+    Q_PROPERTY(qreal implicitWidth READ implicitWidth WRITE setImplicitWidth NOTIFY implicitWidthChanged FINAL)
+    Q_PROPERTY(qreal implicitHeight READ implicitHeight WRITE setImplicitHeight NOTIFY implicitHeightChanged FINAL)
     // 2.3 (Qt 5.10)
     Q_PROPERTY(QPalette palette READ palette WRITE setPalette RESET resetPalette NOTIFY paletteChanged FINAL REVISION 3)
+    // 2.5 (Qt 5.12)
+    Q_PROPERTY(bool suspended READ isSuspended WRITE setSuspended NOTIFY suspendedChanged FINAL REVISION 5)
     Q_CLASSINFO("DeferredPropertyNames", "background,contentItem")
 
 public:
@@ -147,11 +151,18 @@ public:
     QQuickItem *contentItem() const;
     void setContentItem(QQuickItem *item);
 
+    void setImplicitWidth(qreal width);
+    void setImplicitHeight(qreal height);
+
     // 2.3 (Qt 5.10)
     QPalette palette() const;
     void setPalette(const QPalette &palette);
     void resetPalette();
 
+    // 2.5 (Qt 5.12)
+    bool isSuspended() const;
+    void setSuspended(bool suspended);
+
 Q_SIGNALS:
     void fontChanged();
     void availableWidthChanged();
@@ -174,6 +185,8 @@ Q_SIGNALS:
     void contentItemChanged();
     // 2.3 (Qt 5.10)
     Q_REVISION(3) void paletteChanged();
+    // 2.5 (Qt 5.12)
+    Q_REVISION(5) void suspendedChanged();
 
 protected:
     virtual QFont defaultFont() const;
@@ -185,6 +198,7 @@ protected:
     void componentComplete() override;
 
     void itemChange(ItemChange change, const ItemChangeData &value) override;
+    void connectNotify(const QMetaMethod &signal) override;
 
     void focusInEvent(QFocusEvent *event) override;
     void focusOutEvent(QFocusEvent *event) override;
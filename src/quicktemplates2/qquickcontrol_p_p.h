@@ -50,6 +50,7 @@
 
 #include <QtQuickTemplates2/private/qquickcontrol_p.h>
 #include <QtQuickTemplates2/private/qquickdeferredpointer_p_p.h>
+#include <QtQuickTemplates2/private/qquickinheritancenode_p_p.h>
 
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQml/private/qlazilyallocated_p.h>
@@ -62,6 +63,7 @@
 QT_BEGIN_NAMESPACE
 
 class QQuickAccessibleAttached;
+class QQuickImplicitSizer;
 
 class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickControlPrivate : public QQuickItemPrivate
 #if QT_CONFIG(accessibility)
@@ -88,6 +90,14 @@ public:
     virtual void handleUngrab();
 
     void mirrorChange() override;
+    void implicitWidthChanged() override;
+    void implicitHeightChanged() override;
+
+    void initImplicitSize();
+    void setImplicitSizePolicy(bool enabled);
+    void updateImplicitSize();
+    virtual qreal getContentWidth() const;
+    virtual qreal getContentHeight() const;
 
     void setTopPadding(qreal value, bool reset = false);
     void setLeftPadding(qreal value, bool reset = false);
@@ -104,12 +114,13 @@ public:
     void accessibilityActiveChanged(bool active) override;
     QAccessible::Role accessibleRole() const override;
     static QQuickAccessibleAttached *accessibleAttached(const QObject *object);
+    static void addAccessibilityObserver(QAccessible::ActivationObserver *observer);
+    static void removeAccessibilityObserver(QAccessible::ActivationObserver *observer);
 #endif
 
     virtual void resolveFont();
     void inheritFont(const QFont &font);
     void updateFont(const QFont &font);
-    static void updateFontRecur(QQuickItem *item, const QFont &font);
     inline void setFont_helper(const QFont &font) {
         if (resolvedFont.resolve() == font.resolve() && resolvedFont == font)
             return;
@@ -121,7 +132,6 @@ public:
     virtual void resolvePalette();
     void inheritPalette(const QPalette &palette);
     void updatePalette(const QPalette &palette);
-    static void updatePaletteRecur(QQuickItem *item, const QPalette &palette);
     inline void setPalette_helper(const QPalette &palette) {
         if (resolvedPalette.resolve() == palette.resolve() && resolvedPalette == palette)
             return;
@@ -130,13 +140,21 @@ public:
     static QPalette parentPalette(const QQuickItem *item);
     static QPalette themePalette(QPlatformTheme::Palette type);
 
+    // Returns the inherited font or palette if resolving it changed nothing,
+    // so that the whole subtree shares the same data instead of a copy.
+    template <typename T>
+    static T shareInherited(const T &resolved, const T &inherited) {
+        if (resolved.resolve() == inherited.resolve() && resolved == inherited)
+            return inherited;
+        return resolved;
+    }
+
     void updateLocale(const QLocale &l, bool e);
-    static void updateLocaleRecur(QQuickItem *item, const QLocale &l);
     static QLocale calcLocale(const QQuickItem *item);
 
 #if QT_CONFIG(quicktemplates2_hover)
     void updateHoverEnabled(bool enabled, bool xplicit);
-    static void updateHoverEnabledRecur(QQuickItem *item, bool enabled);
+    void updateAcceptHoverEvents();
     static bool calcHoverEnabled(const QQuickItem *item);
 #endif
 
@@ -146,23 +164,41 @@ public:
     virtual void cancelBackground();
     virtual void executeBackground(bool complete = false);
 
+    virtual bool canDeferDelegates() const;
+    void executeDeferredDelegates();
+
+    virtual void executePopup(bool complete = false);
+    void incubatePopup();
+
+    void resumeInheritance();
+
     struct ExtraData {
         QFont requestedFont;
         QPalette requestedPalette;
     };
     QLazilyAllocated<ExtraData> extra;
 
-    bool hasTopPadding = false;
-    bool hasLeftPadding = false;
-    bool hasRightPadding = false;
-    bool hasBottomPadding = false;
-    bool hasLocale = false;
-    bool wheelEnabled = false;
+    bool hasTopPadding : 1;
+    bool hasLeftPadding : 1;
+    bool hasRightPadding : 1;
+    bool hasBottomPadding : 1;
+    bool hasLocale : 1;
+    bool wheelEnabled : 1;
+    bool hasImplicitSizePolicy : 1;
+    bool explicitImplicitWidth : 1;
+    bool explicitImplicitHeight : 1;
+    bool delegatesDeferred : 1;
+    bool popupIncubation : 1;
+    bool suspended : 1;
 #if QT_CONFIG(quicktemplates2_hover)
-    bool hovered = false;
-    bool explicitHoverEnabled = false;
+    bool hovered : 1;
+    bool hoverEnabledValue : 1;
+    bool explicitHoverEnabled : 1;
+    bool handlesHover : 1;
 #endif
     int touchId = -1;
+    // the inherited attributes that changed while suspended
+    QQuickInheritanceNode::Attributes suspendedAttributes;
     qreal padding = 0;
     qreal topPadding = 0;
     qreal leftPadding = 0;
@@ -176,6 +212,8 @@ public:
     Qt::FocusReason focusReason = Qt::OtherFocusReason;
     QQuickDeferredPointer<QQuickItem> background;
     QQuickDeferredPointer<QQuickItem> contentItem;
+    QQuickInheritanceNode inheritanceNode;
+    QScopedPointer<QQuickImplicitSizer> implicitSizer;
 };
 
 QT_END_NAMESPACE
@@ -35,8 +35,13 @@
 ****************************************************************************/
 
 #include "qquickdeferredexecute_p_p.h"
+#include "qquicktimingspan_p_p.h"
 
-#include <QtCore/qhash.h>
+#include <QtCore/qbasictimer.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qqueue.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQml/private/qqmldata_p.h>
 #include <QtQml/private/qqmlcomponent_p.h>
@@ -44,16 +49,16 @@
 
 QT_BEGIN_NAMESPACE
 
-namespace QtQuickPrivate {
+Q_LOGGING_CATEGORY(lcDeferred, "qt.quick.controls.deferred")
 
-typedef QHash<uint, QQmlComponentPrivate::DeferredState *> DeferredStates;
+namespace QtQuickPrivate {
 
-static inline uint qHash(QObject *object, const QString &propertyName)
+// The state of a deferred execution in progress is stored in the
+// QQuickDeferredPointer of the delegate from begin to complete.
+struct DeferredState : public QQmlComponentPrivate::DeferredState
 {
-    return ::qHash(object) + ::qHash(propertyName);
-}
-
-Q_GLOBAL_STATIC(DeferredStates, deferredStates)
+    QPointer<QQmlEngine> engine;
+};
 
 static void cancelDeferred(QQmlData *ddata, int propertyIndex)
 {
@@ -108,21 +113,32 @@ static bool beginDeferred(QQmlEnginePrivate *enginePriv, const QQmlProperty &pro
     return enginePriv->inProgressCreations > wasInProgress;
 }
 
-void beginDeferred(QObject *object, const QString &property)
+// Adds the construction of the deferred bindings of the property to the
+// state of the delegate, which may have been begun earlier, for example when
+// the delegate was accessed while the object was being created.
+DeferredState *beginDeferred(QObject *object, const QString &property, DeferredState *state)
 {
     QQmlData *data = QQmlData::get(object);
-    if (data && !data->deferredData.isEmpty() && !data->wasDeleted(object)) {
-        QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
-
-        QQmlComponentPrivate::DeferredState *state = new QQmlComponentPrivate::DeferredState;
-        if (beginDeferred(ep, QQmlProperty(object, property), state))
-            deferredStates()->insert(qHash(object, property), state);
-        else
-            delete state;
-
-        // Release deferred data for those compilation units that no longer have deferred bindings
-        data->releaseDeferredData();
+    if (!data || data->deferredData.isEmpty() || data->wasDeleted(object))
+        return state;
+
+    QQuickTimingSpan span(lcDeferred, "beginDeferred", object);
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
+
+    DeferredState *newState = state ? state : new DeferredState;
+    newState->engine = data->context->engine;
+    const int count = newState->constructionStates.count();
+    if (!beginDeferred(ep, QQmlProperty(object, property), newState)) {
+        if (!state)
+            delete newState;
+        newState = state;
+    } else {
+        span.addItems(newState->constructionStates.count() - count);
     }
+
+    // Release deferred data for those compilation units that no longer have deferred bindings
+    data->releaseDeferredData();
+    return newState;
 }
 
 void cancelDeferred(QObject *object, const QString &property)
@@ -132,17 +148,95 @@ void cancelDeferred(QObject *object, const QString &property)
         cancelDeferred(data, QQmlProperty(object, property).index());
 }
 
-void completeDeferred(QObject *object, const QString &property)
+void completeDeferred(QObject *object, DeferredState *state)
 {
     QQmlData *data = QQmlData::get(object);
-    QQmlComponentPrivate::DeferredState *state = deferredStates()->take(qHash(object, property));
     if (data && state && !data->wasDeleted(object)) {
+        QQuickTimingSpan span(lcDeferred, "completeDeferred", object);
         QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine);
         QQmlComponentPrivate::completeDeferred(ep, state);
     }
     delete state;
 }
 
+// Drops a deferred execution that was begun, but whose object was destroyed
+// before it was completed.
+void releaseDeferred(DeferredState *state)
+{
+    if (state->engine)
+        QQmlEnginePrivate::get(state->engine)->inProgressCreations -= state->constructionStates.count();
+    // the construction states are deleted by the destructor of the state
+    delete state;
+}
+
+// Executes deferred delegates that nobody has asked for yet in small batches
+// from the event loop, so that the frames in between can still be rendered.
+class DeferredIncubator : public QObject
+{
+public:
+    explicit DeferredIncubator(QObject *parent) : QObject(parent) { }
+
+    void incubate(QObject *object, DeferredExecutor executor)
+    {
+        queue.enqueue(Pending{object, executor});
+        if (!timer.isActive())
+            timer.start(0, this);
+    }
+
+protected:
+    void timerEvent(QTimerEvent *event) override
+    {
+        if (event->timerId() != timer.timerId()) {
+            QObject::timerEvent(event);
+            return;
+        }
+
+        static const qint64 TimeBudget = 5; // ms
+
+        QElapsedTimer elapsed;
+        elapsed.start();
+        while (!queue.isEmpty() && elapsed.elapsed() < TimeBudget) {
+            const Pending pending = queue.dequeue();
+            if (pending.object)
+                pending.executor(pending.object);
+        }
+        if (queue.isEmpty())
+            timer.stop();
+    }
+
+private:
+    struct Pending {
+        QPointer<QObject> object;
+        DeferredExecutor executor;
+    };
+
+    QBasicTimer timer;
+    QQueue<Pending> queue;
+};
+
+bool isIncubationEnabled()
+{
+    return qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_INCUBATE_DELEGATES") > 0;
+}
+
+/*
+    Schedules \a executor to be called for \a object from the event loop,
+    unless the object is destroyed before that. The executor is expected to
+    do nothing if the delegate was already executed on demand.
+*/
+void incubateDeferred(QObject *object, DeferredExecutor executor)
+{
+    static QPointer<DeferredIncubator> incubator;
+    if (!incubator) {
+        if (!QCoreApplication::instance()) {
+            executor(object);
+            return;
+        }
+        incubator = new DeferredIncubator(QCoreApplication::instance());
+    }
+    incubator->incubate(object, executor);
+}
+
 } // QtQuickPrivate
 
 QT_END_NAMESPACE
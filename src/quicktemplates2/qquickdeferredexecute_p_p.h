@@ -59,9 +59,13 @@ class QString;
 class QObject;
 
 namespace QtQuickPrivate {
-    void beginDeferred(QObject *object, const QString &property);
+    DeferredState *beginDeferred(QObject *object, const QString &property, DeferredState *state);
     void cancelDeferred(QObject *object, const QString &property);
-    void completeDeferred(QObject *object, const QString &property);
+    void completeDeferred(QObject *object, DeferredState *state);
+
+    typedef void (*DeferredExecutor)(QObject *object);
+    bool isIncubationEnabled();
+    void incubateDeferred(QObject *object, DeferredExecutor executor);
 }
 
 template<typename T>
@@ -71,7 +75,7 @@ void quickBeginDeferred(QObject *object, const QString &property, QQuickDeferred
            return;
 
     delegate.setExecuting(true);
-    QtQuickPrivate::beginDeferred(object, property);
+    delegate.setState(QtQuickPrivate::beginDeferred(object, property, delegate.state()));
     delegate.setExecuting(false);
 }
 
@@ -81,13 +85,24 @@ inline void quickCancelDeferred(QObject *object, const QString &property)
 }
 
 template<typename T>
-void quickCompleteDeferred(QObject *object, const QString &property, QQuickDeferredPointer<T> &delegate)
+void quickCompleteDeferred(QObject *object, QQuickDeferredPointer<T> &delegate)
 {
     Q_ASSERT(!delegate.wasExecuted());
-    QtQuickPrivate::completeDeferred(object, property);
+    QtQuickPrivate::completeDeferred(object, delegate.state());
+    delegate.setState(nullptr);
     delegate.setExecuted();
 }
 
+inline bool quickIncubationEnabled()
+{
+    return QtQuickPrivate::isIncubationEnabled();
+}
+
+inline void quickIncubateDeferred(QObject *object, QtQuickPrivate::DeferredExecutor executor)
+{
+    QtQuickPrivate::incubateDeferred(object, executor);
+}
+
 QT_END_NAMESPACE
 
 #endif // QQUICKDEFERREDEXECUTE_P_P_H
@@ -49,16 +49,22 @@
 //
 
 #include <QtCore/qglobal.h>
+#include <QtQuickTemplates2/private/qtquicktemplates2global_p.h>
 
 QT_BEGIN_NAMESPACE
 
+namespace QtQuickPrivate {
+    struct DeferredState;
+    Q_QUICKTEMPLATES2_PRIVATE_EXPORT void releaseDeferred(DeferredState *state);
+}
+
 template<typename T>
 class QQuickDeferredPointer
 {
 public:
     inline QQuickDeferredPointer();
     inline QQuickDeferredPointer(T *);
-    inline QQuickDeferredPointer(const QQuickDeferredPointer<T> &o);
+    inline ~QQuickDeferredPointer();
 
     inline bool isNull() const;
 
@@ -68,6 +74,9 @@ public:
     inline bool isExecuting() const;
     inline void setExecuting(bool);
 
+    inline QtQuickPrivate::DeferredState *state() const;
+    inline void setState(QtQuickPrivate::DeferredState *state);
+
     inline operator T*() const;
     inline operator bool() const;
 
@@ -76,10 +85,12 @@ public:
     inline T *operator->() const;
 
     inline QQuickDeferredPointer<T> &operator=(T *);
-    inline QQuickDeferredPointer<T> &operator=(const QQuickDeferredPointer &o);
 
 private:
+    Q_DISABLE_COPY(QQuickDeferredPointer)
+
     quintptr ptr_value = 0;
+    QtQuickPrivate::DeferredState *deferredState = nullptr;
 
     static const quintptr WasExecutedBit = 0x1;
     static const quintptr IsExecutingBit = 0x2;
@@ -98,10 +109,12 @@ QQuickDeferredPointer<T>::QQuickDeferredPointer(T *v)
     Q_ASSERT((ptr_value & FlagsMask) == 0);
 }
 
+// a deferred execution that was begun but never completed
 template<typename T>
-QQuickDeferredPointer<T>::QQuickDeferredPointer(const QQuickDeferredPointer<T> &o)
-: ptr_value(o.ptr_value)
+QQuickDeferredPointer<T>::~QQuickDeferredPointer()
 {
+    if (deferredState)
+        QtQuickPrivate::releaseDeferred(deferredState);
 }
 
 template<typename T>
@@ -137,6 +150,18 @@ void QQuickDeferredPointer<T>::setExecuting(bool b)
         ptr_value &= ~IsExecutingBit;
 }
 
+template<typename T>
+QtQuickPrivate::DeferredState *QQuickDeferredPointer<T>::state() const
+{
+    return deferredState;
+}
+
+template<typename T>
+void QQuickDeferredPointer<T>::setState(QtQuickPrivate::DeferredState *state)
+{
+    deferredState = state;
+}
+
 template<typename T>
 QQuickDeferredPointer<T>::operator T*() const
 {
@@ -176,13 +201,6 @@ QQuickDeferredPointer<T> &QQuickDeferredPointer<T>::operator=(T *o)
     return *this;
 }
 
-template<typename T>
-QQuickDeferredPointer<T> &QQuickDeferredPointer<T>::operator=(const QQuickDeferredPointer &o)
-{
-    ptr_value = o.ptr_value;
-    return *this;
-}
-
 QT_END_NAMESPACE
 
 #endif // QQUICKDEFERREDPOINTER_P_P_H
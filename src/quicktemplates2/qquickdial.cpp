@@ -117,6 +117,8 @@ public:
     qreal position = 0;
     qreal angle = startAngle;
     qreal stepSize = 0;
+    qreal queuedValue = 0;
+    bool hasQueuedValue = false;
     bool pressed = false;
     QPointF pressPoint;
     QQuickDial::SnapMode snapMode = QQuickDial::NoSnap;
@@ -259,7 +261,7 @@ void QQuickDialPrivate::executeHandle(bool complete)
     if (!handle || complete)
         quickBeginDeferred(q, handleName(), handle);
     if (complete)
-        quickCompleteDeferred(q, handleName(), handle);
+        quickCompleteDeferred(q, handle);
 }
 
 QQuickDial::QQuickDial(QQuickItem *parent)
@@ -344,6 +346,7 @@ qreal QQuickDial::value() const
 void QQuickDial::setValue(qreal value)
 {
     Q_D(QQuickDial);
+    d->hasQueuedValue = false;
     if (isComponentComplete())
         value = d->from > d->to ? qBound(d->to, value, d->from) : qBound(d->from, value, d->to);
 
@@ -355,6 +358,27 @@ void QQuickDial::setValue(qreal value)
     emit valueChanged();
 }
 
+/*!
+    \internal
+
+    Sets the value to \a value on the next frame. Calling this repeatedly
+    before then, for example from a rotary encoder that reports much more
+    often than the screen refreshes, only applies the last value, so the
+    value, position and angle bindings are evaluated once per frame.
+*/
+void QQuickDial::queueValue(qreal value)
+{
+    Q_D(QQuickDial);
+    if (!window()) {
+        setValue(value);
+        return;
+    }
+
+    d->queuedValue = value;
+    d->hasQueuedValue = true;
+    polish();
+}
+
 /*!
     \qmlproperty real QtQuick.Controls::Dial::position
     \readonly
@@ -737,6 +761,14 @@ void QQuickDial::componentComplete()
     d->updatePosition();
 }
 
+void QQuickDial::updatePolish()
+{
+    Q_D(QQuickDial);
+    QQuickControl::updatePolish();
+    if (d->hasQueuedValue)
+        setValue(d->queuedValue);
+}
+
 #if QT_CONFIG(accessibility)
 void QQuickDial::accessibilityActiveChanged(bool active)
 {
@@ -85,6 +85,7 @@ public:
 
     qreal value() const;
     void setValue(qreal value);
+    void queueValue(qreal value);
 
     qreal position() const;
 
@@ -148,6 +149,7 @@ protected:
 
     void mirrorChange() override;
     void componentComplete() override;
+    void updatePolish() override;
 
 #if QT_CONFIG(accessibility)
     void accessibilityActiveChanged(bool active) override;
@@ -179,6 +179,14 @@ void QQuickDialogPrivate::handleClick(QQuickAbstractButton *button)
     }
 }
 
+void QQuickDialogPrivate::reposition()
+{
+    // the popup item is polished both for repositioning and for
+    // the pending header and footer layout changes
+    layout->updatePolish();
+    QQuickPopupPrivate::reposition();
+}
+
 QQuickDialog::QQuickDialog(QObject *parent)
     : QQuickPopup(*(new QQuickDialogPrivate), parent)
 {
@@ -72,6 +72,8 @@ public:
 
     void handleClick(QQuickAbstractButton *button);
 
+    void reposition() override;
+
     int result = 0;
     QString title;
     QQuickDialogButtonBox *buttonBox = nullptr;
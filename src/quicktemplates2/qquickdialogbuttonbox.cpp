@@ -382,9 +382,12 @@ QQuickAbstractButton *QQuickDialogButtonBoxPrivate::createStandardButton(QPlatfo
     return nullptr;
 }
 
-void QQuickDialogButtonBoxPrivate::removeStandardButtons()
+// Removes the standard buttons that are not in \a keep,
+// and returns the standard buttons that were kept.
+QPlatformDialogHelper::StandardButtons QQuickDialogButtonBoxPrivate::removeStandardButtons(QPlatformDialogHelper::StandardButtons keep)
 {
     Q_Q(QQuickDialogButtonBox);
+    QPlatformDialogHelper::StandardButtons kept = QPlatformDialogHelper::NoButton;
     int i = q->count() - 1;
     while (i >= 0) {
         QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton *>(q->itemAt(i));
@@ -392,7 +395,9 @@ void QQuickDialogButtonBoxPrivate::removeStandardButtons()
             QQuickDialogButtonBoxAttached *attached = qobject_cast<QQuickDialogButtonBoxAttached *>(qmlAttachedPropertiesObject<QQuickDialogButtonBox>(button, false));
             if (attached) {
                 QQuickDialogButtonBoxAttachedPrivate *p = QQuickDialogButtonBoxAttachedPrivate::get(attached);
-                if (p->standardButton != QPlatformDialogHelper::NoButton) {
+                if (keep & p->standardButton) {
+                    kept |= p->standardButton;
+                } else if (p->standardButton != QPlatformDialogHelper::NoButton) {
                     q->removeItem(i);
                     button->deleteLater();
                 }
@@ -400,6 +405,7 @@ void QQuickDialogButtonBoxPrivate::removeStandardButtons()
         }
         --i;
     }
+    return kept;
 }
 
 QQuickDialogButtonBox::QQuickDialogButtonBox(QQuickItem *parent)
@@ -526,11 +532,12 @@ void QQuickDialogButtonBox::setStandardButtons(QPlatformDialogHelper::StandardBu
     if (d->standardButtons == buttons)
         return;
 
-    d->removeStandardButtons();
+    // the buttons that remain are reused, and only the new ones are created
+    const QPlatformDialogHelper::StandardButtons kept = d->removeStandardButtons(buttons);
 
     for (int i = QPlatformDialogHelper::FirstButton; i <= QPlatformDialogHelper::LastButton; i<<=1) {
         QPlatformDialogHelper::StandardButton standardButton = static_cast<QPlatformDialogHelper::StandardButton>(i);
-        if (standardButton & buttons) {
+        if ((standardButton & buttons) && !(standardButton & kept)) {
             QQuickAbstractButton *button = d->createStandardButton(standardButton);
             if (button)
                 addItem(button);
@@ -614,7 +621,9 @@ void QQuickDialogButtonBox::geometryChanged(const QRectF &newGeometry, const QRe
 {
     Q_D(QQuickDialogButtonBox);
     QQuickContainer::geometryChanged(newGeometry, oldGeometry);
-    d->updateLayout();
+    // laid out once per frame in updatePolish()
+    if (isComponentComplete())
+        polish();
 }
 
 void QQuickDialogButtonBox::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
@@ -71,7 +71,7 @@ public:
     void handleClick();
 
     QQuickAbstractButton *createStandardButton(QPlatformDialogHelper::StandardButton button);
-    void removeStandardButtons();
+    QPlatformDialogHelper::StandardButtons removeStandardButtons(QPlatformDialogHelper::StandardButtons keep = QPlatformDialogHelper::NoButton);
 
     Qt::Alignment alignment = 0;
     QQuickDialogButtonBox::Position position = QQuickDialogButtonBox::Footer;
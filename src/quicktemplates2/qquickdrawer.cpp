@@ -275,6 +275,18 @@ static bool isWithinDragMargin(const QQuickDrawer *drawer, const QPointF &pos)
     return false;
 }
 
+/*
+    Returns whether a press at \a pos in window coordinates would start
+    dragging the drawer open.
+*/
+bool QQuickDrawerPrivate::canStartDrag(const QPointF &pos) const
+{
+    Q_Q(const QQuickDrawer);
+    if (!window || !interactive || dragMargin < 0.0 || qFuzzyIsNull(dragMargin))
+        return false;
+    return isWithinDragMargin(q, pos);
+}
+
 bool QQuickDrawerPrivate::startDrag(QEvent *event)
 {
     Q_Q(QQuickDrawer);
@@ -406,6 +418,21 @@ bool QQuickDrawerPrivate::grabTouch(QQuickItem *item, QTouchEvent *event)
 
 static const qreal openCloseVelocityThreshold = 300;
 
+// The expected latency (ms) between applying a drag position and the
+// resulting frame being presented, used for predictive positioning.
+static const qreal dragPredictionInterval = 16;
+
+/*
+    When enabled, dragging a drawer does not update its position for every
+    move event. Instead, the latest move is applied at most once per frame,
+    after the animations have advanced, and the position is extrapolated by
+    the current drag velocity to compensate for the input-to-photon latency.
+*/
+static bool isDeferredDragEnabled()
+{
+    return qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_DEFERRED_DRAWER_DRAG") > 0;
+}
+
 bool QQuickDrawerPrivate::blockInput(QQuickItem *item, const QPointF &point) const
 {
     Q_Q(const QQuickDrawer);
@@ -433,6 +460,11 @@ bool QQuickDrawerPrivate::blockInput(QQuickItem *item, const QPointF &point) con
 bool QQuickDrawerPrivate::handlePress(QQuickItem *item, const QPointF &point, ulong timestamp)
 {
     offset = 0;
+    cancelDrag();
+    dragPoint = point;
+    dragTimestamp = timestamp;
+    dragVelocity = QPointF();
+    deferredDrag = isDeferredDragEnabled();
     velocityCalculator.startMeasuring(point, timestamp);
 
     if (!QQuickPopupPrivate::handlePress(item, point, timestamp))
@@ -447,19 +479,33 @@ bool QQuickDrawerPrivate::handleMove(QQuickItem *item, const QPointF &point, ulo
     if (!QQuickPopupPrivate::handleMove(item, point, timestamp))
         return false;
 
+    velocityCalculator.updateMeasuring(point, timestamp);
+
     // limit/reset the offset to the edge of the drawer when pushed from the outside
     if (qFuzzyCompare(position, qreal(1.0)) && !contains(point))
         offset = 0;
 
     bool isGrabbed = popupItem->keepMouseGrab() || popupItem->keepTouchGrab();
-    if (isGrabbed)
-        q->setPosition(positionAt(point) - offset);
+    if (isGrabbed) {
+        if (deferredDrag)
+            scheduleDrag(point, timestamp);
+        else
+            q->setPosition(positionAt(point) - offset);
+    }
 
     return isGrabbed;
 }
 
 bool QQuickDrawerPrivate::handleRelease(QQuickItem *item, const QPointF &point, ulong timestamp)
 {
+    Q_Q(QQuickDrawer);
+    if (pendingDrag) {
+        // apply the last actual drag position, without prediction, before
+        // deciding whether the drawer should open or close
+        cancelDrag();
+        q->setPosition(positionAt(dragPoint) - offset);
+    }
+
     if (!popupItem->keepMouseGrab() && !popupItem->keepTouchGrab()) {
         velocityCalculator.reset();
         return QQuickPopupPrivate::handleRelease(item, point, timestamp);
@@ -531,9 +577,44 @@ void QQuickDrawerPrivate::handleUngrab()
 {
     QQuickPopupPrivate::handleUngrab();
 
+    cancelDrag();
     velocityCalculator.reset();
 }
 
+void QQuickDrawerPrivate::scheduleDrag(const QPointF &point, ulong timestamp)
+{
+    Q_Q(QQuickDrawer);
+    if (timestamp > dragTimestamp && dragTimestamp > 0)
+        dragVelocity = (point - dragPoint) / (timestamp - dragTimestamp);
+    else
+        dragVelocity = QPointF();
+    dragPoint = point;
+    dragTimestamp = timestamp;
+
+    if (pendingDrag || !window)
+        return;
+
+    pendingDrag = QObject::connect(window, &QQuickWindow::afterAnimating, q, [this]() { updateDrag(); });
+    window->update();
+}
+
+void QQuickDrawerPrivate::cancelDrag()
+{
+    if (pendingDrag)
+        QObject::disconnect(pendingDrag);
+    pendingDrag = QMetaObject::Connection();
+}
+
+void QQuickDrawerPrivate::updateDrag()
+{
+    Q_Q(QQuickDrawer);
+    cancelDrag();
+    if (!popupItem->keepMouseGrab() && !popupItem->keepTouchGrab())
+        return;
+
+    q->setPosition(positionAt(dragPoint + dragVelocity * dragPredictionInterval) - offset);
+}
+
 static QList<QQuickStateAction> prepareTransition(QQuickDrawer *drawer, QQuickTransition *transition, qreal to)
 {
     QList<QQuickStateAction> actions;
@@ -72,6 +72,7 @@ public:
     void hideOverlay() override;
     void resizeOverlay() override;
 
+    bool canStartDrag(const QPointF &pos) const;
     bool startDrag(QEvent *event);
     bool grabMouse(QQuickItem *item, QMouseEvent *event);
 #if QT_CONFIG(quicktemplates2_multitouch)
@@ -89,11 +90,21 @@ public:
 
     bool setEdge(Qt::Edge edge);
 
+    void scheduleDrag(const QPointF &point, ulong timestamp);
+    void cancelDrag();
+    void updateDrag();
+
     Qt::Edge edge = Qt::LeftEdge;
     qreal offset = 0;
     qreal position = 0;
     qreal dragMargin = 0;
     QQuickVelocityCalculator velocityCalculator;
+
+    bool deferredDrag = false; // sampled on press, for the whole drag
+    QPointF dragPoint;
+    ulong dragTimestamp = 0;
+    QPointF dragVelocity;
+    QMetaObject::Connection pendingDrag;
 };
 
 QT_END_NAMESPACE
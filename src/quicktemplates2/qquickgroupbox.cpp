@@ -113,7 +113,7 @@ void QQuickGroupBoxPrivate::executeLabel(bool complete)
     if (!label || complete)
         quickBeginDeferred(q, labelName(), label);
     if (complete)
-        quickCompleteDeferred(q, labelName(), label);
+        quickCompleteDeferred(q, label);
 }
 
 QQuickGroupBox::QQuickGroupBox(QQuickItem *parent)
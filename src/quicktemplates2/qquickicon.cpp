@@ -36,6 +36,8 @@
 
 #include "qquickicon_p.h"
 
+#include <QtCore/qhash.h>
+
 QT_BEGIN_NAMESPACE
 
 class QQuickIconPrivate : public QSharedData
@@ -58,6 +60,25 @@ public:
 
     // This is based on QFont's resolve_mask.
     int resolveMask = 0;
+
+    // Cached hash of the values, so that icons that differ can usually be
+    // told apart without comparing the name and source strings.
+    mutable uint hash = 0;
+    mutable bool hashValid = false;
+
+    uint hashValue() const
+    {
+        if (!hashValid) {
+            uint h = qHash(name);
+            h = h * 31 + qHash(source);
+            h = h * 31 + uint(width);
+            h = h * 31 + uint(height);
+            h = h * 31 + color.rgba();
+            hash = h;
+            hashValid = true;
+        }
+        return hash;
+    }
 };
 
 QQuickIcon::QQuickIcon()
@@ -82,7 +103,8 @@ QQuickIcon &QQuickIcon::operator=(const QQuickIcon &other)
 
 bool QQuickIcon::operator==(const QQuickIcon &other) const
 {
-    return d == other.d || (d->name == other.d->name
+    return d == other.d || (d->hashValue() == other.d->hashValue()
+                            && d->name == other.d->name
                             && d->source == other.d->source
                             && d->width == other.d->width
                             && d->height == other.d->height
@@ -106,17 +128,20 @@ QString QQuickIcon::name() const
 
 void QQuickIcon::setName(const QString &name)
 {
-    if ((d->resolveMask & QQuickIconPrivate::NameResolved) && d->name == name)
+    const QQuickIconPrivate *p = d.constData();
+    if ((p->resolveMask & QQuickIconPrivate::NameResolved) && p->name == name)
         return;
 
     d->name = name;
     d->resolveMask |= QQuickIconPrivate::NameResolved;
+    d->hashValid = false;
 }
 
 void QQuickIcon::resetName()
 {
     d->name = QString();
     d->resolveMask &= ~QQuickIconPrivate::NameResolved;
+    d->hashValid = false;
 }
 
 QUrl QQuickIcon::source() const
@@ -126,17 +151,20 @@ QUrl QQuickIcon::source() const
 
 void QQuickIcon::setSource(const QUrl &source)
 {
-    if ((d->resolveMask & QQuickIconPrivate::SourceResolved) && d->source == source)
+    const QQuickIconPrivate *p = d.constData();
+    if ((p->resolveMask & QQuickIconPrivate::SourceResolved) && p->source == source)
         return;
 
     d->source = source;
     d->resolveMask |= QQuickIconPrivate::SourceResolved;
+    d->hashValid = false;
 }
 
 void QQuickIcon::resetSource()
 {
     d->source = QString();
     d->resolveMask &= ~QQuickIconPrivate::SourceResolved;
+    d->hashValid = false;
 }
 
 int QQuickIcon::width() const
@@ -146,17 +174,20 @@ int QQuickIcon::width() const
 
 void QQuickIcon::setWidth(int width)
 {
-    if ((d->resolveMask & QQuickIconPrivate::WidthResolved) && d->width == width)
+    const QQuickIconPrivate *p = d.constData();
+    if ((p->resolveMask & QQuickIconPrivate::WidthResolved) && p->width == width)
         return;
 
     d->width = width;
     d->resolveMask |= QQuickIconPrivate::WidthResolved;
+    d->hashValid = false;
 }
 
 void QQuickIcon::resetWidth()
 {
     d->width = 0;
     d->resolveMask &= ~QQuickIconPrivate::WidthResolved;
+    d->hashValid = false;
 }
 
 int QQuickIcon::height() const
@@ -166,17 +197,20 @@ int QQuickIcon::height() const
 
 void QQuickIcon::setHeight(int height)
 {
-    if ((d->resolveMask & QQuickIconPrivate::HeightResolved) && d->height == height)
+    const QQuickIconPrivate *p = d.constData();
+    if ((p->resolveMask & QQuickIconPrivate::HeightResolved) && p->height == height)
         return;
 
     d->height = height;
     d->resolveMask |= QQuickIconPrivate::HeightResolved;
+    d->hashValid = false;
 }
 
 void QQuickIcon::resetHeight()
 {
     d->height = 0;
     d->resolveMask &= ~QQuickIconPrivate::HeightResolved;
+    d->hashValid = false;
 }
 
 QColor QQuickIcon::color() const
@@ -186,21 +220,32 @@ QColor QQuickIcon::color() const
 
 void QQuickIcon::setColor(const QColor &color)
 {
-    if ((d->resolveMask & QQuickIconPrivate::ColorResolved) && d->color == color)
+    const QQuickIconPrivate *p = d.constData();
+    if ((p->resolveMask & QQuickIconPrivate::ColorResolved) && p->color == color)
         return;
 
     d->color = color;
     d->resolveMask |= QQuickIconPrivate::ColorResolved;
+    d->hashValid = false;
 }
 
 void QQuickIcon::resetColor()
 {
     d->color = Qt::transparent;
     d->resolveMask &= ~QQuickIconPrivate::ColorResolved;
+    d->hashValid = false;
 }
 
 QQuickIcon QQuickIcon::resolve(const QQuickIcon &other) const
 {
+    // Nothing to inherit; return a shallow copy so that the result keeps
+    // sharing its data with this icon.
+    const int allResolved = QQuickIconPrivate::NameResolved | QQuickIconPrivate::SourceResolved
+            | QQuickIconPrivate::WidthResolved | QQuickIconPrivate::HeightResolved
+            | QQuickIconPrivate::ColorResolved;
+    if ((d->resolveMask & allResolved) == allResolved)
+        return *this;
+
     QQuickIcon resolved = *this;
 
     if (!(d->resolveMask & QQuickIconPrivate::NameResolved))
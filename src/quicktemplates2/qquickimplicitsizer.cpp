@@ -0,0 +1,151 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickimplicitsizer_p_p.h"
+#include "qquickcontrol_p.h"
+#include "qquickcontrol_p_p.h"
+
+#include <QtQuick/private/qquickitem_p.h>
+
+QT_BEGIN_NAMESPACE
+
+static const QQuickItemPrivate::ChangeTypes ItemChanges = QQuickItemPrivate::ImplicitWidth | QQuickItemPrivate::ImplicitHeight | QQuickItemPrivate::Destroyed;
+
+QQuickImplicitSizer::QQuickImplicitSizer(QQuickControl *control, bool width, bool height)
+    : m_control(control),
+      m_width(width),
+      m_height(height)
+{
+}
+
+QQuickImplicitSizer::~QQuickImplicitSizer()
+{
+    unwatch(m_background);
+    unwatch(m_contentItem);
+}
+
+bool QQuickImplicitSizer::isActive() const
+{
+    return m_width || m_height;
+}
+
+bool QQuickImplicitSizer::isUpdating() const
+{
+    return m_updating;
+}
+
+void QQuickImplicitSizer::release(Qt::Orientation orientation)
+{
+    if (orientation == Qt::Horizontal)
+        m_width = false;
+    else
+        m_height = false;
+}
+
+void QQuickImplicitSizer::setBackground(QQuickItem *background)
+{
+    if (m_background == background)
+        return;
+
+    unwatch(m_background);
+    m_background = background;
+    watch(background);
+}
+
+void QQuickImplicitSizer::setContentItem(QQuickItem *contentItem)
+{
+    if (m_contentItem == contentItem)
+        return;
+
+    unwatch(m_contentItem);
+    m_contentItem = contentItem;
+    watch(contentItem);
+}
+
+void QQuickImplicitSizer::update()
+{
+    if (!isActive() || m_updating)
+        return;
+
+    QQuickControlPrivate *d = QQuickControlPrivate::get(m_control);
+    m_updating = true;
+    if (m_width) {
+        const qreal contentWidth = d->getContentWidth();
+        m_control->QQuickItem::setImplicitWidth(qMax(m_background ? m_background->implicitWidth() : 0,
+                                                     contentWidth + m_control->leftPadding() + m_control->rightPadding()));
+    }
+    if (m_height) {
+        const qreal contentHeight = d->getContentHeight();
+        m_control->QQuickItem::setImplicitHeight(qMax(m_background ? m_background->implicitHeight() : 0,
+                                                      contentHeight + m_control->topPadding() + m_control->bottomPadding()));
+    }
+    m_updating = false;
+}
+
+void QQuickImplicitSizer::itemImplicitWidthChanged(QQuickItem *)
+{
+    if (m_width)
+        update();
+}
+
+void QQuickImplicitSizer::itemImplicitHeightChanged(QQuickItem *)
+{
+    if (m_height)
+        update();
+}
+
+void QQuickImplicitSizer::itemDestroyed(QQuickItem *item)
+{
+    if (item == m_background)
+        m_background = nullptr;
+    if (item == m_contentItem)
+        m_contentItem = nullptr;
+    update();
+}
+
+void QQuickImplicitSizer::watch(QQuickItem *item)
+{
+    if (item)
+        QQuickItemPrivate::get(item)->addItemChangeListener(this, ItemChanges);
+}
+
+void QQuickImplicitSizer::unwatch(QQuickItem *item)
+{
+    if (item)
+        QQuickItemPrivate::get(item)->removeItemChangeListener(this, ItemChanges);
+}
+
+QT_END_NAMESPACE
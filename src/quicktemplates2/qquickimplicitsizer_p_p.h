@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKIMPLICITSIZER_P_P_H
+#define QQUICKIMPLICITSIZER_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtQuick/private/qquickitemchangelistener_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QQuickControl;
+
+// Calculates the implicit size of a control from the implicit sizes of its
+// background and content item, and its padding, for the dimensions that
+// the style or the user has not bound or assigned.
+class QQuickImplicitSizer : public QQuickItemChangeListener
+{
+public:
+    QQuickImplicitSizer(QQuickControl *control, bool width, bool height);
+    ~QQuickImplicitSizer();
+
+    bool isActive() const;
+    bool isUpdating() const;
+    void release(Qt::Orientation orientation);
+
+    void setBackground(QQuickItem *background);
+    void setContentItem(QQuickItem *contentItem);
+
+    void update();
+
+protected:
+    void itemImplicitWidthChanged(QQuickItem *item) override;
+    void itemImplicitHeightChanged(QQuickItem *item) override;
+    void itemDestroyed(QQuickItem *item) override;
+
+private:
+    void watch(QQuickItem *item);
+    void unwatch(QQuickItem *item);
+
+    QQuickControl *m_control = nullptr;
+    QQuickItem *m_background = nullptr;
+    QQuickItem *m_contentItem = nullptr;
+    bool m_width = false;
+    bool m_height = false;
+    bool m_updating = false;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKIMPLICITSIZER_P_P_H
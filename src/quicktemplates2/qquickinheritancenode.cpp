@@ -0,0 +1,626 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Templates 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickinheritancenode_p_p.h"
+#include "qquickcontrol_p.h"
+#include "qquickcontrol_p_p.h"
+#include "qquicklabel_p.h"
+#include "qquicklabel_p_p.h"
+#include "qquicktextarea_p.h"
+#include "qquicktextarea_p_p.h"
+#include "qquicktextfield_p.h"
+#include "qquicktextfield_p_p.h"
+#include "qquicktimingspan_p_p.h"
+
+#include <QtCore/qscopedvaluerollback.h>
+#include <QtQuick/private/qquickitem_p.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_LOGGING_CATEGORY(lcInheritance, "qt.quick.controls.inheritance")
+
+// the span of the outermost propagation in progress, which counts the nodes reached
+static QQuickTimingSpan *propagationSpan = nullptr;
+
+static const QQuickItemPrivate::ChangeTypes NodeChangeTypes = QQuickItemPrivate::Children | QQuickItemPrivate::Destroyed;
+
+// Attaches a node to the extra data of its item, so that get() does not need
+// a global table. The data is deleted together with the item, and so is the
+// node, which lives in the private of the same item.
+class QQuickInheritanceNodeData : public QObjectUserData
+{
+public:
+    explicit QQuickInheritanceNodeData(QQuickInheritanceNode *node) : node(node) { }
+
+    QQuickInheritanceNode *node;
+};
+
+static uint inheritanceNodeDataId()
+{
+    static const uint id = QObject::registerUserData();
+    return id;
+}
+
+// the batches in progress, innermost last
+typedef QVector<QQuickInheritanceBatch *> QQuickInheritanceBatchList;
+Q_GLOBAL_STATIC(QQuickInheritanceBatchList, activeBatches)
+
+QQuickInheritanceNode::QQuickInheritanceNode()
+{
+}
+
+QQuickInheritanceNode::~QQuickInheritanceNode()
+{
+    invalidate();
+    if (m_batch)
+        m_batch->m_updates[m_pendingUpdate].node = nullptr;
+    if (m_notificationBatch)
+        m_notificationBatch->m_notifications[m_pendingNotification].node = nullptr;
+}
+
+/*!
+    \internal
+
+    Tags \a item with \a type. Items of any type other than ItemType can be
+    looked up with get() by the inheritance walkers.
+*/
+void QQuickInheritanceNode::init(QQuickItem *item, Type type)
+{
+    Q_ASSERT(!m_item || m_item == item);
+    m_item = item;
+    m_type = type;
+    if (type != ItemType && !get(item))
+        item->setUserData(inheritanceNodeDataId(), new QQuickInheritanceNodeData(this));
+}
+
+QQuickInheritanceNode *QQuickInheritanceNode::get(const QQuickItem *item)
+{
+    QObjectUserData *data = item->userData(inheritanceNodeDataId());
+    return data ? static_cast<QQuickInheritanceNodeData *>(data)->node : nullptr;
+}
+
+/*!
+    \internal
+
+    Returns the closest descendants of the item that take part in inheritance.
+    The items in between are watched for child changes so that the list can be
+    re-used until the structure of the subtree changes.
+*/
+QVector<QQuickInheritanceNode *> QQuickInheritanceNode::children()
+{
+    if (m_dirty) {
+        invalidate();
+        // nothing to watch until the item gets children of its own
+        if (m_item && !QQuickItemPrivate::get(m_item)->childItems.isEmpty()) {
+            collect(m_item);
+            m_dirty = false;
+        }
+    }
+    return m_children;
+}
+
+void QQuickInheritanceNode::invalidate()
+{
+    for (QQuickItem *item : qAsConst(m_watched))
+        QQuickItemPrivate::get(item)->removeItemChangeListener(this, NodeChangeTypes);
+    m_watched.clear();
+    m_children.clear();
+    m_dirty = true;
+}
+
+/*!
+    \internal
+
+    Propagates the specified \a attributes of \a values to the closest
+    descendants. Descendants that do not handle an attribute pass it
+    further down to their own descendants.
+
+    While a QQuickInheritanceBatch that covers the node exists, the
+    propagation is recorded instead, and carried out once per node with
+    all attributes that were changed in the meanwhile.
+*/
+void QQuickInheritanceNode::propagate(Attributes attributes, const Values &values)
+{
+    if (QQuickInheritanceBatch *batch = QQuickInheritanceBatch::find(this)) {
+        defer(batch, attributes, values);
+        return;
+    }
+
+    QQuickTimingSpan span(lcInheritance, "propagate", m_item, !propagationSpan);
+    QScopedValueRollback<QQuickTimingSpan *> rollback(propagationSpan, propagationSpan ? propagationSpan : &span);
+
+    const auto nodes = children();
+    for (QQuickInheritanceNode *node : nodes)
+        node->inherit(attributes, values);
+}
+
+void QQuickInheritanceNode::defer(QQuickInheritanceBatch *batch, Attributes attributes, const Values &values)
+{
+    if (m_batch && m_batch != batch) {
+        // the node moved to another window while its update was pending
+        m_batch->m_updates[m_pendingUpdate].node = nullptr;
+        m_batch = nullptr;
+    }
+    if (!m_batch) {
+        m_batch = batch;
+        m_pendingUpdate = batch->m_updates.count();
+        batch->m_updates.append(QQuickInheritanceBatch::Update{this, Attributes(), Values()});
+    }
+
+    QQuickInheritanceBatch::Update &update = batch->m_updates[m_pendingUpdate];
+    if (attributes & FontAttribute) {
+        update.values.font = values.font;
+        update.values.fontChanges |= values.fontChanges;
+    }
+    if (attributes & PaletteAttribute) {
+        update.values.palette = values.palette;
+        update.values.paletteChanges |= values.paletteChanges;
+    }
+    if (attributes & LocaleAttribute)
+        update.values.locale = values.locale;
+    if (attributes & HoverEnabledAttribute)
+        update.values.hoverEnabled = values.hoverEnabled;
+    update.attributes |= attributes;
+}
+
+void QQuickInheritanceNode::propagateFont(const QFont &font, uint changes)
+{
+    Values values;
+    values.font = font;
+    values.fontChanges = changes;
+    propagate(FontAttribute, values);
+}
+
+void QQuickInheritanceNode::propagatePalette(const QPalette &palette, uint changes)
+{
+    Values values;
+    values.palette = palette;
+    values.paletteChanges = changes;
+    propagate(PaletteAttribute, values);
+}
+
+void QQuickInheritanceNode::propagateLocale(const QLocale &locale)
+{
+    Values values;
+    values.locale = locale;
+    propagate(LocaleAttribute, values);
+}
+
+void QQuickInheritanceNode::propagateHoverEnabled(bool enabled)
+{
+    Values values;
+    values.hoverEnabled = enabled;
+    propagate(HoverEnabledAttribute, values);
+}
+
+/*!
+    \internal
+
+    Emits the change signals of the item for \a attributes. While a
+    QQuickInheritanceBatch that covers the node exists, the signals are held
+    back instead, and emitted once per node after the batch has propagated
+    the recorded changes.
+*/
+void QQuickInheritanceNode::notify(Attributes attributes)
+{
+    QQuickInheritanceBatch *batch = QQuickInheritanceBatch::find(this);
+    if (!batch) {
+        emitChanged(attributes);
+        return;
+    }
+
+    if (m_notificationBatch && m_notificationBatch != batch) {
+        // the node moved to another window while its signals were held back
+        attributes |= m_notificationBatch->m_notifications.at(m_pendingNotification).attributes;
+        m_notificationBatch->m_notifications[m_pendingNotification].node = nullptr;
+        m_notificationBatch = nullptr;
+    }
+    if (!m_notificationBatch) {
+        m_notificationBatch = batch;
+        m_pendingNotification = batch->m_notifications.count();
+        batch->m_notifications.append(QQuickInheritanceBatch::Notification{this, Attributes()});
+    }
+    batch->m_notifications[m_pendingNotification].attributes |= attributes;
+}
+
+template <typename T>
+static void emitFontAndPaletteChanged(T *item, QQuickInheritanceNode::Attributes attributes)
+{
+    if (attributes & QQuickInheritanceNode::FontAttribute)
+        emit item->fontChanged();
+    if (attributes & QQuickInheritanceNode::PaletteAttribute)
+        emit item->paletteChanged();
+}
+
+void QQuickInheritanceNode::emitChanged(Attributes attributes)
+{
+    switch (m_type) {
+    case ControlType:
+    case PopupItemType: {
+        QQuickControl *control = static_cast<QQuickControl *>(m_item);
+        emitFontAndPaletteChanged(control, attributes);
+        if (attributes & LocaleAttribute)
+            emit control->localeChanged();
+        break;
+    }
+    case LabelType:
+        emitFontAndPaletteChanged(static_cast<QQuickLabel *>(m_item), attributes);
+        break;
+    case TextAreaType:
+        emitFontAndPaletteChanged(static_cast<QQuickTextArea *>(m_item), attributes);
+        break;
+    case TextFieldType:
+        emitFontAndPaletteChanged(static_cast<QQuickTextField *>(m_item), attributes);
+        break;
+    default:
+        break;
+    }
+}
+
+QFont QQuickInheritanceNode::font() const
+{
+    switch (m_type) {
+    case ControlType:
+    case PopupItemType:
+        return static_cast<QQuickControl *>(m_item)->font();
+    case LabelType:
+        return static_cast<QQuickLabel *>(m_item)->font();
+    case TextAreaType:
+        return static_cast<QQuickTextArea *>(m_item)->font();
+    case TextFieldType:
+        return static_cast<QQuickTextField *>(m_item)->font();
+    default:
+        return QFont();
+    }
+}
+
+QPalette QQuickInheritanceNode::palette() const
+{
+    switch (m_type) {
+    case ControlType:
+    case PopupItemType:
+        return static_cast<QQuickControl *>(m_item)->palette();
+    case LabelType:
+        return static_cast<QQuickLabel *>(m_item)->palette();
+    case TextAreaType:
+        return static_cast<QQuickTextArea *>(m_item)->palette();
+    case TextFieldType:
+        return static_cast<QQuickTextField *>(m_item)->palette();
+    default:
+        return QPalette();
+    }
+}
+
+/*!
+    \internal
+
+    Returns the font resolve mask of the attributes that differ between
+    \a oldFont and \a newFont, either by value or by resolve state. Children
+    that explicitly request all of those attributes are not affected by the
+    change, and can be skipped during propagation.
+*/
+uint QQuickInheritanceNode::fontChanges(const QFont &oldFont, const QFont &newFont)
+{
+    uint changes = oldFont.resolve() ^ newFont.resolve();
+    if (oldFont.family() != newFont.family())
+        changes |= QFont::FamilyResolved;
+    if (oldFont.pointSizeF() != newFont.pointSizeF() || oldFont.pixelSize() != newFont.pixelSize())
+        changes |= QFont::SizeResolved;
+    if (oldFont.styleHint() != newFont.styleHint())
+        changes |= QFont::StyleHintResolved;
+    if (oldFont.styleStrategy() != newFont.styleStrategy())
+        changes |= QFont::StyleStrategyResolved;
+    if (oldFont.weight() != newFont.weight())
+        changes |= QFont::WeightResolved;
+    if (oldFont.style() != newFont.style())
+        changes |= QFont::StyleResolved;
+    if (oldFont.underline() != newFont.underline())
+        changes |= QFont::UnderlineResolved;
+    if (oldFont.overline() != newFont.overline())
+        changes |= QFont::OverlineResolved;
+    if (oldFont.strikeOut() != newFont.strikeOut())
+        changes |= QFont::StrikeOutResolved;
+    if (oldFont.fixedPitch() != newFont.fixedPitch())
+        changes |= QFont::FixedPitchResolved;
+    if (oldFont.stretch() != newFont.stretch())
+        changes |= QFont::StretchResolved;
+    if (oldFont.kerning() != newFont.kerning())
+        changes |= QFont::KerningResolved;
+    if (oldFont.capitalization() != newFont.capitalization())
+        changes |= QFont::CapitalizationResolved;
+    if (oldFont.letterSpacing() != newFont.letterSpacing() || oldFont.letterSpacingType() != newFont.letterSpacingType())
+        changes |= QFont::LetterSpacingResolved;
+    if (oldFont.wordSpacing() != newFont.wordSpacing())
+        changes |= QFont::WordSpacingResolved;
+    if (oldFont.hintingPreference() != newFont.hintingPreference())
+        changes |= QFont::HintingPreferenceResolved;
+    if (oldFont.styleName() != newFont.styleName())
+        changes |= QFont::StyleNameResolved;
+
+    // be conservative about differences that cannot be attributed
+    if (!changes && oldFont != newFont)
+        changes = QFont::AllPropertiesResolved;
+    return changes;
+}
+
+/*!
+    \internal
+
+    Returns the palette resolve mask of the color roles that differ between
+    \a oldPalette and \a newPalette in any color group, either by value or by
+    resolve state.
+*/
+uint QQuickInheritanceNode::paletteChanges(const QPalette &oldPalette, const QPalette &newPalette)
+{
+    uint changes = oldPalette.resolve() ^ newPalette.resolve();
+    for (int role = 0; role < QPalette::NColorRoles; ++role) {
+        const QPalette::ColorRole cr = static_cast<QPalette::ColorRole>(role);
+        for (int group = 0; group < QPalette::NColorGroups; ++group) {
+            const QPalette::ColorGroup cg = static_cast<QPalette::ColorGroup>(group);
+            if (oldPalette.brush(cg, cr) != newPalette.brush(cg, cr)) {
+                changes |= (1 << role);
+                break;
+            }
+        }
+    }
+
+    if (!changes && oldPalette != newPalette)
+        changes = (1 << QPalette::NColorRoles) - 1;
+    return changes;
+}
+
+void QQuickInheritanceNode::itemChildAdded(QQuickItem *, QQuickItem *)
+{
+    invalidate();
+}
+
+void QQuickInheritanceNode::itemChildRemoved(QQuickItem *, QQuickItem *)
+{
+    invalidate();
+}
+
+void QQuickInheritanceNode::itemDestroyed(QQuickItem *item)
+{
+    // the item is in the middle of clearing its listeners
+    m_watched.removeOne(item);
+    invalidate();
+}
+
+template <typename Private>
+static inline bool requestsFont(const Private *d, uint changes)
+{
+    return d->extra.isAllocated() && (d->extra->requestedFont.resolve() & changes) == changes;
+}
+
+template <typename Private>
+static inline bool requestsPalette(const Private *d, uint changes)
+{
+    return d->extra.isAllocated() && (d->extra->requestedPalette.resolve() & changes) == changes;
+}
+
+// Descendants that explicitly request all the changed attributes are
+// skipped, because neither they nor their children are affected.
+template <typename Private>
+static void inheritFontAndPalette(Private *d, QQuickInheritanceNode::Attributes attributes, const QQuickInheritanceNode::Values &values)
+{
+    if ((attributes & QQuickInheritanceNode::FontAttribute) && !requestsFont(d, values.fontChanges))
+        d->inheritFont(values.font);
+    if ((attributes & QQuickInheritanceNode::PaletteAttribute) && !requestsPalette(d, values.paletteChanges))
+        d->inheritPalette(values.palette);
+}
+
+void QQuickInheritanceNode::inherit(Attributes attributes, const Values &values)
+{
+    if (propagationSpan)
+        propagationSpan->addItems();
+
+    switch (m_type) {
+    case ControlType:
+    case PopupItemType: {
+        QQuickControlPrivate *d = QQuickControlPrivate::get(static_cast<QQuickControl *>(m_item));
+        if (d->suspended) {
+            // resolved by QQuickControlPrivate::resumeInheritance()
+            d->suspendedAttributes |= attributes;
+            return;
+        }
+        inheritFontAndPalette(d, attributes, values);
+        if (attributes & LocaleAttribute)
+            d->updateLocale(values.locale, false); // explicit=false
+#if QT_CONFIG(quicktemplates2_hover)
+        if (attributes & HoverEnabledAttribute)
+            d->updateHoverEnabled(values.hoverEnabled, false); // explicit=false
+#endif
+        return;
+    }
+    case LabelType:
+        inheritFontAndPalette(QQuickLabelPrivate::get(static_cast<QQuickLabel *>(m_item)), attributes, values);
+        break;
+    case TextAreaType:
+        inheritFontAndPalette(QQuickTextAreaPrivate::get(static_cast<QQuickTextArea *>(m_item)), attributes, values);
+        break;
+    case TextFieldType:
+        inheritFontAndPalette(QQuickTextFieldPrivate::get(static_cast<QQuickTextField *>(m_item)), attributes, values);
+        break;
+    default:
+        break;
+    }
+
+    // pass the attributes that are not inherited by this type of item through to the children
+    attributes &= ~(FontAttribute | PaletteAttribute);
+    if (attributes)
+        propagate(attributes, values);
+}
+
+void QQuickInheritanceNode::collect(QQuickItem *item)
+{
+    QQuickItemPrivate::get(item)->addItemChangeListener(this, NodeChangeTypes);
+    m_watched += item;
+
+    const QList<QQuickItem *> childItems = QQuickItemPrivate::get(item)->childItems;
+    for (QQuickItem *child : childItems) {
+        if (QQuickInheritanceNode *node = get(child))
+            m_children += node;
+        else
+            collect(child);
+    }
+}
+
+/*!
+    \internal
+
+    Starts recording propagation within \a window, or within all windows
+    if \a window is null, until the batch is flushed or destroyed. Batches
+    can be nested; the innermost one that covers a node records it.
+*/
+QQuickInheritanceBatch::QQuickInheritanceBatch(QQuickWindow *window)
+    : m_window(window)
+{
+    activeBatches()->append(this);
+}
+
+QQuickInheritanceBatch::~QQuickInheritanceBatch()
+{
+    flush();
+    if (!activeBatches.isDestroyed())
+        activeBatches()->removeOne(this);
+}
+
+/*!
+    \internal
+
+    Carries out the propagation recorded so far. Nodes that are reached
+    while processing the recorded updates are queued as well, so that each
+    node is visited once with the combined attributes. The change signals
+    that were held back are emitted afterwards, once per node.
+*/
+void QQuickInheritanceBatch::flush()
+{
+    // the handlers of the change signals may record more changes
+    while (!m_updates.isEmpty() || !m_notifications.isEmpty()) {
+        propagateUpdates();
+        emitNotifications();
+    }
+}
+
+void QQuickInheritanceBatch::propagateUpdates()
+{
+    if (m_updates.isEmpty())
+        return;
+
+    QQuickTimingSpan span(lcInheritance, "flush", nullptr, !propagationSpan);
+    QScopedValueRollback<QQuickTimingSpan *> rollback(propagationSpan, propagationSpan ? propagationSpan : &span);
+
+    for (int i = 0; i < m_updates.count(); ++i) {
+        // the queue may grow while propagating
+        const Update update = m_updates.at(i);
+        if (!update.node)
+            continue;
+
+        update.node->m_batch = nullptr;
+        update.node->m_pendingUpdate = -1;
+        const auto nodes = update.node->children();
+        for (QQuickInheritanceNode *node : nodes)
+            node->inherit(update.attributes, update.values);
+    }
+    m_updates.clear();
+}
+
+void QQuickInheritanceBatch::emitNotifications()
+{
+    for (int i = 0; i < m_notifications.count(); ++i) {
+        // the queue may grow, and nodes may be destroyed, while emitting
+        const Notification notification = m_notifications.at(i);
+        if (!notification.node)
+            continue;
+
+        notification.node->m_notificationBatch = nullptr;
+        notification.node->m_pendingNotification = -1;
+        notification.node->emitChanged(notification.attributes);
+    }
+    m_notifications.clear();
+}
+
+/*!
+    \internal
+
+    Drops the propagation recorded so far without carrying it out, and the
+    change signals that were held back without emitting them.
+*/
+void QQuickInheritanceBatch::discard()
+{
+    for (const Update &update : qAsConst(m_updates)) {
+        if (update.node) {
+            update.node->m_batch = nullptr;
+            update.node->m_pendingUpdate = -1;
+        }
+    }
+    m_updates.clear();
+
+    for (const Notification &notification : qAsConst(m_notifications)) {
+        if (notification.node) {
+            notification.node->m_notificationBatch = nullptr;
+            notification.node->m_pendingNotification = -1;
+        }
+    }
+    m_notifications.clear();
+}
+
+/*!
+    \internal
+
+    Returns the innermost batch that records the propagation of \a node,
+    or null if the node propagates right away.
+*/
+QQuickInheritanceBatch *QQuickInheritanceBatch::find(const QQuickInheritanceNode *node)
+{
+    if (!activeBatches.exists())
+        return nullptr;
+
+    const QQuickInheritanceBatchList *batches = activeBatches();
+    for (int i = batches->count() - 1; i >= 0; --i) {
+        QQuickInheritanceBatch *batch = batches->at(i);
+        if (batch->accepts(node))
+            return batch;
+    }
+    return nullptr;
+}
+
+bool QQuickInheritanceBatch::accepts(const QQuickInheritanceNode *node) const
+{
+    return !m_window || (node->item() && node->item()->window() == m_window);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,198 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Templates 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKINHERITANCENODE_P_P_H
+#define QQUICKINHERITANCENODE_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qvector.h>
+#include <QtCore/qlocale.h>
+#include <QtGui/qfont.h>
+#include <QtGui/qpalette.h>
+#include <QtQuick/private/qquickitemchangelistener_p.h>
+#include <QtQuickTemplates2/private/qtquicktemplates2global_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class QQuickItem;
+class QQuickWindow;
+class QQuickInheritanceBatch;
+
+// Tags an item that takes part in font, palette, locale and hover inheritance
+// (Control, Label, TextField and TextArea), so that the inheritance walkers can
+// dispatch without going through the meta-object system. It also maintains the
+// list of the closest such descendants. The list is built on demand by walking
+// the items in between, and invalidated by listening to child changes of those
+// items, so that repeated propagation does not need to walk the whole subtree.
+// Propagation and the change signals can be batched with QQuickInheritanceBatch.
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickInheritanceNode : public QQuickItemChangeListener
+{
+public:
+    enum Type {
+        ItemType,
+        ControlType,
+        PopupItemType,
+        LabelType,
+        TextAreaType,
+        TextFieldType
+    };
+
+    enum Attribute {
+        FontAttribute = 0x1,
+        PaletteAttribute = 0x2,
+        LocaleAttribute = 0x4,
+        HoverEnabledAttribute = 0x8
+    };
+    Q_DECLARE_FLAGS(Attributes, Attribute)
+
+    struct Values {
+        QFont font;
+        uint fontChanges = 0;
+        QPalette palette;
+        uint paletteChanges = 0;
+        QLocale locale;
+        bool hoverEnabled = false;
+    };
+
+    QQuickInheritanceNode();
+    ~QQuickInheritanceNode();
+
+    void init(QQuickItem *item, Type type);
+
+    QQuickItem *item() const { return m_item; }
+    Type type() const { return m_type; }
+
+    static QQuickInheritanceNode *get(const QQuickItem *item);
+
+    QVector<QQuickInheritanceNode *> children();
+    void invalidate();
+
+    void propagate(Attributes attributes, const Values &values);
+    void propagateFont(const QFont &font, uint changes);
+    void propagatePalette(const QPalette &palette, uint changes);
+    void propagateLocale(const QLocale &locale);
+    void propagateHoverEnabled(bool enabled);
+
+    void notify(Attributes attributes);
+
+    QFont font() const;
+    QPalette palette() const;
+
+    static uint fontChanges(const QFont &oldFont, const QFont &newFont);
+    static uint paletteChanges(const QPalette &oldPalette, const QPalette &newPalette);
+
+protected:
+    void itemChildAdded(QQuickItem *item, QQuickItem *child) override;
+    void itemChildRemoved(QQuickItem *item, QQuickItem *child) override;
+    void itemDestroyed(QQuickItem *item) override;
+
+private:
+    void inherit(Attributes attributes, const Values &values);
+    void collect(QQuickItem *item);
+    void defer(QQuickInheritanceBatch *batch, Attributes attributes, const Values &values);
+    void emitChanged(Attributes attributes);
+
+    Type m_type = ItemType;
+    bool m_dirty = true;
+    int m_pendingUpdate = -1;
+    int m_pendingNotification = -1;
+    QQuickInheritanceBatch *m_batch = nullptr;
+    QQuickInheritanceBatch *m_notificationBatch = nullptr;
+    QQuickItem *m_item = nullptr;
+    QVector<QQuickInheritanceNode *> m_children;
+    QVector<QQuickItem *> m_watched;
+
+    friend class QQuickInheritanceBatch;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QQuickInheritanceNode::Attributes)
+
+// Records the propagation of inherited attributes for as long as it exists,
+// and carries it out once per node with the combined attributes when it is
+// flushed or goes out of scope. The change signals of the nodes are held back
+// as well, and emitted once per node after the propagation. A batch that is bound to a window records the
+// propagation within that window only, and leaves the other windows alone.
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickInheritanceBatch
+{
+public:
+    explicit QQuickInheritanceBatch(QQuickWindow *window = nullptr);
+    ~QQuickInheritanceBatch();
+
+    QQuickWindow *window() const { return m_window; }
+
+    void flush();
+    void discard();
+
+    static QQuickInheritanceBatch *find(const QQuickInheritanceNode *node);
+
+private:
+    Q_DISABLE_COPY(QQuickInheritanceBatch)
+
+    struct Update {
+        QQuickInheritanceNode *node;
+        QQuickInheritanceNode::Attributes attributes;
+        QQuickInheritanceNode::Values values;
+    };
+
+    struct Notification {
+        QQuickInheritanceNode *node;
+        QQuickInheritanceNode::Attributes attributes;
+    };
+
+    bool accepts(const QQuickInheritanceNode *node) const;
+    void propagateUpdates();
+    void emitNotifications();
+
+    QQuickWindow *m_window = nullptr;
+    QVector<Update> m_updates;
+    QVector<Notification> m_notifications;
+
+    friend class QQuickInheritanceNode;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKINHERITANCENODE_P_P_H
@@ -82,14 +82,14 @@ QT_BEGIN_NAMESPACE
 QQuickLabelPrivate::QQuickLabelPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::installActivationObserver(this);
+    QQuickControlPrivate::addAccessibilityObserver(this);
 #endif
 }
 
 QQuickLabelPrivate::~QQuickLabelPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::removeActivationObserver(this);
+    QQuickControlPrivate::removeAccessibilityObserver(this);
 #endif
 }
 
@@ -129,7 +129,7 @@ void QQuickLabelPrivate::inheritFont(const QFont &font)
     parentFont.resolve(extra.isAllocated() ? extra->requestedFont.resolve() | font.resolve() : font.resolve());
 
     const QFont defaultFont = QQuickControlPrivate::themeFont(QPlatformTheme::LabelFont);
-    const QFont resolvedFont = parentFont.resolve(defaultFont);
+    const QFont resolvedFont = QQuickControlPrivate::shareInherited(parentFont.resolve(defaultFont), font);
 
     setFont_helper(resolvedFont);
 }
@@ -145,10 +145,10 @@ void QQuickLabelPrivate::updateFont(const QFont &font)
     QFont oldFont = sourceFont;
     q->QQuickText::setFont(font);
 
-    QQuickControlPrivate::updateFontRecur(q, font);
+    inheritanceNode.propagateFont(font, QQuickInheritanceNode::fontChanges(oldFont, font));
 
     if (oldFont != font)
-        emit q->fontChanged();
+        inheritanceNode.notify(QQuickInheritanceNode::FontAttribute);
 }
 
 /*!
@@ -171,21 +171,20 @@ void QQuickLabelPrivate::inheritPalette(const QPalette &palette)
     parentPalette.resolve(extra.isAllocated() ? extra->requestedPalette.resolve() | palette.resolve() : palette.resolve());
 
     const QPalette defaultPalette = QQuickControlPrivate::themePalette(QPlatformTheme::LabelPalette);
-    const QPalette resolvedPalette = parentPalette.resolve(defaultPalette);
+    const QPalette resolvedPalette = QQuickControlPrivate::shareInherited(parentPalette.resolve(defaultPalette), palette);
 
     setPalette_helper(resolvedPalette);
 }
 
 void QQuickLabelPrivate::updatePalette(const QPalette &palette)
 {
-    Q_Q(QQuickLabel);
     QPalette oldPalette = resolvedPalette;
     resolvedPalette = palette;
 
-    QQuickControlPrivate::updatePaletteRecur(q, palette);
+    inheritanceNode.propagatePalette(palette, QQuickInheritanceNode::paletteChanges(oldPalette, palette));
 
     if (oldPalette != palette)
-        emit q->paletteChanged();
+        inheritanceNode.notify(QQuickInheritanceNode::PaletteAttribute);
 }
 
 void QQuickLabelPrivate::textChanged(const QString &text)
@@ -235,13 +234,14 @@ void QQuickLabelPrivate::executeBackground(bool complete)
     if (!background || complete)
         quickBeginDeferred(q, backgroundName(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickLabel::QQuickLabel(QQuickItem *parent)
     : QQuickText(*(new QQuickLabelPrivate), parent)
 {
     Q_D(QQuickLabel);
+    d->inheritanceNode.init(this, QQuickInheritanceNode::LabelType);
     QObjectPrivate::connect(this, &QQuickText::textChanged, d, &QQuickLabelPrivate::textChanged);
 }
 
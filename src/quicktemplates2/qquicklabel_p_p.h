@@ -51,6 +51,7 @@
 #include <QtQml/private/qlazilyallocated_p.h>
 #include <QtQuick/private/qquicktext_p_p.h>
 #include <QtQuickTemplates2/private/qquickdeferredpointer_p_p.h>
+#include <QtQuickTemplates2/private/qquickinheritancenode_p_p.h>
 
 #if QT_CONFIG(accessibility)
 #include <QtGui/qaccessible.h>
@@ -112,6 +113,7 @@ public:
 
     QPalette resolvedPalette;
     QQuickDeferredPointer<QQuickItem> background;
+    QQuickInheritanceNode inheritanceNode;
 };
 
 QT_END_NAMESPACE
@@ -59,6 +59,8 @@
 #include <QtQuick/private/qquickevents_p_p.h>
 #include <QtQuick/private/qquickwindow_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 // copied from qfusionstyle.cpp
@@ -244,7 +246,6 @@ void QQuickMenuPrivate::removeItem(int index, QQuickItem *item)
 
 void QQuickMenuPrivate::createAndAppendItem(QObject *object)
 {
-    Q_Q(QQuickMenu);
     QQuickItem *item = qobject_cast<QQuickItem *>(object);
     if (!item) {
         if (QQuickAction *action = qobject_cast<QQuickAction *>(object))
@@ -258,7 +259,7 @@ void QQuickMenuPrivate::createAndAppendItem(QObject *object)
             QQuickItemPrivate::get(item)->addItemChangeListener(this, QQuickItemPrivate::SiblingOrder);
             item->setParentItem(contentItem);
         } else if (contentModel->indexOf(item, nullptr) == -1) {
-            q->addItem(item);
+            insertItem(contentModel->count(), item);
         }
     } else {
         contentData.append(object);
@@ -270,8 +271,9 @@ void QQuickMenuPrivate::recreateItems()
     // removeItem() will remove stuff from contentData, so we have to make a copy of it.
     const auto originalContentData = contentData;
 
-    while (contentModel->count() > 0)
-        removeItem(0, itemAt(0));
+    // remove from the end to avoid shifting the remaining items in the model
+    for (int i = contentModel->count() - 1; i >= 0; --i)
+        removeItem(i, itemAt(i));
 
     for (QObject *object : originalContentData)
         createAndAppendItem(object);
@@ -348,8 +350,10 @@ void QQuickMenuPrivate::resizeItems()
 
 void QQuickMenuPrivate::itemChildAdded(QQuickItem *, QQuickItem *child)
 {
-    // add dynamically reparented items (eg. by a Repeater)
-    if (!QQuickItemPrivate::get(child)->isTransparentForPositioner() && !contentData.contains(child))
+    // add dynamically reparented items (eg. by a Repeater). Items that are
+    // being inserted were just appended, so look them up starting from the end.
+    if (!QQuickItemPrivate::get(child)->isTransparentForPositioner()
+            && std::find(contentData.crbegin(), contentData.crend(), child) == contentData.crend())
         insertItem(contentModel->count(), child);
 }
 
@@ -569,18 +573,12 @@ void QQuickMenuPrivate::propagateKeyEvent(QKeyEvent *event)
 void QQuickMenuPrivate::startHoverTimer()
 {
     Q_Q(QQuickMenu);
-    stopHoverTimer();
-    hoverTimer = q->startTimer(SUBMENU_DELAY);
+    hoverTimer.start(SUBMENU_DELAY, q);
 }
 
 void QQuickMenuPrivate::stopHoverTimer()
 {
-    Q_Q(QQuickMenu);
-    if (!hoverTimer)
-        return;
-
-    q->killTimer(hoverTimer);
-    hoverTimer = 0;
+    hoverTimer.stop();
 }
 
 void QQuickMenuPrivate::setCurrentIndex(int index, Qt::FocusReason reason)
@@ -1442,7 +1440,7 @@ void QQuickMenu::keyPressEvent(QKeyEvent *event)
 void QQuickMenu::timerEvent(QTimerEvent *event)
 {
     Q_D(QQuickMenu);
-    if (event->timerId() == d->hoverTimer) {
+    if (event->timerId() == d->hoverTimer.timerId()) {
         if (QQuickMenu *subMenu = d->currentSubMenu())
             subMenu->open();
         d->stopHoverTimer();
@@ -53,6 +53,7 @@
 
 #include <QtQuickTemplates2/private/qquickmenu_p.h>
 #include <QtQuickTemplates2/private/qquickpopup_p_p.h>
+#include <QtQuickTemplates2/private/qquickpresstimer_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -124,7 +125,7 @@ public:
     static void contentData_clear(QQmlListProperty<QObject> *prop);
 
     bool cascade = false;
-    int hoverTimer = 0;
+    QQuickPressTimer hoverTimer;
     int currentIndex = -1;
     qreal overlap = 0;
     QPointer<QQuickMenu> parentMenu;
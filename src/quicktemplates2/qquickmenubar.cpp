@@ -182,7 +182,7 @@ void QQuickMenuBarPrivate::activateItem(QQuickMenuBarItem *item)
 
 void QQuickMenuBarPrivate::activateNextItem()
 {
-    int index = currentItem ? contentModel->indexOf(currentItem, nullptr) : -1;
+    int index = currentItem ? indexOf(currentItem) : -1;
     if (index >= contentModel->count() - 1)
         index = -1;
     activateItem(qobject_cast<QQuickMenuBarItem *>(itemAt(++index)));
@@ -190,7 +190,7 @@ void QQuickMenuBarPrivate::activateNextItem()
 
 void QQuickMenuBarPrivate::activatePreviousItem()
 {
-    int index = currentItem ? contentModel->indexOf(currentItem, nullptr) : contentModel->count();
+    int index = currentItem ? indexOf(currentItem) : contentModel->count();
     if (index <= 0)
         index = contentModel->count();
     activateItem(qobject_cast<QQuickMenuBarItem *>(itemAt(--index)));
@@ -321,6 +321,9 @@ QQuickMenuBar::QQuickMenuBar(QQuickItem *parent)
 {
     Q_D(QQuickMenuBar);
     d->changeTypes |= QQuickItemPrivate::Geometry;
+#if QT_CONFIG(quicktemplates2_hover)
+    d->handlesHover = true;
+#endif
     setFlag(ItemIsFocusScope);
     setFocusPolicy(Qt::ClickFocus);
 }
@@ -144,7 +144,7 @@ void QQuickMenuItemPrivate::executeArrow(bool complete)
     if (!arrow || complete)
         quickBeginDeferred(q, arrowName(), arrow);
     if (complete)
-        quickCompleteDeferred(q, arrowName(), arrow);
+        quickCompleteDeferred(q, arrow);
 }
 
 /*!
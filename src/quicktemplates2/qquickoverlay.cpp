@@ -40,6 +40,10 @@
 #include "qquickpopup_p_p.h"
 #include "qquickdrawer_p_p.h"
 #include "qquickapplicationwindow_p.h"
+#include "qquicktooltip_p.h"
+#include "qquickmenu_p.h"
+#include "qquickmenubaritem_p.h"
+#include "qquicktimingspan_p_p.h"
 #include <QtQml/qqmlinfo.h>
 #include <QtQml/qqmlproperty.h>
 #include <QtQml/qqmlcomponent.h>
@@ -47,6 +51,8 @@
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcOverlay, "qt.quick.controls.overlay")
+
 /*!
     \qmltype Overlay
     \inherits Item
@@ -67,29 +73,100 @@ QT_BEGIN_NAMESPACE
     \sa ApplicationWindow
 */
 
-QVector<QQuickPopup *> QQuickOverlayPrivate::stackingOrderPopups() const
+// The stacking order is cached until the paint order of the overlay's children
+// changes. The paint order list of an item is re-created whenever children are
+// added, removed or restacked, so checking whether the cached list is still
+// shared with the current one is enough to detect changes.
+void QQuickOverlayPrivate::updateStackingOrder() const
 {
     const QList<QQuickItem *> children = paintOrderChildItems();
+    if (!stackingOrderDirty && children.isSharedWith(stackingOrderChildren))
+        return;
 
-    QVector<QQuickPopup *> popups;
-    popups.reserve(children.count());
+    stackingOrderChildren = children;
+    stackingOrderDirty = false;
+    blockingPopupDirty = true;
 
+    sortedPopups.clear();
+    sortedPopups.reserve(children.count());
     for (auto it = children.crbegin(), end = children.crend(); it != end; ++it) {
         QQuickPopup *popup = qobject_cast<QQuickPopup *>((*it)->parent());
         if (popup)
-            popups += popup;
+            sortedPopups += popup;
     }
 
-    return popups;
+    sortedDrawers = allDrawers;
+    std::sort(sortedDrawers.begin(), sortedDrawers.end(), [](const QQuickDrawer *one, const QQuickDrawer *another) {
+        return one->z() > another->z();
+    });
+}
+
+QVector<QQuickPopup *> QQuickOverlayPrivate::stackingOrderPopups() const
+{
+    updateStackingOrder();
+    return sortedPopups;
 }
 
 QVector<QQuickDrawer *> QQuickOverlayPrivate::stackingOrderDrawers() const
 {
-    QVector<QQuickDrawer *> sorted(allDrawers);
-    std::sort(sorted.begin(), sorted.end(), [](const QQuickDrawer *one, const QQuickDrawer *another) {
-        return one->z() > another->z();
-    });
-    return sorted;
+    updateStackingOrder();
+    return sortedDrawers;
+}
+
+// Returns the topmost popup that blocks shortcuts outside of it. The shortcut
+// matcher asks for it once per registered shortcut on every key press, so it
+// is cached together with the stacking order.
+QQuickPopup *QQuickOverlayPrivate::shortcutBlockingPopup() const
+{
+    updateStackingOrder();
+    if (!blockingPopupDirty)
+        return blockingPopup;
+
+    blockingPopup = nullptr;
+    blockingPopupDirty = false;
+    for (QQuickPopup *popup : qAsConst(sortedPopups)) {
+        if (qobject_cast<QQuickToolTip *>(popup))
+            continue; // ignore tooltips (QTBUG-60492)
+        if (popup->isModal() || popup->closePolicy() & QQuickPopup::CloseOnEscape) {
+            if (QQuickMenu *menu = qobject_cast<QQuickMenu *>(popup)) {
+                if (qobject_cast<QQuickMenuBarItem *>(menu->parentItem()))
+                    continue;
+            }
+            blockingPopup = popup;
+            break;
+        }
+    }
+    return blockingPopup;
+}
+
+static bool isSharedDimmingEnabled()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_SHARED_DIMMING") > 0;
+    return enabled;
+}
+
+// With shared dimming, only the dimmer of the topmost dimmed popup is shown.
+// The dimmers of the popups stacked below it are hidden for as long as they
+// are fully covered, so that only one translucent full-window item is blended
+// no matter how many dimmed popups are open. Drawers and popups that are
+// closing do not hide the dimmers below them, because their dimmers fade.
+void QQuickOverlayPrivate::updateDimmers()
+{
+    if (!isSharedDimmingEnabled())
+        return;
+
+    QRectF cover;
+    const auto popups = stackingOrderPopups();
+    for (QQuickPopup *popup : popups) {
+        QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
+        if (!p->dim || !p->dimmer)
+            continue;
+
+        const QRectF rect(p->dimmer->position(), p->dimmer->size());
+        p->dimmer->setVisible(cover.isEmpty() || !cover.contains(rect));
+        if (cover.isEmpty() && p->transitionState != QQuickPopupPrivate::ExitTransition && !qobject_cast<QQuickDrawer *>(popup))
+            cover = rect;
+    }
 }
 
 void QQuickOverlayPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
@@ -103,6 +180,13 @@ bool QQuickOverlayPrivate::startDrag(QEvent *event, const QPointF &pos)
     if (allDrawers.isEmpty())
         return false;
 
+    // most presses are nowhere near the edges
+    const bool withinDragMargin = std::any_of(allDrawers.cbegin(), allDrawers.cend(), [&pos](QQuickDrawer *drawer) {
+        return QQuickDrawerPrivate::get(drawer)->canStartDrag(pos);
+    });
+    if (!withinDragMargin)
+        return false;
+
     // don't start dragging a drawer if a modal popup overlay is blocking (QTBUG-60602)
     QQuickItem *item = q->childAt(pos.x(), pos.y());
     if (item) {
@@ -182,6 +266,10 @@ bool QQuickOverlayPrivate::handleRelease(QQuickItem *source, QEvent *event, QQui
 
 bool QQuickOverlayPrivate::handleMouseEvent(QQuickItem *source, QMouseEvent *event, QQuickPopup *target)
 {
+    QQuickTimingSpan span(lcOverlay, "handleMouseEvent", target);
+    if (span.isActive())
+        span.addItems(stackingOrderPopups().count());
+
     switch (event->type()) {
     case QEvent::MouseButtonPress:
         if (!target && startDrag(event, event->windowPos()))
@@ -200,7 +288,12 @@ bool QQuickOverlayPrivate::handleMouseEvent(QQuickItem *source, QMouseEvent *eve
 #if QT_CONFIG(quicktemplates2_multitouch)
 bool QQuickOverlayPrivate::handleTouchEvent(QQuickItem *source, QTouchEvent *event, QQuickPopup *target)
 {
+    QQuickTimingSpan span(lcOverlay, "handleTouchEvent", target);
+    if (span.isActive())
+        span.addItems(stackingOrderPopups().count());
+
     bool handled = false;
+    bool moved = false;
     switch (event->type()) {
     case QEvent::TouchBegin:
     case QEvent::TouchUpdate:
@@ -214,7 +307,11 @@ bool QQuickOverlayPrivate::handleTouchEvent(QQuickItem *source, QTouchEvent *eve
                     handled |= handlePress(source, event, target);
                 break;
             case Qt::TouchPointMoved:
-                handled |= handleMove(source, event, target ? target : mouseGrabberPopup.data());
+                // the popup handles all the moved points of the event at once
+                if (!moved) {
+                    handled |= handleMove(source, event, target ? target : mouseGrabberPopup.data());
+                    moved = true;
+                }
                 break;
             case Qt::TouchPointReleased:
                 handled |= handleRelease(source, event, target ? target : mouseGrabberPopup.data());
@@ -237,6 +334,7 @@ void QQuickOverlayPrivate::addPopup(QQuickPopup *popup)
 {
     Q_Q(QQuickOverlay);
     allPopups += popup;
+    stackingOrderDirty = true;
     if (QQuickDrawer *drawer = qobject_cast<QQuickDrawer *>(popup)) {
         allDrawers += drawer;
         q->setVisible(!allDrawers.isEmpty() || !q->childItems().isEmpty());
@@ -247,6 +345,7 @@ void QQuickOverlayPrivate::removePopup(QQuickPopup *popup)
 {
     Q_Q(QQuickOverlay);
     allPopups.removeOne(popup);
+    stackingOrderDirty = true;
     if (allDrawers.removeOne(static_cast<QQuickDrawer *>(popup)))
         q->setVisible(!allDrawers.isEmpty() || !q->childItems().isEmpty());
 }
@@ -293,6 +392,10 @@ void QQuickOverlayPrivate::updateGeometry()
     q->setSize(size);
     q->setPosition(pos);
     q->setRotation(rotation);
+
+    // a rotation does not change the geometry of the overlay
+    for (QQuickPopup *popup : qAsConst(allPopups))
+        QQuickPopupPrivate::get(popup)->invalidateSceneRect();
 }
 
 QQuickOverlay::QQuickOverlay(QQuickItem *parent)
@@ -396,8 +499,12 @@ void QQuickOverlay::geometryChanged(const QRectF &newGeometry, const QRectF &old
 {
     Q_D(QQuickOverlay);
     QQuickItem::geometryChanged(newGeometry, oldGeometry);
-    for (QQuickPopup *popup : qAsConst(d->allPopups))
-        QQuickPopupPrivate::get(popup)->resizeOverlay();
+    for (QQuickPopup *popup : qAsConst(d->allPopups)) {
+        QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
+        p->invalidateSceneRect();
+        p->resizeOverlay();
+    }
+    d->updateDimmers();
 }
 
 void QQuickOverlay::mousePressEvent(QMouseEvent *event)
@@ -82,8 +82,12 @@ public:
     void removePopup(QQuickPopup *popup);
     void setMouseGrabberPopup(QQuickPopup *popup);
 
+    void updateStackingOrder() const;
     QVector<QQuickPopup *> stackingOrderPopups() const;
     QVector<QQuickDrawer *> stackingOrderDrawers() const;
+    QQuickPopup *shortcutBlockingPopup() const;
+
+    void updateDimmers();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
 
@@ -94,6 +98,13 @@ public:
     QVector<QQuickPopup *> allPopups;
     QVector<QQuickDrawer *> allDrawers;
     QPointer<QQuickPopup> mouseGrabberPopup;
+
+    mutable bool stackingOrderDirty = true;
+    mutable QList<QQuickItem *> stackingOrderChildren;
+    mutable QVector<QQuickPopup *> sortedPopups;
+    mutable QVector<QQuickDrawer *> sortedDrawers;
+    mutable bool blockingPopupDirty = true;
+    mutable QQuickPopup *blockingPopup = nullptr;
 };
 
 QT_END_NAMESPACE
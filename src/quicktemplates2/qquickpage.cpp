@@ -359,6 +359,13 @@ void QQuickPage::spacingChange(qreal newSpacing, qreal oldSpacing)
     d->layout->update();
 }
 
+void QQuickPage::updatePolish()
+{
+    Q_D(QQuickPage);
+    QQuickControl::updatePolish();
+    d->layout->updatePolish();
+}
+
 #if QT_CONFIG(accessibility)
 QAccessible::Role QQuickPage::accessibleRole() const
 {
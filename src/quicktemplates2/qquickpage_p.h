@@ -106,6 +106,7 @@ protected:
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
     void paddingChange(const QMarginsF &newPadding, const QMarginsF &oldPadding) override;
     void spacingChange(qreal newSpacing, qreal oldSpacing) override;
+    void updatePolish() override;
 
 #if QT_CONFIG(accessibility)
     QAccessible::Role accessibleRole() const override;
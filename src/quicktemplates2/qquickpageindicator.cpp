@@ -95,6 +95,7 @@ public:
     void handleUngrab() override;
 
     QQuickItem *itemAt(const QPointF &pos) const;
+    QQuickItem *positionedItemAt(const QPointF &contentPos) const;
     void updatePressed(bool pressed, const QPointF &pos = QPointF());
     void setContextProperty(QQuickItem *item, const QString &name, const QVariant &value);
 
@@ -146,6 +147,11 @@ QQuickItem *QQuickPageIndicatorPrivate::itemAt(const QPointF &pos) const
         return nullptr;
 
     QPointF contentPos = q->mapToItem(contentItem, pos);
+    if (contentItem->inherits("QQuickRow") || contentItem->inherits("QQuickColumn")) {
+        if (QQuickItem *item = positionedItemAt(contentPos))
+            return item;
+    }
+
     QQuickItem *item = contentItem->childAt(contentPos.x(), contentPos.y());
     while (item && item->parentItem() != contentItem)
         item = item->parentItem();
@@ -172,6 +178,66 @@ QQuickItem *QQuickPageIndicatorPrivate::itemAt(const QPointF &pos) const
     return nearest;
 }
 
+// The Repeater that creates the delegates is a child of the positioner as
+// well, but it has no size and must not take part in the search.
+static bool isPositioned(QQuickItem *item)
+{
+    return item->isVisible() && item->width() > 0 && item->height() > 0
+        && !item->inherits("QQuickRepeater")
+        && !QQuickItemPrivate::get(item)->isTransparentForPositioner();
+}
+
+// The delegates of a Row or a Column are positioned in order along one axis,
+// so the nearest delegate is found with a binary search rather than testing
+// each of them, which matters for page indicators with hundreds of pages.
+QQuickItem *QQuickPageIndicatorPrivate::positionedItemAt(const QPointF &contentPos) const
+{
+    const bool horizontal = contentItem->inherits("QQuickRow");
+    const qreal target = horizontal ? contentPos.x() : contentPos.y();
+    auto center = [horizontal](QQuickItem *item) {
+        return horizontal ? item->x() + item->width() / 2 : item->y() + item->height() / 2;
+    };
+
+    const QList<QQuickItem *> children = contentItem->childItems();
+    int first = 0;
+    int last = children.count() - 1;
+    while (first <= last && !isPositioned(children.at(first)))
+        ++first;
+    while (last > first && !isPositioned(children.at(last)))
+        --last;
+    if (first > last)
+        return nullptr;
+
+    // a right-to-left Row positions its children in descending order
+    const bool ascending = center(children.at(first)) <= center(children.at(last));
+
+    // find the first delegate whose center lies at or past the target
+    int lo = first;
+    int hi = last;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        while (mid < hi && !isPositioned(children.at(mid)))
+            ++mid;
+        const qreal c = center(children.at(mid));
+        if (ascending ? c >= target : c <= target)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    const int index = qMin(lo, hi);
+    QQuickItem *nearest = children.at(index);
+    for (int prev = index - 1; prev >= first; --prev) {
+        QQuickItem *item = children.at(prev);
+        if (!isPositioned(item))
+            continue;
+        if (qAbs(center(item) - target) < qAbs(center(nearest) - target))
+            nearest = item;
+        break;
+    }
+    return nearest;
+}
+
 void QQuickPageIndicatorPrivate::updatePressed(bool pressed, const QPointF &pos)
 {
     QQuickItem *prevItem = pressedItem;
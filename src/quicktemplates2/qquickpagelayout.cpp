@@ -139,6 +139,8 @@ bool QQuickPageLayout::setFooter(QQuickItem *footer)
 
 void QQuickPageLayout::update()
 {
+    m_pending = false;
+
     QQuickItem *content = QQuickControlPrivate::get(m_control)->contentItem;
 
     const qreal hh = m_header && m_header->isVisible() ? m_header->height() : 0;
@@ -162,6 +164,28 @@ void QQuickPageLayout::update()
     }
 }
 
+// The implicit size changes of the header and the footer are coalesced into
+// the polish pass of the control, so that a header or footer that animates
+// its implicit size results in one layout per frame. Items that are not in a
+// window, such as the popup items of closed dialogs, are not polished and lay
+// out right away.
+void QQuickPageLayout::scheduleUpdate()
+{
+    if (!m_control->window()) {
+        update();
+        return;
+    }
+
+    m_pending = true;
+    m_control->polish();
+}
+
+void QQuickPageLayout::updatePolish()
+{
+    if (m_pending)
+        update();
+}
+
 void QQuickPageLayout::itemVisibilityChanged(QQuickItem *)
 {
     update();
@@ -169,12 +193,12 @@ void QQuickPageLayout::itemVisibilityChanged(QQuickItem *)
 
 void QQuickPageLayout::itemImplicitWidthChanged(QQuickItem *)
 {
-    update();
+    scheduleUpdate();
 }
 
 void QQuickPageLayout::itemImplicitHeightChanged(QQuickItem *)
 {
-    update();
+    scheduleUpdate();
 }
 
 void QQuickPageLayout::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
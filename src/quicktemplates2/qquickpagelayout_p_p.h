@@ -67,6 +67,8 @@ public:
     bool setFooter(QQuickItem *footer);
 
     void update();
+    void scheduleUpdate();
+    void updatePolish();
 
 protected:
     void itemVisibilityChanged(QQuickItem *item) override;
@@ -79,6 +81,7 @@ private:
     QQuickItem *m_header = nullptr;
     QQuickItem *m_footer = nullptr;
     QQuickControl *m_control = nullptr;
+    bool m_pending = false;
 };
 
 QT_END_NAMESPACE
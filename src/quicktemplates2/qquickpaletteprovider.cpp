@@ -87,10 +87,22 @@ bool QQuickPaletteProvider::init(int type, QVariant& dst)
     return false;
 }
 
+// The palette is read from and written to the variants without going
+// through QVariant::value(), which would copy the palette on every access
+// of a palette property in a binding.
+template<typename T>
+const T *typedData(const QVariant &variant)
+{
+    if (variant.userType() != qMetaTypeId<T>())
+        return nullptr;
+    return reinterpret_cast<const T *>(variant.constData());
+}
+
 template<typename T>
 bool typedEqual(const void *lhs, const QVariant& rhs)
 {
-    return (*(reinterpret_cast<const T *>(lhs)) == rhs.value<T>());
+    const T *rhsT = typedData<T>(rhs);
+    return (*(reinterpret_cast<const T *>(lhs)) == (rhsT ? *rhsT : T()));
 }
 
 bool QQuickPaletteProvider::equal(int type, const void *lhs, const QVariant &rhs)
@@ -130,7 +142,7 @@ bool typedRead(const QVariant& src, int dstType, void *dst)
 {
     T *dstT = reinterpret_cast<T *>(dst);
     if (src.type() == static_cast<uint>(dstType)) {
-        *dstT = src.value<T>();
+        *dstT = *typedData<T>(src);
     } else {
         *dstT = T();
     }
@@ -152,7 +164,8 @@ template<typename T>
 bool typedWrite(const void *src, QVariant& dst)
 {
     const T *srcT = reinterpret_cast<const T *>(src);
-    if (dst.value<T>() != *srcT) {
+    const T *dstT = typedData<T>(dst);
+    if (!dstT || *dstT != *srcT) {
         dst = *srcT;
         return true;
     }
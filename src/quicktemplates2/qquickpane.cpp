@@ -114,6 +114,170 @@ QQuickItem *QQuickPanePrivate::getContentItem()
     return new QQuickItem(q);
 }
 
+static const QQuickItemPrivate::ChangeTypes ImplicitSizeChanges = QQuickItemPrivate::ImplicitWidth | QQuickItemPrivate::ImplicitHeight | QQuickItemPrivate::Destroyed;
+
+qreal QQuickPanePrivate::getContentWidth() const
+{
+    return contentWidth;
+}
+
+qreal QQuickPanePrivate::getContentHeight() const
+{
+    return contentHeight;
+}
+
+void QQuickPanePrivate::itemImplicitWidthChanged(QQuickItem *)
+{
+    updateContentWidth();
+}
+
+void QQuickPanePrivate::itemImplicitHeightChanged(QQuickItem *)
+{
+    updateContentHeight();
+}
+
+void QQuickPanePrivate::itemDestroyed(QQuickItem *item)
+{
+    if (item == firstChild)
+        firstChild = nullptr;
+    if (item == watchedContentItem)
+        watchedContentItem = nullptr;
+}
+
+void QQuickPanePrivate::watch(QQuickItem *item)
+{
+    if (item)
+        QQuickItemPrivate::get(item)->addItemChangeListener(this, ImplicitSizeChanges);
+}
+
+void QQuickPanePrivate::unwatch(QQuickItem *item)
+{
+    if (item)
+        QQuickItemPrivate::get(item)->removeItemChangeListener(this, ImplicitSizeChanges);
+}
+
+void QQuickPanePrivate::setWatchedContentItem(QQuickItem *item)
+{
+    if (watchedContentItem == item)
+        return;
+
+    if (watchedContentItem)
+        QObjectPrivate::disconnect(watchedContentItem, &QQuickItem::childrenChanged, this, &QQuickPanePrivate::contentChildrenChange);
+    unwatch(watchedContentItem);
+    watchedContentItem = item;
+    watch(item);
+    if (item)
+        QObjectPrivate::connect(item, &QQuickItem::childrenChanged, this, &QQuickPanePrivate::contentChildrenChange);
+    contentChildrenChange();
+}
+
+void QQuickPanePrivate::contentChildrenChange()
+{
+    // only a single content child determines the content size, so the
+    // implicit size of the children is watched only while there is one
+    QQuickItem *child = nullptr;
+    if (watchedContentItem) {
+        const QList<QQuickItem *> children = watchedContentItem->childItems();
+        if (children.count() == 1)
+            child = children.first();
+    }
+
+    if (firstChild != child) {
+        unwatch(firstChild);
+        firstChild = child;
+        watch(child);
+    }
+
+    updateContentWidth();
+    updateContentHeight();
+}
+
+qreal QQuickPanePrivate::implicitContentWidth() const
+{
+    if (!watchedContentItem)
+        return 0;
+
+    const qreal width = watchedContentItem->implicitWidth();
+    if (!qFuzzyIsNull(width) || !firstChild)
+        return width;
+    return firstChild->implicitWidth();
+}
+
+qreal QQuickPanePrivate::implicitContentHeight() const
+{
+    if (!watchedContentItem)
+        return 0;
+
+    const qreal height = watchedContentItem->implicitHeight();
+    if (!qFuzzyIsNull(height) || !firstChild)
+        return height;
+    return firstChild->implicitHeight();
+}
+
+void QQuickPanePrivate::updateContentWidth()
+{
+    Q_Q(QQuickPane);
+    if (hasContentWidth)
+        return;
+
+    const qreal width = implicitContentWidth();
+    if (qFuzzyCompare(contentWidth, width))
+        return;
+
+    contentWidth = width;
+    updateImplicitSize();
+    emit q->contentWidthChanged();
+}
+
+void QQuickPanePrivate::updateContentHeight()
+{
+    Q_Q(QQuickPane);
+    if (hasContentHeight)
+        return;
+
+    const qreal height = implicitContentHeight();
+    if (qFuzzyCompare(contentHeight, height))
+        return;
+
+    contentHeight = height;
+    updateImplicitSize();
+    emit q->contentHeightChanged();
+}
+
+/*
+    The snapshot is a layer of the pane. It is only enabled while the pane
+    is neither hovered nor has active focus, and never overrides a layer
+    that was enabled by other means.
+*/
+void QQuickPanePrivate::updateSnapshot()
+{
+    Q_Q(QQuickPane);
+    QQuickItemLayer *itemLayer = layer();
+    if (!snapshotLayer && itemLayer->enabled())
+        return;
+
+    const bool enable = staticSnapshot && !hovered && !q->hasActiveFocus();
+    if (enable == snapshotLayer)
+        return;
+
+    if (!layerWatched) {
+        QObjectPrivate::connect(itemLayer, &QQuickItemLayer::enabledChanged, this, &QQuickPanePrivate::layerEnabledChange);
+        layerWatched = true;
+    }
+    snapshotLayer = enable;
+    itemLayer->setEnabled(enable);
+}
+
+/*
+    A layer that is turned on or off by someone else than updateSnapshot()
+    is no longer the snapshot, even if it is turned back on later.
+*/
+void QQuickPanePrivate::layerEnabledChange(bool enabled)
+{
+    if (enabled != snapshotLayer)
+        snapshotLayer = false;
+}
+
 QQuickPane::QQuickPane(QQuickItem *parent)
     : QQuickControl(*(new QQuickPanePrivate), parent)
 {
@@ -134,12 +298,22 @@ QQuickPane::QQuickPane(QQuickPanePrivate &dd, QQuickItem *parent)
 #endif
 }
 
+QQuickPane::~QQuickPane()
+{
+    Q_D(QQuickPane);
+    d->unwatch(d->firstChild);
+    d->unwatch(d->watchedContentItem);
+}
+
 /*!
     \qmlproperty real QtQuick.Controls::Pane::contentWidth
 
     This property holds the content width. It is used for calculating the total
     implicit width of the pane.
 
+    Unless it is assigned, the content width is the implicit width of the
+    \l {Control::}{contentItem}, or of its only child item.
+
     For more information, see \l {Content Sizing}.
 
     \sa contentHeight
@@ -153,19 +327,34 @@ qreal QQuickPane::contentWidth() const
 void QQuickPane::setContentWidth(qreal width)
 {
     Q_D(QQuickPane);
+    d->hasContentWidth = true;
     if (qFuzzyCompare(d->contentWidth, width))
         return;
 
     d->contentWidth = width;
+    d->updateImplicitSize();
     emit contentWidthChanged();
 }
 
+void QQuickPane::resetContentWidth()
+{
+    Q_D(QQuickPane);
+    if (!d->hasContentWidth)
+        return;
+
+    d->hasContentWidth = false;
+    d->updateContentWidth();
+}
+
 /*!
     \qmlproperty real QtQuick.Controls::Pane::contentHeight
 
     This property holds the content height. It is used for calculating the total
     implicit height of the pane.
 
+    Unless it is assigned, the content height is the implicit height of the
+    \l {Control::}{contentItem}, or of its only child item.
+
     For more information, see \l {Content Sizing}.
 
     \sa contentWidth
@@ -179,13 +368,25 @@ qreal QQuickPane::contentHeight() const
 void QQuickPane::setContentHeight(qreal height)
 {
     Q_D(QQuickPane);
+    d->hasContentHeight = true;
     if (qFuzzyCompare(d->contentHeight, height))
         return;
 
     d->contentHeight = height;
+    d->updateImplicitSize();
     emit contentHeightChanged();
 }
 
+void QQuickPane::resetContentHeight()
+{
+    Q_D(QQuickPane);
+    if (!d->hasContentHeight)
+        return;
+
+    d->hasContentHeight = false;
+    d->updateContentHeight();
+}
+
 /*!
     \qmlproperty list<Object> QtQuick.Controls::Pane::contentData
     \default
@@ -231,9 +432,53 @@ QQmlListProperty<QQuickItem> QQuickPane::contentChildren()
                                         QQuickItemPrivate::children_clear);
 }
 
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlproperty bool QtQuick.Controls::Pane::staticSnapshot
+
+    This property holds whether the pane is rendered from a snapshot of its
+    content. The default value is \c false.
+
+    When enabled, the pane and its content are rendered into a texture,
+    which is drawn instead of the individual items of the content. The
+    texture is only updated when something in the content changes, which
+    makes large panes of rarely changing content, such as labels and icons
+    in a dashboard, cheaper to render. The content is rendered live while
+    the pane is \l {Control::hovered}{hovered} or has active focus.
+
+    \note The snapshot is an \l {Item::layer.enabled}{item layer}. It is
+    not used while the layer of the pane is enabled otherwise.
+*/
+bool QQuickPane::isStaticSnapshot() const
+{
+    Q_D(const QQuickPane);
+    return d->staticSnapshot;
+}
+
+void QQuickPane::setStaticSnapshot(bool snapshot)
+{
+    Q_D(QQuickPane);
+    if (d->staticSnapshot == snapshot)
+        return;
+
+    d->staticSnapshot = snapshot;
+    d->updateSnapshot();
+    emit staticSnapshotChanged();
+}
+
+void QQuickPane::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    Q_D(QQuickPane);
+    QQuickControl::itemChange(change, value);
+    if (change == ItemActiveFocusHasChanged && d->staticSnapshot)
+        d->updateSnapshot();
+}
+
 void QQuickPane::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
 {
+    Q_D(QQuickPane);
     QQuickControl::contentItemChange(newItem, oldItem);
+    d->setWatchedContentItem(newItem);
     if (oldItem)
         disconnect(oldItem, &QQuickItem::childrenChanged, this, &QQuickPane::contentChildrenChanged);
     if (newItem)
@@ -241,6 +486,14 @@ void QQuickPane::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
     emit contentChildrenChanged();
 }
 
+void QQuickPane::hoverChange()
+{
+    Q_D(QQuickPane);
+    QQuickControl::hoverChange();
+    if (d->staticSnapshot)
+        d->updateSnapshot();
+}
+
 #if QT_CONFIG(accessibility)
 QAccessible::Role QQuickPane::accessibleRole() const
 {
@@ -58,33 +58,46 @@ class QQuickPanePrivate;
 class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickPane : public QQuickControl
 {
     Q_OBJECT
-    Q_PROPERTY(qreal contentWidth READ contentWidth WRITE setContentWidth NOTIFY contentWidthChanged FINAL)
-    Q_PROPERTY(qreal contentHeight READ contentHeight WRITE setContentHeight NOTIFY contentHeightChanged FINAL)
+    Q_PROPERTY(qreal contentWidth READ contentWidth WRITE setContentWidth RESET resetContentWidth NOTIFY contentWidthChanged FINAL)
+    Q_PROPERTY(qreal contentHeight READ contentHeight WRITE setContentHeight RESET resetContentHeight NOTIFY contentHeightChanged FINAL)
     Q_PROPERTY(QQmlListProperty<QObject> contentData READ contentData FINAL)
     Q_PROPERTY(QQmlListProperty<QQuickItem> contentChildren READ contentChildren NOTIFY contentChildrenChanged FINAL)
+    // 2.5 (Qt 5.12)
+    Q_PROPERTY(bool staticSnapshot READ isStaticSnapshot WRITE setStaticSnapshot NOTIFY staticSnapshotChanged FINAL REVISION 5)
     Q_CLASSINFO("DefaultProperty", "contentData")
 
 public:
     explicit QQuickPane(QQuickItem *parent = nullptr);
+    ~QQuickPane();
 
     qreal contentWidth() const;
     void setContentWidth(qreal width);
+    void resetContentWidth();
 
     qreal contentHeight() const;
     void setContentHeight(qreal height);
+    void resetContentHeight();
 
     QQmlListProperty<QObject> contentData();
     QQmlListProperty<QQuickItem> contentChildren();
 
+    // 2.5 (Qt 5.12)
+    bool isStaticSnapshot() const;
+    void setStaticSnapshot(bool snapshot);
+
 Q_SIGNALS:
     void contentWidthChanged();
     void contentHeightChanged();
     void contentChildrenChanged();
+    // 2.5 (Qt 5.12)
+    Q_REVISION(5) void staticSnapshotChanged();
 
 protected:
     QQuickPane(QQuickPanePrivate &dd, QQuickItem *parent);
 
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
     void contentItemChange(QQuickItem *newItem, QQuickItem *oldItem) override;
+    void hoverChange() override;
 
 #if QT_CONFIG(accessibility)
     QAccessible::Role accessibleRole() const override;
@@ -49,20 +49,48 @@
 //
 
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
+#include <QtQuick/private/qquickitemchangelistener_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QQuickPane;
 
-class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickPanePrivate : public QQuickControlPrivate
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickPanePrivate : public QQuickControlPrivate, public QQuickItemChangeListener
 {
     Q_DECLARE_PUBLIC(QQuickPane)
 
 public:
     QQuickItem *getContentItem() override;
 
+    qreal getContentWidth() const override;
+    qreal getContentHeight() const override;
+
+    void itemImplicitWidthChanged(QQuickItem *item) override;
+    void itemImplicitHeightChanged(QQuickItem *item) override;
+    void itemDestroyed(QQuickItem *item) override;
+
+    void watch(QQuickItem *item);
+    void unwatch(QQuickItem *item);
+    void setWatchedContentItem(QQuickItem *item);
+    void contentChildrenChange();
+
+    qreal implicitContentWidth() const;
+    qreal implicitContentHeight() const;
+    void updateContentWidth();
+    void updateContentHeight();
+
+    void updateSnapshot();
+    void layerEnabledChange(bool enabled);
+
+    bool hasContentWidth = false;
+    bool hasContentHeight = false;
     qreal contentWidth = 0;
     qreal contentHeight = 0;
+    QQuickItem *watchedContentItem = nullptr;
+    QQuickItem *firstChild = nullptr;
+    bool staticSnapshot = false;
+    bool snapshotLayer = false;
+    bool layerWatched = false;
 };
 
 QT_END_NAMESPACE
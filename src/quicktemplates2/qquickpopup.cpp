@@ -42,6 +42,7 @@
 #include "qquickoverlay_p_p.h"
 #include "qquickcontrol_p_p.h"
 #include "qquickdialog_p.h"
+#include "qquicktimingspan_p_p.h"
 
 #include <QtQml/qqmlinfo.h>
 #include <QtQuick/qquickitem.h>
@@ -50,6 +51,8 @@
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcPopup, "qt.quick.controls.popup")
+
 /*!
     \qmltype Popup
     \inherits QtObject
@@ -216,7 +219,29 @@ QT_BEGIN_NAMESPACE
 const QQuickPopup::ClosePolicy QQuickPopupPrivate::DefaultClosePolicy = QQuickPopup::CloseOnEscape | QQuickPopup::CloseOnPressOutside;
 
 QQuickPopupPrivate::QQuickPopupPrivate()
-    : transitionManager(this)
+    : focus(false),
+      modal(false),
+      dim(false),
+      hasDim(false),
+      visible(false),
+      complete(true),
+      positioning(false),
+      hasWidth(false),
+      hasHeight(false),
+      hasTopMargin(false),
+      hasLeftMargin(false),
+      hasRightMargin(false),
+      hasBottomMargin(false),
+      allowVerticalFlip(false),
+      allowHorizontalFlip(false),
+      allowVerticalMove(true),
+      allowHorizontalMove(true),
+      allowVerticalResize(true),
+      allowHorizontalResize(true),
+      hadActiveFocusBeforeExitTransition(false),
+      interactive(true),
+      hasClosePolicy(false),
+      transitionManager(this)
 {
 }
 
@@ -230,6 +255,8 @@ void QQuickPopupPrivate::init()
     QObject::connect(popupItem, &QQuickControl::paddingChanged, q, &QQuickPopup::paddingChanged);
     QObject::connect(popupItem, &QQuickControl::backgroundChanged, q, &QQuickPopup::backgroundChanged);
     QObject::connect(popupItem, &QQuickControl::contentItemChanged, q, &QQuickPopup::contentItemChanged);
+    QObjectPrivate::connect(popupItem, &QQuickItem::scaleChanged, this, &QQuickPopupPrivate::invalidateSceneRect);
+    QObjectPrivate::connect(popupItem, &QQuickItem::transformOriginChanged, this, &QQuickPopupPrivate::invalidateSceneRect);
     positioner = new QQuickPopupPositioner(q);
 }
 
@@ -265,9 +292,33 @@ bool QQuickPopupPrivate::tryClose(const QPointF &pos, QQuickPopup::ClosePolicy f
 
 bool QQuickPopupPrivate::contains(const QPointF &scenePos) const
 {
+    // Events under a modal popup are tested for every item that receives
+    // them, so a point outside the bounding rect in the scene is rejected
+    // without mapping it through the hierarchy of the popup item.
+    if (!sceneRect().contains(scenePos))
+        return false;
     return popupItem->contains(popupItem->mapFromScene(scenePos));
 }
 
+/*
+    The bounding rect of the popup item in the scene. It is invalidated
+    whenever the popup item, or the overlay it is parented to, is moved,
+    resized, scaled, rotated or reparented.
+*/
+QRectF QQuickPopupPrivate::sceneRect() const
+{
+    if (sceneRectDirty) {
+        cachedSceneRect = popupItem->mapRectToScene(QRectF(0, 0, popupItem->width(), popupItem->height()));
+        sceneRectDirty = false;
+    }
+    return cachedSceneRect;
+}
+
+void QQuickPopupPrivate::invalidateSceneRect()
+{
+    sceneRectDirty = true;
+}
+
 #if QT_CONFIG(quicktemplates2_multitouch)
 bool QQuickPopupPrivate::acceptTouch(const QTouchEvent::TouchPoint &point)
 {
@@ -383,6 +434,7 @@ bool QQuickPopupPrivate::handleTouchEvent(QQuickItem *item, QTouchEvent *event)
 bool QQuickPopupPrivate::prepareEnterTransition()
 {
     Q_Q(QQuickPopup);
+    QQuickTimingSpan span(lcPopup, "prepareEnterTransition", q);
     if (!window) {
         qmlWarning(q) << "cannot find any window to open popup in.";
         return false;
@@ -399,6 +451,7 @@ bool QQuickPopupPrivate::prepareEnterTransition()
         emit q->aboutToShow();
         visible = true;
         transitionState = EnterTransition;
+        updateDimmers();
         popupItem->setVisible(true);
         positioner->setParentItem(parentItem);
         emit q->visibleChanged();
@@ -409,6 +462,7 @@ bool QQuickPopupPrivate::prepareEnterTransition()
 bool QQuickPopupPrivate::prepareExitTransition()
 {
     Q_Q(QQuickPopup);
+    QQuickTimingSpan span(lcPopup, "prepareExitTransition", q);
     if (transitionState == ExitTransition && transitionManager.isRunning())
         return false;
 
@@ -420,6 +474,7 @@ bool QQuickPopupPrivate::prepareExitTransition()
             popupItem->setFocus(false);
         transitionState = ExitTransition;
         hideOverlay();
+        updateDimmers();
         emit q->aboutToHide();
         emit q->openedChanged();
     }
@@ -429,6 +484,7 @@ bool QQuickPopupPrivate::prepareExitTransition()
 void QQuickPopupPrivate::finalizeEnterTransition()
 {
     Q_Q(QQuickPopup);
+    QQuickTimingSpan span(lcPopup, "finalizeEnterTransition", q);
     if (focus)
         popupItem->setFocus(true);
     transitionState = NoTransition;
@@ -439,6 +495,7 @@ void QQuickPopupPrivate::finalizeEnterTransition()
 void QQuickPopupPrivate::finalizeExitTransition()
 {
     Q_Q(QQuickPopup);
+    QQuickTimingSpan span(lcPopup, "finalizeExitTransition", q);
     positioner->setParentItem(nullptr);
     popupItem->setParentItem(nullptr);
     popupItem->setVisible(false);
@@ -544,6 +601,9 @@ void QQuickPopupPrivate::setWindow(QQuickWindow *newWindow)
         if (overlay)
             QQuickOverlayPrivate::get(overlay)->addPopup(q);
 
+        // Unchanged values are not propagated at all, and the changed ones
+        // reach each node of the popup content in one combined pass.
+        QQuickInheritanceBatch batch(newWindow);
         QQuickControlPrivate *p = QQuickControlPrivate::get(popupItem);
         p->resolveFont();
         p->resolvePalette();
@@ -627,6 +687,7 @@ void QQuickPopupPrivate::createOverlay()
     if (!dimmer)
         dimmer = createDimmer(component, q, overlay);
     resizeOverlay();
+    updateDimmers();
 }
 
 void QQuickPopupPrivate::destroyOverlay()
@@ -635,6 +696,7 @@ void QQuickPopupPrivate::destroyOverlay()
         dimmer->setParentItem(nullptr);
         dimmer->deleteLater();
         dimmer = nullptr;
+        updateDimmers();
     }
 }
 
@@ -645,6 +707,12 @@ void QQuickPopupPrivate::toggleOverlay()
         createOverlay();
 }
 
+void QQuickPopupPrivate::updateDimmers()
+{
+    if (QQuickOverlay *overlay = window ? QQuickOverlay::overlay(window) : nullptr)
+        QQuickOverlayPrivate::get(overlay)->updateDimmers();
+}
+
 void QQuickPopupPrivate::showOverlay()
 {
     // use QQmlProperty instead of QQuickItem::setOpacity() to trigger QML Behaviors
@@ -682,7 +750,8 @@ void QQuickPopupTransitionManager::transitionEnter()
     if (!popup->prepareEnterTransition())
         return;
 
-    if (popup->window)
+    // without a transition, the popup is opened within this call
+    if (popup->window && popup->enter)
         transition(popup->enterActions, popup->enter, popup->q_func());
     else
         finished();
@@ -693,10 +762,14 @@ void QQuickPopupTransitionManager::transitionExit()
     if (!popup->prepareExitTransition())
         return;
 
-    if (popup->window)
+    if (popup->window && popup->exit) {
         transition(popup->exitActions, popup->exit, popup->q_func());
-    else
+    } else {
+        // a running enter transition must not finish after the popup has closed
+        if (isRunning())
+            cancel();
         finished();
+    }
 }
 
 void QQuickPopupTransitionManager::finished()
@@ -845,6 +918,11 @@ void QQuickPopup::setZ(qreal z)
     if (qFuzzyCompare(z, d->popupItem->z()))
         return;
     d->popupItem->setZ(z);
+    if (QQuickOverlay *overlay = d->window ? QQuickOverlay::overlay(d->window) : nullptr) {
+        QQuickOverlayPrivate *p = QQuickOverlayPrivate::get(overlay);
+        p->stackingOrderDirty = true;
+        p->updateDimmers();
+    }
     emit zChanged();
 }
 
@@ -1744,6 +1822,8 @@ void QQuickPopup::setModal(bool modal)
     if (d->modal == modal)
         return;
     d->modal = modal;
+    if (QQuickOverlay *overlay = d->window ? QQuickOverlay::overlay(d->window) : nullptr)
+        QQuickOverlayPrivate::get(overlay)->blockingPopupDirty = true;
     if (d->complete && d->visible)
         d->toggleOverlay();
     emit modalChanged();
@@ -1936,6 +2016,8 @@ void QQuickPopup::setClosePolicy(ClosePolicy policy)
     if (d->closePolicy == policy)
         return;
     d->closePolicy = policy;
+    if (QQuickOverlay *overlay = d->window ? QQuickOverlay::overlay(d->window) : nullptr)
+        QQuickOverlayPrivate::get(overlay)->blockingPopupDirty = true;
     if (isVisible()) {
         if (policy & QQuickPopup::CloseOnEscape)
             d->popupItem->grabShortcut();
@@ -2227,6 +2309,7 @@ void QQuickPopup::fontChange(const QFont &newFont, const QFont &oldFont)
 void QQuickPopup::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
     Q_D(QQuickPopup);
+    d->invalidateSceneRect();
     d->reposition();
     if (!qFuzzyCompare(newGeometry.width(), oldGeometry.width())) {
         emit widthChanged();
@@ -2249,6 +2332,10 @@ void QQuickPopup::itemChange(QQuickItem::ItemChange change, const QQuickItem::It
     case QQuickItem::ItemOpacityHasChanged:
         emit opacityChanged();
         break;
+    case QQuickItem::ItemParentHasChanged:
+    case QQuickItem::ItemRotationHasChanged:
+        d->invalidateSceneRect();
+        break;
     case QQuickItem::ItemVisibleHasChanged:
         if (isComponentComplete() && d->closePolicy & CloseOnEscape) {
             if (data.boolValue)
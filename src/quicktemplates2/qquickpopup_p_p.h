@@ -97,6 +97,8 @@ public:
     bool tryClose(const QPointF &pos, QQuickPopup::ClosePolicy flags);
 
     bool contains(const QPointF &scenePos) const;
+    QRectF sceneRect() const;
+    void invalidateSceneRect();
 
 #if QT_CONFIG(quicktemplates2_multitouch)
     virtual bool acceptTouch(const QTouchEvent::TouchPoint &point);
@@ -118,6 +120,7 @@ public:
     void createOverlay();
     void destroyOverlay();
     void toggleOverlay();
+    void updateDimmers();
     virtual void showOverlay();
     virtual void hideOverlay();
     virtual void resizeOverlay();
@@ -143,28 +146,28 @@ public:
 
     static const QQuickPopup::ClosePolicy DefaultClosePolicy;
 
-    bool focus = false;
-    bool modal = false;
-    bool dim = false;
-    bool hasDim = false;
-    bool visible = false;
-    bool complete = true;
-    bool positioning = false;
-    bool hasWidth = false;
-    bool hasHeight = false;
-    bool hasTopMargin = false;
-    bool hasLeftMargin = false;
-    bool hasRightMargin = false;
-    bool hasBottomMargin = false;
-    bool allowVerticalFlip = false;
-    bool allowHorizontalFlip = false;
-    bool allowVerticalMove = true;
-    bool allowHorizontalMove = true;
-    bool allowVerticalResize = true;
-    bool allowHorizontalResize = true;
-    bool hadActiveFocusBeforeExitTransition = false;
-    bool interactive = true;
-    bool hasClosePolicy = false;
+    bool focus : 1;
+    bool modal : 1;
+    bool dim : 1;
+    bool hasDim : 1;
+    bool visible : 1;
+    bool complete : 1;
+    bool positioning : 1;
+    bool hasWidth : 1;
+    bool hasHeight : 1;
+    bool hasTopMargin : 1;
+    bool hasLeftMargin : 1;
+    bool hasRightMargin : 1;
+    bool hasBottomMargin : 1;
+    bool allowVerticalFlip : 1;
+    bool allowHorizontalFlip : 1;
+    bool allowVerticalMove : 1;
+    bool allowHorizontalMove : 1;
+    bool allowVerticalResize : 1;
+    bool allowHorizontalResize : 1;
+    bool hadActiveFocusBeforeExitTransition : 1;
+    bool interactive : 1;
+    bool hasClosePolicy : 1;
     int touchId = -1;
     qreal x = 0;
     qreal y = 0;
@@ -178,6 +181,8 @@ public:
     qreal contentWidth = 0;
     qreal contentHeight = 0;
     QPointF pressPoint;
+    mutable QRectF cachedSceneRect;
+    mutable bool sceneRectDirty = true;
     TransitionState transitionState = NoTransition;
     QQuickPopup::ClosePolicy closePolicy = DefaultClosePolicy;
     QQuickItem *parentItem = nullptr;
@@ -129,7 +129,7 @@ void QQuickPopupItemPrivate::executeContentItem(bool complete)
     if (!contentItem || complete)
         quickBeginDeferred(popup, contentItemName(), contentItem);
     if (complete)
-        quickCompleteDeferred(popup, contentItemName(), contentItem);
+        quickCompleteDeferred(popup, contentItem);
 }
 
 static inline QString backgroundName() { return QStringLiteral("background"); }
@@ -147,12 +147,14 @@ void QQuickPopupItemPrivate::executeBackground(bool complete)
     if (!background || complete)
         quickBeginDeferred(popup, backgroundName(), background);
     if (complete)
-        quickCompleteDeferred(popup, backgroundName(), background);
+        quickCompleteDeferred(popup, background);
 }
 
 QQuickPopupItem::QQuickPopupItem(QQuickPopup *popup)
     : QQuickControl(*(new QQuickPopupItemPrivate(popup)), nullptr)
 {
+    Q_D(QQuickPopupItem);
+    d->inheritanceNode.init(this, QQuickInheritanceNode::PopupItemType);
     setParent(popup);
     setFlag(ItemIsFocusScope);
     setAcceptedMouseButtons(Qt::AllButtons);
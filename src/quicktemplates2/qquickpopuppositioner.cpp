@@ -39,6 +39,7 @@
 #include "qquickpopup_p_p.h"
 
 #include <QtQuick/private/qquickitem_p.h>
+#include <QtQuick/qquickwindow.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -49,6 +50,18 @@ static const QQuickItemPrivate::ChangeTypes AncestorChangeTypes = QQuickItemPriv
 static const QQuickItemPrivate::ChangeTypes ItemChangeTypes = QQuickItemPrivate::Geometry
                                                              | QQuickItemPrivate::Parent;
 
+/*
+    When enabled, geometry changes of the ancestors of the parent item do not
+    reposition the popup right away. Instead, the popup is repositioned at most
+    once per frame, after the animations have advanced, and only if the scene
+    geometry of the parent item actually changed in the meanwhile.
+*/
+static bool isDeferredPositioningEnabled()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_DEFERRED_POPUP_POSITIONING") > 0;
+    return enabled;
+}
+
 QQuickPopupPositioner::QQuickPopupPositioner(QQuickPopup *popup)
     : m_popup(popup)
 {
@@ -56,6 +69,7 @@ QQuickPopupPositioner::QQuickPopupPositioner(QQuickPopup *popup)
 
 QQuickPopupPositioner::~QQuickPopupPositioner()
 {
+    cancelReposition();
     if (m_parentItem) {
         QQuickItemPrivate::get(m_parentItem)->removeItemChangeListener(this, ItemChangeTypes);
         removeAncestorListeners(m_parentItem->parentItem());
@@ -72,6 +86,7 @@ void QQuickPopupPositioner::setParentItem(QQuickItem *parent)
     if (m_parentItem == parent)
         return;
 
+    cancelReposition();
     if (m_parentItem) {
         QQuickItemPrivate::get(m_parentItem)->removeItemChangeListener(this, ItemChangeTypes);
         removeAncestorListeners(m_parentItem->parentItem());
@@ -114,6 +129,9 @@ void QQuickPopupPositioner::reposition()
                 !p->hasWidth && iw > 0 ? iw : w,
                 !p->hasHeight && ih > 0 ? ih : h);
     if (m_parentItem) {
+        if (isDeferredPositioningEnabled())
+            m_parentSceneRect = m_parentItem->mapRectToScene(QRectF(0, 0, m_parentItem->width(), m_parentItem->height()));
+
         rect.moveTopLeft(m_parentItem->mapToItem(popupItem->parentItem(), rect.topLeft()));
 
         if (p->window) {
@@ -233,9 +251,14 @@ void QQuickPopupPositioner::reposition()
     m_positioning = false;
 }
 
-void QQuickPopupPositioner::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+void QQuickPopupPositioner::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange, const QRectF &)
 {
-    if (m_parentItem && m_popup->popupItem()->isVisible())
+    if (!m_parentItem || !m_popup->popupItem()->isVisible())
+        return;
+
+    if (item != m_parentItem && isDeferredPositioningEnabled())
+        scheduleReposition();
+    else
         QQuickPopupPrivate::get(m_popup)->reposition();
 }
 
@@ -274,4 +297,35 @@ void QQuickPopupPositioner::addAncestorListeners(QQuickItem *item)
     }
 }
 
+void QQuickPopupPositioner::scheduleReposition()
+{
+    if (m_pendingReposition)
+        return;
+
+    QQuickWindow *window = m_parentItem->window();
+    if (!window)
+        return;
+
+    m_pendingReposition = QObject::connect(window, &QQuickWindow::afterAnimating, m_popup, [this]() { updateReposition(); });
+    window->update();
+}
+
+void QQuickPopupPositioner::cancelReposition()
+{
+    if (m_pendingReposition)
+        QObject::disconnect(m_pendingReposition);
+    m_pendingReposition = QMetaObject::Connection();
+}
+
+void QQuickPopupPositioner::updateReposition()
+{
+    cancelReposition();
+    if (!m_parentItem || !m_popup->popupItem()->isVisible())
+        return;
+
+    const QRectF rect = m_parentItem->mapRectToScene(QRectF(0, 0, m_parentItem->width(), m_parentItem->height()));
+    if (rect != m_parentSceneRect)
+        QQuickPopupPrivate::get(m_popup)->reposition();
+}
+
 QT_END_NAMESPACE
@@ -48,6 +48,8 @@
 // We mean it.
 //
 
+#include <QtCore/qobject.h>
+#include <QtCore/qrect.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -75,7 +77,13 @@ private:
     void removeAncestorListeners(QQuickItem *item);
     void addAncestorListeners(QQuickItem *item);
 
+    void scheduleReposition();
+    void cancelReposition();
+    void updateReposition();
+
     bool m_positioning = false;
+    QRectF m_parentSceneRect;
+    QMetaObject::Connection m_pendingReposition;
     QQuickItem *m_parentItem = nullptr;
     QQuickPopup *m_popup = nullptr;
 };
@@ -49,7 +49,7 @@
 //
 
 #include <QtCore/qpoint.h>
-#include <QtCore/qbasictimer.h>
+#include <QtQuickTemplates2/private/qquickpresstimer_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,7 +68,7 @@ struct QQuickPressHandler
     bool isActive();
 
     QQuickItem *control = nullptr;
-    QBasicTimer timer;
+    QQuickPressTimer timer;
     QPointF pressPos;
     bool longPress = false;
     int pressAndHoldSignalIndex = -1;
@@ -0,0 +1,192 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickpresstimer_p_p.h"
+
+#include <QtCore/qbasictimer.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qcoreevent.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qobject.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qthreadstorage.h>
+#include <QtCore/qvector.h>
+
+#include <algorithm>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+class QQuickPressScheduler : public QObject
+{
+public:
+    QQuickPressScheduler() { m_clock.start(); }
+
+    int schedule(int msec, QObject *receiver);
+    void unschedule(int id);
+
+protected:
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    struct Entry {
+        qint64 deadline;
+        int interval;
+        int id;
+        QPointer<QObject> receiver;
+    };
+
+    void insert(const Entry &entry);
+    void restart();
+
+    int m_nextId = 0;
+    QBasicTimer m_timer;
+    QElapsedTimer m_clock;
+    QVector<Entry> m_entries; // ordered by deadline
+};
+
+// Like the timers of the event dispatcher, the scheduler and its timer
+// belong to a thread. Each thread that starts press timers gets its own.
+typedef QThreadStorage<QQuickPressScheduler *> QQuickPressSchedulerStorage;
+Q_GLOBAL_STATIC(QQuickPressSchedulerStorage, pressSchedulers)
+
+static QQuickPressScheduler *pressScheduler()
+{
+    QQuickPressSchedulerStorage *storage = pressSchedulers();
+    if (!storage)
+        return nullptr;
+    if (!storage->hasLocalData())
+        storage->setLocalData(new QQuickPressScheduler);
+    return storage->localData();
+}
+
+int QQuickPressScheduler::schedule(int msec, QObject *receiver)
+{
+    // negative ids never clash with the ids of the dispatcher's timers
+    if (m_nextId == std::numeric_limits<int>::min())
+        m_nextId = -1;
+    else
+        --m_nextId;
+
+    Entry entry;
+    entry.interval = qMax(0, msec);
+    entry.deadline = m_clock.elapsed() + entry.interval;
+    entry.id = m_nextId;
+    entry.receiver = receiver;
+    insert(entry);
+    return entry.id;
+}
+
+void QQuickPressScheduler::unschedule(int id)
+{
+    const bool first = !m_entries.isEmpty() && m_entries.first().id == id;
+    auto it = std::find_if(m_entries.begin(), m_entries.end(), [id](const Entry &entry) { return entry.id == id; });
+    if (it == m_entries.end())
+        return;
+
+    m_entries.erase(it);
+    if (first)
+        restart();
+}
+
+void QQuickPressScheduler::insert(const Entry &entry)
+{
+    auto it = std::upper_bound(m_entries.begin(), m_entries.end(), entry.deadline,
+                               [](qint64 deadline, const Entry &other) { return deadline < other.deadline; });
+    const bool first = it == m_entries.begin();
+    m_entries.insert(it, entry);
+    if (first)
+        restart();
+}
+
+void QQuickPressScheduler::restart()
+{
+    if (m_entries.isEmpty()) {
+        m_timer.stop();
+        return;
+    }
+
+    const qint64 remaining = m_entries.first().deadline - m_clock.elapsed();
+    m_timer.start(int(qMax<qint64>(0, remaining)), this);
+}
+
+void QQuickPressScheduler::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_timer.timerId())
+        return;
+
+    // The receivers may start and stop press timers while their events are
+    // delivered, so the due timers are taken out first. Like QBasicTimer, a
+    // press timer keeps firing at its interval until it is stopped.
+    const qint64 now = m_clock.elapsed();
+    QVector<Entry> due;
+    while (!m_entries.isEmpty() && m_entries.first().deadline <= now) {
+        Entry entry = m_entries.takeFirst();
+        due += entry;
+        entry.deadline = now + qMax(1, entry.interval);
+        insert(entry);
+    }
+    restart();
+
+    for (const Entry &entry : qAsConst(due)) {
+        const bool active = std::any_of(m_entries.cbegin(), m_entries.cend(), [&entry](const Entry &other) { return other.id == entry.id; });
+        if (!active || !entry.receiver)
+            continue;
+
+        QTimerEvent timerEvent(entry.id);
+        QCoreApplication::sendEvent(entry.receiver, &timerEvent);
+    }
+}
+
+void QQuickPressTimer::start(int msec, QObject *receiver)
+{
+    stop();
+    if (QQuickPressScheduler *scheduler = pressScheduler())
+        m_id = scheduler->schedule(msec, receiver);
+}
+
+void QQuickPressTimer::stop()
+{
+    if (!m_id)
+        return;
+
+    QQuickPressSchedulerStorage *storage = pressSchedulers();
+    if (storage && storage->hasLocalData())
+        storage->localData()->unschedule(m_id);
+    m_id = 0;
+}
+
+QT_END_NAMESPACE
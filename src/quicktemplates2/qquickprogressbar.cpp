@@ -36,6 +36,9 @@
 
 #include "qquickprogressbar_p.h"
 #include "qquickcontrol_p_p.h"
+#include "qquickprogresssource_p.h"
+
+#include <QtCore/qpointer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -93,6 +96,7 @@ public:
     qreal to = 1;
     qreal value = 0;
     bool indeterminate = false;
+    QPointer<QQuickProgressSource> progressSource;
 };
 
 QQuickProgressBar::QQuickProgressBar(QQuickItem *parent)
@@ -247,6 +251,35 @@ void QQuickProgressBar::setIndeterminate(bool indeterminate)
     emit indeterminateChanged();
 }
 
+/*
+    Attaches a progress source that worker threads can update at any rate.
+    The progress bar samples the latest value of the source at most once per
+    frame, during polish, and assigns it to the value property.
+*/
+QQuickProgressSource *QQuickProgressBar::progressSource() const
+{
+    Q_D(const QQuickProgressBar);
+    return d->progressSource;
+}
+
+void QQuickProgressBar::setProgressSource(QQuickProgressSource *source)
+{
+    Q_D(QQuickProgressBar);
+    if (d->progressSource == source)
+        return;
+
+    if (d->progressSource)
+        disconnect(d->progressSource, &QQuickProgressSource::valueChanged, this, &QQuickItem::polish);
+
+    d->progressSource = source;
+
+    if (source) {
+        // the source emits from the worker thread, so this is a queued connection
+        connect(source, &QQuickProgressSource::valueChanged, this, &QQuickItem::polish);
+        polish();
+    }
+}
+
 void QQuickProgressBar::mirrorChange()
 {
     QQuickControl::mirrorChange();
@@ -261,6 +294,14 @@ void QQuickProgressBar::componentComplete()
     setValue(d->value);
 }
 
+void QQuickProgressBar::updatePolish()
+{
+    Q_D(QQuickProgressBar);
+    QQuickControl::updatePolish();
+    if (d->progressSource)
+        setValue(d->progressSource->take());
+}
+
 #if QT_CONFIG(accessibility)
 QAccessible::Role QQuickProgressBar::accessibleRole() const
 {
@@ -52,6 +52,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickProgressSource;
 class QQuickProgressBarPrivate;
 
 class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickProgressBar : public QQuickControl
@@ -82,6 +83,9 @@ public:
     bool isIndeterminate() const;
     void setIndeterminate(bool indeterminate);
 
+    QQuickProgressSource *progressSource() const;
+    void setProgressSource(QQuickProgressSource *source);
+
 Q_SIGNALS:
     void fromChanged();
     void toChanged();
@@ -93,6 +97,7 @@ Q_SIGNALS:
 protected:
     void mirrorChange() override;
     void componentComplete() override;
+    void updatePolish() override;
 
 #if QT_CONFIG(accessibility)
     QAccessible::Role accessibleRole() const override;
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickprogresssource_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A progress source lets worker threads publish progress at any rate.
+    The latest value is guarded by a mutex that is only held to copy it,
+    and only the first update after the value was taken notifies the
+    receiver, which samples the value at most once per frame (see
+    QQuickProgressBar). A 64-bit atomic would avoid the mutex, but is not
+    available on all the 32-bit platforms that are supported.
+*/
+
+QQuickProgressSource::QQuickProgressSource(QObject *parent)
+    : QObject(parent)
+{
+}
+
+qreal QQuickProgressSource::value() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_value;
+}
+
+void QQuickProgressSource::setValue(qreal value)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_value = value;
+    }
+    if (m_pending.testAndSetOrdered(0, 1))
+        emit valueChanged();
+}
+
+qreal QQuickProgressSource::take()
+{
+    m_pending.storeRelease(0);
+    QMutexLocker locker(&m_mutex);
+    return m_value;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qquickprogresssource_p.cpp"
@@ -167,7 +167,7 @@ void QQuickRangeSliderNodePrivate::executeHandle(bool complete)
     if (!handle || complete)
         quickBeginDeferred(q, handleName(), handle);
     if (complete)
-        quickCompleteDeferred(q, handleName(), handle);
+        quickCompleteDeferred(q, handle);
 }
 
 QQuickRangeSliderNodePrivate *QQuickRangeSliderNodePrivate::get(QQuickRangeSliderNode *node)
@@ -565,6 +565,9 @@ QQuickRangeSlider::QQuickRangeSlider(QQuickItem *parent)
     Q_D(QQuickRangeSlider);
     d->first = new QQuickRangeSliderNode(0.0, this);
     d->second = new QQuickRangeSliderNode(1.0, this);
+#if QT_CONFIG(quicktemplates2_hover)
+    d->handlesHover = true;
+#endif
 
     setFlag(QQuickItem::ItemIsFocusScope);
     setAcceptedMouseButtons(Qt::LeftButton);
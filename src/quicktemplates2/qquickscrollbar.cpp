@@ -226,6 +226,13 @@ void QQuickScrollBarPrivate::updateActive()
     q->setActive(moving || (interactive && (pressed || hover)));
 }
 
+// The styles only show the scroll bar when the content does not fit, or when
+// it is always on, so there is no need to create the delegates before then.
+bool QQuickScrollBarPrivate::canDeferDelegates() const
+{
+    return policy != QQuickScrollBar::AlwaysOn && size >= 1.0;
+}
+
 void QQuickScrollBarPrivate::resizeContent()
 {
     Q_Q(QQuickScrollBar);
@@ -298,6 +305,10 @@ void QQuickScrollBarPrivate::visualAreaChange(const VisualArea &newVisualArea, c
 QQuickScrollBar::QQuickScrollBar(QQuickItem *parent)
     : QQuickControl(*(new QQuickScrollBarPrivate), parent)
 {
+#if QT_CONFIG(quicktemplates2_hover)
+    Q_D(QQuickScrollBar);
+    d->handlesHover = true;
+#endif
     setKeepMouseGrab(true);
     setAcceptedMouseButtons(Qt::LeftButton);
 #if QT_CONFIG(cursor)
@@ -336,6 +347,8 @@ void QQuickScrollBar::setSize(qreal size)
 
     auto oldVisualArea = d->visualArea();
     d->size = size;
+    if (d->delegatesDeferred && !d->canDeferDelegates())
+        d->executeDeferredDelegates();
     if (isComponentComplete())
         d->resizeContent();
     emit sizeChanged();
@@ -578,6 +591,8 @@ void QQuickScrollBar::setPolicy(Policy policy)
         return;
 
     d->policy = policy;
+    if (d->delegatesDeferred && !d->canDeferDelegates())
+        d->executeDeferredDelegates();
     emit policyChanged();
 }
 
@@ -82,6 +82,7 @@ public:
     void setInteractive(bool interactive);
     void updateActive();
     void resizeContent() override;
+    bool canDeferDelegates() const override;
 
     void handlePress(const QPointF &point) override;
     void handleMove(const QPointF &point) override;
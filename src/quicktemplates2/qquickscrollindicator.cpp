@@ -146,6 +146,7 @@ public:
     void visualAreaChange(const VisualArea &newVisualArea, const VisualArea &oldVisualArea);
 
     void resizeContent() override;
+    bool canDeferDelegates() const override;
 
     qreal size = 0;
     qreal minimumSize = 0;
@@ -176,6 +177,13 @@ void QQuickScrollIndicatorPrivate::visualAreaChange(const VisualArea &newVisualA
         emit q->visualPositionChanged();
 }
 
+// The styles only show the indicator when the content does not fit,
+// so there is no need to create the delegates before then.
+bool QQuickScrollIndicatorPrivate::canDeferDelegates() const
+{
+    return size >= 1.0;
+}
+
 void QQuickScrollIndicatorPrivate::resizeContent()
 {
     Q_Q(QQuickScrollIndicator);
@@ -231,6 +239,8 @@ void QQuickScrollIndicator::setSize(qreal size)
 
     auto oldVisualArea = d->visualArea();
     d->size = size;
+    if (d->delegatesDeferred && !d->canDeferDelegates())
+        d->executeDeferredDelegates();
     if (isComponentComplete())
         d->resizeContent();
     emit sizeChanged();
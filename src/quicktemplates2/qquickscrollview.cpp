@@ -38,6 +38,7 @@
 #include "qquickcontrol_p_p.h"
 #include "qquickscrollbar_p_p.h"
 
+#include <QtCore/qelapsedtimer.h>
 #include <QtQuick/private/qquickflickable_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -115,6 +116,10 @@ QT_BEGIN_NAMESPACE
         {Focus Management in Qt Quick Controls 2}
 */
 
+// How long hovering is ignored after a touch, so that a touch gesture
+// does not flip the scroll bars between touch and mouse interaction.
+static const int INPUT_SOURCE_DELAY = 300;
+
 class QQuickScrollViewPrivate : public QQuickControlPrivate
 {
     Q_DECLARE_PUBLIC(QQuickScrollView)
@@ -133,6 +138,15 @@ public:
 
     void setScrollBarsInteractive(bool interactive);
 
+    enum InputSource {
+        UnknownInput,
+        MouseInput,
+        TouchInput
+    };
+
+    void setInputSource(InputSource source);
+    void scrollBarChange();
+
     static void contentData_append(QQmlListProperty<QObject> *prop, QObject *obj);
     static int contentData_count(QQmlListProperty<QObject> *prop);
     static QObject *contentData_at(QQmlListProperty<QObject> *prop, int index);
@@ -144,6 +158,9 @@ public:
     static void contentChildren_clear(QQmlListProperty<QQuickItem> *prop);
 
     bool wasTouched = false;
+    InputSource inputSource = UnknownInput;
+    bool scrollBarsWatched = false;
+    QElapsedTimer touchTimer;
     qreal contentWidth = -1;
     qreal contentHeight = -1;
     QQuickFlickable *flickable = nullptr;
@@ -272,6 +289,34 @@ void QQuickScrollViewPrivate::setScrollBarsInteractive(bool interactive)
     }
 }
 
+void QQuickScrollViewPrivate::setInputSource(InputSource source)
+{
+    // Only update the scroll bars when the input source actually changes,
+    // instead of for every press, so that their style bindings are not re-run.
+    if (source == inputSource)
+        return;
+
+    inputSource = source;
+    setScrollBarsInteractive(source != TouchInput);
+
+    // scroll bars that are attached later must follow the current source
+    if (!scrollBarsWatched) {
+        Q_Q(QQuickScrollView);
+        QQuickScrollBarAttached *attached = qobject_cast<QQuickScrollBarAttached *>(qmlAttachedPropertiesObject<QQuickScrollBar>(q));
+        if (attached) {
+            QObjectPrivate::connect(attached, &QQuickScrollBarAttached::horizontalChanged, this, &QQuickScrollViewPrivate::scrollBarChange);
+            QObjectPrivate::connect(attached, &QQuickScrollBarAttached::verticalChanged, this, &QQuickScrollViewPrivate::scrollBarChange);
+            scrollBarsWatched = true;
+        }
+    }
+}
+
+void QQuickScrollViewPrivate::scrollBarChange()
+{
+    if (inputSource != UnknownInput)
+        setScrollBarsInteractive(inputSource != TouchInput);
+}
+
 void QQuickScrollViewPrivate::contentData_append(QQmlListProperty<QObject> *prop, QObject *obj)
 {
     QQuickScrollViewPrivate *p = static_cast<QQuickScrollViewPrivate *>(prop->data);
@@ -474,18 +519,24 @@ bool QQuickScrollView::childMouseEventFilter(QQuickItem *item, QEvent *event)
     switch (event->type()) {
     case QEvent::TouchBegin:
         d->wasTouched = true;
-        d->setScrollBarsInteractive(false);
+        d->touchTimer.start();
+        d->setInputSource(QQuickScrollViewPrivate::TouchInput);
+        return false;
+
+    case QEvent::TouchUpdate:
+        d->touchTimer.start();
         return false;
 
     case QEvent::TouchEnd:
         d->wasTouched = false;
+        d->touchTimer.start();
         return false;
 
     case QEvent::MouseButtonPress:
         // NOTE: Flickable does not handle touch events, only synthesized mouse events
         if (static_cast<QMouseEvent *>(event)->source() == Qt::MouseEventNotSynthesized) {
             d->wasTouched = false;
-            d->setScrollBarsInteractive(true);
+            d->setInputSource(QQuickScrollViewPrivate::MouseInput);
             return false;
         }
         return !d->wasTouched && item == d->flickable;
@@ -498,8 +549,12 @@ bool QQuickScrollView::childMouseEventFilter(QQuickItem *item, QEvent *event)
 
     case QEvent::HoverEnter:
     case QEvent::HoverMove:
-        if (d->wasTouched && (item == d->verticalScrollBar() || item == d->horizontalScrollBar()))
-            d->setScrollBarsInteractive(true);
+        if (d->wasTouched && d->inputSource == QQuickScrollViewPrivate::TouchInput
+                && (!d->touchTimer.isValid() || d->touchTimer.hasExpired(INPUT_SOURCE_DELAY))
+                && (item == d->verticalScrollBar() || item == d->horizontalScrollBar())) {
+            d->wasTouched = false;
+            d->setInputSource(QQuickScrollViewPrivate::MouseInput);
+        }
         break;
 
     default:
@@ -513,7 +568,7 @@ bool QQuickScrollView::eventFilter(QObject *object, QEvent *event)
 {
     Q_D(QQuickScrollView);
     if (event->type() == QEvent::Wheel) {
-        d->setScrollBarsInteractive(true);
+        d->setInputSource(QQuickScrollViewPrivate::MouseInput);
         if (!d->wheelEnabled)
             return true;
     }
@@ -36,10 +36,7 @@
 
 #include "qquickshortcutcontext_p_p.h"
 #include "qquickoverlay_p_p.h"
-#include "qquicktooltip_p.h"
 #include "qquickpopup_p.h"
-#include "qquickmenu_p.h"
-#include "qquickmenubaritem_p.h"
 
 #include <QtGui/qguiapplication.h>
 #include <QtQuick/qquickrendercontrol.h>
@@ -52,20 +49,8 @@ static bool isBlockedByPopup(QQuickItem *item)
         return false;
 
     QQuickOverlay *overlay = QQuickOverlay::overlay(item->window());
-    const auto popups = QQuickOverlayPrivate::get(overlay)->stackingOrderPopups();
-    for (QQuickPopup *popup : popups) {
-        if (qobject_cast<QQuickToolTip *>(popup))
-            continue; // ignore tooltips (QTBUG-60492)
-        if (popup->isModal() || popup->closePolicy() & QQuickPopup::CloseOnEscape) {
-            if (QQuickMenu *menu = qobject_cast<QQuickMenu *>(popup)) {
-                if (qobject_cast<QQuickMenuBarItem *>(menu->parentItem()))
-                    continue;
-            }
-            return item != popup->popupItem() && !popup->popupItem()->isAncestorOf(item);
-        }
-    }
-
-    return false;
+    QQuickPopup *popup = QQuickOverlayPrivate::get(overlay)->shortcutBlockingPopup();
+    return popup && item != popup->popupItem() && !popup->popupItem()->isAncestorOf(item);
 }
 
 bool QQuickShortcutContext::matcher(QObject *obj, Qt::ShortcutContext context)
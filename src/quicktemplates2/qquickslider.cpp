@@ -245,7 +245,7 @@ void QQuickSliderPrivate::executeHandle(bool complete)
     if (!handle || complete)
         quickBeginDeferred(q, handleName(), handle);
     if (complete)
-        quickCompleteDeferred(q, handleName(), handle);
+        quickCompleteDeferred(q, handle);
 }
 
 QQuickSlider::QQuickSlider(QQuickItem *parent)
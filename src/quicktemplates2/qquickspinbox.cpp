@@ -37,6 +37,7 @@
 #include "qquickspinbox_p.h"
 #include "qquickcontrol_p_p.h"
 #include "qquickdeferredexecute_p_p.h"
+#include "qquickpresstimer_p_p.h"
 
 #include <QtGui/qguiapplication.h>
 #include <QtGui/qstylehints.h>
@@ -141,8 +142,8 @@ public:
     int to = 99;
     int value = 0;
     int stepSize = 1;
-    int delayTimer = 0;
-    int repeatTimer = 0;
+    QQuickPressTimer delayTimer;
+    QQuickPressTimer repeatTimer;
     QString displayText;
     QQuickSpinButton *up = nullptr;
     QQuickSpinButton *down = nullptr;
@@ -315,27 +316,20 @@ void QQuickSpinBoxPrivate::startRepeatDelay()
 {
     Q_Q(QQuickSpinBox);
     stopPressRepeat();
-    delayTimer = q->startTimer(AUTO_REPEAT_DELAY);
+    delayTimer.start(AUTO_REPEAT_DELAY, q);
 }
 
 void QQuickSpinBoxPrivate::startPressRepeat()
 {
     Q_Q(QQuickSpinBox);
     stopPressRepeat();
-    repeatTimer = q->startTimer(AUTO_REPEAT_INTERVAL);
+    repeatTimer.start(AUTO_REPEAT_INTERVAL, q);
 }
 
 void QQuickSpinBoxPrivate::stopPressRepeat()
 {
-    Q_Q(QQuickSpinBox);
-    if (delayTimer > 0) {
-        q->killTimer(delayTimer);
-        delayTimer = 0;
-    }
-    if (repeatTimer > 0) {
-        q->killTimer(repeatTimer);
-        repeatTimer = 0;
-    }
+    delayTimer.stop();
+    repeatTimer.stop();
 }
 
 void QQuickSpinBoxPrivate::handlePress(const QPointF &point)
@@ -378,11 +372,11 @@ void QQuickSpinBoxPrivate::handleRelease(const QPointF &point)
     int oldValue = value;
     if (up->isPressed()) {
         up->setPressed(false);
-        if (repeatTimer <= 0 && ui && ui->contains(ui->mapFromItem(q, point)))
+        if (!repeatTimer.isActive() && ui && ui->contains(ui->mapFromItem(q, point)))
             q->increase();
     } else if (down->isPressed()) {
         down->setPressed(false);
-        if (repeatTimer <= 0 && di && di->contains(di->mapFromItem(q, point)))
+        if (!repeatTimer.isActive() && di && di->contains(di->mapFromItem(q, point)))
             q->decrease();
     }
     if (value != oldValue)
@@ -409,6 +403,9 @@ QQuickSpinBox::QQuickSpinBox(QQuickItem *parent)
     Q_D(QQuickSpinBox);
     d->up = new QQuickSpinButton(this);
     d->down = new QQuickSpinButton(this);
+#if QT_CONFIG(quicktemplates2_hover)
+    d->handlesHover = true;
+#endif
 
     setFlag(ItemIsFocusScope);
     setFiltersChildMouseEvents(true);
@@ -914,9 +911,9 @@ void QQuickSpinBox::timerEvent(QTimerEvent *event)
 {
     Q_D(QQuickSpinBox);
     QQuickControl::timerEvent(event);
-    if (event->timerId() == d->delayTimer) {
+    if (event->timerId() == d->delayTimer.timerId()) {
         d->startPressRepeat();
-    } else if (event->timerId() == d->repeatTimer) {
+    } else if (event->timerId() == d->repeatTimer.timerId()) {
         if (d->up->isPressed())
             d->increase(true);
         else if (d->down->isPressed())
@@ -1041,7 +1038,7 @@ void QQuickSpinButtonPrivate::executeIndicator(bool complete)
     if (!indicator || complete)
         quickBeginDeferred(q, indicatorName(), indicator);
     if (complete)
-        quickCompleteDeferred(q, indicatorName(), indicator);
+        quickCompleteDeferred(q, indicator);
 }
 
 QQuickSpinButton::QQuickSpinButton(QQuickSpinBox *parent)
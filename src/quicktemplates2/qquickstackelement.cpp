@@ -44,6 +44,7 @@
 #include <QtQml/private/qv4qobjectwrapper_p.h>
 #include <QtQml/private/qqmlcomponent_p.h>
 #include <QtQml/private/qqmlengine_p.h>
+#include <QtQml/private/qqmlglobal_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -78,17 +79,25 @@ QQuickStackElement::QQuickStackElement()
 
 QQuickStackElement::~QQuickStackElement()
 {
+    setCulled(false);
     if (item)
         QQuickItemPrivate::get(item)->removeItemChangeListener(this, QQuickItemPrivate::Destroyed);
 
     if (ownComponent)
         delete component;
+    else
+        QObject::disconnect(statusConnection);
+
+    if (view)
+        QQuickStackViewPrivate::get(view)->releaseTransition(this);
 
     QQuickStackViewAttached *attached = attachedStackObject(this);
     if (item) {
         if (ownItem) {
-            item->setParentItem(nullptr);
-            item->deleteLater();
+            if (!view || !QQuickStackViewPrivate::get(view)->cacheElement(this)) {
+                item->setParentItem(nullptr);
+                item->deleteLater();
+            }
             item = nullptr;
         } else {
             setVisible(false);
@@ -119,12 +128,17 @@ QQuickStackElement *QQuickStackElement::fromString(const QString &str, QQuickSta
         return nullptr;
     }
 
+    QQmlContext *context = qmlContext(view);
+    if (!context) {
+        *error = QStringLiteral("cannot load url without a QML engine: ") + str;
+        return nullptr;
+    }
+
     if (url.isRelative())
-        url = qmlContext(view)->resolvedUrl(url);
+        url = context->resolvedUrl(url);
 
     QQuickStackElement *element = new QQuickStackElement;
-    element->component = new QQmlComponent(qmlEngine(view), url, view);
-    element->ownComponent = true;
+    element->component = QQuickStackViewPrivate::get(view)->componentForUrl(url);
     return element;
 }
 
@@ -152,8 +166,15 @@ bool QQuickStackElement::load(QQuickStackView *parent)
     if (!item) {
         ownItem = true;
 
+        if (QQuickStackViewPrivate::get(parent)->takeCachedElement(this)) {
+            initialize();
+            return item;
+        }
+
         if (component->isLoading()) {
-            QObject::connect(component, &QQmlComponent::statusChanged, [this](QQmlComponent::Status status) {
+            // the component may be shared, so the connection must not outlive the element
+            QObject::disconnect(statusConnection);
+            statusConnection = QObject::connect(component, &QQmlComponent::statusChanged, [this](QQmlComponent::Status status) {
                 if (status == QQmlComponent::Ready)
                     load(view);
                 else if (status == QQmlComponent::Error)
@@ -270,6 +291,45 @@ void QQuickStackElement::setStatus(QQuickStackView::Status value)
     emit attached->statusChanged();
 }
 
+static bool isStatusChangedConnected(QQuickStackViewAttached *attached)
+{
+    IS_SIGNAL_CONNECTED(attached, QQuickStackViewAttached, statusChanged, ());
+}
+
+static bool isActivatingConnected(QQuickStackViewAttached *attached)
+{
+    IS_SIGNAL_CONNECTED(attached, QQuickStackViewAttached, activating, ());
+}
+
+static bool isDeactivatingConnected(QQuickStackViewAttached *attached)
+{
+    IS_SIGNAL_CONNECTED(attached, QQuickStackViewAttached, deactivating, ());
+}
+
+/*
+    Returns whether anything listens to a change to the intermediate
+    \a value (Activating or Deactivating), either through a signal handler
+    or through a binding to the status.
+*/
+bool QQuickStackElement::isStatusObserved(QQuickStackView::Status value)
+{
+    QQuickStackViewAttached *attached = attachedStackObject(this);
+    if (!attached)
+        return false;
+
+    if (isStatusChangedConnected(attached))
+        return true;
+
+    switch (value) {
+    case QQuickStackView::Activating:
+        return isActivatingConnected(attached);
+    case QQuickStackView::Deactivating:
+        return isDeactivatingConnected(attached);
+    default:
+        return true;
+    }
+}
+
 void QQuickStackElement::setVisible(bool visible)
 {
     QQuickStackViewAttached *attached = attachedStackObject(this);
@@ -279,6 +339,20 @@ void QQuickStackElement::setVisible(bool visible)
     item->setVisible(visible);
 }
 
+/*
+    Culls the item while it is hidden deep in the stack, so that the scene
+    graph skips its whole subtree. The item stays in the view, so that its
+    parent, focus and attached properties are not affected.
+*/
+void QQuickStackElement::setCulled(bool value)
+{
+    if (!item || culled == value)
+        return;
+
+    culled = value;
+    QQuickItemPrivate::get(item)->setCulled(value);
+}
+
 void QQuickStackElement::transitionNextReposition(QQuickItemViewTransitioner *transitioner, QQuickItemViewTransitioner::TransitionType type, bool asTarget)
 {
     if (transitioner)
@@ -307,8 +381,10 @@ bool QQuickStackElement::prepareTransition(QQuickItemViewTransitioner *transitio
 void QQuickStackElement::startTransition(QQuickItemViewTransitioner *transitioner, QQuickStackView::Status status)
 {
     setStatus(status);
-    if (transitioner)
+    if (transitioner) {
+        QQuickStackViewPrivate::get(view)->acquireTransition(this);
         QQuickItemViewTransitionableItem::startTransition(transitioner, index);
+    }
 }
 
 void QQuickStackElement::itemDestroyed(QQuickItem *)
@@ -77,7 +77,9 @@ public:
     void setIndex(int index);
     void setView(QQuickStackView *view);
     void setStatus(QQuickStackView::Status status);
+    bool isStatusObserved(QQuickStackView::Status status);
     void setVisible(bool visible);
+    void setCulled(bool culled);
 
     void transitionNextReposition(QQuickItemViewTransitioner *transitioner, QQuickItemViewTransitioner::TransitionType type, bool asTarget);
     bool prepareTransition(QQuickItemViewTransitioner *transitioner, const QRectF &viewBounds);
@@ -92,6 +94,7 @@ public:
     bool ownComponent = false;
     bool widthValid = false;
     bool heightValid = false;
+    bool culled = false;
     QQmlContext *context = nullptr;
     QQmlComponent *component = nullptr;
     QQuickStackView *view = nullptr;
@@ -99,6 +102,7 @@ public:
     QQuickStackView::Status status = QQuickStackView::Inactive;
     QV4::PersistentValue properties;
     QV4::PersistentValue qmlCallingContext;
+    QMetaObject::Connection statusConnection;
 };
 
 QT_END_NAMESPACE
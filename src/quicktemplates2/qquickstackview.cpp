@@ -43,9 +43,11 @@
 #include <QtQml/qjsvalue.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/qqmlcontext.h>
 
 #include <private/qv4qobjectwrapper_p.h>
 #include <private/qqmlengine_p.h>
+#include <private/qqmlcontext_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -359,10 +361,14 @@ QQuickStackView::~QQuickStackView()
     if (d->transitioner) {
         d->transitioner->setChangeListener(nullptr);
         delete d->transitioner;
+        d->transitioner = nullptr;
     }
+    d->cacheSize = 0;
     qDeleteAll(d->removing);
     qDeleteAll(d->removed);
     qDeleteAll(d->elements);
+    qDeleteAll(d->transitionPool);
+    d->trimCache(0);
 }
 
 QQuickStackViewAttached *QQuickStackView::qmlAttachedProperties(QObject *object)
@@ -544,41 +550,14 @@ void QQuickStackView::push(QQmlV4Function *args)
 
     QStringList errors;
     QList<QQuickStackElement *> elements = d->parseElements(0, args, &errors);
-    // Remove any items that are already in the stack, as they can't be in two places at once.
-    for (int i = 0; i < elements.size(); ) {
-        QQuickStackElement *element = elements.at(i);
-        if (element->item && d->findElement(element->item))
-            elements.removeAt(i);
-        else
-            ++i;
-    }
-
-    if (!errors.isEmpty() || elements.isEmpty()) {
-        if (!errors.isEmpty()) {
-            for (const QString &error : qAsConst(errors))
-                d->warn(error);
-        } else {
-            d->warn(QStringLiteral("nothing to push"));
-        }
+    if (!errors.isEmpty()) {
+        for (const QString &error : qAsConst(errors))
+            d->warn(error);
         args->setReturnValue(QV4::Encode::null());
         return;
     }
 
-    QQuickStackElement *exit = nullptr;
-    if (!d->elements.isEmpty())
-        exit = d->elements.top();
-
-    int oldDepth = d->elements.count();
-    if (d->pushElements(elements)) {
-        d->depthChange(d->elements.count(), oldDepth);
-        QQuickStackElement *enter = d->elements.top();
-        d->startTransition(QQuickStackTransition::pushEnter(operation, enter, this),
-                           QQuickStackTransition::pushExit(operation, exit, this),
-                           operation == Immediate);
-        d->setCurrentItem(enter);
-    }
-
-    if (d->currentItem) {
+    if (d->pushWithTransition(elements, operation)) {
         QV4::ScopedValue rv(scope, QV4::QObjectWrapper::wrap(v4, d->currentItem));
         args->setReturnValue(rv->asReturnedValue());
     } else {
@@ -851,6 +830,172 @@ bool QQuickStackView::isEmpty() const
     return d->elements.isEmpty();
 }
 
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlproperty int QtQuick.Controls::StackView::cacheSize
+
+    This property holds the maximum number of popped or replaced items that
+    are kept for reuse. The default value is \c 0, which means that the items
+    created by the stack view are destroyed as soon as they are removed from
+    the stack.
+
+    When the value is greater than \c 0, the items that the stack view created
+    from a \l Component or a URL are detached and kept instead of destroyed
+    when they are removed from the stack. Pushing the same component or URL
+    again reuses the most recently kept instance, without creating and loading
+    a new one. Items that were pushed as items are not affected, because they
+    are never owned by the stack view. When more items are kept than the cache
+    size allows, the least recently kept items are destroyed.
+
+    \note A reused item keeps its state from the previous time it was on the
+    stack, except for the properties passed to \l push() or \l replace().
+
+    \sa push(), pop(), replace()
+*/
+int QQuickStackView::cacheSize() const
+{
+    Q_D(const QQuickStackView);
+    return d->cacheSize;
+}
+
+void QQuickStackView::setCacheSize(int size)
+{
+    Q_D(QQuickStackView);
+    if (d->cacheSize == size)
+        return;
+
+    d->cacheSize = size;
+    d->trimCache(size);
+    emit cacheSizeChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlproperty bool QtQuick.Controls::StackView::releaseHiddenItems
+
+    This property holds whether the items that are hidden deeper in the stack
+    are culled from the scene graph until they become visible again. The
+    default value is \c false.
+
+    When enabled, the scene graph skips the whole subtree of an item that gets
+    hidden because another item was pushed on top of it. The item stays in the
+    stack view, so its parent, focus and attached properties are not affected.
+    The item is brought back before a transition that reveals it starts.
+
+    Items that are explicitly kept visible with the attached
+    \l {StackView::visible}{StackView.visible} property are not culled.
+*/
+bool QQuickStackView::releaseHiddenItems() const
+{
+    Q_D(const QQuickStackView);
+    return d->releaseHiddenItems;
+}
+
+void QQuickStackView::setReleaseHiddenItems(bool release)
+{
+    Q_D(QQuickStackView);
+    if (d->releaseHiddenItems == release)
+        return;
+
+    d->releaseHiddenItems = release;
+    for (QQuickStackElement *element : qAsConst(d->elements)) {
+        if (!release)
+            element->setCulled(false);
+        else if (element->item && element->status == Inactive && !element->item->isVisible())
+            element->setCulled(true);
+    }
+    emit releaseHiddenItemsChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlmethod void QtQuick.Controls::StackView::preload(url, behavior)
+
+    Compiles the component at \a url asynchronously in the background, so
+    that pushing or replacing the same URL later does not have to load and
+    compile it first. This avoids a hitch at the start of the transition.
+
+    If \a behavior is \c StackView.ForceLoad and \l cacheSize is greater
+    than \c 0, an item is also created of the component once it is ready,
+    and kept in the cache. The next push of the URL then uses that item
+    right away. The default behavior is \c StackView.DontLoad.
+
+    \code
+    StackView {
+        id: stackView
+        cacheSize: 3
+        Component.onCompleted: stackView.preload("SettingsPage.qml", StackView.ForceLoad)
+    }
+    \endcode
+
+    \sa push(), cacheSize
+*/
+void QQuickStackView::preload(QQmlV4Function *args)
+{
+    Q_D(QQuickStackView);
+    QScopedValueRollback<QString> rollback(d->operation, QStringLiteral("preload"));
+    if (args->length() <= 0) {
+        d->warn(QStringLiteral("missing arguments"));
+        return;
+    }
+
+    QV4::ExecutionEngine *v4 = args->v4engine();
+    QV4::Scope scope(v4);
+    QV4::ScopedValue urlArg(scope, (*args)[0]);
+    QUrl url(urlArg->toQString());
+    if (url.isEmpty() || !url.isValid()) {
+        d->warn(QStringLiteral("invalid url: ") + urlArg->toQString());
+        return;
+    }
+
+    QQmlContextData *context = v4->callingQmlContext();
+    if (url.isRelative())
+        url = context ? context->resolvedUrl(url) : qmlContext(this)->resolvedUrl(url);
+
+    LoadBehavior behavior = DontLoad;
+    if (args->length() > 1) {
+        QV4::ScopedValue behaviorArg(scope, (*args)[1]);
+        if (behaviorArg->isInt32())
+            behavior = static_cast<LoadBehavior>(behaviorArg->toInt32());
+    }
+
+    d->preloadUrl(url, behavior == ForceLoad);
+}
+
+/*!
+    \internal
+
+    Typed alternatives to push() for C++. They push a single \a item,
+    \a component or \a url with optional initial \a properties, without
+    inspecting a JavaScript argument list.
+*/
+QQuickItem *QQuickStackView::pushItem(QQuickItem *item, const QVariantMap &properties, Operation operation)
+{
+    Q_D(QQuickStackView);
+    QScopedValueRollback<QString> rollback(d->operation, QStringLiteral("pushItem"));
+    return d->pushElement(item, properties, operation);
+}
+
+QQuickItem *QQuickStackView::pushComponent(QQmlComponent *component, const QVariantMap &properties, Operation operation)
+{
+    Q_D(QQuickStackView);
+    QScopedValueRollback<QString> rollback(d->operation, QStringLiteral("pushComponent"));
+    return d->pushElement(component, properties, operation);
+}
+
+QQuickItem *QQuickStackView::pushUrl(const QUrl &url, const QVariantMap &properties, Operation operation)
+{
+    Q_D(QQuickStackView);
+    QScopedValueRollback<QString> rollback(d->operation, QStringLiteral("pushUrl"));
+    QString error;
+    QQuickStackElement *element = QQuickStackElement::fromString(url.toString(), this, &error);
+    if (!element) {
+        d->warn(error);
+        return nullptr;
+    }
+    return d->pushElement(element, properties, operation);
+}
+
 /*!
     \qmlmethod void QtQuick.Controls::StackView::clear(transition)
 
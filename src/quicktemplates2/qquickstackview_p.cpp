@@ -37,9 +37,14 @@
 #include "qquickstackview_p_p.h"
 #include "qquickstackelement_p_p.h"
 #include "qquickstacktransition_p_p.h"
+#include "qquicktimingspan_p_p.h"
 
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQml/qqmlcomponent.h>
 #include <QtQml/qqmllist.h>
+#include <QtQml/private/qqmlcontext_p.h>
+#include <QtQml/private/qqmlengine_p.h>
 #include <QtQml/private/qv4qmlcontext_p.h>
 #include <QtQml/private/qv4qobjectwrapper_p.h>
 #include <QtQuick/private/qquickanimation_p.h>
@@ -47,6 +52,8 @@
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcStackView, "qt.quick.controls.stackview")
+
 void QQuickStackViewPrivate::warn(const QString &error)
 {
     Q_Q(QQuickStackView);
@@ -64,8 +71,10 @@ void QQuickStackViewPrivate::setCurrentItem(QQuickStackElement *element)
         return;
 
     currentItem = item;
-    if (element)
+    if (element) {
+        element->setCulled(false);
         element->setVisible(true);
+    }
     if (item)
         item->setFocus(true);
     emit q->currentItemChanged();
@@ -167,6 +176,95 @@ QQuickStackElement *QQuickStackViewPrivate::createElement(const QV4::Value &valu
     return nullptr;
 }
 
+/*
+    Returns the component for \a url from the components that have been
+    pushed or preloaded before, so that pushing the same URL again shares
+    one QQmlComponent instead of creating a new one every time. A component
+    that failed to load is not reused, so that the URL is loaded again.
+    Returns \c nullptr if the view has no QML engine to load the URL with.
+*/
+QQmlComponent *QQuickStackViewPrivate::componentForUrl(const QUrl &url)
+{
+    Q_Q(QQuickStackView);
+    QQmlEngine *engine = qmlEngine(q);
+    if (!engine)
+        return nullptr;
+
+    QQmlComponent *&component = components[url];
+    if (!component || component->isError())
+        component = new QQmlComponent(engine, url, q);
+    return component;
+}
+
+QQuickItem *QQuickStackViewPrivate::pushWithTransition(QList<QQuickStackElement *> elems, QQuickStackView::Operation operation)
+{
+    Q_Q(QQuickStackView);
+    // Remove any items that are already in the stack, as they can't be in two places at once.
+    for (int i = 0; i < elems.size(); ) {
+        QQuickStackElement *element = elems.at(i);
+        if (element->item && findElement(element->item))
+            elems.removeAt(i);
+        else
+            ++i;
+    }
+
+    if (elems.isEmpty()) {
+        warn(QStringLiteral("nothing to push"));
+        return nullptr;
+    }
+
+    QQuickStackElement *exit = nullptr;
+    if (!elements.isEmpty())
+        exit = elements.top();
+
+    int oldDepth = elements.count();
+    if (pushElements(elems)) {
+        depthChange(elements.count(), oldDepth);
+        QQuickStackElement *enter = elements.top();
+        startTransition(QQuickStackTransition::pushEnter(operation, enter, q),
+                        QQuickStackTransition::pushExit(operation, exit, q),
+                        operation == QQuickStackView::Immediate);
+        setCurrentItem(enter);
+    }
+    return currentItem;
+}
+
+QQuickItem *QQuickStackViewPrivate::pushElement(QObject *object, const QVariantMap &properties, QQuickStackView::Operation operation)
+{
+    Q_Q(QQuickStackView);
+    if (!object) {
+        warn(QStringLiteral("nothing to push"));
+        return nullptr;
+    }
+
+    QString error;
+    QQuickStackElement *element = QQuickStackElement::fromObject(object, q, &error);
+    if (!element) {
+        warn(error);
+        return nullptr;
+    }
+    return pushElement(element, properties, operation);
+}
+
+QQuickItem *QQuickStackViewPrivate::pushElement(QQuickStackElement *element, const QVariantMap &properties, QQuickStackView::Operation operation)
+{
+    Q_Q(QQuickStackView);
+    if (!properties.isEmpty()) {
+        QQmlEngine *engine = qmlEngine(q);
+        if (!engine) {
+            warn(QStringLiteral("cannot set properties without a QML engine"));
+            delete element;
+            return nullptr;
+        }
+        QV4::ExecutionEngine *v4 = QQmlEnginePrivate::getV4Engine(engine);
+        QV4::Scope scope(v4);
+        QV4::ScopedValue props(scope, v4->fromVariant(properties));
+        element->properties.set(v4, props);
+        element->qmlCallingContext.set(v4, QV4::QmlContext::create(v4->rootContext(), QQmlContextData::get(qmlContext(q)), q));
+    }
+    return pushWithTransition(QList<QQuickStackElement *>() << element, operation);
+}
+
 bool QQuickStackViewPrivate::pushElements(const QList<QQuickStackElement *> &elems)
 {
     Q_Q(QQuickStackView);
@@ -195,6 +293,7 @@ bool QQuickStackViewPrivate::popElements(QQuickStackElement *element)
         if (!element)
             break;
     }
+    elements.top()->setCulled(false);
     return elements.top()->load(q);
 }
 
@@ -219,8 +318,43 @@ void QQuickStackViewPrivate::ensureTransitioner()
     }
 }
 
+/*
+    Transition jobs are owned by QQuickItemViewTransitionableItem, and are
+    only reused within the same stack element. Elements come and go with
+    every push and pop, so the idle jobs of destroyed elements are kept in
+    a small pool and handed to new elements, instead of allocating a new
+    job for every element that transitions. The pooled jobs are parked in
+    otherwise empty transitionable items, which know how to delete them.
+*/
+static const int MaxPooledTransitions = 4;
+
+void QQuickStackViewPrivate::acquireTransition(QQuickStackElement *element)
+{
+    if (element->transition || transitionPool.isEmpty())
+        return;
+
+    QQuickItemViewTransitionableItem *holder = transitionPool.takeLast();
+    qSwap(element->transition, holder->transition);
+    delete holder;
+}
+
+void QQuickStackViewPrivate::releaseTransition(QQuickStackElement *element)
+{
+    if (!transitioner || !element->transition || transitioner->runningJobs.contains(element->transition)
+            || transitionPool.count() >= MaxPooledTransitions)
+        return;
+
+    QQuickItemViewTransitionableItem *holder = new QQuickItemViewTransitionableItem(nullptr);
+    qSwap(element->transition, holder->transition);
+    transitionPool += holder;
+}
+
 void QQuickStackViewPrivate::startTransition(const QQuickStackTransition &first, const QQuickStackTransition &second, bool immediate)
 {
+    Q_Q(QQuickStackView);
+    QQuickTimingSpan span(lcStackView, "startTransition", q);
+    span.addItems(!!first.element + !!second.element);
+
     if (first.element)
         first.element->transitionNextReposition(transitioner, first.type, first.target);
     if (second.element)
@@ -247,7 +381,12 @@ void QQuickStackViewPrivate::startTransition(const QQuickStackTransition &first,
 
 void QQuickStackViewPrivate::completeTransition(QQuickStackElement *element, QQuickTransition *transition, QQuickStackView::Status status)
 {
-    element->setStatus(status);
+    // viewItemTransitionFinished() replaces the intermediate status of an
+    // immediate transition right away, so it is only emitted if observed.
+    if ((status == QQuickStackView::Activating || status == QQuickStackView::Deactivating) && !element->isStatusObserved(status))
+        element->status = status;
+    else
+        element->setStatus(status);
     if (transition) {
         // TODO: add a proper way to complete a transition
         QQmlListProperty<QQuickAbstractAnimation> animations = transition->animations();
@@ -270,6 +409,8 @@ void QQuickStackViewPrivate::viewItemTransitionFinished(QQuickItemViewTransition
         element->setVisible(false);
         if (element->removal || element->isPendingRemoval())
             removed += element;
+        else if (releaseHiddenItems && element->item && !element->item->isVisible())
+            element->setCulled(true);
     }
 
     if (transitioner && transitioner->runningJobs.isEmpty()) {
@@ -296,6 +437,151 @@ void QQuickStackViewPrivate::setBusy(bool b)
     emit q->busyChanged();
 }
 
+/*
+    Compiles the component at \a url asynchronously, and creates an item
+    of it into the cache once it is ready if \a load is \c true. The
+    compiled component is kept, so that pushing the URL later does not
+    have to compile it again.
+*/
+void QQuickStackViewPrivate::preloadUrl(const QUrl &url, bool load)
+{
+    Q_Q(QQuickStackView);
+    QQmlComponent *component = components.value(url);
+    if (component && component->isError())
+        component = nullptr;
+    const bool created = !component;
+    if (created) {
+        component = new QQmlComponent(qmlEngine(q), url, QQmlComponent::Asynchronous, q);
+        components.insert(url, component);
+    }
+
+    if (load)
+        preloading.insert(component);
+
+    if (component->isLoading()) {
+        if (created) {
+            QObject::connect(component, &QQmlComponent::statusChanged, q, [this, component](QQmlComponent::Status status) {
+                if (status == QQmlComponent::Ready)
+                    finishPreload(component);
+                else if (status == QQmlComponent::Error)
+                    warn(component->errorString().trimmed());
+            });
+        }
+    } else if (component->isError()) {
+        if (created)
+            warn(component->errorString().trimmed());
+    } else {
+        finishPreload(component);
+    }
+}
+
+void QQuickStackViewPrivate::finishPreload(QQmlComponent *component)
+{
+    Q_Q(QQuickStackView);
+    if (!preloading.remove(component) || cacheSize <= 0)
+        return;
+
+    for (const QQuickStackCachedItem &cached : qAsConst(cache)) {
+        if (cached.item && cached.url == component->url())
+            return;
+    }
+
+    QQmlContext *creationContext = component->creationContext();
+    if (!creationContext)
+        creationContext = qmlContext(q);
+    QQmlContext *context = new QQmlContext(creationContext, q);
+    context->setContextObject(q);
+
+    QQuickItem *item = qmlobject_cast<QQuickItem *>(component->create(context));
+    if (!item) {
+        if (component->isError())
+            warn(component->errorString().trimmed());
+        delete context;
+        return;
+    }
+
+    QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+    item->setParent(q);
+
+    QQuickStackCachedItem cached;
+    cached.url = component->url();
+    cached.item = item;
+    cached.context = context;
+    cache += cached;
+    trimCache(cacheSize);
+}
+
+static bool matchesCachedItem(const QQuickStackCachedItem &cached, QQuickStackElement *element)
+{
+    if (!cached.item)
+        return false;
+    if (element->ownComponent)
+        return !cached.url.isEmpty() && cached.url == element->component->url();
+    return cached.url.isEmpty() && cached.component == element->component;
+}
+
+/*
+    Keeps the item of a popped or replaced \a element, which was created by
+    the view, detached from the view so that it can be reused when the same
+    component or URL is pushed again. Returns \c false if the item should be
+    destroyed instead.
+*/
+bool QQuickStackViewPrivate::cacheElement(QQuickStackElement *element)
+{
+    if (cacheSize <= 0 || !element->ownItem || !element->item || !element->component || !element->init)
+        return false;
+
+    QQuickItem *item = element->item;
+    if (!element->widthValid)
+        item->resetWidth();
+    if (!element->heightValid)
+        item->resetHeight();
+    item->setParentItem(nullptr);
+
+    QQuickStackCachedItem cached;
+    cached.url = element->ownComponent ? element->component->url() : QUrl();
+    cached.component = element->ownComponent ? nullptr : element->component;
+    cached.item = item;
+    cached.context = element->context;
+    cache += cached;
+
+    element->item = nullptr;
+    element->context = nullptr;
+    trimCache(cacheSize);
+    return true;
+}
+
+/*
+    Hands a cached item matching the component or URL of \a element
+    over to the element, most recently cached items first.
+*/
+bool QQuickStackViewPrivate::takeCachedElement(QQuickStackElement *element)
+{
+    if (cache.isEmpty() || !element->component)
+        return false;
+
+    for (int i = cache.count() - 1; i >= 0; --i) {
+        if (!matchesCachedItem(cache.at(i), element))
+            continue;
+
+        const QQuickStackCachedItem cached = cache.takeAt(i);
+        element->item = cached.item;
+        element->context = cached.context;
+        return true;
+    }
+    return false;
+}
+
+void QQuickStackViewPrivate::trimCache(int size)
+{
+    while (cache.count() > qMax(0, size)) {
+        const QQuickStackCachedItem cached = cache.takeFirst();
+        if (cached.item)
+            cached.item->deleteLater();
+        delete cached.context;
+    }
+}
+
 void QQuickStackViewPrivate::depthChange(int newDepth, int oldDepth)
 {
     Q_Q(QQuickStackView);
@@ -74,6 +74,9 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickStackView : public QQuickControl
     Q_PROPERTY(QQuickTransition *replaceExit READ replaceExit WRITE setReplaceExit NOTIFY replaceExitChanged FINAL)
     // 2.3 (Qt 5.10)
     Q_PROPERTY(bool empty READ isEmpty NOTIFY emptyChanged FINAL REVISION 3)
+    // 2.5 (Qt 5.12)
+    Q_PROPERTY(int cacheSize READ cacheSize WRITE setCacheSize NOTIFY cacheSizeChanged FINAL REVISION 5)
+    Q_PROPERTY(bool releaseHiddenItems READ releaseHiddenItems WRITE setReleaseHiddenItems NOTIFY releaseHiddenItemsChanged FINAL REVISION 5)
 
 public:
     explicit QQuickStackView(QQuickItem *parent = nullptr);
@@ -135,10 +138,22 @@ public:
     Q_INVOKABLE void push(QQmlV4Function *args);
     Q_INVOKABLE void pop(QQmlV4Function *args);
     Q_INVOKABLE void replace(QQmlV4Function *args);
+    Q_REVISION(5) Q_INVOKABLE void preload(QQmlV4Function *args);
+
+    QQuickItem *pushItem(QQuickItem *item, const QVariantMap &properties = QVariantMap(), Operation operation = PushTransition);
+    QQuickItem *pushComponent(QQmlComponent *component, const QVariantMap &properties = QVariantMap(), Operation operation = PushTransition);
+    QQuickItem *pushUrl(const QUrl &url, const QVariantMap &properties = QVariantMap(), Operation operation = PushTransition);
 
     // 2.3 (Qt 5.10)
     bool isEmpty() const;
 
+    // 2.5 (Qt 5.12)
+    int cacheSize() const;
+    void setCacheSize(int size);
+
+    bool releaseHiddenItems() const;
+    void setReleaseHiddenItems(bool release);
+
 public Q_SLOTS:
     void clear(Operation operation = Immediate);
 
@@ -154,6 +169,9 @@ Q_SIGNALS:
     void replaceExitChanged();
     // 2.3 (Qt 5.10)
     Q_REVISION(3) void emptyChanged();
+    // 2.5 (Qt 5.12)
+    Q_REVISION(5) void cacheSizeChanged();
+    Q_REVISION(5) void releaseHiddenItemsChanged();
 
 protected:
     void componentComplete() override;
@@ -54,13 +54,27 @@
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 #include <QtQml/private/qv4value_p.h>
 #include <QtCore/qset.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qurl.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qpointer.h>
 
 QT_BEGIN_NAMESPACE
 
+class QQmlContext;
+class QQmlComponent;
 class QQmlContextData;
 class QQuickStackElement;
 struct QQuickStackTransition;
 
+struct QQuickStackCachedItem
+{
+    QUrl url;
+    QPointer<QQmlComponent> component;
+    QPointer<QQuickItem> item;
+    QQmlContext *context;
+};
+
 class QQuickStackViewPrivate : public QQuickControlPrivate, public QQuickItemViewTransitionChangeListener
 {
     Q_DECLARE_PUBLIC(QQuickStackView)
@@ -79,12 +93,18 @@ public:
     QQuickStackElement *findElement(QQuickItem *item) const;
     QQuickStackElement *findElement(const QV4::Value &value) const;
     QQuickStackElement *createElement(const QV4::Value &value, QQmlContextData *context, QString *error);
+    QQmlComponent *componentForUrl(const QUrl &url);
+    QQuickItem *pushWithTransition(QList<QQuickStackElement *> elements, QQuickStackView::Operation operation);
+    QQuickItem *pushElement(QObject *object, const QVariantMap &properties, QQuickStackView::Operation operation);
+    QQuickItem *pushElement(QQuickStackElement *element, const QVariantMap &properties, QQuickStackView::Operation operation);
     bool pushElements(const QList<QQuickStackElement *> &elements);
     bool pushElement(QQuickStackElement *element);
     bool popElements(QQuickStackElement *element);
     bool replaceElements(QQuickStackElement *element, const QList<QQuickStackElement *> &elements);
 
     void ensureTransitioner();
+    void acquireTransition(QQuickStackElement *element);
+    void releaseTransition(QQuickStackElement *element);
     void startTransition(const QQuickStackTransition &first, const QQuickStackTransition &second, bool immediate);
     void completeTransition(QQuickStackElement *element, QQuickTransition *transition, QQuickStackView::Status status);
 
@@ -92,7 +112,16 @@ public:
     void setBusy(bool busy);
     void depthChange(int newDepth, int oldDepth);
 
+    void preloadUrl(const QUrl &url, bool load);
+    void finishPreload(QQmlComponent *component);
+
+    bool cacheElement(QQuickStackElement *element);
+    bool takeCachedElement(QQuickStackElement *element);
+    void trimCache(int size);
+
     bool busy = false;
+    bool releaseHiddenItems = false;
+    int cacheSize = 0;
     QString operation;
     QJSValue initialItem;
     QQuickItem *currentItem = nullptr;
@@ -100,6 +129,10 @@ public:
     QList<QQuickStackElement*> removed;
     QStack<QQuickStackElement *> elements;
     QQuickItemViewTransitioner *transitioner = nullptr;
+    QVector<QQuickItemViewTransitionableItem *> transitionPool;
+    QList<QQuickStackCachedItem> cache;
+    QHash<QUrl, QQmlComponent *> components;
+    QSet<QQmlComponent *> preloading;
 };
 
 class QQuickStackViewAttachedPrivate : public QObjectPrivate, public QQuickItemChangeListener
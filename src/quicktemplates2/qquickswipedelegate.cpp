@@ -44,6 +44,7 @@
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformtheme.h>
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/private/qqmlglobal_p.h>
 #include <QtQuick/private/qquickanimation_p.h>
 #include <QtQuick/private/qquicktransition_p.h>
 #include <QtQuick/private/qquicktransitionmanager_p_p.h>
@@ -158,6 +159,7 @@ public:
     bool isTransitioning() const;
     void beginTransition(qreal position);
     void finishTransition();
+    void releaseItems();
 
     QQuickSwipeDelegate *control = nullptr;
     // Same range as position, but is set before press events so that we can
@@ -221,12 +223,17 @@ QQuickItem *QQuickSwipePrivate::createDelegateItem(QQmlComponent *component)
     // the creation context will be null and we have to create it ourselves.
     if (!creationContext)
         creationContext = qmlContext(control);
-    QQmlContext *context = new QQmlContext(creationContext, control);
+    // The context lives as long as the item, so that replacing or releasing
+    // the item does not leave its context behind in the control.
+    QQmlContext *context = new QQmlContext(creationContext);
     context->setContextObject(control);
     QQuickItem *item = qobject_cast<QQuickItem*>(component->beginCreate(context));
     if (item) {
+        QQml_setParent_noEvent(context, item);
         item->setParentItem(control);
         component->completeCreate();
+    } else {
+        delete context;
     }
     return item;
 }
@@ -418,10 +425,54 @@ void QQuickSwipePrivate::finishTransition()
 {
     Q_Q(QQuickSwipe);
     q->setComplete(qFuzzyCompare(qAbs(position), qreal(1.0)));
-    if (complete)
+    if (complete) {
         emit q->opened();
-    else
+    } else {
         emit q->closed();
+        if (qFuzzyIsNull(position))
+            releaseItems();
+    }
+}
+
+static bool isSwipeItemReleaseEnabled()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_QUICK_CONTROLS_RELEASE_SWIPE_ITEMS") > 0;
+    return enabled;
+}
+
+static void releaseItem(QQuickItem *item)
+{
+    // the close may have been requested by the item itself, for example from
+    // a button's clicked handler, so it must not be deleted synchronously
+    item->setVisible(false);
+    item->deleteLater();
+}
+
+// Releases the items that were created from the swipe delegates once the
+// swipe has been closed, so that a long list of swipe delegates does not keep
+// the items of every delegate that has ever been swiped. The items are created
+// again from their components on the next swipe.
+void QQuickSwipePrivate::releaseItems()
+{
+    Q_Q(QQuickSwipe);
+    if (!isSwipeItemReleaseEnabled())
+        return;
+
+    if (left && leftItem) {
+        releaseItem(leftItem);
+        leftItem = nullptr;
+        emit q->leftItemChanged();
+    }
+    if (behind && behindItem) {
+        releaseItem(behindItem);
+        behindItem = nullptr;
+        emit q->behindItemChanged();
+    }
+    if (right && rightItem) {
+        releaseItem(rightItem);
+        rightItem = nullptr;
+        emit q->rightItemChanged();
+    }
 }
 
 QQuickSwipe::QQuickSwipe(QQuickSwipeDelegate *control)
@@ -770,6 +821,8 @@ bool QQuickSwipeDelegatePrivate::handleMouseMoveEvent(QQuickItem *item, QMouseEv
     if (item == q && !pressed)
         return false;
 
+    swipePrivate->velocityCalculator.updateMeasuring(event->pos(), event->timestamp());
+
     const QPointF mappedEventPos = item->mapToItem(q, event->pos());
     const qreal distance = (mappedEventPos - pressPoint).x();
     if (!q->keepMouseGrab()) {
@@ -1125,6 +1178,21 @@ static bool isChildOrGrandchildOf(QQuickItem *child, QQuickItem *item)
     return item && (child == item || item->isAncestorOf(child));
 }
 
+bool QQuickSwipeDelegatePrivate::isFilteredChild(QQuickItem *child)
+{
+    const QQuickSwipePrivate *swipePrivate = QQuickSwipePrivate::get(&swipe);
+    if (!swipePrivate->leftItem && !swipePrivate->behindItem && !swipePrivate->rightItem)
+        return false;
+
+    if (child != filterChild) {
+        filterChild = child;
+        filterChildMatches = isChildOrGrandchildOf(child, swipePrivate->leftItem)
+            || isChildOrGrandchildOf(child, swipePrivate->behindItem)
+            || isChildOrGrandchildOf(child, swipePrivate->rightItem);
+    }
+    return filterChildMatches;
+}
+
 bool QQuickSwipeDelegate::childMouseEventFilter(QQuickItem *child, QEvent *event)
 {
     Q_D(QQuickSwipeDelegate);
@@ -1133,11 +1201,11 @@ bool QQuickSwipeDelegate::childMouseEventFilter(QQuickItem *child, QEvent *event
     // items before these items won't allow us to get mouse events when the control is not currently exposed
     // but has been previously. Therefore, we instead call setFiltersChildMouseEvents(true) in the constructor
     // and filter out child events only when the child is the left/right/behind item.
-    const QQuickSwipePrivate *swipePrivate = QQuickSwipePrivate::get(&d->swipe);
-    if (!isChildOrGrandchildOf(child, swipePrivate->leftItem) && !isChildOrGrandchildOf(child, swipePrivate->behindItem)
-        && !isChildOrGrandchildOf(child, swipePrivate->rightItem)) {
+    // The result is cached for the duration of a press-release sequence.
+    if (event->type() == QEvent::MouseButtonPress)
+        d->filterChild = nullptr;
+    if (!d->isFilteredChild(child))
         return false;
-    }
 
     switch (event->type()) {
     case QEvent::MouseButtonPress: {
@@ -1149,11 +1217,13 @@ bool QQuickSwipeDelegate::childMouseEventFilter(QQuickItem *child, QEvent *event
         // items that are stealing events from it.
         QMouseEvent *mouseEvent = static_cast<QMouseEvent *>(event);
         QQuickItemDelegate::mouseReleaseEvent(mouseEvent);
+        d->filterChild = nullptr;
         return d->handleMouseReleaseEvent(child, mouseEvent);
     } case QEvent::UngrabMouse: {
         // If the mouse was pressed over e.g. rightItem and then dragged down,
         // the ListView would eventually grab the mouse, at which point we must
         // clear the pressed flag so that it doesn't stay pressed after the release.
+        d->filterChild = nullptr;
         Attached *attached = attachedObject(child);
         if (attached)
             attached->setPressed(false);
@@ -66,9 +66,16 @@ public:
     bool handleMouseMoveEvent(QQuickItem *item, QMouseEvent *event);
     bool handleMouseReleaseEvent(QQuickItem *item, QMouseEvent *event);
 
+    bool isFilteredChild(QQuickItem *child);
+
     void resizeContent() override;
 
     QQuickSwipe swipe;
+    // Caches whether the child that received the last filtered event belongs to
+    // one of the swipe items, so that the parent chain is only walked once per
+    // press-release sequence.
+    QQuickItem *filterChild = nullptr;
+    bool filterChildMatches = false;
 };
 
 QT_END_NAMESPACE
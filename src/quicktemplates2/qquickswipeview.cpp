@@ -36,7 +36,10 @@
 
 #include "qquickswipeview_p.h"
 
+#include <QtCore/qset.h>
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlincubator.h>
 #include <QtQuickTemplates2/private/qquickcontainer_p_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -75,7 +78,9 @@ QT_BEGIN_NAMESPACE
     pages are relatively complex, it may be desirable to free up resources by
     unloading pages that are outside the immediate reach of the user.
     The following example presents how to use \l Loader to keep a maximum of
-    three pages simultaneously instantiated.
+    three pages simultaneously instantiated. Since QtQuick.Controls 2.5, the
+    same can be achieved by declaring the pages as \l Component{Components}
+    and setting \l cacheBuffer.
 
     \code
     SwipeView {
@@ -103,6 +108,112 @@ QT_BEGIN_NAMESPACE
         {Focus Management in Qt Quick Controls 2}
 */
 
+class QQuickSwipeViewPage;
+
+class QQuickSwipeViewPageIncubator : public QQmlIncubator
+{
+public:
+    QQuickSwipeViewPageIncubator(QQuickSwipeViewPage *page)
+        : QQmlIncubator(Asynchronous), page(page) { }
+
+protected:
+    void setInitialState(QObject *object) override;
+    void statusChanged(Status status) override;
+
+private:
+    QQuickSwipeViewPage *page;
+};
+
+/*
+    A placeholder that takes the place of a page declared as a Component.
+    The actual page is created into it when it gets within the cache buffer,
+    and destroyed when it goes out of it.
+*/
+class QQuickSwipeViewPage : public QQuickItem
+{
+public:
+    QQuickSwipeViewPage(QQmlComponent *component)
+        : component(component) { }
+
+    ~QQuickSwipeViewPage()
+    {
+        unload();
+    }
+
+    void load(bool sync);
+    void unload();
+
+    void resizeItem();
+
+    QPointer<QQmlComponent> component;
+    QQmlContext *context = nullptr;
+    QQuickSwipeViewPageIncubator *incubator = nullptr;
+    QPointer<QQuickItem> item;
+
+protected:
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override
+    {
+        QQuickItem::geometryChanged(newGeometry, oldGeometry);
+        resizeItem();
+    }
+};
+
+void QQuickSwipeViewPageIncubator::setInitialState(QObject *object)
+{
+    QQuickItem *item = qobject_cast<QQuickItem *>(object);
+    if (item) {
+        item->setParentItem(page);
+        item->setSize(page->size());
+    }
+}
+
+void QQuickSwipeViewPageIncubator::statusChanged(Status status)
+{
+    if (status == Ready) {
+        page->item = qobject_cast<QQuickItem *>(object());
+        if (!page->item)
+            delete object();
+    } else if (status == Error) {
+        if (!page->component.isNull())
+            qmlWarning(page->component) << "SwipeView: failed to create a page:" << errors();
+    }
+}
+
+void QQuickSwipeViewPage::load(bool sync)
+{
+    if (item || !component)
+        return;
+
+    if (!incubator) {
+        QQmlContext *creationContext = component->creationContext();
+        if (!creationContext)
+            creationContext = qmlContext(this);
+        context = new QQmlContext(creationContext, this);
+        incubator = new QQuickSwipeViewPageIncubator(this);
+        component->create(*incubator, context);
+    }
+    if (sync && incubator->isLoading())
+        incubator->forceCompletion();
+}
+
+void QQuickSwipeViewPage::unload()
+{
+    if (incubator) {
+        incubator->clear();
+        delete incubator;
+        incubator = nullptr;
+    }
+    delete item;
+    delete context;
+    context = nullptr;
+}
+
+void QQuickSwipeViewPage::resizeItem()
+{
+    if (item)
+        item->setSize(size());
+}
+
 class QQuickSwipeViewPrivate : public QQuickContainerPrivate
 {
     Q_DECLARE_PUBLIC(QQuickSwipeView)
@@ -111,10 +222,19 @@ public:
     void resizeItem(QQuickItem *item);
     void resizeItems();
 
+    QQuickSwipeViewPage *findPage(QQmlComponent *component) const;
+    void createPages();
+    void updatePages();
+    void updateVisibility();
+
     static QQuickSwipeViewPrivate *get(QQuickSwipeView *view);
 
     bool interactive = true;
+    bool hideDistantPages = false;
+    int cacheBuffer = -1;
     Qt::Orientation orientation = Qt::Horizontal;
+    QVector<QQuickSwipeViewPage *> pages;
+    QSet<QQuickItem *> hiddenPages;
 };
 
 class QQuickSwipeViewAttachedPrivate : public QObjectPrivate
@@ -159,6 +279,91 @@ void QQuickSwipeViewPrivate::resizeItems()
     }
 }
 
+QQuickSwipeViewPage *QQuickSwipeViewPrivate::findPage(QQmlComponent *component) const
+{
+    for (QQuickSwipeViewPage *page : pages) {
+        if (page->component == component)
+            return page;
+    }
+    return nullptr;
+}
+
+/*
+    Wraps the Components declared as children of the view into placeholder
+    pages, in the same order relative to the items as they were declared.
+*/
+void QQuickSwipeViewPrivate::createPages()
+{
+    int index = 0;
+    const QObjectList data = contentData;
+    for (QObject *object : data) {
+        if (QQuickItem *item = qobject_cast<QQuickItem *>(object)) {
+            const int itemIndex = indexOf(item);
+            if (itemIndex != -1)
+                index = itemIndex + 1;
+            continue;
+        }
+
+        QQmlComponent *component = qobject_cast<QQmlComponent *>(object);
+        if (!component)
+            continue;
+
+        if (findPage(component))
+            continue;
+
+        Q_Q(QQuickSwipeView);
+        QQuickSwipeViewPage *page = new QQuickSwipeViewPage(component);
+        page->setParent(q);
+        QQmlContext *context = qmlContext(component);
+        QQmlEngine::setContextForObject(page, context ? context : qmlContext(q));
+        pages += page;
+        insertItem(index++, page);
+    }
+}
+
+void QQuickSwipeViewPrivate::updatePages()
+{
+    if (pages.isEmpty())
+        return;
+
+    for (QQuickSwipeViewPage *page : qAsConst(pages)) {
+        const int index = indexOf(page);
+        if (index == -1)
+            continue;
+
+        if (cacheBuffer < 0 || qAbs(index - currentIndex) <= cacheBuffer)
+            page->load(index == currentIndex);
+        else
+            page->unload();
+    }
+}
+
+/*
+    Hides the pages that are more than one page away from the current page,
+    and shows them again when they get closer. Only pages that were hidden
+    here are shown again, so that explicitly hidden pages stay hidden.
+*/
+void QQuickSwipeViewPrivate::updateVisibility()
+{
+    Q_Q(QQuickSwipeView);
+    const int count = q->count();
+    for (int i = 0; i < count; ++i) {
+        QQuickItem *item = itemAt(i);
+        if (!item)
+            continue;
+
+        const bool distant = hideDistantPages && currentIndex != -1 && qAbs(i - currentIndex) > 1;
+        if (distant) {
+            if (!hiddenPages.contains(item) && QQuickItemPrivate::get(item)->explicitVisible) {
+                hiddenPages.insert(item);
+                item->setVisible(false);
+            }
+        } else if (hiddenPages.remove(item)) {
+            item->setVisible(true);
+        }
+    }
+}
+
 QQuickSwipeViewPrivate *QQuickSwipeViewPrivate::get(QQuickSwipeView *view)
 {
     return view->d_func();
@@ -169,6 +374,9 @@ QQuickSwipeView::QQuickSwipeView(QQuickItem *parent)
 {
     setFlag(ItemIsFocusScope);
     setActiveFocusOnTab(true);
+    Q_D(QQuickSwipeView);
+    QObjectPrivate::connect(this, &QQuickContainer::currentIndexChanged, d, &QQuickSwipeViewPrivate::updatePages);
+    QObjectPrivate::connect(this, &QQuickContainer::currentIndexChanged, d, &QQuickSwipeViewPrivate::updateVisibility);
 }
 
 /*!
@@ -256,11 +464,114 @@ bool QQuickSwipeView::isVertical() const
     return d->orientation == Qt::Vertical;
 }
 
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlproperty int QtQuick.Controls::SwipeView::cacheBuffer
+
+    This property holds the number of pages on each side of the current page
+    that are kept instantiated, when the pages are declared as
+    \l Component{Components}. The default value is \c -1, which disables
+    the lazy instantiation.
+
+    When the value is \c 0 or greater, each \l Component declared as a child
+    of the view becomes a page. The page is created when it gets within
+    \c cacheBuffer pages from the \l {Container::}{currentIndex}, and
+    destroyed when it goes further away. Pages that are not yet current are
+    incubated asynchronously, so that they are typically ready by the time
+    the user swipes to them. Pages declared as items are always instantiated.
+
+    The following example keeps a maximum of three pages instantiated:
+
+    \code
+    SwipeView {
+        cacheBuffer: 1
+
+        Component { FirstPage { } }
+        Component { SecondPage { } }
+        Component { ThirdPage { } }
+        Component { FourthPage { } }
+    }
+    \endcode
+
+    \note The lazily created pages are placed inside a placeholder item,
+    which is the one that has the \l {SwipeView::index}{SwipeView} attached
+    properties and is listed in \l {Container::}{contentChildren}.
+*/
+int QQuickSwipeView::cacheBuffer() const
+{
+    Q_D(const QQuickSwipeView);
+    return d->cacheBuffer;
+}
+
+void QQuickSwipeView::setCacheBuffer(int buffer)
+{
+    Q_D(QQuickSwipeView);
+    if (buffer < 0)
+        buffer = -1;
+    if (d->cacheBuffer == buffer)
+        return;
+
+    const bool created = d->cacheBuffer >= 0;
+    d->cacheBuffer = buffer;
+    if (isComponentComplete()) {
+        if (!created)
+            d->createPages();
+        d->updatePages();
+    }
+    emit cacheBufferChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.5 (Qt 5.12)
+    \qmlproperty bool QtQuick.Controls::SwipeView::hideDistantPages
+
+    This property holds whether pages that are more than one page away from
+    the \l {Container::}{currentIndex} are hidden. The default value is
+    \c false.
+
+    Pages that are out of view are already covered by the pages in between,
+    but they remain part of the scene. Hiding them keeps pages with
+    continuously updating content, such as charts or video, from taking
+    part in the synchronization and rendering of every frame. The previous
+    and next pages remain visible, so that they can be swiped to.
+
+    The view sets the \l {Item::}{visible} property of the distant pages to
+    \c false, and restores it when they get closer again. Pages can use the
+    \l {SwipeView::isCurrentItem}{SwipeView.isCurrentItem} attached property
+    to pause their own animations.
+*/
+bool QQuickSwipeView::hideDistantPages() const
+{
+    Q_D(const QQuickSwipeView);
+    return d->hideDistantPages;
+}
+
+void QQuickSwipeView::setHideDistantPages(bool hide)
+{
+    Q_D(QQuickSwipeView);
+    if (d->hideDistantPages == hide)
+        return;
+
+    d->hideDistantPages = hide;
+    d->updateVisibility();
+    emit hideDistantPagesChanged();
+}
+
 QQuickSwipeViewAttached *QQuickSwipeView::qmlAttachedProperties(QObject *object)
 {
     return new QQuickSwipeViewAttached(object);
 }
 
+void QQuickSwipeView::componentComplete()
+{
+    Q_D(QQuickSwipeView);
+    QQuickContainer::componentComplete();
+    if (d->cacheBuffer >= 0) {
+        d->createPages();
+        d->updatePages();
+    }
+}
+
 void QQuickSwipeView::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
     Q_D(QQuickSwipeView);
@@ -277,20 +588,36 @@ void QQuickSwipeView::itemAdded(int index, QQuickItem *item)
     QQuickSwipeViewAttached *attached = qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item));
     if (attached)
         QQuickSwipeViewAttachedPrivate::get(attached)->update(this, index);
+    d->updatePages();
+    d->updateVisibility();
 }
 
 void QQuickSwipeView::itemMoved(int index, QQuickItem *item)
 {
+    Q_D(QQuickSwipeView);
     QQuickSwipeViewAttached *attached = qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item));
     if (attached)
         QQuickSwipeViewAttachedPrivate::get(attached)->update(this, index);
+    d->updatePages();
+    d->updateVisibility();
 }
 
 void QQuickSwipeView::itemRemoved(int, QQuickItem *item)
 {
+    Q_D(QQuickSwipeView);
     QQuickSwipeViewAttached *attached = qobject_cast<QQuickSwipeViewAttached *>(qmlAttachedPropertiesObject<QQuickSwipeView>(item));
     if (attached)
         QQuickSwipeViewAttachedPrivate::get(attached)->update(nullptr, -1);
+    for (int i = 0; i < d->pages.count(); ++i) {
+        if (d->pages.at(i) == item) {
+            d->pages.removeAt(i);
+            break;
+        }
+    }
+    if (d->hiddenPages.remove(item))
+        item->setVisible(true);
+    d->updatePages();
+    d->updateVisibility();
 }
 
 #if QT_CONFIG(accessibility)
@@ -65,6 +65,9 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickSwipeView : public QQuickContainer
     // 2.3 (Qt 5.10)
     Q_PROPERTY(bool horizontal READ isHorizontal NOTIFY orientationChanged FINAL REVISION 3)
     Q_PROPERTY(bool vertical READ isVertical NOTIFY orientationChanged FINAL REVISION 3)
+    // 2.5 (Qt 5.12)
+    Q_PROPERTY(int cacheBuffer READ cacheBuffer WRITE setCacheBuffer NOTIFY cacheBufferChanged FINAL REVISION 5)
+    Q_PROPERTY(bool hideDistantPages READ hideDistantPages WRITE setHideDistantPages NOTIFY hideDistantPagesChanged FINAL REVISION 5)
 
 public:
     explicit QQuickSwipeView(QQuickItem *parent = nullptr);
@@ -83,13 +86,24 @@ public:
     bool isHorizontal() const;
     bool isVertical() const;
 
+    // 2.5 (Qt 5.12)
+    int cacheBuffer() const;
+    void setCacheBuffer(int buffer);
+
+    bool hideDistantPages() const;
+    void setHideDistantPages(bool hide);
+
 Q_SIGNALS:
     // 2.1 (Qt 5.8)
     Q_REVISION(1) void interactiveChanged();
     // 2.2 (Qt 5.9)
     Q_REVISION(2) void orientationChanged();
+    // 2.5 (Qt 5.12)
+    Q_REVISION(5) void cacheBufferChanged();
+    Q_REVISION(5) void hideDistantPagesChanged();
 
 protected:
+    void componentComplete() override;
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
     void itemAdded(int index, QQuickItem *item) override;
     void itemMoved(int index, QQuickItem *item) override;
@@ -103,12 +103,17 @@ public:
     void updateCurrentItem();
     void updateCurrentIndex();
     void updateLayout();
+    void updateContentWidth();
+    void scheduleLayout();
+    void scheduleContentWidth();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemImplicitWidthChanged(QQuickItem *item) override;
     void itemImplicitHeightChanged(QQuickItem *item) override;
 
     bool updatingLayout = false;
+    bool layoutPending = false;
+    bool contentWidthPending = false;
     bool hasContentWidth = false;
     bool hasContentHeight = false;
     qreal contentWidth = 0;
@@ -144,12 +149,15 @@ void QQuickTabBarPrivate::updateCurrentIndex()
     Q_Q(QQuickTabBar);
     QQuickTabButton *button = qobject_cast<QQuickTabButton *>(q->sender());
     if (button && button->isChecked())
-        q->setCurrentIndex(contentModel->indexOf(button, nullptr));
+        q->setCurrentIndex(indexOf(button));
 }
 
 void QQuickTabBarPrivate::updateLayout()
 {
     Q_Q(QQuickTabBar);
+    layoutPending = false;
+    contentWidthPending = false;
+
     const int count = contentModel->count();
     if (count <= 0 || !contentItem)
         return;
@@ -217,22 +225,74 @@ void QQuickTabBarPrivate::updateLayout()
         emit q->contentHeightChanged();
 }
 
-void QQuickTabBarPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+// The width of resizable tabs does not depend on their implicit width, so a
+// change in the implicit width of such a tab only affects the content width.
+void QQuickTabBarPrivate::updateContentWidth()
 {
-    if (!updatingLayout)
+    Q_Q(QQuickTabBar);
+    contentWidthPending = false;
+    if (hasContentWidth)
+        return;
+
+    const int count = contentModel->count();
+    qreal totalWidth = qMax(0, count - 1) * spacing;
+    for (int i = 0; i < count; ++i) {
+        if (QQuickItem *item = q->itemAt(i))
+            totalWidth += QQuickItemPrivate::get(item)->widthValid ? item->width() : item->implicitWidth();
+    }
+
+    if (!qFuzzyCompare(contentWidth, totalWidth)) {
+        contentWidth = totalWidth;
+        emit q->contentWidthChanged();
+    }
+}
+
+// A layout pass visits every tab. Changes in individual tabs are coalesced
+// into one pass before the next frame, so that a tab bar with a large amount
+// of tabs doesn't lay out all of them once per changed tab.
+void QQuickTabBarPrivate::scheduleLayout()
+{
+    Q_Q(QQuickTabBar);
+    if (componentComplete) {
+        layoutPending = true;
+        q->polish();
+    } else {
         updateLayout();
+    }
 }
 
-void QQuickTabBarPrivate::itemImplicitWidthChanged(QQuickItem *)
+void QQuickTabBarPrivate::scheduleContentWidth()
 {
-    if (!updatingLayout && !hasContentWidth)
+    Q_Q(QQuickTabBar);
+    if (componentComplete) {
+        contentWidthPending = true;
+        q->polish();
+    } else {
         updateLayout();
+    }
+}
+
+void QQuickTabBarPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+{
+    if (!updatingLayout)
+        scheduleLayout();
+}
+
+void QQuickTabBarPrivate::itemImplicitWidthChanged(QQuickItem *item)
+{
+    if (updatingLayout || hasContentWidth)
+        return;
+
+    if (QQuickItemPrivate::get(item)->widthValid)
+        scheduleLayout();
+    else
+        scheduleContentWidth();
 }
 
 void QQuickTabBarPrivate::itemImplicitHeightChanged(QQuickItem *)
 {
     if (!updatingLayout && !hasContentHeight)
-        updateLayout();
+        scheduleLayout();
 }
 
 QQuickTabBar::QQuickTabBar(QQuickItem *parent)
@@ -366,7 +426,10 @@ void QQuickTabBar::updatePolish()
 {
     Q_D(QQuickTabBar);
     QQuickContainer::updatePolish();
-    d->updateLayout();
+    if (d->layoutPending || !d->contentWidthPending)
+        d->updateLayout();
+    else
+        d->updateContentWidth();
 }
 
 void QQuickTabBar::componentComplete()
@@ -396,16 +459,17 @@ void QQuickTabBar::itemAdded(int index, QQuickItem *item)
     QQuickItemPrivate::get(item)->setCulled(true); // QTBUG-55129
     if (QQuickTabButton *button = qobject_cast<QQuickTabButton *>(item))
         QObjectPrivate::connect(button, &QQuickTabButton::checkedChanged, d, &QQuickTabBarPrivate::updateCurrentIndex);
-    QQuickTabBarAttached *attached = qobject_cast<QQuickTabBarAttached *>(qmlAttachedPropertiesObject<QQuickTabBar>(item));
+    // attached objects that don't exist yet resolve the tab bar and index when created
+    QQuickTabBarAttached *attached = qobject_cast<QQuickTabBarAttached *>(qmlAttachedPropertiesObject<QQuickTabBar>(item, false));
     if (attached)
         QQuickTabBarAttachedPrivate::get(attached)->update(this, index);
     if (isComponentComplete())
-        polish();
+        d->scheduleLayout();
 }
 
 void QQuickTabBar::itemMoved(int index, QQuickItem *item)
 {
-    QQuickTabBarAttached *attached = qobject_cast<QQuickTabBarAttached *>(qmlAttachedPropertiesObject<QQuickTabBar>(item));
+    QQuickTabBarAttached *attached = qobject_cast<QQuickTabBarAttached *>(qmlAttachedPropertiesObject<QQuickTabBar>(item, false));
     if (attached)
         QQuickTabBarAttachedPrivate::get(attached)->update(this, index);
 }
@@ -416,11 +480,11 @@ void QQuickTabBar::itemRemoved(int index, QQuickItem *item)
     Q_UNUSED(index);
     if (QQuickTabButton *button = qobject_cast<QQuickTabButton *>(item))
         QObjectPrivate::disconnect(button, &QQuickTabButton::checkedChanged, d, &QQuickTabBarPrivate::updateCurrentIndex);
-    QQuickTabBarAttached *attached = qobject_cast<QQuickTabBarAttached *>(qmlAttachedPropertiesObject<QQuickTabBar>(item));
+    QQuickTabBarAttached *attached = qobject_cast<QQuickTabBarAttached *>(qmlAttachedPropertiesObject<QQuickTabBar>(item, false));
     if (attached)
         QQuickTabBarAttachedPrivate::get(attached)->update(nullptr, -1);
     if (isComponentComplete())
-        polish();
+        d->scheduleLayout();
 }
 
 QPalette QQuickTabBar::defaultPalette() const
@@ -496,6 +560,19 @@ void QQuickTabBarAttachedPrivate::update(QQuickTabBar *newTabBar, int newIndex)
 QQuickTabBarAttached::QQuickTabBarAttached(QObject *parent)
     : QObject(*(new QQuickTabBarAttachedPrivate), parent)
 {
+    // The tab bar only updates the attached objects that exist, so that
+    // inserting or removing a tab doesn't create one for every tab that
+    // follows it. A new attached object looks up its tab bar and index.
+    Q_D(QQuickTabBarAttached);
+    QQuickItem *item = qobject_cast<QQuickItem *>(parent);
+    for (QQuickItem *ancestor = item ? item->parentItem() : nullptr; ancestor; ancestor = ancestor->parentItem()) {
+        if (QQuickTabBar *tabBar = qobject_cast<QQuickTabBar *>(ancestor)) {
+            const int index = QQuickContainerPrivate::get(tabBar)->indexOf(item);
+            if (index != -1)
+                d->update(tabBar, index);
+            break;
+        }
+    }
 }
 
 int QQuickTabBarAttached::index() const
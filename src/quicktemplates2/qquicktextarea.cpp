@@ -134,14 +134,14 @@ QT_BEGIN_NAMESPACE
 QQuickTextAreaPrivate::QQuickTextAreaPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::installActivationObserver(this);
+    QQuickControlPrivate::addAccessibilityObserver(this);
 #endif
 }
 
 QQuickTextAreaPrivate::~QQuickTextAreaPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::removeActivationObserver(this);
+    QQuickControlPrivate::removeAccessibilityObserver(this);
 #endif
 }
 
@@ -187,7 +187,7 @@ void QQuickTextAreaPrivate::inheritFont(const QFont &font)
     parentFont.resolve(extra.isAllocated() ? extra->requestedFont.resolve() | font.resolve() : font.resolve());
 
     const QFont defaultFont = QQuickControlPrivate::themeFont(QPlatformTheme::EditorFont);
-    const QFont resolvedFont = parentFont.resolve(defaultFont);
+    const QFont resolvedFont = QQuickControlPrivate::shareInherited(parentFont.resolve(defaultFont), font);
 
     setFont_helper(resolvedFont);
 }
@@ -203,10 +203,10 @@ void QQuickTextAreaPrivate::updateFont(const QFont &font)
     QFont oldFont = sourceFont;
     q->QQuickTextEdit::setFont(font);
 
-    QQuickControlPrivate::updateFontRecur(q, font);
+    inheritanceNode.propagateFont(font, QQuickInheritanceNode::fontChanges(oldFont, font));
 
     if (oldFont != font)
-        emit q->fontChanged();
+        inheritanceNode.notify(QQuickInheritanceNode::FontAttribute);
 }
 
 /*!
@@ -229,21 +229,20 @@ void QQuickTextAreaPrivate::inheritPalette(const QPalette &palette)
     parentPalette.resolve(extra.isAllocated() ? extra->requestedPalette.resolve() | palette.resolve() : palette.resolve());
 
     const QPalette defaultPalette = QQuickControlPrivate::themePalette(QPlatformTheme::TextEditPalette);
-    const QPalette resolvedPalette = parentPalette.resolve(defaultPalette);
+    const QPalette resolvedPalette = QQuickControlPrivate::shareInherited(parentPalette.resolve(defaultPalette), palette);
 
     setPalette_helper(resolvedPalette);
 }
 
 void QQuickTextAreaPrivate::updatePalette(const QPalette &palette)
 {
-    Q_Q(QQuickTextArea);
     QPalette oldPalette = resolvedPalette;
     resolvedPalette = palette;
 
-    QQuickControlPrivate::updatePaletteRecur(q, palette);
+    inheritanceNode.propagatePalette(palette, QQuickInheritanceNode::paletteChanges(oldPalette, palette));
 
     if (oldPalette != palette)
-        emit q->paletteChanged();
+        inheritanceNode.notify(QQuickInheritanceNode::PaletteAttribute);
 }
 
 #if QT_CONFIG(quicktemplates2_hover)
@@ -257,7 +256,7 @@ void QQuickTextAreaPrivate::updateHoverEnabled(bool enabled, bool xplicit)
     explicitHoverEnabled = xplicit;
     if (wasEnabled != enabled) {
         q->setAcceptHoverEvents(enabled);
-        QQuickControlPrivate::updateHoverEnabledRecur(q, enabled);
+        inheritanceNode.propagateHoverEnabled(enabled);
         emit q->hoverEnabledChanged();
     }
 }
@@ -447,7 +446,7 @@ void QQuickTextAreaPrivate::executeBackground(bool complete)
     if (!background || complete)
         quickBeginDeferred(q, backgroundName(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickTextArea::QQuickTextArea(QQuickItem *parent)
@@ -458,6 +457,7 @@ QQuickTextArea::QQuickTextArea(QQuickItem *parent)
     setAcceptedMouseButtons(Qt::AllButtons);
     d->setImplicitResizeEnabled(false);
     d->pressHandler.control = this;
+    d->inheritanceNode.init(this, QQuickInheritanceNode::TextAreaType);
 #if QT_CONFIG(cursor)
     setCursor(Qt::IBeamCursor);
 #endif
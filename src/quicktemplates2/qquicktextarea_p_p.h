@@ -53,6 +53,7 @@
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 #include <QtQuickTemplates2/private/qquickpresshandler_p_p.h>
 #include <QtQuickTemplates2/private/qquickdeferredpointer_p_p.h>
+#include <QtQuickTemplates2/private/qquickinheritancenode_p_p.h>
 
 #include <QtQuickTemplates2/private/qquicktextarea_p.h>
 
@@ -141,6 +142,7 @@ public:
 
     QPalette resolvedPalette;
     QQuickDeferredPointer<QQuickItem> background;
+    QQuickInheritanceNode inheritanceNode;
     QString placeholder;
     Qt::FocusReason focusReason = Qt::OtherFocusReason;
     QQuickPressHandler pressHandler;
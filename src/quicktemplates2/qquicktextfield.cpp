@@ -115,14 +115,14 @@ QT_BEGIN_NAMESPACE
 QQuickTextFieldPrivate::QQuickTextFieldPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::installActivationObserver(this);
+    QQuickControlPrivate::addAccessibilityObserver(this);
 #endif
 }
 
 QQuickTextFieldPrivate::~QQuickTextFieldPrivate()
 {
 #if QT_CONFIG(accessibility)
-    QAccessible::removeActivationObserver(this);
+    QQuickControlPrivate::removeAccessibilityObserver(this);
 #endif
 }
 
@@ -162,7 +162,7 @@ void QQuickTextFieldPrivate::inheritFont(const QFont &font)
     parentFont.resolve(extra.isAllocated() ? extra->requestedFont.resolve() | font.resolve() : font.resolve());
 
     const QFont defaultFont = QQuickControlPrivate::themeFont(QPlatformTheme::EditorFont);
-    const QFont resolvedFont = parentFont.resolve(defaultFont);
+    const QFont resolvedFont = QQuickControlPrivate::shareInherited(parentFont.resolve(defaultFont), font);
 
     setFont_helper(resolvedFont);
 }
@@ -178,10 +178,10 @@ void QQuickTextFieldPrivate::updateFont(const QFont &font)
     QFont oldFont = sourceFont;
     q->QQuickTextInput::setFont(font);
 
-    QQuickControlPrivate::updateFontRecur(q, font);
+    inheritanceNode.propagateFont(font, QQuickInheritanceNode::fontChanges(oldFont, font));
 
     if (oldFont != font)
-        emit q->fontChanged();
+        inheritanceNode.notify(QQuickInheritanceNode::FontAttribute);
 }
 
 /*!
@@ -204,21 +204,20 @@ void QQuickTextFieldPrivate::inheritPalette(const QPalette &palette)
     parentPalette.resolve(extra.isAllocated() ? extra->requestedPalette.resolve() | palette.resolve() : palette.resolve());
 
     const QPalette defaultPalette = QQuickControlPrivate::themePalette(QPlatformTheme::TextLineEditPalette);
-    const QPalette resolvedPalette = parentPalette.resolve(defaultPalette);
+    const QPalette resolvedPalette = QQuickControlPrivate::shareInherited(parentPalette.resolve(defaultPalette), palette);
 
     setPalette_helper(resolvedPalette);
 }
 
 void QQuickTextFieldPrivate::updatePalette(const QPalette &palette)
 {
-    Q_Q(QQuickTextField);
     QPalette oldPalette = resolvedPalette;
     resolvedPalette = palette;
 
-    QQuickControlPrivate::updatePaletteRecur(q, palette);
+    inheritanceNode.propagatePalette(palette, QQuickInheritanceNode::paletteChanges(oldPalette, palette));
 
     if (oldPalette != palette)
-        emit q->paletteChanged();
+        inheritanceNode.notify(QQuickInheritanceNode::PaletteAttribute);
 }
 
 #if QT_CONFIG(quicktemplates2_hover)
@@ -232,7 +231,7 @@ void QQuickTextFieldPrivate::updateHoverEnabled(bool enabled, bool xplicit)
     explicitHoverEnabled = xplicit;
     if (wasEnabled != enabled) {
         q->setAcceptHoverEvents(enabled);
-        QQuickControlPrivate::updateHoverEnabledRecur(q, enabled);
+        inheritanceNode.propagateHoverEnabled(enabled);
         emit q->hoverEnabledChanged();
     }
 }
@@ -322,7 +321,7 @@ void QQuickTextFieldPrivate::executeBackground(bool complete)
     if (!background || complete)
         quickBeginDeferred(q, backgroundName(), background);
     if (complete)
-        quickCompleteDeferred(q, backgroundName(), background);
+        quickCompleteDeferred(q, background);
 }
 
 QQuickTextField::QQuickTextField(QQuickItem *parent)
@@ -330,6 +329,7 @@ QQuickTextField::QQuickTextField(QQuickItem *parent)
 {
     Q_D(QQuickTextField);
     d->pressHandler.control = this;
+    d->inheritanceNode.init(this, QQuickInheritanceNode::TextFieldType);
     d->setImplicitResizeEnabled(false);
     setAcceptedMouseButtons(Qt::AllButtons);
     setActiveFocusOnTab(true);
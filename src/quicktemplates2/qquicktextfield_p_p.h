@@ -52,6 +52,7 @@
 #include <QtQuick/private/qquicktextinput_p_p.h>
 #include <QtQuickTemplates2/private/qquickpresshandler_p_p.h>
 #include <QtQuickTemplates2/private/qquickdeferredpointer_p_p.h>
+#include <QtQuickTemplates2/private/qquickinheritancenode_p_p.h>
 
 #include <QtQuickTemplates2/private/qquicktextfield_p.h>
 
@@ -129,6 +130,7 @@ public:
 
     QPalette resolvedPalette;
     QQuickDeferredPointer<QQuickItem> background;
+    QQuickInheritanceNode inheritanceNode;
     QString placeholder;
     Qt::FocusReason focusReason = Qt::OtherFocusReason;
     QQuickPressHandler pressHandler;
@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Templates 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QQUICKTIMINGSPAN_P_P_H
+#define QQUICKTIMINGSPAN_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qloggingcategory.h>
+
+QT_BEGIN_NAMESPACE
+
+// Measures the time spent in a scope and reports it to a logging category
+// when the scope is left. Nothing is measured unless debug output has been
+// enabled for the category, for example with QT_LOGGING_RULES.
+class QQuickTimingSpan
+{
+public:
+    typedef const QLoggingCategory &(*CategoryFunction)();
+
+    QQuickTimingSpan(CategoryFunction category, const char *operation, const QObject *object = nullptr, bool enabled = true)
+        : m_category(category), m_operation(operation), m_object(object)
+    {
+        if (enabled && m_category().isDebugEnabled())
+            m_timer.start();
+    }
+
+    ~QQuickTimingSpan()
+    {
+        if (!m_timer.isValid())
+            return;
+
+        QDebug debug = QMessageLogger(nullptr, 0, nullptr, m_category().categoryName()).debug().nospace();
+        debug << m_operation;
+        if (m_object)
+            debug << ' ' << m_object;
+        debug << ": " << m_timer.nsecsElapsed() / 1000 << " us";
+        if (m_items > 0)
+            debug << ", " << m_items << " items";
+    }
+
+    bool isActive() const { return m_timer.isValid(); }
+    void addItems(int count = 1) { m_items += count; }
+
+private:
+    Q_DISABLE_COPY(QQuickTimingSpan)
+
+    CategoryFunction m_category;
+    const char *m_operation;
+    const QObject *m_object;
+    int m_items = 0;
+    QElapsedTimer m_timer;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKTIMINGSPAN_P_P_H
@@ -38,8 +38,9 @@
 #include "qquickpopup_p_p.h"
 #include "qquickpopupitem_p_p.h"
 #include "qquickcontrol_p_p.h"
+#include "qquickpresstimer_p_p.h"
 
-#include <QtCore/qbasictimer.h>
+#include <QtCore/qpointer.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlcontext.h>
@@ -133,8 +134,8 @@ public:
     int delay = 0;
     int timeout = -1;
     QString text;
-    QBasicTimer delayTimer;
-    QBasicTimer timeoutTimer;
+    QQuickPressTimer delayTimer;
+    QQuickPressTimer timeoutTimer;
 };
 
 void QQuickToolTipPrivate::startDelay()
@@ -334,10 +335,15 @@ public:
     int delay = 0;
     int timeout = -1;
     QString text;
+    mutable QPointer<QQuickToolTip> sharedTip;
 };
 
 QQuickToolTip *QQuickToolTipAttachedPrivate::instance(bool create) const
 {
+    // the shared instance lives as long as the engine, so it is enough to look it up once
+    if (sharedTip)
+        return sharedTip;
+
     QQmlEngine *engine = qmlEngine(parent);
     if (!engine)
         return nullptr;
@@ -360,6 +366,7 @@ QQuickToolTip *QQuickToolTipAttachedPrivate::instance(bool create) const
         else
             engine->setProperty(name, QVariant::fromValue(object));
     }
+    sharedTip = tip;
     return tip;
 }
 
@@ -505,9 +512,18 @@ void QQuickToolTipAttached::show(const QString &text, int ms)
     if (!tip)
         return;
 
+    QQuickItem *item = qobject_cast<QQuickItem *>(parent());
+    if (tip->isVisible() && tip->parentItem() == item && tip->text() == text) {
+        // already showing the same text for this item; avoid resetting the
+        // geometry, which would re-layout and reposition the shared tool tip
+        tip->setTimeout(ms >= 0 ? ms : d->timeout);
+        tip->setDelay(d->delay);
+        return;
+    }
+
     tip->resetWidth();
     tip->resetHeight();
-    tip->setParentItem(qobject_cast<QQuickItem *>(parent()));
+    tip->setParentItem(item);
     tip->setTimeout(ms >= 0 ? ms : d->timeout);
     tip->setDelay(d->delay);
     tip->setText(text);
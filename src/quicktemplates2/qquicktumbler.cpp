@@ -38,7 +38,8 @@
 
 #include <QtGui/qpa/qplatformtheme.h>
 #include <QtQml/qqmlinfo.h>
-#include <QtQuick/private/qquickflickable_p.h>
+#include <QtQuick/private/qquicklistview_p.h>
+#include <QtQuick/private/qquickpathview_p.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
 #include <QtQuickTemplates2/private/qquicktumbler_p_p.h>
 
@@ -83,6 +84,26 @@ QT_BEGIN_NAMESPACE
 
     \snippet qtquickcontrols2-tumbler-timePicker.qml tumbler
 
+    For large numeric ranges, use an integer \l model and calculate the
+    value from the \c index in the delegate. An integer model has no backing
+    data, and the view only creates the delegates that are needed to fill
+    \l visibleItemCount, so the size of the range does not matter:
+
+    \code
+    Tumbler {
+        readonly property int from: 0
+        readonly property int step: 5
+
+        model: 20001
+        delegate: Text {
+            text: from + index * step
+            opacity: 1.0 - Math.abs(Tumbler.displacement) / (Tumbler.tumbler.visibleItemCount / 2)
+            horizontalAlignment: Text.AlignHCenter
+            verticalAlignment: Text.AlignVCenter
+        }
+    }
+    \endcode
+
     \sa {Customizing Tumbler}, {Input Controls}
 */
 
@@ -104,16 +125,20 @@ QQuickItem *QQuickTumblerPrivate::determineViewType(QQuickItem *contentItem)
         return nullptr;
     }
 
-    if (contentItem->inherits("QQuickPathView")) {
+    if (QQuickPathView *contentPathView = qobject_cast<QQuickPathView *>(contentItem)) {
         view = contentItem;
+        pathView = contentPathView;
+        listView = nullptr;
         viewContentItem = contentItem;
         viewContentItemType = PathViewContentItem;
         viewOffset = 0;
 
         return contentItem;
-    } else if (contentItem->inherits("QQuickListView")) {
+    } else if (QQuickListView *contentListView = qobject_cast<QQuickListView *>(contentItem)) {
         view = contentItem;
-        viewContentItem = qobject_cast<QQuickFlickable*>(contentItem)->contentItem();
+        pathView = nullptr;
+        listView = contentListView;
+        viewContentItem = contentListView->contentItem();
         viewContentItemType = ListViewContentItem;
         viewContentY = 0;
 
@@ -135,6 +160,8 @@ QQuickItem *QQuickTumblerPrivate::determineViewType(QQuickItem *contentItem)
 void QQuickTumblerPrivate::resetViewData()
 {
     view = nullptr;
+    pathView = nullptr;
+    listView = nullptr;
     viewContentItem = nullptr;
     if (viewContentItemType == PathViewContentItem)
         viewOffset = 0;
@@ -151,6 +178,15 @@ QList<QQuickItem *> QQuickTumblerPrivate::viewContentItemChildItems() const
     return viewContentItem->childItems();
 }
 
+int QQuickTumblerPrivate::viewCount() const
+{
+    if (pathView)
+        return pathView->count();
+    if (listView)
+        return listView->count();
+    return 0;
+}
+
 QQuickTumblerPrivate *QQuickTumblerPrivate::get(QQuickTumbler *tumbler)
 {
     return tumbler->d_func();
@@ -204,7 +240,7 @@ void QQuickTumblerPrivate::_q_onViewCountChanged()
     if (ignoreSignals)
         return;
 
-    setCount(view->property("count").toInt());
+    setCount(viewCount());
 
     if (count > 0) {
         if (pendingCurrentIndex != -1) {
@@ -229,23 +265,53 @@ void QQuickTumblerPrivate::_q_onViewCountChanged()
 
 void QQuickTumblerPrivate::_q_onViewOffsetChanged()
 {
-    viewOffset = view->property("offset").toReal();
+    viewOffset = pathView->offset();
     calculateDisplacements();
 }
 
 void QQuickTumblerPrivate::_q_onViewContentYChanged()
 {
-    viewContentY = view->property("contentY").toReal();
+    viewContentY = listView->contentY();
     calculateDisplacements();
 }
 
+/*
+    The parameters that are common to all delegates are read from the view
+    once per pass, instead of once per delegate through the meta-object.
+*/
+QQuickTumblerPrivate::DisplacementParameters QQuickTumblerPrivate::displacementParameters() const
+{
+    Q_Q(const QQuickTumbler);
+    DisplacementParameters parameters;
+    if (!viewContentItem)
+        return parameters;
+
+    // The attached property gets created before our count is updated, so just cheat here
+    // to avoid having to listen to count changes.
+    parameters.count = viewCount();
+    parameters.visibleItemCount = visibleItemCount;
+    if (viewContentItemType == ListViewContentItem) {
+        parameters.delegateHeight = delegateHeight(q);
+        parameters.preferredHighlightBegin = listView->preferredHighlightBegin();
+    }
+    return parameters;
+}
+
 void QQuickTumblerPrivate::calculateDisplacements()
 {
+    Q_Q(QQuickTumbler);
     const auto items = viewContentItemChildItems();
+    if (items.isEmpty())
+        return;
+
+    if (!attachedPropertiesFunc)
+        attachedPropertiesFunc = qmlAttachedPropertiesFunction(q, &QQuickTumbler::staticMetaObject);
+
+    const DisplacementParameters parameters = displacementParameters();
     for (QQuickItem *childItem : items) {
-        QQuickTumblerAttached *attached = qobject_cast<QQuickTumblerAttached *>(qmlAttachedPropertiesObject<QQuickTumbler>(childItem, false));
+        QQuickTumblerAttached *attached = qobject_cast<QQuickTumblerAttached *>(qmlAttachedPropertiesObject(childItem, attachedPropertiesFunc, false));
         if (attached)
-            QQuickTumblerAttachedPrivate::get(attached)->calculateDisplacement();
+            QQuickTumblerAttachedPrivate::get(attached)->calculateDisplacement(parameters);
     }
 }
 
@@ -722,7 +788,7 @@ void QQuickTumblerPrivate::setWrap(bool shouldWrap, bool isExplicit)
     ignoreCurrentIndexChanges = false;
 
     // If isComponentComplete() is true, we require a contentItem. If it's not
-    // true, it might not have been created yet, so we wait until
+    // true, QQuickTumblerView has not created its view yet, so we wait until
     // componentComplete() is called.
     //
     // When the contentItem (usually QQuickTumblerView) has been created, we
@@ -730,7 +796,7 @@ void QQuickTumblerPrivate::setWrap(bool shouldWrap, bool isExplicit)
     // properties, this will have already been called, in which case it will
     // return early. If the delegate doesn't use attached properties, we need
     // to call it here.
-    if (q->isComponentComplete() || contentItem)
+    if (q->isComponentComplete())
         setupViewData(contentItem);
 
     setCurrentIndex(oldCurrentIndex);
@@ -768,7 +834,7 @@ void QQuickTumbler::updatePolish()
     if (d->pendingCurrentIndex != -1) {
         // Update our count, as ignoreSignals might have been true
         // when _q_onViewCountChanged() was last called.
-        d->setCount(d->view->property("count").toInt());
+        d->setCount(d->viewCount());
 
         // If the count is still 0, it's not going to happen.
         if (d->count == 0) {
@@ -825,15 +891,24 @@ void QQuickTumblerAttachedPrivate::init(QQuickItem *delegateItem)
 
 void QQuickTumblerAttachedPrivate::calculateDisplacement()
 {
-    const qreal previousDisplacement = displacement;
-    displacement = 0;
-
     if (!tumbler) {
         // Can happen if the attached properties are accessed on the wrong type of item or the tumbler was destroyed.
         // We don't want to emit the change signal though, as this could cause warnings about Tumbler.tumbler being null.
+        displacement = 0;
         return;
     }
 
+    calculateDisplacement(QQuickTumblerPrivate::get(tumbler)->displacementParameters());
+}
+
+void QQuickTumblerAttachedPrivate::calculateDisplacement(const QQuickTumblerPrivate::DisplacementParameters &parameters)
+{
+    const qreal previousDisplacement = displacement;
+    displacement = 0;
+
+    if (!tumbler)
+        return;
+
     // Can happen if there is no ListView or PathView within the contentItem.
     QQuickTumblerPrivate *tumblerPrivate = QQuickTumblerPrivate::get(tumbler);
     if (!tumblerPrivate->viewContentItem) {
@@ -841,9 +916,7 @@ void QQuickTumblerAttachedPrivate::calculateDisplacement()
         return;
     }
 
-    // The attached property gets created before our count is updated, so just cheat here
-    // to avoid having to listen to count changes.
-    const int count = tumblerPrivate->view->property("count").toInt();
+    const int count = parameters.count;
     // This can happen in tests, so it may happen in normal usage too.
     if (count == 0) {
         emitIfDisplacementChanged(previousDisplacement, displacement);
@@ -855,7 +928,7 @@ void QQuickTumblerAttachedPrivate::calculateDisplacement()
 
         displacement = count > 1 ? count - index - offset : 0;
         // Don't add 1 if count <= visibleItemCount
-        const int visibleItems = tumbler->visibleItemCount();
+        const int visibleItems = parameters.visibleItemCount;
         const int halfVisibleItems = visibleItems / 2 + (visibleItems < count ? 1 : 0);
         if (displacement > halfVisibleItems)
             displacement -= count;
@@ -863,10 +936,8 @@ void QQuickTumblerAttachedPrivate::calculateDisplacement()
             displacement += count;
     } else {
         const qreal contentY = tumblerPrivate->viewContentY;
-        const qreal delegateH = delegateHeight(tumbler);
-        const qreal preferredHighlightBegin = tumblerPrivate->view->property("preferredHighlightBegin").toReal();
         // Tumbler's displacement goes from negative at the top to positive towards the bottom, so we must switch this around.
-        const qreal reverseDisplacement = (contentY + preferredHighlightBegin) / delegateH;
+        const qreal reverseDisplacement = (contentY + parameters.preferredHighlightBegin) / parameters.delegateHeight;
         displacement = reverseDisplacement - index;
     }
 
@@ -54,6 +54,9 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickListView;
+class QQuickPathView;
+
 class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickTumblerPrivate : public QQuickControlPrivate, public QQuickItemChangeListener
 {
     Q_DECLARE_PUBLIC(QQuickTumbler)
@@ -69,6 +72,7 @@ public:
     QQuickItem *determineViewType(QQuickItem *contentItem);
     void resetViewData();
     QList<QQuickItem *> viewContentItemChildItems() const;
+    int viewCount() const;
 
     static QQuickTumblerPrivate *get(QQuickTumbler *tumbler);
 
@@ -80,6 +84,9 @@ public:
     bool modelBeingSet = false;
     bool currentIndexSetDuringModelChange = false;
     QQuickItem *view = nullptr;
+    // the typed view, resolved once in determineViewType(), for the hot paths
+    QQuickPathView *pathView = nullptr;
+    QQuickListView *listView = nullptr;
     QQuickItem *viewContentItem = nullptr;
     ContentItemType viewContentItemType = UnsupportedContentItemType;
     union {
@@ -91,6 +98,7 @@ public:
     bool ignoreCurrentIndexChanges = false;
     int count = 0;
     bool ignoreSignals = false;
+    QQmlAttachedPropertiesFunc attachedPropertiesFunc = nullptr;
 
     void _q_updateItemHeights();
     void _q_updateItemWidths();
@@ -99,6 +107,14 @@ public:
     void _q_onViewOffsetChanged();
     void _q_onViewContentYChanged();
 
+    struct DisplacementParameters {
+        int count = 0;
+        int visibleItemCount = 0;
+        qreal delegateHeight = 0;
+        qreal preferredHighlightBegin = 0;
+    };
+
+    DisplacementParameters displacementParameters() const;
     void calculateDisplacements();
 
     void disconnectFromView();
@@ -136,6 +152,7 @@ public:
     void init(QQuickItem *delegateItem);
 
     void calculateDisplacement();
+    void calculateDisplacement(const QQuickTumblerPrivate::DisplacementParameters &parameters);
     void emitIfDisplacementChanged(qreal oldDisplacement, qreal newDisplacement);
 
     // The Tumbler that contains the delegate. Required to calculated the displacement.
@@ -47,8 +47,9 @@ QT_BEGIN_NAMESPACE
 
     // ...
 
-    velocityCalcular.startMeasuring(event->pos(), event->timestamp());
-    velocityCalcular.stopMeasuring(event->pos(), event->timestamp());
+    velocityCalculator.startMeasuring(event->pos(), event->timestamp());  // press
+    velocityCalculator.updateMeasuring(event->pos(), event->timestamp()); // move
+    velocityCalculator.stopMeasuring(event->pos(), event->timestamp());   // release
 
     // ...
 
@@ -58,45 +59,90 @@ QT_BEGIN_NAMESPACE
         doSomethingElse();
 */
 
+// Only the samples within this many milliseconds of the last one are
+// used for estimating the velocity at the end of the gesture.
+static const qint64 VelocityWindow = 100;
+
 void QQuickVelocityCalculator::startMeasuring(const QPointF &point1, qint64 timestamp)
 {
-    m_point1 = point1;
-
-    if (timestamp != 0)
-        m_point1Timestamp = timestamp;
-    else
+    reset();
+    if (timestamp == 0)
         m_timer.start();
+    addSample(point1, timestamp);
+}
+
+void QQuickVelocityCalculator::updateMeasuring(const QPointF &point, qint64 timestamp)
+{
+    if (m_sampleCount == 0)
+        return;
+
+    addSample(point, timestamp);
 }
 
 void QQuickVelocityCalculator::stopMeasuring(const QPointF &point2, qint64 timestamp)
 {
-    if (timestamp == 0 && !m_timer.isValid()) {
+    if (m_sampleCount == 0) {
         qWarning() << "QQuickVelocityCalculator: a call to stopMeasuring() must be preceded by a call to startMeasuring()";
         return;
     }
 
-    m_point2 = point2;
-    m_point2Timestamp = timestamp != 0 ? timestamp : m_timer.elapsed();
+    addSample(point2, timestamp);
     m_timer.invalidate();
 }
 
 void QQuickVelocityCalculator::reset()
 {
-    m_point1 = QPointF();
-    m_point2 = QPointF();
-    m_point1Timestamp = 0;
-    m_point2Timestamp = 0;
+    m_sampleCount = 0;
+    m_nextSample = 0;
     m_timer.invalidate();
 }
 
+/*
+    Returns the least-squares fit of the samples within VelocityWindow of the
+    most recent sample, using at least the two most recent samples. Fitting a
+    line through several samples smooths out the jitter of individual events.
+*/
 QPointF QQuickVelocityCalculator::velocity() const
 {
-    if ((m_point2Timestamp == 0 || m_point1Timestamp == m_point2Timestamp) && !m_timer.isValid())
+    if (m_sampleCount < 2)
+        return QPointF();
+
+    const Sample &last = m_samples[(m_nextSample + MaxSamples - 1) % MaxSamples];
+
+    int count = 0;
+    qreal sumT = 0, sumX = 0, sumY = 0, sumTT = 0, sumTX = 0, sumTY = 0;
+    for (int i = 1; i <= m_sampleCount; ++i) {
+        const Sample &sample = m_samples[(m_nextSample + MaxSamples - i) % MaxSamples];
+        const qint64 age = last.timestamp - sample.timestamp;
+        if (count >= 2 && age > VelocityWindow)
+            break;
+
+        // relative to the last sample to keep the sums small
+        const qreal t = -age / 1000.0;
+        const QPointF p = sample.point - last.point;
+        sumT += t;
+        sumX += p.x();
+        sumY += p.y();
+        sumTT += t * t;
+        sumTX += t * p.x();
+        sumTY += t * p.y();
+        ++count;
+    }
+
+    const qreal denominator = count * sumTT - sumT * sumT;
+    if (qFuzzyIsNull(denominator))
         return QPointF();
 
-    const qreal secondsElapsed = (m_point2Timestamp != 0 ? m_point2Timestamp - m_point1Timestamp : m_timer.elapsed()) / 1000.0;
-    const QPointF distance = m_point2 - m_point1;
-    return distance / secondsElapsed;
+    return QPointF(count * sumTX - sumT * sumX, count * sumTY - sumT * sumY) / denominator;
+}
+
+void QQuickVelocityCalculator::addSample(const QPointF &point, qint64 timestamp)
+{
+    Sample &sample = m_samples[m_nextSample];
+    sample.point = point;
+    sample.timestamp = timestamp != 0 ? timestamp : m_timer.elapsed();
+    m_nextSample = (m_nextSample + 1) % MaxSamples;
+    m_sampleCount = qMin(m_sampleCount + 1, int(MaxSamples));
 }
 
 QT_END_NAMESPACE
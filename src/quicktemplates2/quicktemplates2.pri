@@ -31,6 +31,8 @@ HEADERS += \
     $$PWD/qquickframe_p_p.h \
     $$PWD/qquickgroupbox_p.h \
     $$PWD/qquickicon_p.h \
+    $$PWD/qquickimplicitsizer_p_p.h \
+    $$PWD/qquickinheritancenode_p_p.h \
     $$PWD/qquickitemdelegate_p.h \
     $$PWD/qquickitemdelegate_p_p.h \
     $$PWD/qquicklabel_p.h \
@@ -58,7 +60,9 @@ HEADERS += \
     $$PWD/qquickpopupitem_p_p.h \
     $$PWD/qquickpopuppositioner_p_p.h \
     $$PWD/qquickpresshandler_p_p.h \
+    $$PWD/qquickpresstimer_p_p.h \
     $$PWD/qquickprogressbar_p.h \
+    $$PWD/qquickprogresssource_p.h \
     $$PWD/qquickradiobutton_p.h \
     $$PWD/qquickradiodelegate_p.h \
     $$PWD/qquickrangeslider_p.h \
@@ -86,6 +90,7 @@ HEADERS += \
     $$PWD/qquicktextarea_p_p.h \
     $$PWD/qquicktextfield_p.h \
     $$PWD/qquicktextfield_p_p.h \
+    $$PWD/qquicktimingspan_p_p.h \
     $$PWD/qquicktoolbar_p.h \
     $$PWD/qquicktoolbutton_p.h \
     $$PWD/qquicktoolseparator_p.h \
@@ -114,6 +119,8 @@ SOURCES += \
     $$PWD/qquickframe.cpp \
     $$PWD/qquickgroupbox.cpp \
     $$PWD/qquickicon.cpp \
+    $$PWD/qquickimplicitsizer.cpp \
+    $$PWD/qquickinheritancenode.cpp \
     $$PWD/qquickitemdelegate.cpp \
     $$PWD/qquicklabel.cpp \
     $$PWD/qquickmenu.cpp \
@@ -132,7 +139,9 @@ SOURCES += \
     $$PWD/qquickpopupitem.cpp \
     $$PWD/qquickpopuppositioner.cpp \
     $$PWD/qquickpresshandler.cpp \
+    $$PWD/qquickpresstimer.cpp \
     $$PWD/qquickprogressbar.cpp \
+    $$PWD/qquickprogresssource.cpp \
     $$PWD/qquickradiobutton.cpp \
     $$PWD/qquickradiodelegate.cpp \
     $$PWD/qquickrangeslider.cpp \
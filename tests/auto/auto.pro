@@ -12,6 +12,7 @@ SUBDIRS += \
     pressandhold \
     qquickapplicationwindow \
     qquickcolor \
+    qquickdial \
     qquickdrawer \
     qquickiconimage \
     qquickiconlabel \
@@ -21,11 +22,15 @@ SUBDIRS += \
     qquickmenu \
     qquickmenubar \
     qquickninepatchimage \
+    qquickplatformmenu \
     qquickpopup \
+    qquickprogressbar \
+    qquickstackview \
     qquickstyle \
     qquickstyleselector \
     qquickuniversalstyle \
     qquickuniversalstyleconf \
+    qquickvelocitycalculator \
     revisions \
     sanity \
     snippets
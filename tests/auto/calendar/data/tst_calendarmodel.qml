@@ -122,4 +122,55 @@ TestCase {
 
         inst.destroy()
     }
+
+    function test_days() {
+        var model = calendarModel.createObject(testCase, {mode: CalendarModel.Days, from: "2016-02-27", to: "2016-03-02"})
+        verify(model)
+
+        compare(model.mode, CalendarModel.Days)
+        compare(model.count, 5)
+        compare(model.indexOf(model.dateAt(2)), 2)
+        compare(model.monthAt(2), Calendar.February)
+        compare(model.monthAt(3), Calendar.March)
+        compare(model.yearAt(4), 2016)
+        compare(model.indexOf(new Date(2016, 2, 1)), 3)
+        compare(model.indexOf(new Date(2016, 2, 3)), -1)
+        compare(model.indexOf(new Date(2016, 1, 26)), -1)
+
+        model.to = "2026-02-26"
+        compare(model.count, 3653)
+
+        model.mode = CalendarModel.Months
+        compare(model.count, 121)
+
+        model.destroy()
+    }
+
+    SignalSpy {
+        id: resetSpy
+        signalName: "modelReset"
+    }
+
+    function test_sameCount() {
+        var inst = instantiator.createObject(testCase)
+        verify(inst)
+        compare(inst.count, 12)
+
+        // a single day is a single row in both modes
+        inst.model.from = new Date(2017, 5, 15)
+        inst.model.to = new Date(2017, 5, 15)
+        compare(inst.model.count, 1)
+
+        // the rows are reset anyway, because they represent something else
+        resetSpy.target = inst.model
+        resetSpy.clear()
+        inst.model.mode = CalendarModel.Days
+        compare(inst.model.count, 1)
+        compare(resetSpy.count, 1)
+        compare(inst.model.dateAt(0), new Date(2017, 5, 15))
+        compare(inst.objectAt(0).month, Calendar.June)
+        compare(inst.objectAt(0).year, 2017)
+
+        inst.destroy()
+    }
 }
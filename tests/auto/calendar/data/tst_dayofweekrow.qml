@@ -82,6 +82,27 @@ TestCase {
         control.destroy()
     }
 
+    function test_sharedModel() {
+        var control1 = component.createObject(testCase, {locale: Qt.locale("en_US")})
+        var control2 = component.createObject(testCase, {locale: Qt.locale("en_US")})
+        verify(control1)
+        verify(control2)
+
+        compare(control1.source, control2.source)
+
+        control2.locale = Qt.locale("fi_FI")
+        verify(control1.source !== control2.source)
+        compare(control1.contentItem.children[0].text, "Sun")
+        compare(control2.contentItem.children[0].text, "ma")
+
+        control1.locale = Qt.locale("fi_FI")
+        compare(control1.source, control2.source)
+        compare(control1.contentItem.children[0].text, "ma")
+
+        control1.destroy()
+        control2.destroy()
+    }
+
     function test_font() {
         var control = component.createObject(testCase)
 
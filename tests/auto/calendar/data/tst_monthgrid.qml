@@ -71,6 +71,7 @@ TestCase {
             delegate: Item {
                 readonly property date date: model.date
                 readonly property int day: model.day
+                readonly property string dayText: model.dayText
                 readonly property bool today: model.today
                 readonly property int weekNumber: model.weekNumber
                 readonly property int month: model.month
@@ -84,6 +85,17 @@ TestCase {
         SignalSpy { }
     }
 
+    Component {
+        id: attributesGrid
+        MonthGrid {
+            locale: Qt.locale("en_GB")
+            dateAttributes: DateAttributes { }
+            delegate: Item {
+                readonly property int attributes: model.attributes
+            }
+        }
+    }
+
     function test_locale() {
         var control = delegateGrid.createObject(testCase, {month: 0, year: 2013})
 
@@ -111,6 +123,7 @@ TestCase {
             compare(control.contentItem.children[i].date.getMonth(), cellDate.getUTCMonth())
             compare(control.contentItem.children[i].date.getDate(), cellDate.getUTCDate())
             compare(control.contentItem.children[i].day, cellDate.getUTCDate())
+            compare(control.contentItem.children[i].dayText, cellDate.getUTCDate().toString())
             compare(control.contentItem.children[i].today, cellDate === new Date())
             compare(control.contentItem.children[i].month, cellDate.getUTCMonth())
             compare(control.contentItem.children[i].year, cellDate.getUTCFullYear())
@@ -134,6 +147,7 @@ TestCase {
             compare(control.contentItem.children[j].date.getMonth(), cellDate.getUTCMonth())
             compare(control.contentItem.children[j].date.getDate(), cellDate.getUTCDate())
             compare(control.contentItem.children[j].day, cellDate.getUTCDate())
+            compare(control.contentItem.children[j].dayText, cellDate.getUTCDate().toString())
             compare(control.contentItem.children[j].today, cellDate === new Date())
             compare(control.contentItem.children[j].month, cellDate.getUTCMonth())
             compare(control.contentItem.children[j].year, cellDate.getUTCFullYear())
@@ -280,4 +294,31 @@ TestCase {
             compare(clickedSpy.count, i + 1)
         }
     }
+
+    function test_dateAttributes() {
+        var control = createTemporaryObject(attributesGrid, testCase, {month: 0, year: 2013})
+        verify(control)
+        verify(control.dateAttributes)
+
+        // The first cell is 2012-12-31
+        control.dateAttributes.mark(new Date(2013, 0, 1), new Date(2013, 0, 3), 1)
+        control.dateAttributes.mark(new Date(2013, 0, 2), new Date(2013, 0, 5), 2)
+
+        var expected = [0, 1, 3, 3, 2, 2, 0]
+        for (var i = 0; i < expected.length; ++i)
+            compare(control.contentItem.children[i].attributes, expected[i])
+        compare(control.dateAttributes.attributesAt(new Date(2013, 0, 2)), 3)
+
+        // February 2013 starts from 2013-01-28
+        control.dateAttributes.mark(new Date(2013, 1, 14), new Date(2013, 1, 14), 4)
+        control.month = 1
+        compare(control.contentItem.children[0].attributes, 0)
+        compare(control.contentItem.children[17].attributes, 4)
+
+        control.dateAttributes.clear()
+        compare(control.contentItem.children[17].attributes, 0)
+
+        control.dateAttributes = null
+        compare(control.dateAttributes, null)
+    }
 }
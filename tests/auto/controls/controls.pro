@@ -4,4 +4,5 @@ SUBDIRS += \
     fusion \
     imagine \
     material \
+    native \
     universal
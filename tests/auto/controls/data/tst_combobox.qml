@@ -334,6 +334,82 @@ TestCase {
         compare(control.find(data.term, data.flags), data.index)
     }
 
+    ListModel {
+        id: findModel
+    }
+
+    function test_find_updates() {
+        findModel.clear()
+        findModel.append({ name: "banana", color: "yellow" })
+        findModel.append({ name: "Banana", color: "green" })
+        findModel.append({ name: "apple", color: "red" })
+
+        var control = createTemporaryObject(comboBox, testCase, {model: findModel, textRole: "name"})
+        verify(control)
+
+        // the first of the case insensitive prefix matches in model order
+        compare(control.find("BAN", Qt.MatchStartsWith), 0)
+        compare(control.find("Ban", Qt.MatchStartsWith | Qt.MatchCaseSensitive), 1)
+        compare(control.find("app", Qt.MatchStartsWith), 2)
+        compare(control.find("", Qt.MatchStartsWith), 0)
+
+        // the texts are looked up again when the model data changes
+        findModel.setProperty(0, "name", "cherry")
+        compare(control.find("ban", Qt.MatchStartsWith), 1)
+        compare(control.find("cherry"), 0)
+
+        findModel.append({ name: "Blueberry", color: "blue" })
+        compare(control.find("blue", Qt.MatchStartsWith), 3)
+
+        findModel.remove(1)
+        compare(control.find("ban", Qt.MatchStartsWith), -1)
+        compare(control.find("blue", Qt.MatchStartsWith), 2)
+
+        // ...and when the text role changes
+        control.textRole = "color"
+        compare(control.find("blueberry"), -1)
+        compare(control.find("blue"), 2)
+        compare(control.find("re", Qt.MatchStartsWith), 1)
+
+        // ...or the model is replaced
+        control.model = ["Coconut", "Coco"]
+        compare(control.find("blue"), -1)
+        compare(control.find("coco", Qt.MatchStartsWith), 0)
+    }
+
+
+    Component {
+        id: countingBox
+        ComboBox {
+            property int created: 0
+            delegate: ItemDelegate {
+                text: modelData
+                Component.onCompleted: ++created
+            }
+        }
+    }
+
+    function test_lazyDelegates() {
+        var control = createTemporaryObject(countingBox, testCase, {model: ["Banana", "Apple", "Coconut"]})
+        verify(control)
+
+        compare(control.currentText, "Banana")
+        compare(control.textAt(2), "Coconut")
+        compare(control.find("Apple"), 1)
+
+        control.forceActiveFocus()
+        verify(control.activeFocus)
+        keyPress(Qt.Key_C)
+        compare(control.currentIndex, 2)
+        compare(control.currentText, "Coconut")
+
+        // the delegates are not needed until the popup is opened
+        compare(control.created, 0)
+
+        control.popup.open()
+        tryCompare(control.popup, "visible", true)
+        tryCompare(control, "created", 3)
+    }
 
     function test_arrowKeys() {
         var control = createTemporaryObject(comboBox, testCase, {model: 3})
@@ -1195,6 +1271,41 @@ TestCase {
         compare(control.currentText, "Second")
     }
 
+    ListModel {
+        id: growingmodel
+        ListElement { text: "First" }
+        ListElement { text: "Second" }
+    }
+
+    function test_currentTextOnInsert() {
+        var control = createTemporaryObject(comboBox, testCase, {model: growingmodel, currentIndex: 1})
+        verify(control)
+        compare(control.currentText, "Second")
+
+        var currentTextSpy = signalSpy.createObject(control, {target: control, signalName: "currentTextChanged"})
+        verify(currentTextSpy.valid)
+
+        // rows after the current index do not affect the current text
+        growingmodel.append({text: "Third"})
+        growingmodel.append({text: "Fourth"})
+        compare(control.currentText, "Second")
+        compare(currentTextSpy.count, 0)
+
+        // rows before the current index do
+        growingmodel.insert(0, {text: "Zeroth"})
+        compare(control.currentIndex, 1)
+        compare(control.currentText, "First")
+        compare(currentTextSpy.count, 1)
+
+        growingmodel.setProperty(1, "text", "1st")
+        compare(control.currentText, "1st")
+        compare(currentTextSpy.count, 2)
+
+        growingmodel.setProperty(3, "text", "3rd")
+        compare(control.currentText, "1st")
+        compare(currentTextSpy.count, 2)
+    }
+
     // QTBUG-55030
     function test_highlightRange() {
         var control = createTemporaryObject(comboBox, testCase, {model: 100})
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.5
 import QtQuick.Templates 2.2 as T
 
 TestCase {
@@ -71,6 +71,11 @@ TestCase {
         Rectangle { }
     }
 
+    Component {
+        id: signalSpy
+        SignalSpy { }
+    }
+
     function test_implicitSize() {
         var control = createTemporaryObject(container, testCase)
         verify(control)
@@ -219,4 +224,46 @@ TestCase {
         wait(1)
         verify(item3)
     }
+
+    function test_insertItems() {
+        var control = createTemporaryObject(container, testCase)
+        verify(control)
+
+        var countSpy = signalSpy.createObject(testCase, {target: control, signalName: "countChanged"})
+        verify(countSpy.valid)
+        var childrenSpy = signalSpy.createObject(testCase, {target: control, signalName: "contentChildrenChanged"})
+        verify(childrenSpy.valid)
+
+        var items = []
+        for (var i = 0; i < 5; ++i)
+            items.push(rectangle.createObject(control, {objectName: "item" + i}))
+        // the items were added one by one as children
+        compare(control.count, 5)
+        countSpy.clear()
+        childrenSpy.clear()
+
+        var more = []
+        for (var j = 0; j < 100; ++j)
+            more.push(rectangle.createObject(null, {objectName: "more" + j}))
+        more.push(null)
+        more.push(items[0]) // already in the container
+
+        control.insertItems(2, more)
+        compare(control.count, 105)
+        compare(countSpy.count, 1)
+        compare(childrenSpy.count, 1)
+        compare(control.currentIndex, 0)
+        compare(control.itemAt(0), items[0])
+        compare(control.itemAt(1), items[1])
+        compare(control.itemAt(2).objectName, "more0")
+        compare(control.itemAt(101).objectName, "more99")
+        compare(control.itemAt(102), items[2])
+        compare(control.itemAt(104), items[4])
+
+        // out of range inserts are appended
+        control.insertItems(-1, [rectangle.createObject(null, {objectName: "last"})])
+        compare(control.count, 106)
+        compare(control.itemAt(105).objectName, "last")
+        compare(countSpy.count, 2)
+    }
 }
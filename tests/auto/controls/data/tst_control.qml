@@ -50,8 +50,9 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
-import QtQuick.Templates 2.2 as T
+import QtQuick.Controls 2.5
+import QtQuick.Controls.impl 2.5
+import QtQuick.Templates 2.5 as T
 
 TestCase {
     id: testCase
@@ -936,4 +937,140 @@ TestCase {
         compare(control.implicitWidth, 210)
         compare(control.implicitHeight, 220)
     }
+
+    Component {
+        id: templateImplicitSize
+        T.Control {
+            padding: 10
+            contentItem: Item { implicitWidth: 10; implicitHeight: 20 }
+            background: Rectangle { implicitWidth: 20; implicitHeight: 30 }
+        }
+    }
+
+    function test_templateImplicitSize() {
+        var control = createTemporaryObject(templateImplicitSize, testCase)
+        verify(control)
+
+        // a plain template does not calculate its implicit size
+        compare(control.implicitWidth, 0)
+        compare(control.implicitHeight, 0)
+
+        control.padding = 50
+        compare(control.implicitWidth, 0)
+        compare(control.implicitHeight, 0)
+
+        // the style types opt in
+        control.ImplicitSize.enabled = true
+        compare(control.implicitWidth, 110)
+        compare(control.implicitHeight, 120)
+
+        control.ImplicitSize.enabled = false
+        control.padding = 60
+        compare(control.implicitWidth, 110)
+        compare(control.implicitHeight, 120)
+    }
+
+    Component {
+        id: explicitImplicitSize
+        T.Control {
+            ImplicitSize.enabled: true
+            implicitWidth: 123
+            background: Rectangle { implicitWidth: 20; implicitHeight: 30 }
+        }
+    }
+
+    function test_explicitImplicitSize() {
+        var control = createTemporaryObject(explicitImplicitSize, testCase)
+        verify(control)
+
+        // the assigned implicit width is kept, the implicit height is calculated
+        compare(control.implicitWidth, 123)
+        compare(control.implicitHeight, 30)
+
+        control.padding = 50
+        compare(control.implicitWidth, 123)
+        compare(control.implicitHeight, 100)
+
+        // an assignment from outside turns off the calculation
+        control.implicitHeight = 45
+        control.padding = 60
+        compare(control.implicitWidth, 123)
+        compare(control.implicitHeight, 45)
+    }
+
+    Component {
+        id: zeroImplicitSize
+        T.Control {
+            ImplicitSize.enabled: true
+            implicitWidth: 0
+            padding: 10
+            background: Rectangle { implicitWidth: 20; implicitHeight: 30 }
+        }
+    }
+
+    function test_zeroImplicitSize() {
+        var control = createTemporaryObject(zeroImplicitSize, testCase)
+        verify(control)
+
+        // an explicit zero is kept like any other value
+        compare(control.implicitWidth, 0)
+        compare(control.implicitHeight, 30)
+
+        control.padding = 50
+        compare(control.implicitWidth, 0)
+        compare(control.implicitHeight, 100)
+
+        // assigning the current value from outside turns off the calculation
+        control.implicitHeight = 100
+        control.padding = 60
+        compare(control.implicitHeight, 100)
+    }
+
+    Component {
+        id: suspendedControls
+        Control {
+            property alias child: child
+            property alias grandChild: grandChild
+            Control {
+                id: child
+                Control {
+                    id: grandChild
+                }
+            }
+        }
+    }
+
+    function test_suspended() {
+        var control = createTemporaryObject(suspendedControls, testCase)
+        verify(control)
+        compare(control.child.suspended, false)
+
+        var child = control.child
+        var grandChild = control.grandChild
+
+        var suspendedSpy = signalSpy.createObject(child, {target: child, signalName: "suspendedChanged"})
+        verify(suspendedSpy.valid)
+        var fontSpy = signalSpy.createObject(grandChild, {target: grandChild, signalName: "fontChanged"})
+        verify(fontSpy.valid)
+
+        child.suspended = true
+        compare(child.suspended, true)
+        compare(suspendedSpy.count, 1)
+
+        var pixelSize = grandChild.font.pixelSize
+        control.font.pixelSize = pixelSize + 10
+        control.font.pixelSize = pixelSize + 20
+        control.locale = Qt.locale("ar_EG")
+        compare(child.font.pixelSize, pixelSize)
+        compare(grandChild.font.pixelSize, pixelSize)
+        compare(grandChild.locale.name, Qt.locale().name)
+        compare(fontSpy.count, 0)
+
+        child.suspended = false
+        compare(suspendedSpy.count, 2)
+        compare(child.font.pixelSize, pixelSize + 20)
+        compare(grandChild.font.pixelSize, pixelSize + 20)
+        compare(grandChild.locale.name, "ar_EG")
+        compare(fontSpy.count, 1)
+    }
 }
@@ -123,6 +123,24 @@ TestCase {
         compare(control.standardButton(DialogButtonBox.Cancel), null)
     }
 
+    function test_reuseStandardButtons() {
+        var control = createTemporaryObject(buttonBox, testCase, {standardButtons: DialogButtonBox.Ok})
+        verify(control)
+
+        var okButton = control.standardButton(DialogButtonBox.Ok)
+        verify(okButton)
+
+        control.standardButtons = DialogButtonBox.Ok | DialogButtonBox.Cancel
+        compare(control.count, 2)
+        compare(control.standardButton(DialogButtonBox.Ok), okButton)
+        verify(control.standardButton(DialogButtonBox.Cancel))
+
+        control.standardButtons = DialogButtonBox.Ok
+        compare(control.count, 1)
+        compare(control.standardButton(DialogButtonBox.Ok), okButton)
+        compare(control.standardButton(DialogButtonBox.Cancel), null)
+    }
+
     function test_attached() {
         var control = createTemporaryObject(buttonBox, testCase)
         verify(control)
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.3
 
 TestCase {
     id: testCase
@@ -139,4 +139,28 @@ TestCase {
         compare(control.background.width, control.width)
         compare(control.background.height, control.height)
     }
+
+    function test_palette() {
+        var control = createTemporaryObject(label, testCase)
+        verify(control)
+
+        // the default, Fusion and Imagine styles follow the palette
+        var followsColor = control.color.toString() === control.palette.windowText.toString()
+        var followsLinkColor = control.linkColor.toString() === control.palette.link.toString()
+
+        control.palette.windowText = "#ff0000"
+        control.palette.link = "#ff0000"
+        if (followsColor)
+            compare(control.color, "#ff0000")
+        if (followsLinkColor)
+            compare(control.linkColor, "#ff0000")
+
+        // explicit colors take precedence over the palette
+        control.color = "#00ff00"
+        control.linkColor = "#00ff00"
+        control.palette.windowText = "#0000ff"
+        control.palette.link = "#0000ff"
+        compare(control.color, "#00ff00")
+        compare(control.linkColor, "#00ff00")
+    }
 }
@@ -150,6 +150,31 @@ TestCase {
         }
     }
 
+    function test_pressDelegates_data() {
+        return [
+            { tag: "ltr", mirrored: false },
+            { tag: "rtl", mirrored: true }
+        ]
+    }
+
+    function test_pressDelegates(data) {
+        var control = createTemporaryObject(pageIndicator, testCase, {count: 10, interactive: true})
+        verify(control)
+        control.LayoutMirroring.enabled = data.mirrored
+        control.LayoutMirroring.childrenInherit = true
+        waitForRendering(control)
+
+        for (var i = 0; i < control.count; ++i) {
+            var child = control.contentItem.children[i]
+            verify(child)
+            control.currentIndex = -1
+            var pos = control.mapFromItem(child, child.width / 2, child.height / 2)
+            mousePress(control, pos.x, pos.y, Qt.LeftButton)
+            mouseRelease(control, pos.x, pos.y, Qt.LeftButton)
+            compare(control.currentIndex, i)
+        }
+    }
+
     function test_mouseArea_data() {
         return [
             { tag: "interactive", interactive: true },
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.5
 
 TestCase {
     id: testCase
@@ -141,6 +141,40 @@ TestCase {
         verify(control.implicitHeight > 0)
     }
 
+    function test_contentSize() {
+        var control = createTemporaryObject(oneChildPane, testCase)
+        verify(control)
+
+        var child = control.contentChildren[0]
+        verify(child)
+
+        child.implicitWidth = 200
+        compare(control.contentWidth, 200)
+        compare(control.implicitWidth, 200 + control.leftPadding + control.rightPadding)
+
+        child.implicitHeight = 60
+        compare(control.contentHeight, 60)
+        compare(control.implicitHeight, 60 + control.topPadding + control.bottomPadding)
+
+        control.contentWidth = 50
+        child.implicitWidth = 300
+        compare(control.contentWidth, 50)
+        compare(control.implicitWidth, 50 + control.leftPadding + control.rightPadding)
+
+        control.contentWidth = undefined
+        compare(control.contentWidth, 300)
+
+        // a second child makes the content size unknown
+        var item = Qt.createQmlObject("import QtQuick 2.11; Item { implicitWidth: 10; implicitHeight: 10 }", control.contentItem)
+        verify(item)
+        compare(control.contentWidth, 0)
+        compare(control.contentHeight, 0)
+
+        item.destroy()
+        tryCompare(control, "contentWidth", 300)
+        compare(control.contentHeight, 60)
+    }
+
     function test_contentItem() {
         var control = createTemporaryObject(contentPane, testCase)
         verify(control)
@@ -173,4 +207,44 @@ TestCase {
         mouseClick(control)
         compare(control.pressCount, 1)
     }
+
+    function test_staticSnapshot() {
+        var control = createTemporaryObject(oneChildPane, testCase, {width: 100, height: 100})
+        verify(control)
+
+        compare(control.staticSnapshot, false)
+        compare(control.layer.enabled, false)
+
+        control.staticSnapshot = true
+        compare(control.layer.enabled, true)
+
+        control.forceActiveFocus()
+        verify(control.activeFocus)
+        compare(control.layer.enabled, false)
+
+        control.focus = false
+        verify(!control.activeFocus)
+        compare(control.layer.enabled, true)
+
+        control.staticSnapshot = false
+        compare(control.layer.enabled, false)
+
+        // an explicitly enabled layer is left alone
+        control.layer.enabled = true
+        control.staticSnapshot = true
+        control.forceActiveFocus()
+        compare(control.layer.enabled, true)
+
+        control.staticSnapshot = false
+        control.layer.enabled = false
+        control.focus = false
+        control.staticSnapshot = true
+        compare(control.layer.enabled, true)
+
+        // a snapshot layer that is turned off and back on from outside is no longer the snapshot
+        control.layer.enabled = false
+        control.layer.enabled = true
+        control.forceActiveFocus()
+        compare(control.layer.enabled, true)
+    }
 }
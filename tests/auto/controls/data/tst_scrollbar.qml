@@ -703,6 +703,77 @@ TestCase {
         verify(control.state === "active" || control.contentItem.state === "active")
     }
 
+    Component {
+        id: fittingFlickable
+        Flickable {
+            id: fitting
+            width: 100
+            height: 100
+            contentWidth: 100
+            contentHeight: 100
+            property int created: 0
+            ScrollBar.vertical: ScrollBar {
+                contentItem: Item { Component.onCompleted: ++fitting.created }
+            }
+        }
+    }
+
+    function test_deferredDelegates() {
+        var container = createTemporaryObject(fittingFlickable, testCase)
+        verify(container)
+
+        var vertical = container.ScrollBar.vertical
+        verify(vertical)
+        compare(vertical.size, 1.0)
+        compare(container.created, 0)
+
+        var contentItemSpy = signalSpy.createObject(vertical, {target: vertical, signalName: "contentItemChanged"})
+        verify(contentItemSpy.valid)
+
+        container.contentHeight = 200
+        compare(vertical.size, 0.5)
+        compare(container.created, 1)
+        verify(vertical.contentItem)
+        compare(contentItemSpy.count, 1)
+    }
+
+    Component {
+        id: fittingStyledFlickable
+        Flickable {
+            width: 100
+            height: 100
+            contentWidth: 100
+            contentHeight: 100
+            ScrollBar.vertical: ScrollBar { }
+        }
+    }
+
+    function test_deferredStyleDelegates() {
+        var container = createTemporaryObject(fittingStyledFlickable, testCase)
+        verify(container)
+
+        var vertical = container.ScrollBar.vertical
+        verify(vertical)
+        compare(vertical.size, 1.0)
+
+        container.contentHeight = 200
+        compare(vertical.size, 0.5)
+
+        // the delegates of the style are complete, whether or not they were deferred
+        verify(vertical.contentItem)
+        compare(vertical.contentItem.parent, vertical)
+        verify(vertical.implicitWidth > 0)
+        verify(vertical.implicitHeight > 0)
+
+        vertical.active = true
+        verify(vertical.state === "active" || vertical.contentItem.state === "active")
+
+        vertical.active = false
+        container.contentHeight = 100
+        compare(vertical.size, 1.0)
+        verify(vertical.state !== "active" && vertical.contentItem.state !== "active")
+    }
+
     function test_overshoot() {
         var container = createTemporaryObject(flickable, testCase)
         verify(container)
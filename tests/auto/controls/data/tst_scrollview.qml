@@ -312,6 +312,56 @@ TestCase {
         touch.release(0, control, control.width / 2, 0).commit()
     }
 
+    function test_touchThenMouse() {
+        var control = createTemporaryObject(scrollView, testCase, {width: 200, height: 200, contentHeight: 400})
+        verify(control)
+
+        var vertical = control.ScrollBar.vertical
+        verify(vertical)
+
+        var touch = touchEvent(control)
+        touch.press(0, control, control.width / 2, control.height / 2).commit()
+        compare(vertical.interactive, false)
+        touch.release(0, control, control.width / 2, control.height / 2).commit()
+        compare(vertical.interactive, false)
+
+        mousePress(control, control.width / 2, control.height / 2, Qt.LeftButton)
+        compare(vertical.interactive, true)
+        mouseRelease(control, control.width / 2, control.height / 2, Qt.LeftButton)
+        compare(vertical.interactive, true)
+    }
+
+    Component {
+        id: scrollBar
+        ScrollBar { }
+    }
+
+    function test_touchThenAttach() {
+        var control = createTemporaryObject(scrollView, testCase, {width: 200, height: 200, contentHeight: 400})
+        verify(control)
+
+        var touch = touchEvent(control)
+        touch.press(0, control, control.width / 2, control.height / 2).commit()
+        compare(control.ScrollBar.vertical.interactive, false)
+        touch.release(0, control, control.width / 2, control.height / 2).commit()
+
+        // a scroll bar attached after the touch follows the touch input
+        var vertical = createTemporaryObject(scrollBar, control)
+        verify(vertical)
+        compare(vertical.interactive, true)
+        control.ScrollBar.vertical = vertical
+        compare(vertical.interactive, false)
+
+        // hovering a scroll bar after the touch has ended does not flip it back
+        vertical.hoverEnabled = true
+        mouseMove(vertical, vertical.width / 2, vertical.height / 2)
+        compare(vertical.interactive, false)
+
+        mousePress(control, control.width / 2, control.height / 2, Qt.LeftButton)
+        compare(vertical.interactive, true)
+        mouseRelease(control, control.width / 2, control.height / 2, Qt.LeftButton)
+    }
+
     function test_keys() {
         var control = createTemporaryObject(scrollView, testCase, {width: 200, height: 200, contentWidth: 400, contentHeight: 400})
         verify(control)
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.5
 
 TestCase {
     id: testCase
@@ -1231,6 +1231,104 @@ TestCase {
         verify(!ma.pressed)
     }
 
+    function test_cacheSize() {
+        var control = createTemporaryObject(stackView, testCase)
+        verify(control)
+        compare(control.cacheSize, 0)
+
+        // without a cache, a new instance is created every time
+        var item1 = control.push(component, StackView.Immediate)
+        verify(item1)
+        control.push(component, StackView.Immediate)
+        control.pop(StackView.Immediate)
+        var item2 = control.push(component, StackView.Immediate)
+        verify(item2)
+        verify(item2 !== item1)
+        control.clear()
+
+        control.cacheSize = 2
+        compare(control.cacheSize, 2)
+
+        var page = control.push(component, StackView.Immediate)
+        var cached = control.push(component, StackView.Immediate)
+        verify(cached !== page)
+        control.pop(StackView.Immediate)
+        compare(control.depth, 1)
+        compare(cached.parent, null)
+
+        // pushing the same component reuses the popped instance
+        var reused = control.push(component, {objectName: "reused"}, StackView.Immediate)
+        compare(reused, cached)
+        compare(reused.parent, control)
+        compare(reused.objectName, "reused")
+        compare(reused.StackView.index, 1)
+        compare(reused.StackView.status, StackView.Active)
+
+        // a different component is not served from the cache
+        control.pop(StackView.Immediate)
+        var field = control.push(textField, StackView.Immediate)
+        verify(field !== cached)
+        control.clear()
+        compare(control.depth, 0)
+
+        // shrinking the cache destroys the least recently kept items
+        control.cacheSize = 0
+        verify(control.push(component, StackView.Immediate) !== cached)
+    }
+
+    function test_releaseHiddenItems() {
+        var control = createTemporaryObject(stackView, testCase, {releaseHiddenItems: true})
+        verify(control)
+        compare(control.releaseHiddenItems, true)
+
+        var item1 = control.push(component, StackView.Immediate)
+        var item2 = control.push(component, StackView.Immediate)
+        var item3 = control.push(component, StackView.Immediate)
+        compare(control.depth, 3)
+
+        // hidden items stay in the view and in the stack
+        compare(item1.parent, control)
+        compare(item2.parent, control)
+        compare(item3.parent, control)
+        compare(item1.visible, false)
+        compare(item2.visible, false)
+        compare(item1.StackView.index, 0)
+        compare(item1.StackView.view, control)
+        compare(item1.StackView.status, StackView.Inactive)
+        compare(control.get(0), item1)
+
+        control.pop(StackView.Immediate)
+        compare(item2.parent, control)
+        compare(item2.visible, true)
+        compare(item2.StackView.status, StackView.Active)
+
+        control.releaseHiddenItems = false
+        compare(item1.parent, control)
+        compare(item1.visible, false)
+
+        control.releaseHiddenItems = true
+        control.pop(StackView.Immediate)
+        compare(item1.parent, control)
+        compare(item1.visible, true)
+        compare(control.currentItem, item1)
+    }
+
+    function test_preload() {
+        var control = createTemporaryObject(stackView, testCase, {cacheSize: 1})
+        verify(control)
+
+        control.preload("TestItem.qml")
+        control.preload("TestItem.qml", StackView.ForceLoad)
+
+        var item = control.push("TestItem.qml", {objectName: "preloaded"}, StackView.Immediate)
+        verify(item)
+        compare(item.objectName, "preloaded")
+        compare(item.parent, control)
+        compare(item.StackView.index, 0)
+        compare(control.depth, 1)
+        compare(control.currentItem, item)
+    }
+
     // Separate function to ensure that the temporary value created to hold the return value of the Qt.createComponent()
     // call is out of scope when the caller calls gc().
     function stackViewFactory()
@@ -296,6 +296,37 @@ TestCase {
         compare(control.swipe.behindItem, oldBehindItem);
     }
 
+    property int destroyedSwipeItems: 0
+
+    Component {
+        id: swappedItemComponent
+
+        Item {
+            // resolved from the control, which is the context object
+            property string controlText: text
+            Component.onDestruction: ++testCase.destroyedSwipeItems
+        }
+    }
+
+    function test_swapDelegates() {
+        var control = createTemporaryObject(swipeDelegateComponent, testCase);
+        verify(control);
+
+        destroyedSwipeItems = 0;
+        for (var i = 0; i < 10; ++i) {
+            control.swipe.left = swappedItemComponent;
+            swipe(control, 0.0, 1.0);
+            compare(control.swipe.leftItem.controlText, "SwipeDelegate");
+
+            swipe(control, 1.0, 0.0);
+            tryCompare(control.background, "x", 0, 1000);
+
+            control.swipe.left = null;
+            compare(control.swipe.leftItem, null);
+            compare(destroyedSwipeItems, i + 1);
+        }
+    }
+
     function test_defaults() {
         var control = createTemporaryObject(swipeDelegateComponent, testCase);
         verify(control);
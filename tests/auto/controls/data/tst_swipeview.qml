@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.5
 
 TestCase {
     id: testCase
@@ -557,4 +557,76 @@ TestCase {
             compare(control.itemAt(i).x, 0)
         }
     }
+
+    Component {
+        id: lazyView
+        SwipeView {
+            cacheBuffer: 1
+            Text { text: "0" }
+            Component { Text { text: "1" } }
+            Component { Text { text: "2" } }
+            Component { Text { text: "3" } }
+        }
+    }
+
+    function test_cacheBuffer() {
+        var control = createTemporaryObject(lazyView, testCase, {width: 200, height: 200})
+        verify(control)
+        compare(control.cacheBuffer, 1)
+
+        // components become pages in the order they were declared
+        compare(control.count, 4)
+        compare(control.currentIndex, 0)
+        compare(control.itemAt(0).text, "0")
+
+        // the next page is incubated, the last one is out of the buffer
+        tryCompare(control.itemAt(1).children, "length", 1)
+        compare(control.itemAt(1).children[0].text, "1")
+        compare(control.itemAt(1).children[0].width, control.width)
+        compare(control.itemAt(3).children.length, 0)
+
+        // the current page is created immediately
+        control.currentIndex = 3
+        compare(control.itemAt(3).children.length, 1)
+        compare(control.itemAt(3).children[0].text, "3")
+        tryCompare(control.itemAt(1).children, "length", 0)
+
+        // disabling the buffer instantiates all pages
+        control.cacheBuffer = -1
+        tryCompare(control.itemAt(1).children, "length", 1)
+        tryCompare(control.itemAt(2).children, "length", 1)
+        compare(control.count, 4)
+    }
+
+    function test_hideDistantPages() {
+        var control = createTemporaryObject(swipeView, testCase, {width: 200, height: 200})
+        verify(control)
+        compare(control.hideDistantPages, false)
+
+        for (var i = 0; i < 5; ++i)
+            control.addItem(page.createObject(control, {text: i}))
+        compare(control.count, 5)
+        compare(control.currentIndex, 0)
+
+        control.itemAt(4).visible = false
+
+        control.hideDistantPages = true
+        compare(control.itemAt(0).visible, true)
+        compare(control.itemAt(1).visible, true)
+        compare(control.itemAt(2).visible, false)
+        compare(control.itemAt(3).visible, false)
+        compare(control.itemAt(4).visible, false)
+
+        control.currentIndex = 2
+        compare(control.itemAt(0).visible, false)
+        compare(control.itemAt(1).visible, true)
+        compare(control.itemAt(2).visible, true)
+        compare(control.itemAt(3).visible, true)
+        // explicitly hidden pages stay hidden
+        compare(control.itemAt(4).visible, false)
+
+        control.hideDistantPages = false
+        compare(control.itemAt(0).visible, true)
+        compare(control.itemAt(4).visible, false)
+    }
 }
@@ -259,6 +259,30 @@ TestCase {
         tryCompare(control, "opacity", 1)
     }
 
+    function test_showSameText() {
+        var item = createTemporaryObject(mouseArea, testCase)
+        verify(item)
+
+        var sharedTip = ToolTip.toolTip
+        item.ToolTip.show("Same")
+        verify(sharedTip.visible)
+        compare(sharedTip.text, "Same")
+
+        // showing the same text again must not reset the geometry
+        sharedTip.width = 123
+        item.ToolTip.show("Same")
+        verify(sharedTip.visible)
+        compare(sharedTip.width, 123)
+
+        // different text resets the geometry
+        item.ToolTip.show("Different")
+        verify(sharedTip.visible)
+        compare(sharedTip.text, "Different")
+        verify(sharedTip.width !== 123)
+
+        item.ToolTip.hide()
+    }
+
     Component {
         id: buttonAndShortcutComponent
 
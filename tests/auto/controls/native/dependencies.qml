@@ -0,0 +1,5 @@
+import QtTest 1.0
+import QtQuick 2.6
+import QtQuick.Controls 2.2
+
+TestCase { }
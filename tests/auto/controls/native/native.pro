@@ -0,0 +1,14 @@
+TEMPLATE = app
+TARGET = tst_native
+CONFIG += qmltestcase
+
+DEFINES += TST_CONTROLS_DATA=\\\"$$QQC2_SOURCE_TREE/tests/auto/controls/data\\\"
+
+SOURCES += \
+    $$PWD/tst_native.cpp
+
+OTHER_FILES += \
+    $$PWD/../data/*.qml
+
+TESTDATA += \
+    $$PWD/../data/tst_*
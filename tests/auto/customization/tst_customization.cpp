@@ -39,6 +39,8 @@
 #include <QtCore/qregularexpression.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlincubator.h>
+#include <QtQml/private/qqmlengine_p.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickwindow.h>
 #include <QtQuickControls2/qquickstyle.h>
@@ -125,6 +127,8 @@ private slots:
 
     void comboPopup();
 
+    void destroyDeferred();
+
 private:
     void reset();
     void addHooks();
@@ -505,6 +509,53 @@ void tst_customization::comboPopup()
     }
 }
 
+class InterruptingIncubator : public QQmlIncubator
+{
+public:
+    InterruptingIncubator(bool *incubate) : m_incubate(incubate) { }
+
+protected:
+    void setInitialState(QObject *object) override
+    {
+        // begin the deferred execution of the background, and stop the
+        // incubation before the control is completed
+        object->property("background");
+        *m_incubate = false;
+    }
+
+private:
+    bool *m_incubate;
+};
+
+void tst_customization::destroyDeferred()
+{
+    QQuickStyle::setStyle(testFile("styles/simple"));
+
+    QQmlIncubationController controller;
+    engine->setIncubationController(&controller);
+
+    const int inProgressCreations = QQmlEnginePrivate::get(engine)->inProgressCreations;
+
+    bool incubate = true;
+    InterruptingIncubator incubator(&incubate);
+
+    QQmlComponent component(engine);
+    component.setData("import QtQuick.Controls 2.2; Control { }", QUrl());
+    component.create(incubator);
+    controller.incubateWhile(&incubate);
+
+    QCOMPARE(incubator.status(), QQmlIncubator::Loading);
+    QVERIFY(qt_createdQObjects()->contains("control-background-simple"));
+
+    // destroy the control while the deferred execution is still pending
+    incubator.clear();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    QVERIFY(qt_destroyedQObjects()->contains("control-simple"));
+    QVERIFY(qt_destroyedQObjects()->contains("control-background-simple"));
+    QCOMPARE(QQmlEnginePrivate::get(engine)->inProgressCreations, inProgressCreations);
+}
+
 QTEST_MAIN(tst_customization)
 
 #include "tst_customization.moc"
@@ -61,6 +61,7 @@ private slots:
 
     void inheritance_data();
     void inheritance();
+    void reparent();
 
     void defaultFont_data();
     void defaultFont();
@@ -217,6 +218,58 @@ void tst_font::inheritance()
     QCOMPARE(grandChild->property("font").value<QFont>(), windowFont);
 }
 
+void tst_font::reparent()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.loadUrl(testFileUrl("inheritance-reparent.qml"));
+
+    QScopedPointer<QQuickApplicationWindow> window(qobject_cast<QQuickApplicationWindow *>(component.create()));
+    QVERIFY2(!window.isNull(), qPrintable(component.errorString()));
+
+    QQuickItem *control1 = window->property("control1").value<QQuickItem *>();
+    QQuickItem *control2 = window->property("control2").value<QQuickItem *>();
+    QQuickItem *container = window->property("container").value<QQuickItem *>();
+    QObject *label = window->property("label").value<QObject *>();
+    QVERIFY(control1 && control2 && container && label);
+
+    QFont font1;
+    font1.setPixelSize(30);
+    control1->setProperty("font", font1);
+    QCOMPARE(label->property("font").value<QFont>().pixelSize(), 30);
+
+    // move the intermediate item, and make sure the cached
+    // inheritance information of both controls gets updated
+    container->setParentItem(control2);
+
+    QFont font2;
+    font2.setPixelSize(40);
+    control2->setProperty("font", font2);
+    QCOMPARE(label->property("font").value<QFont>().pixelSize(), 40);
+
+    font1.setPixelSize(50);
+    control1->setProperty("font", font1);
+    QCOMPARE(label->property("font").value<QFont>().pixelSize(), 40);
+
+    // an explicitly requested attribute stops the propagation of that attribute
+    QFont labelFont;
+    labelFont.setPixelSize(20);
+    label->setProperty("font", labelFont);
+    font2.setPixelSize(45);
+    control2->setProperty("font", font2);
+    QCOMPARE(label->property("font").value<QFont>().pixelSize(), 20);
+
+    font2.setItalic(true);
+    control2->setProperty("font", font2);
+    QCOMPARE(label->property("font").value<QFont>().pixelSize(), 20);
+    QCOMPARE(label->property("font").value<QFont>().italic(), true);
+
+    delete container;
+    font2.setPixelSize(55);
+    control2->setProperty("font", font2);
+    QCOMPARE(control2->property("font").value<QFont>().pixelSize(), 55);
+}
+
 class TestFontTheme : public QQuickProxyTheme
 {
 public:
@@ -68,4 +68,13 @@ TestCase {
         verify(dialog)
         dialog.destroy()
     }
+
+    function test_preload() {
+        var dialog = fileDialog.createObject(testCase)
+        verify(dialog)
+        dialog.preload()
+        wait(0)
+        compare(dialog.visible, false)
+        dialog.destroy()
+    }
 }
@@ -160,13 +160,25 @@ TestCase {
         compare(item3.checked, false)
         compare(checkedItemSpy.count, 4)
 
+        // uncheck
+        item1.checked = false
+        compare(group.checkedItem, null)
+        compare(item1.checked, false)
+        compare(item2.checked, false)
+        compare(item3.checked, false)
+        compare(checkedItemSpy.count, 5)
+
+        item1.checked = true
+        compare(group.checkedItem, item1)
+        compare(checkedItemSpy.count, 6)
+
         // remove non-checked
         group.removeItem(item2)
         compare(group.checkedItem, item1)
         compare(item1.checked, true)
         compare(item2.checked, false)
         compare(item3.checked, false)
-        compare(checkedItemSpy.count, 4)
+        compare(checkedItemSpy.count, 6)
 
         // remove checked
         group.removeItem(item1)
@@ -174,7 +186,7 @@ TestCase {
         compare(item1.checked, false)
         compare(item2.checked, false)
         compare(item3.checked, false)
-        compare(checkedItemSpy.count, 5)
+        compare(checkedItemSpy.count, 7)
 
         group.destroy()
     }
@@ -85,4 +85,12 @@ TestCase {
         compare(StandardPaths.LocateFile, 0)
         compare(StandardPaths.LocateDirectory, 1)
     }
+
+    function test_cachedLocations() {
+        var writable = StandardPaths.writableLocation(StandardPaths.TempLocation)
+        compare(StandardPaths.writableLocation(StandardPaths.TempLocation), writable)
+
+        var locations = StandardPaths.standardLocations(StandardPaths.TempLocation)
+        compare(StandardPaths.standardLocations(StandardPaths.TempLocation), locations)
+    }
 }
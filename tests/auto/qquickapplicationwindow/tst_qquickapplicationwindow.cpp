@@ -70,6 +70,9 @@ private slots:
     void attachedProperties();
     void font();
     void defaultFont();
+    void batchUpdate();
+    void batchUpdateSignals();
+    void batchUpdateScope();
     void locale();
     void activeFocusControl_data();
     void activeFocusControl();
@@ -584,6 +587,188 @@ void tst_QQuickApplicationWindow::defaultFont()
     QCOMPARE(window->font(), *theme.font());
 }
 
+void tst_QQuickApplicationWindow::batchUpdate()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.loadUrl(testFileUrl("font.qml"));
+    QScopedPointer<QQuickApplicationWindow> window(qobject_cast<QQuickApplicationWindow *>(component.create()));
+    QVERIFY(window);
+
+    QQuickControl *mainItem = window->property("mainItem").value<QQuickControl *>();
+    QVERIFY(mainItem);
+    QQuickControl *item3 = mainItem->property("item_3").value<QQuickControl *>();
+    QVERIFY(item3);
+    QQuickLabel *item6 = mainItem->property("item_6").value<QQuickLabel *>();
+    QVERIFY(item6);
+
+    QSignalSpy fontSpy(item3, SIGNAL(fontChanged()));
+    QSignalSpy paletteSpy(item3, SIGNAL(paletteChanged()));
+    QSignalSpy localeSpy(item3, SIGNAL(localeChanged()));
+    QVERIFY(fontSpy.isValid());
+    QVERIFY(paletteSpy.isValid());
+    QVERIFY(localeSpy.isValid());
+
+    const QFont oldFont = item3->font();
+
+    QFont font = window->font();
+    font.setPixelSize(font.pixelSize() > 0 ? font.pixelSize() + 5 : 20);
+    QPalette palette = window->palette();
+    palette.setColor(QPalette::Base, Qt::red);
+
+    window->beginUpdate();
+    window->beginUpdate();
+    window->setFont(font);
+    font.setItalic(true);
+    window->setFont(font);
+    window->setPalette(palette);
+    window->setLocale(QLocale("fi_FI"));
+    window->endUpdate();
+
+    // the window itself changes right away, the children only at the end
+    QCOMPARE(window->font(), font);
+    QCOMPARE(item3->font(), oldFont);
+    QCOMPARE(fontSpy.count(), 0);
+    QCOMPARE(paletteSpy.count(), 0);
+    QCOMPARE(localeSpy.count(), 0);
+
+    window->endUpdate();
+
+    QCOMPARE(mainItem->font(), font);
+    QCOMPARE(item3->font(), font);
+    QCOMPARE(item6->font(), font);
+    QCOMPARE(item3->palette().color(QPalette::Base), QColor(Qt::red));
+    QCOMPARE(item6->palette().color(QPalette::Base), QColor(Qt::red));
+    QCOMPARE(item3->locale().name(), QString("fi_FI"));
+    QCOMPARE(fontSpy.count(), 1);
+    QCOMPARE(paletteSpy.count(), 1);
+    QCOMPARE(localeSpy.count(), 1);
+
+    QTest::ignoreMessage(QtWarningMsg, qUtf8Printable(testFileUrl("font.qml").toString() + ":55:1: QML ApplicationWindow: endUpdate() called without a matching beginUpdate()"));
+    window->endUpdate();
+}
+
+void tst_QQuickApplicationWindow::batchUpdateSignals()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.loadUrl(testFileUrl("font.qml"));
+    QScopedPointer<QQuickApplicationWindow> window(qobject_cast<QQuickApplicationWindow *>(component.create()));
+    QVERIFY(window);
+
+    QQuickControl *mainItem = window->property("mainItem").value<QQuickControl *>();
+    QVERIFY(mainItem);
+    QQuickControl *item3 = mainItem->property("item_3").value<QQuickControl *>();
+    QVERIFY(item3);
+
+    QSignalSpy windowFontSpy(window.data(), SIGNAL(fontChanged()));
+    QSignalSpy windowPaletteSpy(window.data(), SIGNAL(paletteChanged()));
+    QSignalSpy windowLocaleSpy(window.data(), SIGNAL(localeChanged()));
+    QVERIFY(windowFontSpy.isValid());
+    QVERIFY(windowPaletteSpy.isValid());
+    QVERIFY(windowLocaleSpy.isValid());
+
+    QSignalSpy controlFontSpy(mainItem, SIGNAL(fontChanged()));
+    QSignalSpy controlPaletteSpy(mainItem, SIGNAL(paletteChanged()));
+    QSignalSpy controlLocaleSpy(mainItem, SIGNAL(localeChanged()));
+    QVERIFY(controlFontSpy.isValid());
+    QVERIFY(controlPaletteSpy.isValid());
+    QVERIFY(controlLocaleSpy.isValid());
+
+    QSignalSpy childFontSpy(item3, SIGNAL(fontChanged()));
+    QSignalSpy childPaletteSpy(item3, SIGNAL(paletteChanged()));
+    QSignalSpy childLocaleSpy(item3, SIGNAL(localeChanged()));
+    QVERIFY(childFontSpy.isValid());
+    QVERIFY(childPaletteSpy.isValid());
+    QVERIFY(childLocaleSpy.isValid());
+
+    QFont font = window->font();
+    font.setPixelSize(font.pixelSize() > 0 ? font.pixelSize() + 5 : 20);
+    QPalette palette = window->palette();
+    palette.setColor(QPalette::Base, Qt::red);
+
+    window->beginUpdate();
+    window->setFont(font);
+    font.setItalic(true);
+    window->setFont(font);
+    window->setPalette(palette);
+    palette.setColor(QPalette::Text, Qt::green);
+    window->setPalette(palette);
+    window->setLocale(QLocale("fi_FI"));
+    window->setLocale(QLocale("sv_SE"));
+
+    QFont controlFont = font;
+    controlFont.setBold(true);
+    mainItem->setFont(controlFont);
+    controlFont.setUnderline(true);
+    mainItem->setFont(controlFont);
+
+    // the values change right away, the signals are held back
+    QCOMPARE(window->font(), font);
+    QVERIFY(mainItem->font().underline());
+    QCOMPARE(windowFontSpy.count(), 0);
+    QCOMPARE(windowPaletteSpy.count(), 0);
+    QCOMPARE(windowLocaleSpy.count(), 0);
+    QCOMPARE(controlFontSpy.count(), 0);
+    QCOMPARE(controlPaletteSpy.count(), 0);
+    QCOMPARE(controlLocaleSpy.count(), 0);
+    QCOMPARE(childFontSpy.count(), 0);
+
+    window->endUpdate();
+
+    QCOMPARE(item3->font(), mainItem->font());
+    QCOMPARE(item3->palette().color(QPalette::Text), QColor(Qt::green));
+    QCOMPARE(item3->locale().name(), QString("sv_SE"));
+
+    // one signal per changed attribute, no matter how many times it was changed
+    QCOMPARE(windowFontSpy.count(), 1);
+    QCOMPARE(windowPaletteSpy.count(), 1);
+    QCOMPARE(windowLocaleSpy.count(), 1);
+    QCOMPARE(controlFontSpy.count(), 1);
+    QCOMPARE(controlPaletteSpy.count(), 1);
+    QCOMPARE(controlLocaleSpy.count(), 1);
+    QCOMPARE(childFontSpy.count(), 1);
+    QCOMPARE(childPaletteSpy.count(), 1);
+    QCOMPARE(childLocaleSpy.count(), 1);
+}
+
+void tst_QQuickApplicationWindow::batchUpdateScope()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.loadUrl(testFileUrl("font.qml"));
+    QScopedPointer<QQuickApplicationWindow> window1(qobject_cast<QQuickApplicationWindow *>(component.create()));
+    QVERIFY(window1);
+    QScopedPointer<QQuickApplicationWindow> window2(qobject_cast<QQuickApplicationWindow *>(component.create()));
+    QVERIFY(window2);
+
+    QQuickControl *mainItem1 = window1->property("mainItem").value<QQuickControl *>();
+    QVERIFY(mainItem1);
+    QQuickControl *mainItem2 = window2->property("mainItem").value<QQuickControl *>();
+    QVERIFY(mainItem2);
+
+    QFont font = window1->font();
+    font.setPixelSize(font.pixelSize() > 0 ? font.pixelSize() + 5 : 20);
+
+    // a batch in one window does not hold back the others
+    window1->beginUpdate();
+    window1->setFont(font);
+    window2->setFont(font);
+    QVERIFY(mainItem1->font() != font);
+    QCOMPARE(mainItem2->font(), font);
+    window1->endUpdate();
+    QCOMPARE(mainItem1->font(), font);
+
+    // destroying a window in the middle of a batch drops the recorded changes
+    font.setItalic(true);
+    window2->beginUpdate();
+    window2->setFont(font);
+    window2.reset();
+
+    window1->setFont(font);
+    QCOMPARE(mainItem1->font(), font);
+}
+
 void tst_QQuickApplicationWindow::locale()
 {
     QQmlEngine engine;
@@ -0,0 +1,111 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:BSD$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** BSD License Usage
+** Alternatively, you may use this file under the terms of the BSD license
+** as follows:
+**
+** "Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are
+** met:
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in
+**     the documentation and/or other materials provided with the
+**     distribution.
+**   * Neither the name of The Qt Company Ltd nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.11
+import QtTest 1.0
+import QtQuick.Controls 2.4
+import QtQuick.Controls.impl 2.5
+
+TestCase {
+    id: testCase
+    width: 200
+    height: 200
+    visible: true
+    when: windowShown
+    name: "StateColor"
+
+    Component {
+        id: component
+        Button {
+            id: control
+            property alias stateColor: stateColor
+            StateColor {
+                id: stateColor
+                control: control
+                normal: "#000000"
+                checked: "#ffffff"
+                down: "#0000ff"
+                downFactor: 0.5
+                focus: "#ff0000"
+                focusFactor: 1.0
+            }
+        }
+    }
+
+    function test_color() {
+        var control = createTemporaryObject(component, testCase)
+        verify(control)
+
+        var stateColor = control.stateColor
+        compare(stateColor.color, "#000000")
+
+        control.checkable = true
+        control.checked = true
+        compare(stateColor.color, "#ffffff")
+
+        control.checked = false
+        control.highlighted = true
+        compare(stateColor.color, "#ffffff")
+
+        control.highlighted = false
+        control.down = true
+        compare(stateColor.color, Qt.rgba(0, 0, 0.5, 1))
+
+        control.down = undefined
+        compare(stateColor.color, "#000000")
+
+        stateColor.normal = "#00ff00"
+        compare(stateColor.color, "#00ff00")
+
+        control.forceActiveFocus(Qt.TabFocusReason)
+        verify(control.visualFocus)
+        compare(stateColor.color, "#ff0000")
+    }
+}
@@ -0,0 +1,124 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/qtest.h>
+#include <QtTest/qsignalspy.h>
+#include "../shared/visualtestutil.h"
+
+#include <QtQuick/qquickwindow.h>
+#include <QtQuickTemplates2/private/qquickdial_p.h>
+
+class tst_QQuickDial : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void queueValue();
+    void queueValueWithoutWindow();
+    void setValueDropsQueuedValue();
+};
+
+void tst_QQuickDial::queueValue()
+{
+    QQuickWindow window;
+    window.resize(200, 200);
+
+    QQuickDial *dial = new QQuickDial(window.contentItem());
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QQUICK_VERIFY_POLISH(dial);
+
+    QSignalSpy valueSpy(dial, &QQuickDial::valueChanged);
+    QVERIFY(valueSpy.isValid());
+    QSignalSpy positionSpy(dial, &QQuickDial::positionChanged);
+    QVERIFY(positionSpy.isValid());
+    QSignalSpy angleSpy(dial, &QQuickDial::angleChanged);
+    QVERIFY(angleSpy.isValid());
+
+    // the values queued before the next frame are applied once
+    dial->queueValue(0.2);
+    dial->queueValue(0.4);
+    dial->queueValue(0.6);
+    QCOMPARE(dial->value(), qreal(0));
+    QCOMPARE(valueSpy.count(), 0);
+
+    QQUICK_VERIFY_POLISH(dial);
+    QCOMPARE(dial->value(), qreal(0.6));
+    QCOMPARE(dial->position(), qreal(0.6));
+    QCOMPARE(valueSpy.count(), 1);
+    QCOMPARE(positionSpy.count(), 1);
+    QCOMPARE(angleSpy.count(), 1);
+
+    // queued values are bound like any other value
+    dial->queueValue(2);
+    QQUICK_VERIFY_POLISH(dial);
+    QCOMPARE(dial->value(), qreal(1));
+    QCOMPARE(valueSpy.count(), 2);
+}
+
+void tst_QQuickDial::queueValueWithoutWindow()
+{
+    QQuickDial dial;
+    QSignalSpy valueSpy(&dial, &QQuickDial::valueChanged);
+    QVERIFY(valueSpy.isValid());
+
+    // there is no frame to wait for
+    dial.queueValue(0.5);
+    QCOMPARE(dial.value(), qreal(0.5));
+    QCOMPARE(valueSpy.count(), 1);
+}
+
+void tst_QQuickDial::setValueDropsQueuedValue()
+{
+    QQuickWindow window;
+    window.resize(200, 200);
+
+    QQuickDial *dial = new QQuickDial(window.contentItem());
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QQUICK_VERIFY_POLISH(dial);
+
+    dial->queueValue(0.3);
+    dial->setValue(0.9);
+    QCOMPARE(dial->value(), qreal(0.9));
+
+    QQUICK_VERIFY_POLISH(dial);
+    QCOMPARE(dial->value(), qreal(0.9));
+}
+
+QTEST_MAIN(tst_QQuickDial)
+
+#include "tst_qquickdial.moc"
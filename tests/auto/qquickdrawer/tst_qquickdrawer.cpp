@@ -73,6 +73,8 @@ private slots:
     void position_data();
     void position();
 
+    void deferredDrag();
+
     void dragMargin_data();
     void dragMargin();
 
@@ -358,6 +360,50 @@ void tst_QQuickDrawer::position()
     QTRY_COMPARE(drawer->position(), 1.0);
 }
 
+void tst_QQuickDrawer::deferredDrag()
+{
+    qputenv("QT_QUICK_CONTROLS_DEFERRED_DRAWER_DRAG", "1");
+
+    QQuickApplicationHelper helper(this, QStringLiteral("applicationwindow.qml"));
+
+    QQuickApplicationWindow *window = helper.appWindow;
+    window->show();
+    window->requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickDrawer *drawer = helper.appWindow->property("drawer").value<QQuickDrawer*>();
+    QVERIFY(drawer);
+
+    QSignalSpy positionSpy(drawer, &QQuickDrawer::positionChanged);
+    QVERIFY(positionSpy.isValid());
+
+    // the moves are applied once per frame, not as they arrive
+    QTest::mousePress(window, Qt::LeftButton, Qt::NoModifier, QPoint(0, 100));
+    QTest::mouseMove(window, QPoint(50, 100));
+    QTest::mouseMove(window, QPoint(80, 100));
+    QTest::mouseMove(window, QPoint(100, 100));
+    QCOMPARE(drawer->position(), qreal(0));
+
+    QTRY_VERIFY(drawer->position() > 0);
+    QCOMPARE(positionSpy.count(), 1);
+
+    // the last actual point decides, and the drawer snaps open
+    QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, QPoint(100, 100));
+    QTRY_COMPARE(drawer->position(), 1.0);
+
+    // without the environment variable, every move is applied right away
+    qunsetenv("QT_QUICK_CONTROLS_DEFERRED_DRAWER_DRAG");
+    drawer->close();
+    QTRY_COMPARE(drawer->position(), 0.0);
+
+    QTest::mousePress(window, Qt::LeftButton, Qt::NoModifier, QPoint(0, 100));
+    QTest::mouseMove(window, QPoint(50, 100));
+    QTest::mouseMove(window, QPoint(150, 100));
+    QCOMPARE(drawer->position(), 0.5);
+    QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, QPoint(150, 100));
+    QTRY_COMPARE(drawer->position(), 1.0);
+}
+
 void tst_QQuickDrawer::dragMargin_data()
 {
     QTest::addColumn<Qt::Edge>("edge");
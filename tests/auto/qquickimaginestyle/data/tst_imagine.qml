@@ -54,6 +54,7 @@ import QtTest 1.1
 import QtQuick.Templates 2.3 as T
 import QtQuick.Controls 2.3
 import QtQuick.Controls.Imagine 2.3
+import QtQuick.Controls.Imagine.impl 2.3
 
 TestCase {
     id: testCase
@@ -100,6 +101,42 @@ TestCase {
         compare(image.pixel(control.width / 2, control.height / 2), "#ff0000")
     }
 
+    Component {
+        id: imageSelectorComponent
+        Image {
+            property alias selectorCache: selector.cache
+            property alias selectorStates: selector.states
+            ImageSelector on source {
+                id: selector
+                path: assetDir.path
+                name: "asset"
+            }
+        }
+    }
+
+    function test_imageSelector_data() {
+        return [
+            { tag: "cache", cache: true },
+            { tag: "no cache", cache: false }
+        ]
+    }
+
+    function test_imageSelector(data) {
+        assetDir.addAsset("asset.png")
+
+        var image = createTemporaryObject(imageSelectorComponent, testCase, {selectorCache: data.cache})
+        verify(image)
+        compare(image.source.toString().split("/").pop(), "asset.png")
+
+        // a file that is added to the directory is found by the next lookup
+        var state = "state" + (data.cache ? 1 : 2)
+        assetDir.addAsset("asset-" + state + ".png")
+        var states = {}
+        states[state] = true
+        image.selectorStates = [states]
+        compare(image.source.toString().split("/").pop(), "asset-" + state + ".png")
+    }
+
     function test_fontFromConfigFile() {
         var control = createTemporaryObject(buttonComponent, testCase)
         verify(control)
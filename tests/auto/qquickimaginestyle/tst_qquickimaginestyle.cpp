@@ -34,5 +34,46 @@
 **
 ****************************************************************************/
 
+#include <QtCore/qdatetime.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtCore/qthread.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQml/qqmlengine.h>
 #include <QtQuickTest/quicktest.h>
-QUICK_TEST_MAIN(tst_qquickmaterialstyle)
+
+// Provides a writable asset directory for the image selector tests.
+class AssetDir : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QString path READ path CONSTANT)
+
+public:
+    QString path() const { return m_dir.path(); }
+
+    Q_INVOKABLE void addAsset(const QString &fileName)
+    {
+        // make sure that the modification time of the directory changes
+        const QDateTime lastModified = QFileInfo(m_dir.path()).lastModified();
+        for (int i = 0; i < 200 && QFileInfo(m_dir.path()).lastModified() == lastModified; ++i) {
+            QFile::remove(m_dir.filePath(fileName));
+            QThread::msleep(10);
+            QFile::copy(QStringLiteral(":/control-assets/button-background.9.png"), m_dir.filePath(fileName));
+        }
+    }
+
+public slots:
+    void qmlEngineAvailable(QQmlEngine *engine)
+    {
+        engine->rootContext()->setContextProperty(QStringLiteral("assetDir"), this);
+    }
+
+private:
+    QTemporaryDir m_dir;
+};
+
+QUICK_TEST_MAIN_WITH_SETUP(tst_qquickimaginestyle, AssetDir)
+
+#include "tst_qquickimaginestyle.moc"
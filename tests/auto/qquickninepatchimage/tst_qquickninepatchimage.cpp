@@ -33,6 +33,7 @@
 #include <QtCore/qsize.h>
 #include <QtGui/private/qhighdpiscaling_p.h>
 #include <QtQml/qqmlengine.h>
+#include <QtQml/qqmlcomponent.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/qquickview.h>
 #include <QtQuick/qquickitemgrabresult.h>
@@ -52,10 +53,13 @@ private slots:
     void ninePatch();
     void padding_data();
     void padding();
+    void mirror();
     void inset_data();
     void inset();
     void implicitSize_data();
     void implicitSize();
+    void resize();
+    void sharedSource();
 };
 
 static QImage grabItemToImage(QQuickItem *item)
@@ -66,6 +70,27 @@ static QImage grabItemToImage(QQuickItem *item)
     return result->image();
 }
 
+// Generates an image to compare against the actual foo.9.png 9-patch image.
+static QImage generateNinePatchImage(const QSize &size, int dpr, QImage::Format format)
+{
+    QImage generatedImage(size * dpr, format);
+    generatedImage.fill(Qt::red);
+
+    QImage blueRect(4 * dpr, 4 * dpr, format);
+    blueRect.fill(Qt::blue);
+
+    QPainter painter(&generatedImage);
+    // Top-left
+    painter.drawImage(0, 0, blueRect);
+    // Top-right
+    painter.drawImage(generatedImage.width() - blueRect.width(), 0, blueRect);
+    // Bottom-right
+    painter.drawImage(generatedImage.width() - blueRect.width(), generatedImage.height() - blueRect.height(), blueRect);
+    // Bottom-left
+    painter.drawImage(0, generatedImage.height() - blueRect.height(), blueRect);
+    return generatedImage;
+}
+
 void tst_qquickninepatchimage::ninePatch_data()
 {
     QTest::addColumn<int>("dpr");
@@ -107,23 +132,7 @@ void tst_qquickninepatchimage::ninePatch()
     ninePatchImage->setSize(size);
 
     const QImage ninePatchImageGrab = grabItemToImage(ninePatchImage).scaled(size * dpr);
-
-    // Generate an image to compare against the actual 9-patch image.
-    QImage generatedImage(size * dpr, ninePatchImageGrab.format());
-    generatedImage.fill(Qt::red);
-
-    QImage blueRect(4 * dpr, 4 * dpr, ninePatchImageGrab.format());
-    blueRect.fill(Qt::blue);
-
-    QPainter painter(&generatedImage);
-    // Top-left
-    painter.drawImage(0, 0, blueRect);
-    // Top-right
-    painter.drawImage(generatedImage.width() - blueRect.width(), 0, blueRect);
-    // Bottom-right
-    painter.drawImage(generatedImage.width() - blueRect.width(), generatedImage.height() - blueRect.height(), blueRect);
-    // Bottom-left
-    painter.drawImage(0, generatedImage.height() - blueRect.height(), blueRect);
+    const QImage generatedImage = generateNinePatchImage(size, dpr, ninePatchImageGrab.format());
 
     if ((QGuiApplication::platformName() == QLatin1String("offscreen"))
         || (QGuiApplication::platformName() == QLatin1String("minimal")))
@@ -162,6 +171,38 @@ void tst_qquickninepatchimage::padding()
     QCOMPARE(ninePatchImage->property("bottomPadding").toReal(), 10);
 }
 
+void tst_qquickninepatchimage::mirror()
+{
+    QQuickView view(testFileUrl("ninepatchimage.qml"));
+    QCOMPARE(view.status(), QQuickView::Ready);
+    view.show();
+    view.requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(&view));
+
+    QQuickImage *ninePatchImage = qobject_cast<QQuickImage *>(view.rootObject());
+    QVERIFY(ninePatchImage);
+    ninePatchImage->setSource(testFileUrl("padding.9.png"));
+
+    QSignalSpy leftPaddingSpy(ninePatchImage, SIGNAL(leftPaddingChanged()));
+    QSignalSpy rightPaddingSpy(ninePatchImage, SIGNAL(rightPaddingChanged()));
+    QVERIFY(leftPaddingSpy.isValid());
+    QVERIFY(rightPaddingSpy.isValid());
+
+    ninePatchImage->setMirror(true);
+    QCOMPARE(ninePatchImage->property("topPadding").toReal(), 8);
+    QCOMPARE(ninePatchImage->property("leftPadding").toReal(), 20);
+    QCOMPARE(ninePatchImage->property("rightPadding").toReal(), 18);
+    QCOMPARE(ninePatchImage->property("bottomPadding").toReal(), 10);
+    QCOMPARE(leftPaddingSpy.count(), 1);
+    QCOMPARE(rightPaddingSpy.count(), 1);
+
+    ninePatchImage->setMirror(false);
+    QCOMPARE(ninePatchImage->property("leftPadding").toReal(), 18);
+    QCOMPARE(ninePatchImage->property("rightPadding").toReal(), 20);
+    QCOMPARE(leftPaddingSpy.count(), 2);
+    QCOMPARE(rightPaddingSpy.count(), 2);
+}
+
 void tst_qquickninepatchimage::inset_data()
 {
     QTest::addColumn<int>("dpr");
@@ -240,6 +281,74 @@ void tst_qquickninepatchimage::implicitSize()
     QCOMPARE(ninePatchImage->implicitHeight(), implicitSize.height());
 }
 
+void tst_qquickninepatchimage::resize()
+{
+    QHighDpiScaling::setGlobalFactor(1);
+
+    QQuickView view(testFileUrl("ninepatchimage.qml"));
+    QCOMPARE(view.status(), QQuickView::Ready);
+    view.show();
+    view.requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(&view));
+
+    QQuickImage *ninePatchImage = qobject_cast<QQuickImage *>(view.rootObject());
+    QVERIFY(ninePatchImage);
+    ninePatchImage->setSource(testFileUrl("foo.9.png"));
+
+    if ((QGuiApplication::platformName() == QLatin1String("offscreen"))
+        || (QGuiApplication::platformName() == QLatin1String("minimal")))
+        QSKIP("Grabbing does not work on offscreen/minimal platforms");
+
+    // the same node is updated in place for every size
+    const QList<QSize> sizes = QList<QSize>() << QSize(40, 40) << QSize(80, 40) << QSize(10, 10) << QSize(40, 80) << QSize(8, 8);
+    for (const QSize &size : sizes) {
+        ninePatchImage->setSize(size);
+        const QImage ninePatchImageGrab = grabItemToImage(ninePatchImage).scaled(size);
+        QCOMPARE(ninePatchImageGrab, generateNinePatchImage(size, 1, ninePatchImageGrab.format()));
+    }
+}
+
+void tst_qquickninepatchimage::sharedSource()
+{
+    QHighDpiScaling::setGlobalFactor(1);
+
+    QQuickView view(testFileUrl("ninepatchimage.qml"));
+    QCOMPARE(view.status(), QQuickView::Ready);
+    view.show();
+    view.requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(&view));
+
+    QQuickImage *ninePatchImage = qobject_cast<QQuickImage *>(view.rootObject());
+    QVERIFY(ninePatchImage);
+
+    // the second image reuses the coordinates that were parsed for the first
+    QQmlComponent component(view.engine(), testFileUrl("ninepatchimage.qml"));
+    QScopedPointer<QQuickImage> other(qobject_cast<QQuickImage *>(component.create()));
+    QVERIFY(other);
+    other->setParentItem(view.contentItem());
+
+    ninePatchImage->setSource(testFileUrl("padding.9.png"));
+    other->setSource(testFileUrl("padding.9.png"));
+    for (QQuickImage *image : { ninePatchImage, other.data() }) {
+        QCOMPARE(image->property("topPadding").toReal(), 8);
+        QCOMPARE(image->property("leftPadding").toReal(), 18);
+        QCOMPARE(image->property("rightPadding").toReal(), 20);
+        QCOMPARE(image->property("bottomPadding").toReal(), 10);
+    }
+
+    // switching the source back and forth picks the matching coordinates
+    other->setSource(testFileUrl("inset-all.9.png"));
+    QCOMPARE(other->property("topInset").toReal(), 1);
+    QCOMPARE(other->property("leftInset").toReal(), 2);
+    QCOMPARE(other->property("rightInset").toReal(), 3);
+    QCOMPARE(other->property("bottomInset").toReal(), 4);
+    QCOMPARE(ninePatchImage->property("topInset").toReal(), 0);
+
+    other->setSource(testFileUrl("padding.9.png"));
+    QCOMPARE(other->property("leftPadding").toReal(), 18);
+    QCOMPARE(other->property("topInset").toReal(), 0);
+}
+
 QTEST_MAIN(tst_qquickninepatchimage)
 
 #include "tst_qquickninepatchimage.moc"
@@ -0,0 +1,14 @@
+CONFIG += testcase
+TARGET = tst_qquickplatformmenu
+SOURCES += tst_qquickplatformmenu.cpp
+
+macos:CONFIG -= app_bundle
+
+QT += core-private gui-private qml testlib
+
+include (../shared/util.pri)
+
+TESTDATA = data/*
+
+OTHER_FILES += \
+    data/*.qml
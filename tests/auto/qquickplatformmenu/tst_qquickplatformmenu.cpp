@@ -0,0 +1,279 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/qtest.h>
+#include "../shared/util.h"
+
+#include <QtQml/qqmlengine.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtGui/qpa/qplatformmenu.h>
+#include <QtGui/qpa/qplatformtheme.h>
+#include <QtGui/private/qguiapplication_p.h>
+
+// Counts the calls that the platform menus and menu items receive, so that
+// the tests can verify which properties are forwarded on each sync.
+class MockMenuItem : public QPlatformMenuItem
+{
+public:
+    void setText(const QString &text) override { m_text = text; ++textCalls; ++calls; }
+    void setIcon(const QIcon &) override { ++iconCalls; ++calls; }
+    void setMenu(QPlatformMenu *) override { ++calls; }
+    void setVisible(bool) override { ++calls; }
+    void setIsSeparator(bool) override { ++calls; }
+    void setFont(const QFont &) override { ++calls; }
+    void setRole(MenuRole) override { ++calls; }
+    void setCheckable(bool) override { ++calls; }
+    void setChecked(bool) override { ++calls; }
+#ifndef QT_NO_SHORTCUT
+    void setShortcut(const QKeySequence &) override { ++calls; }
+#endif
+    void setEnabled(bool enabled) override { m_enabled = enabled; ++calls; }
+    void setIconSize(int) override { ++calls; }
+
+    QString m_text;
+    bool m_enabled = false;
+    int textCalls = 0;
+    int iconCalls = 0;
+    int calls = 0;
+    int syncCalls = 0;
+};
+
+class MockMenu : public QPlatformMenu
+{
+public:
+    void insertMenuItem(QPlatformMenuItem *menuItem, QPlatformMenuItem *before) override
+    {
+        const int index = before ? m_items.indexOf(static_cast<MockMenuItem *>(before)) : -1;
+        m_items.insert(index == -1 ? m_items.count() : index, static_cast<MockMenuItem *>(menuItem));
+    }
+    void removeMenuItem(QPlatformMenuItem *menuItem) override { m_items.removeOne(static_cast<MockMenuItem *>(menuItem)); }
+    void syncMenuItem(QPlatformMenuItem *menuItem) override { ++static_cast<MockMenuItem *>(menuItem)->syncCalls; }
+    void syncSeparatorsCollapsible(bool) override { }
+
+    void setText(const QString &text) override { m_text = text; ++textCalls; }
+    void setIcon(const QIcon &) override { }
+    void setEnabled(bool) override { }
+    void setVisible(bool) override { }
+
+    QPlatformMenuItem *menuItemAt(int position) const override { return m_items.value(position); }
+    QPlatformMenuItem *menuItemForTag(quintptr) const override { return nullptr; }
+    QPlatformMenuItem *createMenuItem() const override { return new MockMenuItem; }
+    QPlatformMenu *createSubMenu() const override { return new MockMenu; }
+
+    MockMenuItem *item(const QString &text) const
+    {
+        for (MockMenuItem *item : m_items) {
+            if (item->m_text == text)
+                return item;
+        }
+        return nullptr;
+    }
+
+    QString m_text;
+    int textCalls = 0;
+    QVector<MockMenuItem *> m_items;
+};
+
+class MockTheme : public QPlatformTheme
+{
+public:
+    QPlatformMenu *createPlatformMenu() const override
+    {
+        MockMenu *menu = new MockMenu;
+        menus += menu;
+        return menu;
+    }
+
+    mutable QVector<MockMenu *> menus;
+};
+
+class tst_QQuickPlatformMenu : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void syncChanges();
+    void addItem();
+    void icon();
+
+private:
+    QPlatformTheme *originalTheme = nullptr;
+    MockTheme *theme = nullptr;
+};
+
+void tst_QQuickPlatformMenu::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+
+    originalTheme = QGuiApplicationPrivate::platform_theme;
+    theme = new MockTheme;
+    QGuiApplicationPrivate::platform_theme = theme;
+}
+
+void tst_QQuickPlatformMenu::cleanupTestCase()
+{
+    QGuiApplicationPrivate::platform_theme = originalTheme;
+    delete theme;
+}
+
+void tst_QQuickPlatformMenu::syncChanges()
+{
+    theme->menus.clear();
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("menu.qml"));
+    QScopedPointer<QObject> menu(component.create());
+    QVERIFY2(menu, qPrintable(component.errorString()));
+
+    QCOMPARE(theme->menus.count(), 1);
+    MockMenu *handle = theme->menus.first();
+    QCOMPARE(handle->m_items.count(), 2);
+
+    MockMenuItem *first = handle->item(QStringLiteral("First"));
+    QVERIFY(first);
+    MockMenuItem *second = handle->item(QStringLiteral("Second"));
+    QVERIFY(second);
+    QCOMPARE(first->textCalls, 1);
+    QCOMPARE(second->textCalls, 1);
+
+    QObject *firstItem = menu->findChild<QObject *>(QStringLiteral("first"));
+    QVERIFY(firstItem);
+
+    // only the changed property of the changed item is forwarded
+    const int firstCalls = first->calls;
+    const int firstSyncs = first->syncCalls;
+    const int secondCalls = second->calls;
+    const int secondSyncs = second->syncCalls;
+    QVERIFY(firstItem->setProperty("text", QStringLiteral("Changed")));
+    QCOMPARE(first->m_text, QStringLiteral("Changed"));
+    QCOMPARE(first->textCalls, 2);
+    QCOMPARE(first->calls, firstCalls + 1);
+    QCOMPARE(first->syncCalls, firstSyncs + 1);
+    QCOMPARE(second->calls, secondCalls);
+    QCOMPARE(second->syncCalls, secondSyncs);
+
+    QVERIFY(firstItem->setProperty("enabled", false));
+    QCOMPARE(first->m_enabled, false);
+    QCOMPARE(first->calls, firstCalls + 2);
+    QCOMPARE(first->syncCalls, firstSyncs + 2);
+    QCOMPARE(second->calls, secondCalls);
+
+    // changing the menu does not push the items again
+    const int menuTextCalls = handle->textCalls;
+    QVERIFY(menu->setProperty("title", QStringLiteral("Menu")));
+    QCOMPARE(handle->m_text, QStringLiteral("Menu"));
+    QCOMPARE(handle->textCalls, menuTextCalls + 1);
+    QCOMPARE(first->calls, firstCalls + 2);
+    QCOMPARE(second->calls, secondCalls);
+}
+
+void tst_QQuickPlatformMenu::addItem()
+{
+    theme->menus.clear();
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("menu.qml"));
+    QScopedPointer<QObject> menu(component.create());
+    QVERIFY2(menu, qPrintable(component.errorString()));
+
+    QCOMPARE(theme->menus.count(), 1);
+    MockMenu *handle = theme->menus.first();
+    MockMenuItem *first = handle->item(QStringLiteral("First"));
+    QVERIFY(first);
+    MockMenuItem *second = handle->item(QStringLiteral("Second"));
+    QVERIFY(second);
+
+    // populating the menu pushes the new items, but not the existing ones
+    const int firstCalls = first->calls;
+    const int firstSyncs = first->syncCalls;
+    const int secondCalls = second->calls;
+    const int secondSyncs = second->syncCalls;
+    for (int i = 0; i < 10; ++i) {
+        const QString text = QString::number(i);
+        QVariant item;
+        QVERIFY(QMetaObject::invokeMethod(menu.data(), "addMenuItem", Q_RETURN_ARG(QVariant, item), Q_ARG(QVariant, text)));
+        QCOMPARE(handle->m_items.count(), 3 + i);
+        MockMenuItem *added = handle->item(text);
+        QVERIFY(added);
+        QCOMPARE(added->textCalls, 1);
+    }
+    QCOMPARE(first->calls, firstCalls);
+    QCOMPARE(first->syncCalls, firstSyncs);
+    QCOMPARE(second->calls, secondCalls);
+    QCOMPARE(second->syncCalls, secondSyncs);
+}
+
+void tst_QQuickPlatformMenu::icon()
+{
+    theme->menus.clear();
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("menu.qml"));
+    QScopedPointer<QObject> menu(component.create());
+    QVERIFY2(menu, qPrintable(component.errorString()));
+
+    QCOMPARE(theme->menus.count(), 1);
+    MockMenuItem *first = theme->menus.first()->item(QStringLiteral("First"));
+    QVERIFY(first);
+    QObject *firstItem = menu->findChild<QObject *>(QStringLiteral("first"));
+    QVERIFY(firstItem);
+    QCOMPARE(first->iconCalls, 0);
+
+    // the icon is decoded in the background, and pushed once it is ready
+    QVERIFY(firstItem->setProperty("iconSource", testFileUrl("icon1.png")));
+    QCOMPARE(first->iconCalls, 0);
+    QTRY_COMPARE(first->iconCalls, 1);
+
+    // later loads are reported as well
+    const int syncs = first->syncCalls;
+    QVERIFY(firstItem->setProperty("iconSource", testFileUrl("icon2.png")));
+    QTRY_COMPARE(first->iconCalls, 2);
+    QCOMPARE(first->syncCalls, syncs + 1);
+
+    // a cached image is pushed right away
+    QVERIFY(firstItem->setProperty("iconSource", testFileUrl("icon1.png")));
+    QCOMPARE(first->iconCalls, 3);
+
+    // the resolved icon is not pushed again for unrelated changes
+    QVERIFY(firstItem->setProperty("text", QStringLiteral("Changed")));
+    QCOMPARE(first->iconCalls, 3);
+}
+
+QTEST_MAIN(tst_QQuickPlatformMenu)
+
+#include "tst_qquickplatformmenu.moc"
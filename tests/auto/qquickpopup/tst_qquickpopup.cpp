@@ -42,9 +42,11 @@
 #include "../shared/qtest_quickcontrols.h"
 
 #include <QtGui/qpa/qwindowsysteminterface.h>
+#include <QtQml/private/qqmlobjectmodel_p.h>
 #include <QtQuickTemplates2/private/qquickapplicationwindow_p.h>
 #include <QtQuickTemplates2/private/qquickcombobox_p.h>
 #include <QtQuickTemplates2/private/qquickoverlay_p.h>
+#include <QtQuickTemplates2/private/qquickoverlay_p_p.h>
 #include <QtQuickTemplates2/private/qquickpopup_p.h>
 #include <QtQuickTemplates2/private/qquickbutton_p.h>
 #include <QtQuickTemplates2/private/qquickslider_p.h>
@@ -65,6 +67,7 @@ private slots:
     void overlay();
     void zOrder_data();
     void zOrder();
+    void stackingOrder();
     void windowChange();
     void closePolicy_data();
     void closePolicy();
@@ -84,6 +87,8 @@ private slots:
     void enabled();
     void orientation_data();
     void orientation();
+    void incubatePopup_data();
+    void incubatePopup();
 };
 
 void tst_QQuickPopup::initTestCase()
@@ -389,6 +394,57 @@ void tst_QQuickPopup::zOrder()
     QTRY_VERIFY(!popup->isVisible());
 }
 
+void tst_QQuickPopup::stackingOrder()
+{
+    QQuickApplicationHelper helper(this, QStringLiteral("window.qml"));
+
+    QQuickWindow *window = helper.window;
+    window->show();
+    window->requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickOverlay *overlay = QQuickOverlay::overlay(window);
+    QVERIFY(overlay);
+    QQuickOverlayPrivate *overlayPrivate = QQuickOverlayPrivate::get(overlay);
+
+    QQuickPopup *popup = window->property("popup").value<QQuickPopup*>();
+    QVERIFY(popup);
+    QQuickPopup *popup2 = window->property("popup2").value<QQuickPopup*>();
+    QVERIFY(popup2);
+
+    typedef QVector<QQuickPopup *> Popups;
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups());
+
+    popup2->open();
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup2);
+
+    // popup2 has higher z-order
+    popup->open();
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup2 << popup);
+
+    popup->setZ(2);
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup << popup2);
+
+    // restacking the popup items is picked up as well
+    popup->popupItem()->setZ(0);
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup2 << popup);
+    popup->popupItem()->setZ(2);
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup << popup2);
+
+    popup->close();
+    QTRY_VERIFY(!popup->isVisible());
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup2);
+
+    popup->open();
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups() << popup << popup2);
+
+    popup->close();
+    popup2->close();
+    QTRY_VERIFY(!popup->isVisible());
+    QTRY_VERIFY(!popup2->isVisible());
+    QCOMPARE(overlayPrivate->stackingOrderPopups(), Popups());
+}
+
 void tst_QQuickPopup::windowChange()
 {
     QQuickPopup popup;
@@ -1064,6 +1120,61 @@ void tst_QQuickPopup::orientation()
     QCOMPARE(popup->popupItem()->position(), position);
 }
 
+void tst_QQuickPopup::incubatePopup_data()
+{
+    QTest::addColumn<bool>("incubate");
+
+    QTest::newRow("incubate") << true;
+    QTest::newRow("on demand") << false;
+}
+
+void tst_QQuickPopup::incubatePopup()
+{
+    QFETCH(bool, incubate);
+
+    qputenv("QT_QUICK_CONTROLS_INCUBATE_DELEGATES", incubate ? "1" : "0");
+    QQuickApplicationHelper helper(this, "incubatePopup.qml");
+    qunsetenv("QT_QUICK_CONTROLS_INCUBATE_DELEGATES");
+
+    QQuickWindow *window = helper.window;
+    QQuickComboBox *comboBox = window->property("comboBox").value<QQuickComboBox *>();
+    QVERIFY(comboBox);
+
+    // nothing asked for the popup during creation
+    QVERIFY(!comboBox->findChild<QQuickPopup *>("popup"));
+
+    if (incubate) {
+        QTRY_VERIFY(comboBox->findChild<QQuickPopup *>("popup"));
+    } else {
+        QCoreApplication::processEvents();
+        QVERIFY(!comboBox->findChild<QQuickPopup *>("popup"));
+    }
+
+    QQuickPopup *popup = comboBox->popup();
+    QVERIFY(popup);
+    QCOMPARE(popup->objectName(), QString("popup"));
+    QCOMPARE(comboBox->findChild<QQuickPopup *>("popup"), popup);
+
+    // the delegate model is not affected by when the popup is created
+    QVERIFY(comboBox->delegateModel());
+    QCOMPARE(comboBox->delegateModel()->count(), 3);
+    QCOMPARE(comboBox->currentText(), QString("One"));
+
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    popup->open();
+    QTRY_VERIFY(popup->isOpened());
+    QQuickItem *listView = popup->contentItem();
+    QVERIFY(listView);
+    QTRY_COMPARE(listView->property("count").toInt(), 3);
+
+    comboBox->setModel(QStringList() << "A" << "B");
+    QCOMPARE(comboBox->delegateModel()->count(), 2);
+    QCOMPARE(listView->property("count").toInt(), 2);
+    QCOMPARE(comboBox->currentText(), QString("A"));
+}
+
 QTEST_QUICKCONTROLS_MAIN(tst_QQuickPopup)
 
 #include "tst_qquickpopup.moc"
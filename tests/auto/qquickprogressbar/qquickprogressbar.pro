@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qquickprogressbar
+SOURCES += tst_qquickprogressbar.cpp
+
+macos:CONFIG -= app_bundle
+
+QT += core-private gui-private qml-private quick-private testlib quicktemplates2-private
+
+include (../shared/util.pri)
@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/qtest.h>
+#include <QtTest/qsignalspy.h>
+#include "../shared/visualtestutil.h"
+
+#include <QtCore/qthread.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuickTemplates2/private/qquickprogressbar_p.h>
+#include <QtQuickTemplates2/private/qquickprogresssource_p.h>
+
+class tst_QQuickProgressBar : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void source();
+    void threads();
+    void progressSource();
+};
+
+void tst_QQuickProgressBar::source()
+{
+    QQuickProgressSource source;
+    QCOMPARE(source.value(), qreal(0));
+
+    QSignalSpy valueSpy(&source, &QQuickProgressSource::valueChanged);
+    QVERIFY(valueSpy.isValid());
+
+    // only the first update after the value was taken notifies
+    source.setValue(0.25);
+    source.setValue(0.5);
+    QCOMPARE(source.value(), qreal(0.5));
+    QCOMPARE(valueSpy.count(), 1);
+
+    QCOMPARE(source.take(), qreal(0.5));
+    QCOMPARE(source.value(), qreal(0.5));
+
+    source.setValue(0.75);
+    QCOMPARE(valueSpy.count(), 2);
+    QCOMPARE(source.take(), qreal(0.75));
+}
+
+class ProgressThread : public QThread
+{
+public:
+    ProgressThread(QQuickProgressSource *source, int steps) : source(source), steps(steps) { }
+
+protected:
+    void run() override
+    {
+        for (int i = 1; i <= steps; ++i)
+            source->setValue(qreal(i) / steps);
+    }
+
+private:
+    QQuickProgressSource *source;
+    int steps;
+};
+
+void tst_QQuickProgressBar::threads()
+{
+    QQuickProgressSource source;
+
+    QAtomicInt notifications;
+    connect(&source, &QQuickProgressSource::valueChanged, [&notifications]() { notifications.ref(); });
+
+    ProgressThread thread1(&source, 1000);
+    ProgressThread thread2(&source, 1000);
+    thread1.start();
+    thread2.start();
+    QVERIFY(thread1.wait());
+    QVERIFY(thread2.wait());
+
+    // nobody took the value in between, so there was a single notification
+    QCOMPARE(notifications.load(), 1);
+    QCOMPARE(source.take(), qreal(1));
+}
+
+void tst_QQuickProgressBar::progressSource()
+{
+    QQuickWindow window;
+    window.resize(200, 200);
+
+    QQuickProgressBar *progressBar = new QQuickProgressBar(window.contentItem());
+    QSignalSpy valueSpy(progressBar, &QQuickProgressBar::valueChanged);
+    QVERIFY(valueSpy.isValid());
+
+    QQuickProgressSource source;
+    progressBar->setProgressSource(&source);
+    QCOMPARE(progressBar->progressSource(), &source);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QQUICK_VERIFY_POLISH(progressBar);
+    QCOMPARE(valueSpy.count(), 0);
+
+    // several updates in the same frame are applied once
+    ProgressThread thread(&source, 10);
+    thread.start();
+    QVERIFY(thread.wait());
+    QTRY_COMPARE(progressBar->value(), qreal(1));
+    QCOMPARE(valueSpy.count(), 1);
+
+    source.setValue(0.5);
+    QTRY_COMPARE(progressBar->value(), qreal(0.5));
+    QCOMPARE(valueSpy.count(), 2);
+
+    // a detached source is no longer sampled
+    progressBar->setProgressSource(nullptr);
+    source.setValue(0.25);
+    QTest::qWait(50);
+    QCOMPARE(progressBar->value(), qreal(0.5));
+}
+
+QTEST_MAIN(tst_QQuickProgressBar)
+
+#include "tst_qquickprogressbar.moc"
@@ -0,0 +1,196 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/qtest.h>
+#include <QtTest/qsignalspy.h>
+#include "../shared/util.h"
+#include "../shared/visualtestutil.h"
+
+#include <QtCore/qtemporarydir.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuickTemplates2/private/qquickstackview_p.h>
+#include <QtQuickTemplates2/private/qquickstackview_p_p.h>
+
+using namespace QQuickVisualTestUtil;
+
+class tst_QQuickStackView : public QQmlDataTest
+{
+    Q_OBJECT
+
+private slots:
+    void pushItem();
+    void pushComponent();
+    void pushUrl();
+    void pushFailedUrl();
+    void pushWithoutEngine();
+};
+
+void tst_QQuickStackView::pushItem()
+{
+    QQuickApplicationHelper helper(this, QStringLiteral("stackview.qml"));
+    QQuickStackView *stackView = helper.window->property("stackView").value<QQuickStackView *>();
+    QVERIFY(stackView);
+
+    QQuickItem item;
+    QVariantMap properties;
+    properties.insert(QStringLiteral("objectName"), QStringLiteral("item"));
+
+    QCOMPARE(stackView->pushItem(&item, properties, QQuickStackView::Immediate), &item);
+    QCOMPARE(stackView->depth(), 1);
+    QCOMPARE(stackView->currentItem(), &item);
+    QCOMPARE(item.objectName(), QStringLiteral("item"));
+    QCOMPARE(item.parentItem(), stackView);
+
+    // an item that is already in the stack is not pushed again
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*pushItem: nothing to push"));
+    QVERIFY(!stackView->pushItem(&item, QVariantMap(), QQuickStackView::Immediate));
+    QCOMPARE(stackView->depth(), 1);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*pushItem: nothing to push"));
+    QVERIFY(!stackView->pushItem(nullptr));
+    QCOMPARE(stackView->depth(), 1);
+
+    stackView->clear(QQuickStackView::Immediate);
+    QCOMPARE(item.parentItem(), static_cast<QQuickItem *>(nullptr));
+}
+
+void tst_QQuickStackView::pushComponent()
+{
+    QQuickApplicationHelper helper(this, QStringLiteral("stackview.qml"));
+    QQuickStackView *stackView = helper.window->property("stackView").value<QQuickStackView *>();
+    QVERIFY(stackView);
+    QQmlComponent *component = helper.window->property("component").value<QQmlComponent *>();
+    QVERIFY(component);
+
+    QVariantMap properties;
+    properties.insert(QStringLiteral("value"), 1);
+    QQuickItem *first = stackView->pushComponent(component, properties, QQuickStackView::Immediate);
+    QVERIFY(first);
+    QCOMPARE(first->property("value").toInt(), 1);
+
+    properties.insert(QStringLiteral("value"), 2);
+    QQuickItem *second = stackView->pushComponent(component, properties, QQuickStackView::Immediate);
+    QVERIFY(second);
+    QVERIFY(second != first);
+    QCOMPARE(second->property("value").toInt(), 2);
+    QCOMPARE(stackView->depth(), 2);
+    QCOMPARE(stackView->currentItem(), second);
+
+    // the component belongs to the caller
+    stackView->clear(QQuickStackView::Immediate);
+    QCOMPARE(stackView->depth(), 0);
+    QVERIFY(!component->isError());
+}
+
+void tst_QQuickStackView::pushUrl()
+{
+    QQuickApplicationHelper helper(this, QStringLiteral("stackview.qml"));
+    QQuickStackView *stackView = helper.window->property("stackView").value<QQuickStackView *>();
+    QVERIFY(stackView);
+    QQuickStackViewPrivate *d = QQuickStackViewPrivate::get(stackView);
+
+    QVariantMap properties;
+    properties.insert(QStringLiteral("value"), 1);
+    QQuickItem *first = stackView->pushUrl(testFileUrl("page.qml"), properties, QQuickStackView::Immediate);
+    QVERIFY(first);
+    QCOMPARE(first->objectName(), QStringLiteral("page"));
+    QCOMPARE(first->property("value").toInt(), 1);
+
+    // pushing the same url again shares the component
+    QQuickItem *second = stackView->pushUrl(testFileUrl("page.qml"), QVariantMap(), QQuickStackView::Immediate);
+    QVERIFY(second);
+    QVERIFY(second != first);
+    QCOMPARE(second->property("value").toInt(), 0);
+    QCOMPARE(stackView->depth(), 2);
+    QCOMPARE(d->components.count(), 1);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*pushUrl: invalid url: .*"));
+    QVERIFY(!stackView->pushUrl(QUrl(QStringLiteral("x://[v]"))));
+    QCOMPARE(stackView->depth(), 2);
+}
+
+void tst_QQuickStackView::pushFailedUrl()
+{
+    QQuickApplicationHelper helper(this, QStringLiteral("stackview.qml"));
+    QQuickStackView *stackView = helper.window->property("stackView").value<QQuickStackView *>();
+    QVERIFY(stackView);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString filePath = dir.filePath(QStringLiteral("Page.qml"));
+    const QUrl url = QUrl::fromLocalFile(filePath);
+
+    QTest::ignoreMessage(QtWarningMsg, "QQmlComponent: Component is not ready");
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*pushUrl: .*Page.qml.*No such file or directory"));
+    QVERIFY(!stackView->pushUrl(url, QVariantMap(), QQuickStackView::Immediate));
+
+    QFile file(filePath);
+    QVERIFY(file.open(QFile::WriteOnly));
+    file.write("import QtQuick 2.11\nItem { objectName: \"fixed\" }\n");
+    file.close();
+
+    // the failed component is not reused once the url can be loaded
+    helper.engine.clearComponentCache();
+    QQuickItem *item = stackView->pushUrl(url, QVariantMap(), QQuickStackView::Immediate);
+    QVERIFY(item);
+    QCOMPARE(item->objectName(), QStringLiteral("fixed"));
+    QCOMPARE(stackView->currentItem(), item);
+}
+
+void tst_QQuickStackView::pushWithoutEngine()
+{
+    QQuickStackView stackView;
+
+    QQuickItem item;
+    QCOMPARE(stackView.pushItem(&item, QVariantMap(), QQuickStackView::Immediate), &item);
+    QCOMPARE(stackView.depth(), 1);
+
+    QQuickItem other;
+    QVariantMap properties;
+    properties.insert(QStringLiteral("objectName"), QStringLiteral("other"));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*pushItem: cannot set properties without a QML engine"));
+    QVERIFY(!stackView.pushItem(&other, properties, QQuickStackView::Immediate));
+    QCOMPARE(stackView.depth(), 1);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*pushUrl: cannot load url without a QML engine: .*"));
+    QVERIFY(!stackView.pushUrl(QUrl(QStringLiteral("Page.qml")), QVariantMap(), QQuickStackView::Immediate));
+    QCOMPARE(stackView.depth(), 1);
+}
+
+QTEST_MAIN(tst_QQuickStackView)
+
+#include "tst_qquickstackview.moc"
@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qquickvelocitycalculator
+SOURCES += tst_qquickvelocitycalculator.cpp
+
+macos:CONFIG -= app_bundle
+
+QT += core-private testlib quicktemplates2-private
@@ -0,0 +1,153 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/qtest.h>
+#include <QtQuickTemplates2/private/qquickvelocitycalculator_p_p.h>
+
+class tst_QQuickVelocityCalculator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void empty();
+    void pressAndRelease();
+    void recentSamples();
+    void window();
+    void ringBuffer();
+    void reset();
+};
+
+void tst_QQuickVelocityCalculator::empty()
+{
+    QQuickVelocityCalculator calculator;
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    // moves without a press are ignored
+    calculator.updateMeasuring(QPointF(10, 10), 10);
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    QTest::ignoreMessage(QtWarningMsg, "QQuickVelocityCalculator: a call to stopMeasuring() must be preceded by a call to startMeasuring()");
+    calculator.stopMeasuring(QPointF(20, 20), 20);
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    // a single sample has no velocity
+    calculator.startMeasuring(QPointF(0, 0), 100);
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    // neither has a release at the same time
+    calculator.stopMeasuring(QPointF(10, 10), 100);
+    QCOMPARE(calculator.velocity(), QPointF());
+}
+
+void tst_QQuickVelocityCalculator::pressAndRelease()
+{
+    // the same as the distance over the time, like before
+    QQuickVelocityCalculator calculator;
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    calculator.stopMeasuring(QPointF(100, -50), 1500);
+    QCOMPARE(calculator.velocity(), QPointF(200, -100));
+}
+
+void tst_QQuickVelocityCalculator::recentSamples()
+{
+    QQuickVelocityCalculator calculator;
+
+    // a slow start...
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    for (int i = 1; i <= 10; ++i)
+        calculator.updateMeasuring(QPointF(i, 0), 1000 + i * 100);
+
+    // ...and a fast flick at the end, at 1000 px/s
+    calculator.updateMeasuring(QPointF(30, 0), 2020);
+    calculator.updateMeasuring(QPointF(50, 0), 2040);
+    calculator.updateMeasuring(QPointF(70, 0), 2060);
+    calculator.stopMeasuring(QPointF(90, 0), 2080);
+
+    // the average since the press would be 84 px/s
+    const QPointF velocity = calculator.velocity();
+    QVERIFY2(velocity.x() > 500, qPrintable(QString::number(velocity.x())));
+    QCOMPARE(velocity.y(), qreal(0));
+}
+
+void tst_QQuickVelocityCalculator::window()
+{
+    QQuickVelocityCalculator calculator;
+
+    // samples older than 100 ms are ignored, but the two most recent are always used
+    calculator.startMeasuring(QPointF(0, 0), 1);
+    calculator.updateMeasuring(QPointF(1000, 0), 500);
+    calculator.stopMeasuring(QPointF(1100, 0), 1000);
+    QCOMPARE(calculator.velocity(), QPointF(200, 0));
+
+    // a constant velocity within the window is reproduced exactly
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    calculator.updateMeasuring(QPointF(0, 10), 1010);
+    calculator.updateMeasuring(QPointF(0, 20), 1020);
+    calculator.updateMeasuring(QPointF(0, 30), 1030);
+    calculator.stopMeasuring(QPointF(0, 40), 1040);
+    QCOMPARE(calculator.velocity(), QPointF(0, 1000));
+}
+
+void tst_QQuickVelocityCalculator::ringBuffer()
+{
+    QQuickVelocityCalculator calculator;
+
+    // more samples than fit in the buffer
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    for (int i = 1; i < 100; ++i)
+        calculator.updateMeasuring(QPointF(i * 5, 0), 1000 + i * 5);
+    calculator.stopMeasuring(QPointF(500, 0), 1500);
+    QCOMPARE(calculator.velocity(), QPointF(1000, 0));
+}
+
+void tst_QQuickVelocityCalculator::reset()
+{
+    QQuickVelocityCalculator calculator;
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    calculator.stopMeasuring(QPointF(100, 0), 1100);
+    QCOMPARE(calculator.velocity(), QPointF(1000, 0));
+
+    calculator.reset();
+    QCOMPARE(calculator.velocity(), QPointF());
+
+    // a new press starts over
+    calculator.startMeasuring(QPointF(0, 0), 2000);
+    calculator.stopMeasuring(QPointF(0, 100), 2100);
+    QCOMPARE(calculator.velocity(), QPointF(0, 1000));
+}
+
+QTEST_APPLESS_MAIN(tst_QQuickVelocityCalculator)
+
+#include "tst_qquickvelocitycalculator.moc"
@@ -49,6 +49,9 @@ private slots:
 
     void window_data();
     void window();
+
+    void control_data();
+    void control();
 };
 
 void tst_revisions::revisions_data()
@@ -108,6 +111,32 @@ void tst_revisions::window()
     QCOMPARE(window.isNull(), !error.isEmpty());
 }
 
+void tst_revisions::control_data()
+{
+    QTest::addColumn<int>("revision");
+    QTest::addColumn<QString>("qml");
+    QTest::addColumn<QString>("error");
+
+    // Qt 5.11: 2.4
+    QTest::newRow("suspended:2.4") << 4 << "suspended: true" << ":1 \"Control.suspended\" is not available in QtQuick.Templates 2.4";
+
+    // Qt 5.12: 2.5
+    QTest::newRow("suspended:2.5") << 5 << "suspended: true" << "";
+}
+
+void tst_revisions::control()
+{
+    QFETCH(int, revision);
+    QFETCH(QString, qml);
+    QFETCH(QString, error);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(QString("import QtQuick.Templates 2.%1; Control { %2 }").arg(revision).arg(qml).toUtf8(), QUrl());
+    QScopedPointer<QObject> control(component.create());
+    QCOMPARE(control.isNull(), !error.isEmpty());
+}
+
 QTEST_MAIN(tst_revisions)
 
 #include "tst_revisions.moc"
@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_animatednodes
+
+QT += quick testlib quick-private quickcontrols2-private
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_animatednodes.cpp
@@ -0,0 +1,195 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QtQuickControls2/private/qquickanimatednode_p.h>
+
+// Counts the animated nodes that are advanced by the shared driver, which
+// marks them and their content dirty for every frame.
+static int countRunningNodes(QSGNode *node)
+{
+    if (!node)
+        return 0;
+
+    int count = 0;
+    if (node->type() == QSGNode::TransformNodeType) {
+        QQuickAnimatedNode *animatedNode = dynamic_cast<QQuickAnimatedNode *>(node);
+        if (animatedNode && animatedNode->isRunning())
+            ++count;
+    }
+    for (QSGNode *child = node->firstChild(); child; child = child->nextSibling())
+        count += countRunningNodes(child);
+    return count;
+}
+
+class tst_AnimatedNodes : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void rendertime();
+    void rendertime_data();
+
+    void runningnodes();
+    void runningnodes_data();
+
+private:
+    void addRows();
+};
+
+enum Measurement {
+    RenderTime,
+    RunningNodes
+};
+
+void tst_AnimatedNodes::addRows()
+{
+    QTest::addColumn<QByteArray>("import");
+    QTest::addColumn<QByteArray>("type");
+    QTest::addColumn<int>("count");
+
+    const QByteArray defaultImpl = "import QtQuick.Controls.impl 2.4";
+    const QByteArray materialImpl = "import QtQuick.Controls.Material.impl 2.4";
+    const QByteArray universalImpl = "import QtQuick.Controls.Universal.impl 2.4";
+
+    const int counts[] = { 10, 100 };
+    for (int count : counts) {
+        const QByteArray suffix = ":" + QByteArray::number(count);
+        QTest::newRow("default/BusyIndicatorImpl" + suffix) << defaultImpl << QByteArray("BusyIndicatorImpl { running: true; pen: \"black\"; fill: \"black\" }") << count;
+        QTest::newRow("default/ProgressBarImpl" + suffix) << defaultImpl << QByteArray("ProgressBarImpl { indeterminate: true; color: \"black\" }") << count;
+        QTest::newRow("material/BusyIndicatorImpl" + suffix) << materialImpl << QByteArray("BusyIndicatorImpl { running: true; color: \"black\" }") << count;
+        QTest::newRow("material/ProgressBarImpl" + suffix) << materialImpl << QByteArray("ProgressBarImpl { indeterminate: true; color: \"black\" }") << count;
+        QTest::newRow("material/Ripple" + suffix) << materialImpl << QByteArray("Ripple { active: true; pressed: root.pressed; color: \"#20000000\" }") << count;
+        QTest::newRow("universal/BusyIndicatorImpl" + suffix) << universalImpl << QByteArray("BusyIndicatorImpl { count: 5; color: \"black\" }") << count;
+        QTest::newRow("universal/ProgressBarImpl" + suffix) << universalImpl << QByteArray("ProgressBarImpl { indeterminate: true; color: \"black\" }") << count;
+    }
+}
+
+// Shows count instances of the type in a window and measures the frames that
+// the running animations schedule. The ripples are pressed and released
+// repeatedly, because they only animate when the pressed state changes.
+static void doBenchmark(Measurement measurement)
+{
+    QFETCH(QByteArray, import);
+    QFETCH(QByteArray, type);
+    QFETCH(int, count);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.10\n" + import + "\n"
+                      "Grid {\n"
+                      "    id: root\n"
+                      "    columns: 10\n"
+                      "    property bool pressed: false\n"
+                      "    Timer { running: true; repeat: true; interval: 100; onTriggered: root.pressed = !root.pressed }\n"
+                      "    Repeater {\n"
+                      "        model: " + QByteArray::number(count) + "\n"
+                      "        delegate: " + type + "\n"
+                      "    }\n"
+                      "}\n", QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object, qPrintable(component.errorString()));
+
+    QQuickItem *root = qobject_cast<QQuickItem *>(object.data());
+    QVERIFY(root);
+
+    const auto children = root->childItems();
+    for (QQuickItem *child : children)
+        child->setSize(QSizeF(48, 48));
+
+    QQuickWindow window;
+    window.resize(480, 480);
+    root->setParentItem(window.contentItem());
+
+    static const int WarmupFrames = 10;
+    static const int Frames = 100;
+
+    QElapsedTimer timer;
+    qint64 renderTime = 0;
+    QAtomicInt frames;
+    QAtomicInt runningNodes;
+    QObject::connect(&window, &QQuickWindow::beforeRendering, &window, [&]() {
+        timer.start();
+    }, Qt::DirectConnection);
+    QObject::connect(&window, &QQuickWindow::afterRendering, &window, [&]() {
+        if (frames.load() < WarmupFrames)
+            return;
+        renderTime += timer.nsecsElapsed();
+        runningNodes.fetchAndAddOrdered(countRunningNodes(QQuickItemPrivate::get(root)->itemNodeInstance));
+    }, Qt::DirectConnection);
+    QObject::connect(&window, &QQuickWindow::frameSwapped, &window, [&]() {
+        frames.fetchAndAddOrdered(1);
+    }, Qt::DirectConnection);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(QTest::qWaitFor([&]() { return frames.load() >= WarmupFrames + Frames; }, 10000));
+    window.hide();
+
+    const int measured = frames.load() - WarmupFrames;
+    if (measurement == RenderTime)
+        QTest::setBenchmarkResult(renderTime / measured, QTest::WalltimeNanoseconds);
+    else
+        QTest::setBenchmarkResult(qreal(runningNodes.load()) / measured, QTest::Events);
+
+    root->setParentItem(nullptr);
+}
+
+void tst_AnimatedNodes::rendertime()
+{
+    doBenchmark(RenderTime);
+}
+
+void tst_AnimatedNodes::rendertime_data()
+{
+    addRows();
+}
+
+void tst_AnimatedNodes::runningnodes()
+{
+    doBenchmark(RunningNodes);
+}
+
+void tst_AnimatedNodes::runningnodes_data()
+{
+    addRows();
+}
+
+QTEST_MAIN(tst_AnimatedNodes)
+
+#include "tst_animatednodes.moc"
@@ -1,4 +1,11 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    animatednodes \
     creationtime \
-    objectcount
+    imagine \
+    interaction \
+    memoryusage \
+    objectcount \
+    popups \
+    propagation \
+    startup
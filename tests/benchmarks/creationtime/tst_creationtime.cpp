@@ -37,6 +37,20 @@
 #include <QtQml>
 #include <QtTest>
 
+// The phases of creating a control that can be benchmarked separately.
+// Create measures the whole QQmlComponent::create() and keeps the plain
+// row names, so that its results remain comparable across releases.
+enum Phase {
+    Create,
+    Compile,
+    BeginCreate,
+    CompleteCreate
+};
+
+Q_DECLARE_METATYPE(Phase)
+
+static const char *phaseSuffixes[] = { "", ":compile", ":begin", ":complete" };
+
 class tst_CreationTime : public QObject
 {
     Q_OBJECT
@@ -92,23 +106,78 @@ static void addTestRows(QQmlEngine *engine, const QString &sourcePath, const QSt
             for (const QString &importPath : importPathList) {
                 QString name = entry.dir().dirName() + "/" + entry.fileName();
                 QString filePath = importPath + "/" + targetPath + "/" + entry.fileName();
+                QUrl url;
                 if (QFile::exists(filePath)) {
-                    QTest::newRow(qPrintable(name)) << QUrl::fromLocalFile(filePath);
-                    break;
+                    url = QUrl::fromLocalFile(filePath);
                 } else {
                     filePath = QQmlFile::urlToLocalFileOrQrc(filePath);
-                    if (!filePath.isEmpty() && QFile::exists(filePath)) {
-                        QTest::newRow(qPrintable(name)) << QUrl(filePath);
-                        break;
-                    }
+                    if (!filePath.isEmpty() && QFile::exists(filePath))
+                        url = QUrl(filePath);
+                }
+                if (!url.isEmpty()) {
+                    for (int phase = Create; phase <= CompleteCreate; ++phase)
+                        QTest::newRow(qPrintable(name + phaseSuffixes[phase])) << url << Phase(phase);
+                    break;
                 }
             }
         }
     }
 }
 
-static void doBenchmark(QQmlEngine *engine, const QUrl &url)
+static void doCompileBenchmark(QQmlEngine *engine, const QUrl &url)
+{
+    QBENCHMARK {
+        engine->clearComponentCache();
+        QQmlComponent component(engine);
+        component.loadUrl(url);
+        QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    }
+}
+
+// beginCreate() and completeCreate() cannot be separated within a QBENCHMARK
+// loop, so the phases are timed by hand and reported as a benchmark result.
+static void doPhaseBenchmark(QQmlEngine *engine, const QUrl &url, Phase phase)
+{
+    QQmlComponent component(engine);
+    component.loadUrl(url);
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    const int iterations = 100;
+    QObjectList objects;
+    objects.reserve(iterations);
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    for (int i = 0; i < iterations; ++i) {
+        timer.start();
+        QObject *object = component.beginCreate(engine->rootContext());
+        if (phase == BeginCreate)
+            elapsed += timer.nsecsElapsed();
+        QVERIFY2(object, qPrintable(component.errorString()));
+
+        timer.start();
+        component.completeCreate();
+        if (phase == CompleteCreate)
+            elapsed += timer.nsecsElapsed();
+        objects += object;
+    }
+    qDeleteAll(objects);
+
+    QTest::setBenchmarkResult(qreal(elapsed) / iterations, QTest::WalltimeNanoseconds);
+}
+
+static void doBenchmark(QQmlEngine *engine, const QUrl &url, Phase phase)
 {
+    if (phase == Compile) {
+        doCompileBenchmark(engine, url);
+        return;
+    }
+
+    if (phase != Create) {
+        doPhaseBenchmark(engine, url, phase);
+        return;
+    }
+
     QQmlComponent component(engine);
     component.loadUrl(url);
 
@@ -125,72 +194,84 @@ static void doBenchmark(QQmlEngine *engine, const QUrl &url)
 void tst_CreationTime::controls()
 {
     QFETCH(QUrl, url);
-    doBenchmark(&engine, url);
+    QFETCH(Phase, phase);
+    doBenchmark(&engine, url, phase);
 }
 
 void tst_CreationTime::controls_data()
 {
     QTest::addColumn<QUrl>("url");
+    QTest::addColumn<Phase>("phase");
     addTestRows(&engine, "controls", "QtQuick/Controls.2", QStringList() << "ApplicationWindow");
 }
 
 void tst_CreationTime::fusion()
 {
     QFETCH(QUrl, url);
-    doBenchmark(&engine, url);
+    QFETCH(Phase, phase);
+    doBenchmark(&engine, url, phase);
 }
 
 void tst_CreationTime::fusion_data()
 {
     QTest::addColumn<QUrl>("url");
+    QTest::addColumn<Phase>("phase");
     addTestRows(&engine, "controls/fusion", "QtQuick/Controls.2/Fusion", QStringList() << "ApplicationWindow" << "ButtonPanel" << "CheckIndicator" << "RadioIndicator" << "SliderGroove" << "SliderHandle" << "SwitchIndicator");
 }
 
 void tst_CreationTime::imagine()
 {
     QFETCH(QUrl, url);
-    doBenchmark(&engine, url);
+    QFETCH(Phase, phase);
+    doBenchmark(&engine, url, phase);
 }
 
 void tst_CreationTime::imagine_data()
 {
     QTest::addColumn<QUrl>("url");
+    QTest::addColumn<Phase>("phase");
     addTestRows(&engine, "controls/imagine", "QtQuick/Controls.2/Imagine", QStringList() << "ApplicationWindow");
 }
 
 void tst_CreationTime::material()
 {
     QFETCH(QUrl, url);
-    doBenchmark(&engine, url);
+    QFETCH(Phase, phase);
+    doBenchmark(&engine, url, phase);
 }
 
 void tst_CreationTime::material_data()
 {
     QTest::addColumn<QUrl>("url");
+    QTest::addColumn<Phase>("phase");
     addTestRows(&engine, "controls/material", "QtQuick/Controls.2/Material", QStringList() << "ApplicationWindow" << "Ripple" << "SliderHandle" << "CheckIndicator" << "RadioIndicator" << "SwitchIndicator" << "BoxShadow" << "ElevationEffect" << "CursorDelegate");
 }
 
 void tst_CreationTime::universal()
 {
     QFETCH(QUrl, url);
-    doBenchmark(&engine, url);
+    QFETCH(Phase, phase);
+    doBenchmark(&engine, url, phase);
 }
 
 void tst_CreationTime::universal_data()
 {
     QTest::addColumn<QUrl>("url");
+    QTest::addColumn<Phase>("phase");
     addTestRows(&engine, "controls/universal", "QtQuick/Controls.2/Universal", QStringList() << "ApplicationWindow" << "CheckIndicator" << "RadioIndicator" << "SwitchIndicator");
 }
 
 void tst_CreationTime::calendar()
 {
     QFETCH(QUrl, url);
-    doBenchmark(&engine, url);
+    QFETCH(Phase, phase);
+    doBenchmark(&engine, url, phase);
 }
 
 void tst_CreationTime::calendar_data()
 {
     QTest::addColumn<QUrl>("url");
+    QTest::addColumn<Phase>("phase");
     addTestRows(&engine, "calendar", "Qt/labs/calendar");
 }
 
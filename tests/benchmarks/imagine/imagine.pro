@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_imagine
+
+QT += quick testlib
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_imagine.cpp
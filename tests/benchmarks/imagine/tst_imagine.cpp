@@ -0,0 +1,138 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+
+static const char *const stateNames[] = {
+    "disabled", "pressed", "checked", "checkable", "focused", "highlighted"
+};
+
+class tst_Imagine : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void stateChanges();
+    void stateChanges_data();
+};
+
+void tst_Imagine::stateChanges_data()
+{
+    QTest::addColumn<QByteArray>("image");
+    QTest::addColumn<QByteArray>("selector");
+    QTest::addColumn<QByteArray>("name");
+    QTest::addColumn<int>("stateCount");
+    QTest::addColumn<bool>("cache");
+
+    struct Row {
+        const char *image;
+        const char *selector;
+        const char *name;
+    };
+    const Row rows[] = {
+        { "Image", "ImageSelector", "button-background" },
+        { "NinePatchImage", "NinePatchImageSelector", "button-background" },
+        { "AnimatedImage", "AnimatedImageSelector", "busyindicator-animation" }
+    };
+
+    for (const Row &row : rows) {
+        for (int stateCount = 1; stateCount <= 6; ++stateCount) {
+            for (bool cache : { false, true }) {
+                const QByteArray tag = QByteArray(row.selector) + ":" + QByteArray::number(stateCount) + (cache ? ":warm" : ":cold");
+                QTest::newRow(tag) << QByteArray(row.image) << QByteArray(row.selector) << QByteArray(row.name) << stateCount << cache;
+            }
+        }
+    }
+}
+
+// Cycles through all combinations of the active states of an image selector.
+// The cold rows bypass the cache of the selected file paths, so that every
+// state change looks the best matching asset up. The warm rows visit each
+// combination once before measuring, so that every lookup hits the cache.
+void tst_Imagine::stateChanges()
+{
+    QFETCH(QByteArray, image);
+    QFETCH(QByteArray, selector);
+    QFETCH(QByteArray, name);
+    QFETCH(int, stateCount);
+    QFETCH(bool, cache);
+
+    QByteArray properties;
+    QByteArray states;
+    for (int i = 0; i < stateCount; ++i) {
+        properties += "    property bool " + QByteArray(stateNames[i]) + ": false\n";
+        states += "            {\"" + QByteArray(stateNames[i]) + "\": root." + stateNames[i] + "},\n";
+    }
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.10\n"
+                      "import QtQuick.Controls.Imagine 2.4\n"
+                      "import QtQuick.Controls.Imagine.impl 2.4\n"
+                      + image + " {\n"
+                      "    id: root\n"
+                      + properties +
+                      "    source: Imagine.url + \"" + name + "\"\n"
+                      "    " + selector + " on source {\n"
+                      "        cache: " + (cache ? "true" : "false") + "\n"
+                      "        states: [\n"
+                      + states +
+                      "        ]\n"
+                      "    }\n"
+                      "}\n", QUrl());
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object, qPrintable(component.errorString()));
+
+    const int combinations = 1 << stateCount;
+    auto cycle = [&]() {
+        for (int combination = 0; combination < combinations; ++combination) {
+            for (int i = 0; i < stateCount; ++i)
+                object->setProperty(stateNames[i], bool(combination & (1 << i)));
+        }
+    };
+
+    if (cache)
+        cycle();
+
+    QBENCHMARK {
+        cycle();
+    }
+}
+
+QTEST_MAIN(tst_Imagine)
+
+#include "tst_imagine.moc"
@@ -0,0 +1,13 @@
+import QtQuick 2.11
+import QtQuick.Controls 2.4
+
+Item {
+    width: 400
+    height: 400
+
+    Drawer {
+        objectName: "control"
+        width: 200
+        height: 400
+    }
+}
@@ -0,0 +1,18 @@
+import QtQuick 2.11
+import QtQuick.Controls 2.4
+
+Item {
+    width: 400
+    height: 400
+
+    ListView {
+        objectName: "control"
+        anchors.fill: parent
+        model: 1000
+        delegate: ItemDelegate {
+            width: ListView.view.width
+            text: modelData
+        }
+        ScrollBar.vertical: ScrollBar { }
+    }
+}
@@ -0,0 +1,16 @@
+import QtQuick 2.11
+import QtQuick.Controls 2.4
+
+Item {
+    width: 400
+    height: 400
+
+    Menu {
+        objectName: "control"
+        MenuItem { text: "Cut" }
+        MenuItem { text: "Copy" }
+        MenuItem { text: "Paste" }
+        MenuSeparator { }
+        MenuItem { text: "Select All" }
+    }
+}
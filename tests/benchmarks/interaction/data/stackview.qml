@@ -0,0 +1,27 @@
+import QtQuick 2.11
+import QtQuick.Controls 2.4
+
+Item {
+    width: 400
+    height: 400
+
+    function push() { stackView.push(page) }
+    function pop() { stackView.pop() }
+
+    StackView {
+        id: stackView
+        objectName: "control"
+        anchors.fill: parent
+        initialItem: page
+    }
+
+    Component {
+        id: page
+        Page {
+            Label {
+                text: "Page " + StackView.index
+                anchors.centerIn: parent
+            }
+        }
+    }
+}
@@ -0,0 +1,11 @@
+TEMPLATE = app
+TARGET = tst_interaction
+
+QT += quick quickcontrols2 testlib
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_interaction.cpp
+
+TESTDATA = data/*
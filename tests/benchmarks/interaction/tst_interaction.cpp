@@ -0,0 +1,402 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+#include <QtQuickControls2/qquickstyle.h>
+
+// Collects per-frame timings of a window while an interaction is driven
+// through it. The scene graph signals are connected directly, so that the
+// render thread timings are taken on the render thread itself.
+class FrameStatistics : public QObject
+{
+public:
+    explicit FrameStatistics(QQuickWindow *window);
+
+    void start();
+    void stop();
+
+    qreal averagePolishTime() const { return average(m_polishTimes); }
+    qreal averageSyncTime() const { return average(m_syncTimes); }
+    qreal averageRenderTime() const { return average(m_renderTimes); }
+    int droppedFrames() const;
+
+private:
+    static qreal average(const QVector<qint64> &times);
+
+    QQuickWindow *m_window;
+    bool m_recording = false;
+    qint64 m_frameInterval;
+    QElapsedTimer m_clock;
+    qint64 m_polishStart = 0;
+    qint64 m_syncStart = 0;
+    qint64 m_renderStart = 0;
+    mutable QMutex m_mutex;
+    QVector<qint64> m_polishTimes;
+    QVector<qint64> m_syncTimes;
+    QVector<qint64> m_renderTimes;
+    QVector<qint64> m_swapTimes;
+};
+
+FrameStatistics::FrameStatistics(QQuickWindow *window)
+    : m_window(window)
+{
+    const qreal refreshRate = window->screen() ? window->screen()->refreshRate() : 60;
+    m_frameInterval = qint64(1000000000 / (refreshRate > 0 ? refreshRate : 60));
+    m_clock.start();
+
+    // polishing happens on the GUI thread after the animations have been
+    // advanced, right before the GUI thread blocks for the synchronization
+    connect(window, &QQuickWindow::afterAnimating, this, [this]() {
+        QMutexLocker locker(&m_mutex);
+        m_polishStart = m_clock.nsecsElapsed();
+    });
+    connect(window, &QQuickWindow::beforeSynchronizing, this, [this]() {
+        QMutexLocker locker(&m_mutex);
+        m_syncStart = m_clock.nsecsElapsed();
+        if (m_recording && m_polishStart > 0)
+            m_polishTimes += m_syncStart - m_polishStart;
+    }, Qt::DirectConnection);
+    connect(window, &QQuickWindow::afterSynchronizing, this, [this]() {
+        QMutexLocker locker(&m_mutex);
+        if (m_recording)
+            m_syncTimes += m_clock.nsecsElapsed() - m_syncStart;
+    }, Qt::DirectConnection);
+    connect(window, &QQuickWindow::beforeRendering, this, [this]() {
+        m_renderStart = m_clock.nsecsElapsed();
+    }, Qt::DirectConnection);
+    connect(window, &QQuickWindow::afterRendering, this, [this]() {
+        QMutexLocker locker(&m_mutex);
+        if (m_recording)
+            m_renderTimes += m_clock.nsecsElapsed() - m_renderStart;
+    }, Qt::DirectConnection);
+    connect(window, &QQuickWindow::frameSwapped, this, [this]() {
+        QMutexLocker locker(&m_mutex);
+        if (m_recording)
+            m_swapTimes += m_clock.nsecsElapsed();
+    }, Qt::DirectConnection);
+}
+
+void FrameStatistics::start()
+{
+    QMutexLocker locker(&m_mutex);
+    m_polishTimes.clear();
+    m_syncTimes.clear();
+    m_renderTimes.clear();
+    m_swapTimes.clear();
+    m_polishStart = 0;
+    m_recording = true;
+}
+
+void FrameStatistics::stop()
+{
+    QMutexLocker locker(&m_mutex);
+    m_recording = false;
+}
+
+// A frame counts as dropped for every display interval that passed
+// between two swaps beyond the first one.
+int FrameStatistics::droppedFrames() const
+{
+    QMutexLocker locker(&m_mutex);
+    int dropped = 0;
+    for (int i = 1; i < m_swapTimes.count(); ++i) {
+        const qint64 interval = m_swapTimes.at(i) - m_swapTimes.at(i - 1);
+        dropped += qMax<qint64>(0, (interval + m_frameInterval / 2) / m_frameInterval - 1);
+    }
+    return dropped;
+}
+
+qreal FrameStatistics::average(const QVector<qint64> &times)
+{
+    if (times.isEmpty())
+        return 0;
+
+    qint64 total = 0;
+    for (qint64 time : times)
+        total += time;
+    return qreal(total) / times.count();
+}
+
+enum Metric {
+    EventTime,
+    PolishTime,
+    SyncTime,
+    RenderTime,
+    DroppedFrames
+};
+
+class tst_Interaction : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void events();
+    void events_data();
+
+    void polish();
+    void polish_data();
+
+    void sync();
+    void sync_data();
+
+    void render();
+    void render_data();
+
+    void framedrops();
+    void framedrops_data();
+
+private:
+    void addTestRows();
+    void doBenchmark(Metric metric);
+};
+
+void tst_Interaction::initTestCase()
+{
+    // the style is chosen with QT_QUICK_CONTROLS_STYLE, so that each style
+    // is benchmarked in a separate run of the same rows
+    qInfo() << "Style:" << QQuickStyle::name();
+}
+
+void tst_Interaction::addTestRows()
+{
+    QTest::addColumn<QString>("scenario");
+    QTest::newRow("button") << QString("button");
+    QTest::newRow("slider") << QString("slider");
+    QTest::newRow("tumbler") << QString("tumbler");
+    QTest::newRow("listview") << QString("listview");
+    QTest::newRow("combobox") << QString("combobox");
+    QTest::newRow("menu") << QString("menu");
+    QTest::newRow("drawer") << QString("drawer");
+    QTest::newRow("stackview") << QString("stackview");
+}
+
+// Wraps the QTest event calls, so that the time spent on delivering the
+// input events on the GUI thread can be measured separately from the frames.
+class EventTimer
+{
+public:
+    template <typename Function>
+    void operator()(Function function)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        function();
+        m_total += timer.nsecsElapsed();
+        ++m_count;
+    }
+
+    qreal average() const { return m_count ? qreal(m_total) / m_count : 0; }
+
+private:
+    qint64 m_total = 0;
+    int m_count = 0;
+};
+
+static bool waitForSignal(QObject *object, const char *signal)
+{
+    QSignalSpy spy(object, signal);
+    return spy.wait();
+}
+
+static void drag(EventTimer &deliver, QWindow *window, const QPoint &from, const QPoint &to, int steps)
+{
+    deliver([&]() { QTest::mousePress(window, Qt::LeftButton, Qt::NoModifier, from); });
+    for (int i = 1; i <= steps; ++i) {
+        const QPoint pos = from + (to - from) * i / steps;
+        deliver([&]() { QTest::mouseMove(window, pos, 16); });
+    }
+    deliver([&]() { QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, to, 16); });
+}
+
+static bool runScenario(const QString &scenario, QQuickView *view, QObject *control, EventTimer &deliver)
+{
+    QQuickItem *item = qobject_cast<QQuickItem *>(control);
+    const QPoint center = item ? item->mapToScene(QPointF(item->width() / 2, item->height() / 2)).toPoint() : QPoint();
+
+    if (scenario == QLatin1String("button")) {
+        for (int i = 0; i < 10; ++i) {
+            deliver([&]() { QTest::mousePress(view, Qt::LeftButton, Qt::NoModifier, center); });
+            QTest::qWait(50);
+            deliver([&]() { QTest::mouseRelease(view, Qt::LeftButton, Qt::NoModifier, center); });
+            QTest::qWait(50);
+        }
+    } else if (scenario == QLatin1String("slider")) {
+        const QPoint left = item->mapToScene(QPointF(0, item->height() / 2)).toPoint();
+        const QPoint right = item->mapToScene(QPointF(item->width() - 1, item->height() / 2)).toPoint();
+        drag(deliver, view, left, right, 30);
+        drag(deliver, view, right, left, 30);
+    } else if (scenario == QLatin1String("tumbler")) {
+        const QPoint top = item->mapToScene(QPointF(item->width() / 2, 1)).toPoint();
+        const QPoint bottom = item->mapToScene(QPointF(item->width() / 2, item->height() - 1)).toPoint();
+        for (int i = 0; i < 5; ++i)
+            drag(deliver, view, bottom, top, 10);
+        QTest::qWait(500);
+    } else if (scenario == QLatin1String("listview")) {
+        const QPoint top(center.x(), 10);
+        const QPoint bottom(center.x(), view->height() - 10);
+        for (int i = 0; i < 5; ++i)
+            drag(deliver, view, bottom, top, 10);
+        if (!QTest::qWaitFor([&]() { return !control->property("moving").toBool(); }, 10000))
+            return false;
+    } else if (scenario == QLatin1String("combobox")) {
+        QObject *popup = control->property("popup").value<QObject *>();
+        for (int i = 0; i < 3; ++i) {
+            deliver([&]() { QTest::mouseClick(view, Qt::LeftButton, Qt::NoModifier, center); });
+            if (!popup->property("opened").toBool() && !waitForSignal(popup, SIGNAL(opened())))
+                return false;
+            deliver([&]() { QTest::keyClick(view, Qt::Key_Escape); });
+            if (popup->property("visible").toBool() && !waitForSignal(popup, SIGNAL(closed())))
+                return false;
+        }
+    } else if (scenario == QLatin1String("menu") || scenario == QLatin1String("drawer")) {
+        for (int i = 0; i < 3; ++i) {
+            QMetaObject::invokeMethod(control, "open");
+            if (!control->property("opened").toBool() && !waitForSignal(control, SIGNAL(opened())))
+                return false;
+            deliver([&]() { QTest::keyClick(view, Qt::Key_Escape); });
+            if (control->property("visible").toBool() && !waitForSignal(control, SIGNAL(closed())))
+                return false;
+        }
+    } else if (scenario == QLatin1String("stackview")) {
+        for (int i = 0; i < 3; ++i) {
+            QMetaObject::invokeMethod(view->rootObject(), "push");
+            if (!QTest::qWaitFor([&]() { return !control->property("busy").toBool(); }))
+                return false;
+            QMetaObject::invokeMethod(view->rootObject(), "pop");
+            if (!QTest::qWaitFor([&]() { return !control->property("busy").toBool(); }))
+                return false;
+        }
+    }
+    return true;
+}
+
+void tst_Interaction::doBenchmark(Metric metric)
+{
+    QFETCH(QString, scenario);
+
+    QQuickView view;
+    FrameStatistics statistics(&view);
+    view.setSource(QUrl::fromLocalFile(QFINDTESTDATA("data/" + scenario + ".qml")));
+    QVERIFY2(view.status() == QQuickView::Ready, qPrintable(view.errors().value(0).toString()));
+
+    QObject *control = view.rootObject()->findChild<QObject *>("control");
+    QVERIFY(control);
+
+    // popups are closed with the escape key, which needs an active window
+    view.show();
+    view.requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(&view));
+
+    EventTimer deliver;
+    statistics.start();
+    QVERIFY(runScenario(scenario, &view, control, deliver));
+    statistics.stop();
+
+    switch (metric) {
+    case EventTime:
+        QTest::setBenchmarkResult(deliver.average(), QTest::WalltimeNanoseconds);
+        break;
+    case PolishTime:
+        QTest::setBenchmarkResult(statistics.averagePolishTime(), QTest::WalltimeNanoseconds);
+        break;
+    case SyncTime:
+        QTest::setBenchmarkResult(statistics.averageSyncTime(), QTest::WalltimeNanoseconds);
+        break;
+    case RenderTime:
+        QTest::setBenchmarkResult(statistics.averageRenderTime(), QTest::WalltimeNanoseconds);
+        break;
+    case DroppedFrames:
+        QTest::setBenchmarkResult(statistics.droppedFrames(), QTest::Events);
+        break;
+    }
+}
+
+void tst_Interaction::events()
+{
+    doBenchmark(EventTime);
+}
+
+void tst_Interaction::events_data()
+{
+    addTestRows();
+}
+
+void tst_Interaction::polish()
+{
+    doBenchmark(PolishTime);
+}
+
+void tst_Interaction::polish_data()
+{
+    addTestRows();
+}
+
+void tst_Interaction::sync()
+{
+    doBenchmark(SyncTime);
+}
+
+void tst_Interaction::sync_data()
+{
+    addTestRows();
+}
+
+void tst_Interaction::render()
+{
+    doBenchmark(RenderTime);
+}
+
+void tst_Interaction::render_data()
+{
+    addTestRows();
+}
+
+void tst_Interaction::framedrops()
+{
+    doBenchmark(DroppedFrames);
+}
+
+void tst_Interaction::framedrops_data()
+{
+    addTestRows();
+}
+
+QTEST_MAIN(tst_Interaction)
+
+#include "tst_interaction.moc"
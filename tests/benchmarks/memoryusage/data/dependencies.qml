@@ -0,0 +1,9 @@
+import QtQuick 2.6
+import QtQuick.Controls 2.1
+import QtQuick.Controls.Fusion 2.3
+import QtQuick.Controls.Imagine 2.3
+import QtQuick.Controls.Material 2.1
+import QtQuick.Controls.Universal 2.1
+import Qt.labs.calendar 1.0
+
+Control { }
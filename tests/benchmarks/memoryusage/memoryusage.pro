@@ -0,0 +1,11 @@
+TEMPLATE = app
+TARGET = tst_memoryusage
+
+QT += quick testlib core-private quick-private
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+DEFINES += QQC2_IMPORT_PATH=\\\"$$QQC2_SOURCE_TREE/src/imports\\\"
+
+SOURCES += \
+    tst_memoryusage.cpp
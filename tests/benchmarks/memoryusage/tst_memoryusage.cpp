@@ -0,0 +1,269 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+#include <QtCore/private/qhooks_p.h>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QtQuick/qsgtexture.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// Returns the number of bytes currently allocated on the heap. This covers
+// both operator new and the malloc() calls made by Qt's containers.
+static qint64 heapBytes()
+{
+#if defined(__GLIBC__)
+    const struct mallinfo info = mallinfo();
+    return qint64(info.uordblks) + qint64(info.hblkhd);
+#else
+    return -1;
+#endif
+}
+
+// Textures are QObjects, so the live ones are tracked with the same hooks as
+// in the objectcount benchmark. They are created on the render thread.
+Q_GLOBAL_STATIC(QMutex, qt_qobjectsMutex)
+Q_GLOBAL_STATIC(QSet<QObject *>, qt_qobjects)
+
+extern "C" Q_DECL_EXPORT void qt_addQObject(QObject *object)
+{
+    QMutexLocker locker(qt_qobjectsMutex());
+    qt_qobjects->insert(object);
+}
+
+extern "C" Q_DECL_EXPORT void qt_removeQObject(QObject *object)
+{
+    QMutexLocker locker(qt_qobjectsMutex());
+    qt_qobjects->remove(object);
+}
+
+static int countTextures()
+{
+    QMutexLocker locker(qt_qobjectsMutex());
+    int count = 0;
+    for (QObject *object : qAsConst(*qt_qobjects())) {
+        if (qobject_cast<QSGTexture *>(object))
+            ++count;
+    }
+    return count;
+}
+
+static int countNodes(QSGNode *node)
+{
+    if (!node)
+        return 0;
+
+    int count = 1;
+    for (QSGNode *child = node->firstChild(); child; child = child->nextSibling())
+        count += countNodes(child);
+    return count;
+}
+
+class tst_MemoryUsage : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void heapbytes();
+    void heapbytes_data();
+
+    void sgnodes();
+    void sgnodes_data();
+
+    void textures();
+    void textures_data();
+
+private:
+    QQmlEngine engine;
+};
+
+void tst_MemoryUsage::init()
+{
+    qtHookData[QHooks::AddQObject] = reinterpret_cast<quintptr>(&qt_addQObject);
+    qtHookData[QHooks::RemoveQObject] = reinterpret_cast<quintptr>(&qt_removeQObject);
+
+    // warmup
+    QQmlComponent component(&engine);
+    component.setData("import QtQuick 2.0; import QtQuick.Controls 2.1; Item { Button {} }", QUrl());
+    delete component.create();
+}
+
+void tst_MemoryUsage::cleanup()
+{
+    qtHookData[QHooks::AddQObject] = 0;
+    qtHookData[QHooks::RemoveQObject] = 0;
+}
+
+static void addTestRows(QQmlEngine *engine, const QString &sourcePath, const QString &targetPath, const QStringList &skiplist = QStringList())
+{
+    // See tst_objectcount.cpp for why the source tree is only used for
+    // finding out the set of QML files that a style implements.
+    const QFileInfoList entries = QDir(QQC2_IMPORT_PATH "/" + sourcePath).entryInfoList(QStringList("*.qml"), QDir::Files);
+    for (const QFileInfo &entry : entries) {
+        QString name = entry.baseName();
+        if (!skiplist.contains(name)) {
+            const auto importPathList = engine->importPathList();
+            for (const QString &importPath : importPathList) {
+                QString name = entry.dir().dirName() + "/" + entry.fileName();
+                QString filePath = importPath + "/" + targetPath + "/" + entry.fileName();
+                if (QFile::exists(filePath)) {
+                    QTest::newRow(qPrintable(name)) << QUrl::fromLocalFile(filePath);
+                    break;
+                } else {
+                    filePath = QQmlFile::urlToLocalFileOrQrc(filePath);
+                    if (!filePath.isEmpty() && QFile::exists(filePath)) {
+                        QTest::newRow(qPrintable(name)) << QUrl(filePath);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void initTestRows(QQmlEngine *engine)
+{
+    addTestRows(engine, "controls", "QtQuick/Controls.2");
+    addTestRows(engine, "controls/fusion", "QtQuick/Controls.2/Fusion", QStringList() << "ButtonPanel" << "CheckIndicator" << "RadioIndicator" << "SliderGroove" << "SliderHandle" << "SwitchIndicator");
+    addTestRows(engine, "controls/imagine", "QtQuick/Controls.2/Imagine");
+    addTestRows(engine, "controls/material", "QtQuick/Controls.2/Material", QStringList() << "Ripple" << "SliderHandle" << "CheckIndicator" << "RadioIndicator" << "SwitchIndicator" << "BoxShadow" << "ElevationEffect" << "CursorDelegate");
+    addTestRows(engine, "controls/universal", "QtQuick/Controls.2/Universal", QStringList() << "CheckIndicator" << "RadioIndicator" << "SwitchIndicator");
+}
+
+void tst_MemoryUsage::heapbytes()
+{
+    QFETCH(QUrl, url);
+
+    if (heapBytes() < 0)
+        QSKIP("Heap statistics are not available on this platform");
+
+    QQmlComponent component(&engine);
+    component.loadUrl(url);
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    // only the bytes that remain allocated after the creation are counted,
+    // so that temporaries do not inflate the result
+    const qint64 before = heapBytes();
+    QScopedPointer<QObject> object(component.create());
+    const qint64 after = heapBytes();
+    QVERIFY2(object.data(), qPrintable(component.errorString()));
+
+    QTest::setBenchmarkResult(after - before, QTest::BytesAllocated);
+}
+
+void tst_MemoryUsage::heapbytes_data()
+{
+    QTest::addColumn<QUrl>("url");
+    initTestRows(&engine);
+}
+
+enum Measurement {
+    Nodes,
+    Textures
+};
+
+// Shows the control in a window and measures its scene graph after the
+// first frame. The nodes are counted on the render thread while the GUI
+// thread is blocked for the synchronization, and textures are counted once
+// the frame has been swapped.
+static void doSceneGraphBenchmark(QQmlEngine *engine, const QUrl &url, Measurement measurement)
+{
+    QQmlComponent component(engine);
+    component.loadUrl(url);
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(object.data(), qPrintable(component.errorString()));
+
+    QQuickItem *item = qobject_cast<QQuickItem *>(object.data());
+    if (!item)
+        QSKIP("The control is not an item");
+
+    QQuickWindow window;
+    window.resize(400, 400);
+    item->setParentItem(window.contentItem());
+
+    const int texturesBefore = countTextures();
+    QAtomicInt nodes;
+    QObject::connect(&window, &QQuickWindow::afterSynchronizing, &window, [&]() {
+        nodes.store(countNodes(QQuickItemPrivate::get(item)->itemNodeInstance));
+    }, Qt::DirectConnection);
+
+    QSignalSpy frameSpy(&window, &QQuickWindow::frameSwapped);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    if (frameSpy.isEmpty())
+        QVERIFY(frameSpy.wait());
+
+    if (measurement == Nodes)
+        QTest::setBenchmarkResult(nodes.load(), QTest::Events);
+    else
+        QTest::setBenchmarkResult(countTextures() - texturesBefore, QTest::Events);
+
+    item->setParentItem(nullptr);
+}
+
+void tst_MemoryUsage::sgnodes()
+{
+    QFETCH(QUrl, url);
+    doSceneGraphBenchmark(&engine, url, Nodes);
+}
+
+void tst_MemoryUsage::sgnodes_data()
+{
+    QTest::addColumn<QUrl>("url");
+    initTestRows(&engine);
+}
+
+void tst_MemoryUsage::textures()
+{
+    QFETCH(QUrl, url);
+    doSceneGraphBenchmark(&engine, url, Textures);
+}
+
+void tst_MemoryUsage::textures_data()
+{
+    QTest::addColumn<QUrl>("url");
+    initTestRows(&engine);
+}
+
+QTEST_MAIN(tst_MemoryUsage)
+
+#include "tst_memoryusage.moc"
@@ -0,0 +1,62 @@
+import QtQuick 2.10
+import QtQuick.Controls 2.4
+
+ApplicationWindow {
+    width: 640
+    height: 480
+
+    property int count: 0
+    property int activations: 0
+    property alias ancestor: ancestor
+
+    Shortcut {
+        sequence: "Ctrl+A"
+        onActivated: ++activations
+    }
+
+    Item {
+        id: ancestor
+        width: 100
+        height: 100
+
+        Repeater {
+            model: count
+
+            Item {
+                width: 20
+                height: 20
+
+                Popup {
+                    visible: true
+                    width: 20
+                    height: 20
+                    closePolicy: Popup.NoAutoClose
+                    Shortcut { sequence: "Ctrl+B" }
+                }
+
+                Menu {
+                    visible: true
+                    closePolicy: Popup.NoAutoClose
+                    MenuItem { text: "MenuItem" }
+                }
+
+                ToolTip {
+                    visible: true
+                    timeout: -1
+                    text: "ToolTip"
+                    closePolicy: Popup.NoAutoClose
+                }
+
+                Drawer {
+                    visible: true
+                    width: 20
+                    height: 480
+                    modal: false
+                    dim: false
+                    closePolicy: Popup.NoAutoClose
+                    Shortcut { sequence: "Ctrl+B" }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,11 @@
+TEMPLATE = app
+TARGET = tst_popups
+
+QT += quick testlib
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_popups.cpp
+
+TESTDATA = data/*
@@ -0,0 +1,183 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+
+// Opens count popups, menus, tooltips and drawers at once. The popups stay
+// in the top-left corner, so that the events in the middle of the window go
+// through the overlay without being accepted by any of them.
+class tst_Popups : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void pressMoveRelease();
+    void pressMoveRelease_data();
+
+    void shortcut();
+    void shortcut_data();
+
+    void reposition();
+    void reposition_data();
+
+    void repositionCount();
+    void repositionCount_data();
+
+private:
+    void addRows();
+
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window;
+};
+
+void tst_Popups::init()
+{
+    QFETCH(int, count);
+
+    QQmlComponent component(&engine);
+    component.loadUrl(QUrl::fromLocalFile(QFINDTESTDATA("data/popups.qml")));
+    QObject *object = component.beginCreate(engine.rootContext());
+    QVERIFY2(object, qPrintable(component.errorString()));
+    object->setProperty("count", count);
+    component.completeCreate();
+
+    window.reset(qobject_cast<QQuickWindow *>(object));
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    window->requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(window.data()));
+}
+
+void tst_Popups::cleanup()
+{
+    window.reset();
+}
+
+void tst_Popups::addRows()
+{
+    QTest::addColumn<int>("count");
+
+    const int counts[] = { 1, 10, 50 };
+    for (int count : counts)
+        QTest::newRow(qPrintable(QString::number(count))) << count;
+}
+
+void tst_Popups::pressMoveRelease()
+{
+    const QPoint pos(window->width() / 2, window->height() / 2);
+    QBENCHMARK {
+        QTest::mousePress(window.data(), Qt::LeftButton, Qt::NoModifier, pos);
+        QTest::mouseMove(window.data(), pos + QPoint(10, 10));
+        QTest::mouseRelease(window.data(), Qt::LeftButton, Qt::NoModifier, pos + QPoint(10, 10));
+    }
+}
+
+void tst_Popups::pressMoveRelease_data()
+{
+    addRows();
+}
+
+// Matching the shortcut of the window checks whether it is blocked by any of
+// the open popups, which have shortcuts of their own for another sequence.
+void tst_Popups::shortcut()
+{
+    QBENCHMARK {
+        QTest::keyClick(window.data(), Qt::Key_A, Qt::ControlModifier);
+    }
+    QVERIFY(window->property("activations").toInt() > 0);
+}
+
+void tst_Popups::shortcut_data()
+{
+    addRows();
+}
+
+void tst_Popups::reposition()
+{
+    QQuickItem *ancestor = window->property("ancestor").value<QQuickItem *>();
+    QVERIFY(ancestor);
+
+    QBENCHMARK {
+        ancestor->setX(ancestor->x() + 1);
+        QCoreApplication::processEvents();
+    }
+}
+
+void tst_Popups::reposition_data()
+{
+    addRows();
+}
+
+// Counts how many times the popups are moved while their ancestor is
+// animated over a number of frames.
+void tst_Popups::repositionCount()
+{
+    QQuickItem *ancestor = window->property("ancestor").value<QQuickItem *>();
+    QVERIFY(ancestor);
+    QQuickItem *overlay = window->property("overlay").value<QQuickItem *>();
+    QVERIFY(overlay);
+
+    int repositions = 0;
+    const auto popupItems = overlay->childItems();
+    for (QQuickItem *popupItem : popupItems) {
+        connect(popupItem, &QQuickItem::xChanged, window.data(), [&repositions]() { ++repositions; });
+        connect(popupItem, &QQuickItem::yChanged, window.data(), [&repositions]() { ++repositions; });
+    }
+
+    static const int Frames = 10;
+    QSignalSpy frameSpy(window.data(), &QQuickWindow::frameSwapped);
+    for (int i = 0; i < Frames; ++i) {
+        ancestor->setPosition(ancestor->position() + QPointF(1, 1));
+        window->update();
+        QVERIFY(frameSpy.wait());
+    }
+
+    QTest::setBenchmarkResult(repositions, QTest::Events);
+}
+
+void tst_Popups::repositionCount_data()
+{
+    addRows();
+}
+
+QTEST_MAIN(tst_Popups)
+
+#include "tst_popups.moc"
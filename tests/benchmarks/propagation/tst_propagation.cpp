@@ -0,0 +1,260 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+
+// The nodes bind to the style attached properties, so that the Material and
+// Universal attached objects exist and the theme changes have bindings to
+// re-evaluate, like in a real application.
+static const char *const nodeTypes[] = {
+    "Control { property color material: Material.foreground; property color universal: Universal.foreground }",
+    "Label { text: \"Label\" }",
+    "TextField { text: \"TextField\" }",
+    "Item { }"
+};
+
+static const char imports[] =
+    "import QtQuick 2.10\n"
+    "import QtQuick.Controls 2.4\n"
+    "import QtQuick.Controls.Material 2.4\n"
+    "import QtQuick.Controls.Universal 2.4\n";
+
+class tst_Propagation : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void font();
+    void font_data();
+
+    void palette();
+    void palette_data();
+
+    void locale();
+    void locale_data();
+
+    void materialTheme();
+    void materialTheme_data();
+
+    void universalTheme();
+    void universalTheme_data();
+
+    void hoverEnabled();
+    void hoverEnabled_data();
+
+private:
+    void buildTree(int count, int depth);
+    void addRows();
+
+    QQmlEngine engine;
+    QScopedPointer<QQuickWindow> window;
+    QQuickItem *root = nullptr;
+};
+
+void tst_Propagation::init()
+{
+    QFETCH(int, count);
+    QFETCH(int, depth);
+    buildTree(count, depth);
+    QVERIFY(window);
+    QVERIFY(root);
+}
+
+void tst_Propagation::cleanup()
+{
+    window.reset();
+    root = nullptr;
+}
+
+static QObject *createObject(QQmlComponent *component, QObject *parent = nullptr)
+{
+    QObject *object = component->create();
+    if (!object) {
+        qWarning() << component->errorString();
+        return nullptr;
+    }
+    object->setParent(parent);
+    return object;
+}
+
+// Builds an ApplicationWindow with a root Control that has count / depth
+// chains of depth nodes. The node types alternate between Control, Label,
+// TextField and Item, so that every chain contains all of them.
+void tst_Propagation::buildTree(int count, int depth)
+{
+    QQmlComponent windowComponent(&engine);
+    windowComponent.setData(QByteArray(imports) + "ApplicationWindow { }", QUrl());
+    window.reset(qobject_cast<QQuickWindow *>(createObject(&windowComponent)));
+    if (!window)
+        return;
+
+    QVector<QQmlComponent *> components;
+    for (const char *type : nodeTypes) {
+        QQmlComponent *component = new QQmlComponent(&engine);
+        component->setData(QByteArray(imports) + type, QUrl());
+        components += component;
+    }
+
+    root = qobject_cast<QQuickItem *>(createObject(components.first(), window.data()));
+    if (root)
+        root->setParentItem(window->contentItem());
+
+    int type = 0;
+    for (int chain = 0; root && chain < qMax(1, count / depth); ++chain) {
+        QQuickItem *parent = root;
+        for (int level = 0; level < depth; ++level) {
+            QQmlComponent *component = components.at(type++ % components.count());
+            QQuickItem *item = qobject_cast<QQuickItem *>(createObject(component, parent));
+            if (!item) {
+                root = nullptr;
+                break;
+            }
+            item->setParentItem(parent);
+            parent = item;
+        }
+    }
+
+    qDeleteAll(components);
+}
+
+void tst_Propagation::addRows()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<int>("depth");
+
+    const int counts[] = { 1000, 10000, 100000 };
+    const int depths[] = { 4, 64 };
+    for (int count : counts) {
+        for (int depth : depths)
+            QTest::newRow(qPrintable(QString::fromLatin1("%1k:depth%2").arg(count / 1000).arg(depth))) << count << depth;
+    }
+}
+
+void tst_Propagation::font()
+{
+    int pixelSize = 12;
+    QBENCHMARK {
+        QFont font;
+        font.setPixelSize(++pixelSize);
+        window->setProperty("font", font);
+    }
+}
+
+void tst_Propagation::font_data()
+{
+    addRows();
+}
+
+void tst_Propagation::palette()
+{
+    bool dark = false;
+    QBENCHMARK {
+        QPalette palette;
+        palette.setColor(QPalette::Button, (dark = !dark) ? Qt::black : Qt::white);
+        window->setProperty("palette", palette);
+    }
+}
+
+void tst_Propagation::palette_data()
+{
+    addRows();
+}
+
+void tst_Propagation::locale()
+{
+    bool finnish = false;
+    QBENCHMARK {
+        const QLocale locale((finnish = !finnish) ? QLocale::Finnish : QLocale::English);
+        window->setProperty("locale", locale);
+    }
+}
+
+void tst_Propagation::locale_data()
+{
+    addRows();
+}
+
+static void doThemeBenchmark(QQuickItem *root, const QString &property)
+{
+    QQmlProperty theme(root, property, qmlContext(root));
+    QVERIFY(theme.isValid());
+
+    int dark = 0;
+    QBENCHMARK {
+        theme.write(dark = 1 - dark); // Light = 0, Dark = 1
+    }
+}
+
+void tst_Propagation::materialTheme()
+{
+    doThemeBenchmark(root, QStringLiteral("Material.theme"));
+}
+
+void tst_Propagation::materialTheme_data()
+{
+    addRows();
+}
+
+void tst_Propagation::universalTheme()
+{
+    doThemeBenchmark(root, QStringLiteral("Universal.theme"));
+}
+
+void tst_Propagation::universalTheme_data()
+{
+    addRows();
+}
+
+void tst_Propagation::hoverEnabled()
+{
+    bool enabled = false;
+    QBENCHMARK {
+        root->setProperty("hoverEnabled", enabled = !enabled);
+    }
+}
+
+void tst_Propagation::hoverEnabled_data()
+{
+    addRows();
+}
+
+QTEST_MAIN(tst_Propagation)
+
+#include "tst_propagation.moc"
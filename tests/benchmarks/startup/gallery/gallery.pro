@@ -0,0 +1,14 @@
+TEMPLATE = app
+TARGET = startup_gallery
+DESTDIR = ./
+
+QT += quick quickcontrols2
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    main.cpp
+
+# the gallery example is embedded as is, so that the benchmark loads
+# exactly the same files as the example does
+RESOURCES += \
+    gallery.qrc
@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qtimer.h>
+#include <QtGui/qguiapplication.h>
+#include <QtGui/qicon.h>
+#include <QtQml/qqmlapplicationengine.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuickControls2/qquickstyle.h>
+
+#include <stdio.h>
+
+#if defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+// Starts the gallery example like examples/quickcontrols2/gallery/gallery.cpp
+// does, and reports the startup measurements to stdout for tst_startup. The
+// style is selected with QT_QUICK_CONTROLS_STYLE, and the application name
+// with STARTUP_GALLERY_NAME, so that each run can use its own disk cache.
+
+static qint64 peakResidentSetSize()
+{
+#if defined(Q_OS_UNIX)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+#if defined(Q_OS_DARWIN)
+    return usage.ru_maxrss;
+#else
+    return qint64(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return -1;
+#endif
+}
+
+static void report(const char *name, qreal value)
+{
+    fprintf(stdout, "%s %f\n", name, value);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QGuiApplication::setApplicationName(qEnvironmentVariable("STARTUP_GALLERY_NAME", QStringLiteral("Gallery")));
+    QGuiApplication::setOrganizationName("QtProject");
+    QGuiApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
+
+    QGuiApplication app(argc, argv);
+
+    QIcon::setThemeName("gallery");
+
+    QQmlApplicationEngine engine;
+    engine.rootContext()->setContextProperty("availableStyles", QQuickStyle::availableStyles());
+
+    // covers style resolution, plugin loading, compilation and control creation;
+    // the startup trace printed to stderr breaks down the first two
+    const qint64 loadStart = timer.nsecsElapsed();
+    engine.load(QUrl("qrc:/gallery.qml"));
+    report("load", (timer.nsecsElapsed() - loadStart) / 1e6);
+
+    if (engine.rootObjects().isEmpty())
+        return -1;
+
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(engine.rootObjects().first());
+    if (!window)
+        return -1;
+
+    bool firstFrame = true;
+    // frameSwapped() is emitted on the render thread
+    QObject::connect(window, &QQuickWindow::frameSwapped, &app, [&]() {
+        if (!firstFrame)
+            return;
+
+        firstFrame = false;
+        report("first-frame", timer.nsecsElapsed() / 1e6);
+
+        // interactive once the events queued during startup have been processed
+        QTimer::singleShot(0, &app, [&]() {
+            report("interactive", timer.nsecsElapsed() / 1e6);
+            report("peak-rss", peakResidentSetSize());
+            app.quit();
+        });
+    }, Qt::QueuedConnection);
+
+    return app.exec();
+}
@@ -0,0 +1,6 @@
+TEMPLATE = subdirs
+SUBDIRS = \
+    gallery \
+    test
+
+test.depends = gallery
@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = ../tst_startup
+
+QT += testlib
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+
+SOURCES += \
+    ../tst_startup.cpp
@@ -0,0 +1,239 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+
+// Launches the gallery example (see gallery/main.cpp) once per style, first
+// with an empty and then with a populated QML disk cache, and reports the
+// time to the first frame, the time until the application is interactive,
+// and the peak resident set size. The startup trace of the style and plugin
+// loading (QT_QUICK_CONTROLS_TRACE_STARTUP) is printed along with each run.
+
+struct StartupResult
+{
+    bool valid = false;
+    qreal load = 0;
+    qreal firstFrame = 0;
+    qreal interactive = 0;
+    qint64 peakResidentSetSize = -1;
+};
+
+class tst_Startup : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void firstFrame();
+    void firstFrame_data();
+
+    void interactive();
+    void interactive_data();
+
+    void peakMemory();
+    void peakMemory_data();
+
+private:
+    void addTestRows();
+    StartupResult result(const QString &style, bool warm);
+    StartupResult run(const QString &style);
+    QString applicationName(const QString &style) const;
+
+    QString m_gallery;
+    QHash<QString, StartupResult> m_results;
+    QStringList m_cacheDirs;
+    QStringList m_settingsFiles;
+};
+
+void tst_Startup::initTestCase()
+{
+    m_gallery = QCoreApplication::applicationDirPath() + QStringLiteral("/gallery/startup_gallery");
+#ifdef Q_OS_WIN
+    m_gallery += QStringLiteral(".exe");
+#endif
+    if (!QFileInfo::exists(m_gallery))
+        QSKIP("The gallery helper has not been built");
+}
+
+void tst_Startup::cleanupTestCase()
+{
+    for (const QString &dir : qAsConst(m_cacheDirs))
+        QDir(dir).removeRecursively();
+    for (const QString &file : qAsConst(m_settingsFiles))
+        QFile::remove(file);
+}
+
+void tst_Startup::addTestRows()
+{
+    QTest::addColumn<QString>("style");
+    QTest::addColumn<bool>("warm");
+
+    const QStringList styles = QStringList() << "Default" << "Fusion" << "Imagine" << "Material" << "Universal";
+    for (const QString &style : styles) {
+        QTest::newRow(qPrintable(style + ":cold")) << style << false;
+        QTest::newRow(qPrintable(style + ":warm")) << style << true;
+    }
+}
+
+QString tst_Startup::applicationName(const QString &style) const
+{
+    // unique per style and test run, so that a cold run starts without a disk cache
+    return QString::fromLatin1("tst_startup_%1_%2").arg(style).arg(QCoreApplication::applicationPid());
+}
+
+StartupResult tst_Startup::result(const QString &style, bool warm)
+{
+    const QString coldKey = style + QStringLiteral(":cold");
+    if (!m_results.contains(coldKey)) {
+        // the disk cache location of the helper depends on its application name
+        const QString name = applicationName(style);
+        const QString organization = QCoreApplication::organizationName();
+        const QString application = QCoreApplication::applicationName();
+        QCoreApplication::setOrganizationName("QtProject");
+        QCoreApplication::setApplicationName(name);
+        const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+        QCoreApplication::setOrganizationName(organization);
+        QCoreApplication::setApplicationName(application);
+
+        QDir(cacheDir).removeRecursively();
+        m_cacheDirs += cacheDir;
+        m_settingsFiles += QSettings("QtProject", name).fileName();
+
+        m_results.insert(coldKey, run(style));
+    }
+
+    if (!warm)
+        return m_results.value(coldKey);
+
+    const QString warmKey = style + QStringLiteral(":warm");
+    if (!m_results.contains(warmKey))
+        m_results.insert(warmKey, run(style));
+    return m_results.value(warmKey);
+}
+
+StartupResult tst_Startup::run(const QString &style)
+{
+    StartupResult result;
+
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert("STARTUP_GALLERY_NAME", applicationName(style));
+    environment.insert("QT_QUICK_CONTROLS_STYLE", style);
+    environment.insert("QT_QUICK_CONTROLS_TRACE_STARTUP", "1");
+
+    QProcess process;
+    process.setProcessEnvironment(environment);
+    process.start(m_gallery);
+    if (!process.waitForFinished(60000) || process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0) {
+        process.kill();
+        qWarning().noquote() << "The gallery failed to start:" << process.readAllStandardError();
+        return result;
+    }
+
+    const QList<QByteArray> lines = process.readAllStandardOutput().split('\n');
+    for (const QByteArray &line : lines) {
+        const QList<QByteArray> fields = line.trimmed().split(' ');
+        if (fields.count() != 2)
+            continue;
+        if (fields.first() == "load")
+            result.load = fields.last().toDouble();
+        else if (fields.first() == "first-frame")
+            result.firstFrame = fields.last().toDouble();
+        else if (fields.first() == "interactive")
+            result.interactive = fields.last().toDouble();
+        else if (fields.first() == "peak-rss")
+            result.peakResidentSetSize = fields.last().toDouble();
+    }
+    result.valid = result.firstFrame > 0;
+
+    // the breakdown of style resolution and plugin loading; the rest of the
+    // load time is spent in compiling and creating the controls
+    qDebug().noquote() << QTest::currentDataTag() << "load:" << result.load << "ms";
+    qDebug().noquote() << process.readAllStandardError().trimmed();
+    return result;
+}
+
+void tst_Startup::firstFrame_data()
+{
+    addTestRows();
+}
+
+void tst_Startup::firstFrame()
+{
+    QFETCH(QString, style);
+    QFETCH(bool, warm);
+
+    const StartupResult startup = result(style, warm);
+    QVERIFY(startup.valid);
+    QTest::setBenchmarkResult(startup.firstFrame, QTest::WalltimeMilliseconds);
+}
+
+void tst_Startup::interactive_data()
+{
+    addTestRows();
+}
+
+void tst_Startup::interactive()
+{
+    QFETCH(QString, style);
+    QFETCH(bool, warm);
+
+    const StartupResult startup = result(style, warm);
+    QVERIFY(startup.valid);
+    QTest::setBenchmarkResult(startup.interactive, QTest::WalltimeMilliseconds);
+}
+
+void tst_Startup::peakMemory_data()
+{
+    addTestRows();
+}
+
+void tst_Startup::peakMemory()
+{
+    QFETCH(QString, style);
+    QFETCH(bool, warm);
+
+    const StartupResult startup = result(style, warm);
+    QVERIFY(startup.valid);
+    if (startup.peakResidentSetSize < 0)
+        QSKIP("The peak resident set size is not available on this platform");
+    QTest::setBenchmarkResult(startup.peakResidentSetSize, QTest::BytesAllocated);
+}
+
+QTEST_MAIN(tst_Startup)
+
+#include "tst_startup.moc"
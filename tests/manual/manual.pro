@@ -5,6 +5,7 @@ SUBDIRS += \
     fonts \
     screenshots \
     styles \
+    stylecost \
     testbench
 
 qtConfig(systemtrayicon): SUBDIRS += systemtrayicon
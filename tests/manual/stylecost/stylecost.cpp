@@ -0,0 +1,312 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:BSD$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** BSD License Usage
+** Alternatively, you may use this file under the terms of the BSD license
+** as follows:
+**
+** "Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are
+** met:
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in
+**     the documentation and/or other materials provided with the
+**     distribution.
+**   * Neither the name of The Qt Company Ltd nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/qcommandlineparser.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qprocess.h>
+#include <QtCore/qregularexpression.h>
+#include <QtCore/qset.h>
+#include <QtCore/private/qhooks_p.h>
+#include <QtGui/qguiapplication.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQml/qqmlengine.h>
+#include <QtQuick/qquickitem.h>
+#include <QtQuick/qquickview.h>
+#include <QtQuick/qsgtexture.h>
+#include <QtQuickControls2/qquickstyle.h>
+
+#include <stdio.h>
+
+// Live QObjects are tracked with the same hooks as in the objectcount
+// benchmark, so that the textures can be found after the last frame.
+Q_GLOBAL_STATIC(QMutex, qt_qobjectsMutex)
+Q_GLOBAL_STATIC(QSet<QObject *>, qt_qobjects)
+
+extern "C" Q_DECL_EXPORT void qt_addQObject(QObject *object)
+{
+    QMutexLocker locker(qt_qobjectsMutex());
+    qt_qobjects->insert(object);
+}
+
+extern "C" Q_DECL_EXPORT void qt_removeQObject(QObject *object)
+{
+    QMutexLocker locker(qt_qobjectsMutex());
+    qt_qobjects->remove(object);
+}
+
+// The batch renderer does not expose its batches, but it prints them for
+// every frame when QSG_RENDERER_DEBUG contains "render". The message handler
+// picks those lines up on the render thread and hides them from the output.
+static QtMessageHandler previousMessageHandler = nullptr;
+static QBasicMutex batchMutex;
+static qint64 totalOpaqueBatches = 0;
+static qint64 totalAlphaBatches = 0;
+static qint64 renderedBatchFrames = 0;
+
+static void batchMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    static const QRegularExpression opaque(QStringLiteral("Opaque: \\d+ nodes in (\\d+) batches"));
+    static const QRegularExpression alpha(QStringLiteral("Alpha: \\d+ nodes in (\\d+) batches"));
+
+    const QRegularExpressionMatch opaqueMatch = opaque.match(message);
+    const QRegularExpressionMatch alphaMatch = alpha.match(message);
+    if (opaqueMatch.hasMatch() || alphaMatch.hasMatch()) {
+        QMutexLocker locker(&batchMutex);
+        totalOpaqueBatches += opaqueMatch.captured(1).toInt();
+        totalAlphaBatches += alphaMatch.captured(1).toInt();
+        ++renderedBatchFrames;
+        return;
+    }
+
+    if (type == QtDebugMsg && message.startsWith(QLatin1String("Renderer::")))
+        return;
+
+    previousMessageHandler(type, context, message);
+}
+
+// Times the synchronization and rendering of each frame. The signals are
+// emitted on the render thread, so the totals are only read once the window
+// has stopped rendering.
+class FrameCost : public QObject
+{
+public:
+    FrameCost(QQuickWindow *window, int warmupFrames, int frames)
+        : m_window(window), m_warmupFrames(warmupFrames), m_frames(frames)
+    {
+        connect(window, &QQuickWindow::beforeSynchronizing, this, [this]() { m_timer.start(); }, Qt::DirectConnection);
+        connect(window, &QQuickWindow::afterSynchronizing, this, [this]() { if (measuring()) m_syncTime += m_timer.nsecsElapsed(); }, Qt::DirectConnection);
+        connect(window, &QQuickWindow::beforeRendering, this, [this]() { m_timer.start(); }, Qt::DirectConnection);
+        connect(window, &QQuickWindow::afterRendering, this, [this]() { if (measuring()) m_renderTime += m_timer.nsecsElapsed(); }, Qt::DirectConnection);
+        connect(window, &QQuickWindow::frameSwapped, this, &FrameCost::nextFrame);
+    }
+
+    bool measuring() const { return m_frame.load() >= m_warmupFrames; }
+    int measuredFrames() const { return m_frame.load() - m_warmupFrames; }
+    qint64 syncTime() const { return m_syncTime; }
+    qint64 renderTime() const { return m_renderTime; }
+
+    void nextFrame()
+    {
+        if (m_frame.fetchAndAddOrdered(1) + 1 < m_warmupFrames + m_frames)
+            m_window->update();
+        else
+            QCoreApplication::quit();
+    }
+
+private:
+    QQuickWindow *m_window;
+    int m_warmupFrames;
+    int m_frames;
+    QAtomicInt m_frame;
+    QElapsedTimer m_timer;
+    qint64 m_syncTime = 0;
+    qint64 m_renderTime = 0;
+};
+
+// Returns the total area covered by items with content, relative to the
+// window. Values above 1 mean that pixels are painted more than once.
+static qreal coverage(QQuickItem *item, const QRectF &windowRect)
+{
+    if (!item->isVisible() || qFuzzyIsNull(item->opacity()))
+        return 0;
+
+    qreal area = 0;
+    if (item->flags() & QQuickItem::ItemHasContents) {
+        const QRectF rect = item->mapRectToScene(item->boundingRect()) & windowRect;
+        area += rect.width() * rect.height();
+    }
+
+    const auto childItems = item->childItems();
+    for (QQuickItem *child : childItems)
+        area += coverage(child, windowRect);
+    return area;
+}
+
+static void textureUsage(int *count, qint64 *bytes)
+{
+    QMutexLocker locker(qt_qobjectsMutex());
+    *count = 0;
+    *bytes = 0;
+    for (QObject *object : qAsConst(*qt_qobjects())) {
+        if (QSGTexture *texture = qobject_cast<QSGTexture *>(object)) {
+            const QSize size = texture->textureSize();
+            ++*count;
+            *bytes += qint64(size.width()) * size.height() * 4;
+        }
+    }
+}
+
+static QStringList controlUrls()
+{
+    QStringList urls;
+    const QDir dir(QStringLiteral(TESTBENCH_DIR "/controls"));
+    const QStringList entries = dir.entryList(QStringList() << QStringLiteral("*.qml"), QDir::Files, QDir::Name);
+    for (const QString &entry : entries)
+        urls += QUrl::fromLocalFile(dir.filePath(entry)).toString();
+    return urls;
+}
+
+static void printHeader()
+{
+    printf("%-12s %8s %8s %9s %9s %9s %9s %10s\n", "style", "sync ms", "render ms",
+           "opaque", "alpha", "textures", "KiB", "coverage");
+}
+
+// Renders the page with the given style and prints one row of results.
+static int measureStyle(const QString &style, const QSize &size, int warmupFrames, int frames)
+{
+    QQuickStyle::setStyle(style);
+
+    qtHookData[QHooks::AddQObject] = reinterpret_cast<quintptr>(&qt_addQObject);
+    qtHookData[QHooks::RemoveQObject] = reinterpret_cast<quintptr>(&qt_removeQObject);
+
+    QQuickView view;
+    view.setResizeMode(QQuickView::SizeRootObjectToView);
+    view.resize(size);
+    view.rootContext()->setContextProperty(QStringLiteral("controlUrls"), controlUrls());
+    view.setSource(QUrl(QStringLiteral("qrc:/stylecost.qml")));
+    if (view.status() != QQuickView::Ready)
+        return 1;
+
+    FrameCost cost(&view, warmupFrames, frames);
+    view.show();
+    QCoreApplication::exec();
+
+    qreal coveredArea = 0;
+    if (QQuickItem *rootObject = view.rootObject())
+        coveredArea = coverage(rootObject, QRectF(QPointF(), view.size()));
+
+    int textures = 0;
+    qint64 textureBytes = 0;
+    textureUsage(&textures, &textureBytes);
+
+    const int measured = qMax(1, cost.measuredFrames());
+    qint64 opaqueBatches = 0;
+    qint64 alphaBatches = 0;
+    {
+        QMutexLocker locker(&batchMutex);
+        const qint64 batchFrames = qMax<qint64>(1, renderedBatchFrames);
+        opaqueBatches = totalOpaqueBatches / batchFrames;
+        alphaBatches = totalAlphaBatches / batchFrames;
+    }
+
+    printf("%-12s %8.3f %8.3f %9lld %9lld %9d %9lld %10.2f\n", qPrintable(style),
+           cost.syncTime() / 1e6 / measured, cost.renderTime() / 1e6 / measured,
+           opaqueBatches, alphaBatches, textures, textureBytes / 1024,
+           coveredArea / (view.width() * view.height()));
+    fflush(stdout);
+
+    qtHookData[QHooks::AddQObject] = 0;
+    qtHookData[QHooks::RemoveQObject] = 0;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    // A style can only be set once per process, so each style is measured
+    // in a child process that is started with --style.
+    if (!qEnvironmentVariableIsSet("QSG_RENDERER_DEBUG"))
+        qputenv("QSG_RENDERER_DEBUG", "render");
+
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Renders every control of the testbench in every state and "
+                                                    "reports the cost of a frame for each style."));
+    parser.addHelpOption();
+    QCommandLineOption styleOption(QStringLiteral("style"), QStringLiteral("Measures only <style>."), QStringLiteral("style"));
+    QCommandLineOption framesOption(QStringLiteral("frames"), QStringLiteral("Measures <frames> frames (default: 100)."), QStringLiteral("frames"), QStringLiteral("100"));
+    QCommandLineOption warmupOption(QStringLiteral("warmup"), QStringLiteral("Skips the first <frames> frames (default: 10)."), QStringLiteral("frames"), QStringLiteral("10"));
+    QCommandLineOption sizeOption(QStringLiteral("size"), QStringLiteral("Uses a <width>x<height> window (default: 1920x1080)."), QStringLiteral("size"), QStringLiteral("1920x1080"));
+    QCommandLineOption childOption(QStringLiteral("child"));
+    childOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    parser.addOptions(QList<QCommandLineOption>() << styleOption << framesOption << warmupOption << sizeOption << childOption);
+    parser.process(app);
+
+    const QStringList size = parser.value(sizeOption).split(QLatin1Char('x'));
+    const QSize windowSize(size.value(0).toInt(), size.value(1).toInt());
+    if (windowSize.isEmpty()) {
+        fprintf(stderr, "Invalid size: %s\n", qPrintable(parser.value(sizeOption)));
+        return 1;
+    }
+
+    if (parser.isSet(childOption)) {
+        previousMessageHandler = qInstallMessageHandler(batchMessageHandler);
+        return measureStyle(parser.value(styleOption), windowSize,
+                            parser.value(warmupOption).toInt(), parser.value(framesOption).toInt());
+    }
+
+    QStringList styles = parser.values(styleOption);
+    if (styles.isEmpty())
+        styles = QQuickStyle::availableStyles();
+
+    printHeader();
+    fflush(stdout);
+
+    int result = 0;
+    for (const QString &style : qAsConst(styles)) {
+        QStringList arguments;
+        arguments << QStringLiteral("--child") << QStringLiteral("--style") << style
+                  << QStringLiteral("--frames") << parser.value(framesOption)
+                  << QStringLiteral("--warmup") << parser.value(warmupOption)
+                  << QStringLiteral("--size") << parser.value(sizeOption);
+
+        QProcess process;
+        process.setProcessChannelMode(QProcess::ForwardedChannels);
+        process.start(QCoreApplication::applicationFilePath(), arguments);
+        if (!process.waitForFinished(-1) || process.exitCode() != 0) {
+            fprintf(stderr, "Failed to measure %s\n", qPrintable(style));
+            result = 1;
+        }
+    }
+    return result;
+}
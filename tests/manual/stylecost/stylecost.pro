@@ -0,0 +1,11 @@
+TEMPLATE = app
+TARGET = stylecost
+QT += core-private qml quick quickcontrols2
+
+DEFINES += TESTBENCH_DIR=\\\"$$PWD/../testbench\\\"
+
+SOURCES += \
+    stylecost.cpp
+
+RESOURCES += \
+    stylecost.qml